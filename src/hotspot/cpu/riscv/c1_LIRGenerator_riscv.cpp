@@ -1144,7 +1144,7 @@ void LIRGenerator::do_If(If* x) {
 
   // Generate branch profiling. Profiling code doesn't kill flags.
   __ cmp(lir_cond(cond), left, right);
-  profile_branch(x, cond);
+  profile_branch(x, cond, left, right);
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), x->tsux(), x->usux());
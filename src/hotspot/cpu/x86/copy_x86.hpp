@@ -55,6 +55,29 @@ static void pd_zero_to_words(HeapWord* tohw, size_t count) {
   pd_fill_to_words(tohw, count, 0);
 }
 
+// Fills of at least this many words bypass the caches; see pd_fill_to_words_nontemporal.
+static const size_t nontemporal_fill_threshold_words = 4 * M / HeapWordSize;
+
+static void pd_fill_to_words_nontemporal(HeapWord* tohw, size_t count, juint value) {
+#if defined(AMD64) && !defined(_WINDOWS)
+  // A fill this large would only flush the last-level cache of data other
+  // threads still need, and nobody reads the fill value back soon. Write
+  // around the caches, then fence so the weakly ordered stores are visible
+  // before anything that publishes the memory.
+  if (count >= nontemporal_fill_threshold_words) {
+    julong* to = (julong*) tohw;
+    julong  v  = ((julong) value << 32) | value;
+    while (count-- > 0) {
+      __asm__ volatile("movnti %1, %0" : "=m" (*to) : "r" (v));
+      to++;
+    }
+    __asm__ volatile("sfence" : : : "memory");
+    return;
+  }
+#endif // AMD64 && !_WINDOWS
+  pd_fill_to_words(tohw, count, value);
+}
+
 static void pd_zero_to_bytes(void* to, size_t count) {
   (void)memset(to, 0, count);
 }
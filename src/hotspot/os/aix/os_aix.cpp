@@ -297,6 +297,8 @@ julong os::physical_memory() {
 
 size_t os::rss() { return (size_t)0; }
 
+size_t os::malloc_usable_size(void* p) { return (size_t)0; }
+
 // Cpu architecture string
 #if defined(PPC32)
 static char cpu_arch[] = "ppc";
@@ -1849,6 +1851,9 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 void os::pd_disclaim_memory(char *addr, size_t bytes) {
 }
 
+void os::pd_disclaim_memory_lazily(char *addr, size_t bytes) {
+}
+
 size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
   return page_size;
 }
@@ -40,4 +40,8 @@ bool platform_columns_initialize() {
 void sample_platform_values(Sample* record) {
 }
 
+const Column* platform_rss_column() {
+  return NULL;
+}
+
 } // namespace sapmachine_vitals
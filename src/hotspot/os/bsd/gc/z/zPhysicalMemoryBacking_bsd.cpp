@@ -180,3 +180,7 @@ void ZPhysicalMemoryBacking::unmap(zaddress_unsafe addr, size_t size) const {
     fatal("Failed to map memory (%s)", err.to_string());
   }
 }
+
+void ZPhysicalMemoryBacking::threads_do(ThreadClosure* tc) const {
+  // Does nothing
+}
@@ -26,6 +26,8 @@
 
 #include "gc/z/zAddress.hpp"
 
+class ThreadClosure;
+
 class ZPhysicalMemoryBacking {
 private:
   uintptr_t _base;
@@ -45,6 +47,8 @@ class ZPhysicalMemoryBacking {
 
   void map(zaddress_unsafe addr, size_t size, zoffset offset) const;
   void unmap(zaddress_unsafe addr, size_t size) const;
+
+  void threads_do(ThreadClosure* tc) const;
 };
 
 #endif // OS_BSD_GC_Z_ZPHYSICALMEMORYBACKING_BSD_HPP
@@ -107,6 +107,7 @@
 #ifdef __APPLE__
   #include <mach/task_info.h>
   #include <mach-o/dyld.h>
+  #include <malloc/malloc.h>
 #endif
 
 #ifndef MAP_ANONYMOUS
@@ -226,6 +227,14 @@ size_t os::rss() {
   return rss;
 }
 
+size_t os::malloc_usable_size(void* p) {
+#ifdef __APPLE__
+  return ::malloc_size(p);
+#else
+  return 0;
+#endif
+}
+
 // Cpu architecture string
 #if   defined(ZERO)
 static char cpu_arch[] = ZERO_LIBARCH;
@@ -1681,6 +1690,10 @@ void os::pd_disclaim_memory(char *addr, size_t bytes) {
   ::madvise(addr, bytes, MADV_DONTNEED);
 }
 
+void os::pd_disclaim_memory_lazily(char *addr, size_t bytes) {
+  ::madvise(addr, bytes, MADV_FREE);
+}
+
 size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
   return page_size;
 }
@@ -788,7 +788,16 @@ jlong CgroupSubsystem::memory_soft_limit_in_bytes() {
 }
 
 jlong CgroupSubsystem::memory_usage_in_bytes() {
-  return memory_controller()->controller()->memory_usage_in_bytes();
+  // os::available_memory() and friends ask for this on every call, which GC
+  // heuristics and samplers do often. Share one read per cache period.
+  CachingCgroupController<CgroupMemoryController>* contrl = memory_controller();
+  CachedMetric* memory_usage = contrl->usage_cache();
+  if (!memory_usage->should_check_metric()) {
+    return memory_usage->value();
+  }
+  jlong mem_usage = contrl->controller()->memory_usage_in_bytes();
+  memory_usage->set_value(mem_usage, OSCONTAINER_CACHE_TIMEOUT);
+  return mem_usage;
 }
 
 jlong CgroupSubsystem::memory_max_usage_in_bytes() {
@@ -191,14 +191,17 @@ class CachingCgroupController : public CHeapObj<mtInternal> {
   private:
     T* _controller;
     CachedMetric* _metrics_cache;
+    CachedMetric* _usage_cache;
 
   public:
     CachingCgroupController(T* cont) {
       _controller = cont;
       _metrics_cache = new CachedMetric();
+      _usage_cache = new CachedMetric();
     }
 
     CachedMetric* metrics_cache() { return _metrics_cache; }
+    CachedMetric* usage_cache() { return _usage_cache; }
     T* controller() { return _controller; }
 };
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zArray.inline.hpp"
+#include "gc/z/zErrno.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zHugePageCollapser_linux.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "logging/log.hpp"
+#include "os_linux.hpp"
+#include "utilities/align.hpp"
+#include "utilities/debug.hpp"
+
+#include <sys/mman.h>
+
+// Support for building on older Linux systems
+#ifndef MADV_COLLAPSE
+#define MADV_COLLAPSE 25
+#endif
+
+bool ZHugePageCollapser::is_supported() {
+  // An empty range is accepted if the kernel knows about the advice
+  return ::madvise(nullptr, 0, MADV_COLLAPSE) == 0;
+}
+
+ZHugePageCollapser::ZHugePageCollapser(int fd)
+  : _fd(fd),
+    _queue_lock(),
+    _queue(),
+    _uncommit_lock(),
+    _window(0),
+    _stop(false) {
+  set_name("ZHugePageCollapser");
+  create_and_start();
+}
+
+bool ZHugePageCollapser::wait_for_work() const {
+  ZLocker<ZConditionLock> locker(&_queue_lock);
+  while (_queue.is_empty() && !_stop) {
+    _queue_lock.wait();
+  }
+
+  return !_stop;
+}
+
+bool ZHugePageCollapser::dequeue(zoffset* offset) {
+  ZLocker<ZConditionLock> locker(&_queue_lock);
+  if (_queue.is_empty()) {
+    return false;
+  }
+
+  *offset = _queue.pop();
+  return true;
+}
+
+void ZHugePageCollapser::enqueue(zoffset offset, size_t length) {
+  assert(is_aligned(untype(offset), ZGranuleSize), "Misaligned");
+  assert(is_aligned(length, ZGranuleSize), "Misaligned");
+
+  ZLocker<ZConditionLock> locker(&_queue_lock);
+  if (_stop) {
+    return;
+  }
+
+  for (size_t i = 0; i < length; i += ZGranuleSize) {
+    _queue.append(offset + i);
+  }
+  _queue_lock.notify();
+}
+
+ZLock* ZHugePageCollapser::uncommit_lock() {
+  return &_uncommit_lock;
+}
+
+void ZHugePageCollapser::cancel(zoffset offset, size_t length) {
+  const zoffset_end end = to_zoffset_end(offset, length);
+
+  ZLocker<ZConditionLock> locker(&_queue_lock);
+  for (int i = 0; i < _queue.length();) {
+    const zoffset granule = _queue.at(i);
+    if (granule >= offset && granule < end) {
+      _queue.delete_at(i);
+    } else {
+      i++;
+    }
+  }
+}
+
+void ZHugePageCollapser::collapse(zoffset offset) const {
+  // Map the granule into the huge page aligned window
+  void* const addr = (void*)_window;
+  if (mmap(addr, ZGranuleSize, PROT_READ|PROT_WRITE, MAP_FIXED|MAP_SHARED, _fd, untype(offset)) == MAP_FAILED) {
+    ZErrno err;
+    log_debug(gc, heap)("Failed to map memory for collapse (%s)", err.to_string());
+    return;
+  }
+
+  if (os::Linux::should_madvise_shmem_thps()) {
+    os::Linux::madvise_transparent_huge_pages(addr, ZGranuleSize);
+  }
+
+  if (::madvise(addr, ZGranuleSize, MADV_COLLAPSE) == -1) {
+    // Not fatal, the memory stays backed by small pages
+    // until khugepaged gets to it
+    ZErrno err;
+    log_debug(gc, heap)("Failed to collapse memory: " SIZE_FORMAT "M (%s)", untype(offset) / M, err.to_string());
+  } else {
+    log_trace(gc, heap)("Collapsed memory: " SIZE_FORMAT "M", untype(offset) / M);
+  }
+
+  // Detach the granule again, keeping the window reserved
+  if (mmap(addr, ZGranuleSize, PROT_NONE, MAP_FIXED|MAP_ANONYMOUS|MAP_PRIVATE|MAP_NORESERVE, -1, 0) == MAP_FAILED) {
+    ZErrno err;
+    fatal("Failed to unmap memory (%s)", err.to_string());
+  }
+}
+
+void ZHugePageCollapser::run_thread() {
+  // Reserve a window, large enough to hold a huge page aligned granule
+  const size_t reserve_size = ZGranuleSize * 2;
+  void* const reserved = mmap(nullptr, reserve_size, PROT_NONE, MAP_ANONYMOUS|MAP_PRIVATE|MAP_NORESERVE, -1, 0);
+  if (reserved == MAP_FAILED) {
+    ZErrno err;
+    log_warning(gc)("Failed to reserve memory for huge page collapse (%s)", err.to_string());
+
+    // Stop accepting work
+    ZLocker<ZConditionLock> locker(&_queue_lock);
+    _stop = true;
+    _queue.clear();
+    return;
+  }
+
+  _window = align_up((uintptr_t)reserved, ZGranuleSize);
+
+  while (wait_for_work()) {
+    // Hold the uncommit lock while collapsing, so that the
+    // granule can't be uncommitted and then refilled by us
+    ZLocker<ZLock> locker(&_uncommit_lock);
+
+    zoffset offset;
+    if (dequeue(&offset)) {
+      collapse(offset);
+    }
+  }
+
+  munmap(reserved, reserve_size);
+}
+
+void ZHugePageCollapser::terminate() {
+  ZLocker<ZConditionLock> locker(&_queue_lock);
+  _stop = true;
+  _queue_lock.notify_all();
+}
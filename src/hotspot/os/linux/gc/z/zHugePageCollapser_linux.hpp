@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef OS_LINUX_GC_Z_ZHUGEPAGECOLLAPSER_LINUX_HPP
+#define OS_LINUX_GC_Z_ZHUGEPAGECOLLAPSER_LINUX_HPP
+
+#include "gc/z/zAddress.hpp"
+#include "gc/z/zArray.hpp"
+#include "gc/z/zLock.hpp"
+#include "gc/z/zThread.hpp"
+
+// Background thread that collapses newly committed granules of the heap
+// backing file into transparent huge pages, using madvise(MADV_COLLAPSE).
+// This avoids waiting for khugepaged, and keeps the synchronous collapse
+// out of the allocation path.
+//
+// A collapse fills holes in the range it's applied to. Granules are
+// therefore only collapsed while holding the uncommit lock, which the
+// backing also holds while removing granules from the queue and
+// uncommitting them.
+class ZHugePageCollapser : public ZThread {
+private:
+  const int              _fd;
+  mutable ZConditionLock _queue_lock;
+  ZArray<zoffset>        _queue;
+  ZLock                  _uncommit_lock;
+  uintptr_t              _window;
+  bool                   _stop;
+
+  bool wait_for_work() const;
+  bool dequeue(zoffset* offset);
+  void collapse(zoffset offset) const;
+
+protected:
+  virtual void run_thread();
+  virtual void terminate();
+
+public:
+  static bool is_supported();
+
+  ZHugePageCollapser(int fd);
+
+  void enqueue(zoffset offset, size_t length);
+
+  ZLock* uncommit_lock();
+  void cancel(zoffset offset, size_t length);
+};
+
+#endif // OS_LINUX_GC_Z_ZHUGEPAGECOLLAPSER_LINUX_HPP
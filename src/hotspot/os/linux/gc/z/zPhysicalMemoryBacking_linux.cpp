@@ -27,8 +27,10 @@
 #include "gc/z/zArray.inline.hpp"
 #include "gc/z/zErrno.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zHugePageCollapser_linux.hpp"
 #include "gc/z/zInitialize.hpp"
 #include "gc/z/zLargePages.inline.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMountPoint_linux.hpp"
 #include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPhysicalMemoryBacking_linux.hpp"
@@ -36,6 +38,7 @@
 #include "hugepages.hpp"
 #include "logging/log.hpp"
 #include "os_linux.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/init.hpp"
 #include "runtime/os.hpp"
 #include "runtime/safefetch.hpp"
@@ -125,7 +128,8 @@ ZPhysicalMemoryBacking::ZPhysicalMemoryBacking(size_t max_capacity)
     _filesystem(0),
     _block_size(0),
     _available(0),
-    _initialized(false) {
+    _initialized(false),
+    _collapser(nullptr) {
 
   // Create backing file
   _fd = create_fd(ZFILENAME_HEAP);
@@ -198,6 +202,35 @@ ZPhysicalMemoryBacking::ZPhysicalMemoryBacking(size_t max_capacity)
 
   // Successfully initialized
   _initialized = true;
+
+  try_enable_huge_page_collapser();
+}
+
+void ZPhysicalMemoryBacking::try_enable_huge_page_collapser() {
+  if (!ZCollapseHugePages) {
+    // Not enabled
+    return;
+  }
+
+  if (!ZLargePages::is_transparent()) {
+    log_info_p(gc, init)("Huge Page Collapsing: Disabled (Requires -XX:+UseTransparentHugePages)");
+    return;
+  }
+
+  if (ZNUMA::is_enabled()) {
+    // Collapsing from a single thread would undo the per-granule
+    // NUMA interleaving done at commit time
+    log_info_p(gc, init)("Huge Page Collapsing: Disabled (Not supported with NUMA)");
+    return;
+  }
+
+  if (!ZHugePageCollapser::is_supported()) {
+    log_info_p(gc, init)("Huge Page Collapsing: Disabled (Not supported by kernel)");
+    return;
+  }
+
+  log_info_p(gc, init)("Huge Page Collapsing: Enabled");
+  _collapser = new ZHugePageCollapser(_fd);
 }
 
 int ZPhysicalMemoryBacking::create_mem_fd(const char* name) const {
@@ -624,6 +657,11 @@ bool ZPhysicalMemoryBacking::commit_inner(zoffset offset, size_t length) const {
     return false;
   }
 
+  if (_collapser != nullptr) {
+    // Collapse into huge pages in the background
+    _collapser->enqueue(offset, length);
+  }
+
   // Success
   return true;
 }
@@ -701,6 +739,17 @@ size_t ZPhysicalMemoryBacking::uncommit(zoffset offset, size_t length) const {
   log_trace(gc, heap)("Uncommitting memory: " SIZE_FORMAT "M-" SIZE_FORMAT "M (" SIZE_FORMAT "M)",
                       untype(offset) / M, untype(to_zoffset_end(offset, length)) / M, length / M);
 
+  if (_collapser != nullptr) {
+    // Make sure the collapser doesn't repopulate the range behind our back
+    ZLocker<ZLock> locker(_collapser->uncommit_lock());
+    _collapser->cancel(offset, length);
+    return uncommit_inner(offset, length);
+  }
+
+  return uncommit_inner(offset, length);
+}
+
+size_t ZPhysicalMemoryBacking::uncommit_inner(zoffset offset, size_t length) const {
   const ZErrno err = fallocate(true /* punch_hole */, offset, length);
   if (err) {
     log_error(gc)("Failed to uncommit memory (%s)", err.to_string());
@@ -728,3 +777,9 @@ void ZPhysicalMemoryBacking::unmap(zaddress_unsafe addr, size_t size) const {
     fatal("Failed to map memory (%s)", err.to_string());
   }
 }
+
+void ZPhysicalMemoryBacking::threads_do(ThreadClosure* tc) const {
+  if (_collapser != nullptr) {
+    tc->do_thread(_collapser);
+  }
+}
@@ -26,7 +26,9 @@
 
 #include "gc/z/zAddress.hpp"
 
+class ThreadClosure;
 class ZErrno;
+class ZHugePageCollapser;
 
 class ZPhysicalMemoryBacking {
 private:
@@ -37,6 +39,8 @@ class ZPhysicalMemoryBacking {
   size_t   _available;
   bool     _initialized;
 
+  ZHugePageCollapser* _collapser;
+
   void warn_available_space(size_t max_capacity) const;
   void warn_max_map_count(size_t max_capacity) const;
 
@@ -48,6 +52,8 @@ class ZPhysicalMemoryBacking {
   bool is_hugetlbfs() const;
   bool tmpfs_supports_transparent_huge_pages() const;
 
+  void try_enable_huge_page_collapser();
+
   ZErrno fallocate_compat_mmap_hugetlbfs(zoffset offset, size_t length, bool touch) const;
   ZErrno fallocate_compat_mmap_tmpfs(zoffset offset, size_t length) const;
   ZErrno fallocate_compat_pwrite(zoffset offset, size_t length) const;
@@ -62,6 +68,8 @@ class ZPhysicalMemoryBacking {
   size_t commit_numa_interleaved(zoffset offset, size_t length) const;
   size_t commit_default(zoffset offset, size_t length) const;
 
+  size_t uncommit_inner(zoffset offset, size_t length) const;
+
 public:
   ZPhysicalMemoryBacking(size_t max_capacity);
 
@@ -74,6 +82,8 @@ class ZPhysicalMemoryBacking {
 
   void map(zaddress_unsafe addr, size_t size, zoffset offset) const;
   void unmap(zaddress_unsafe addr, size_t size) const;
+
+  void threads_do(ThreadClosure* tc) const;
 };
 
 #endif // OS_LINUX_GC_Z_ZPHYSICALMEMORYBACKING_LINUX_HPP
@@ -116,12 +116,24 @@
   develop(bool, DelayThreadStartALot, false,                            \
           "Artificially delay thread starts randomly for testing.")     \
                                                                         \
+  product(bool, THPMetaspaceMitigation, true, DIAGNOSTIC,               \
+          "If THPs are unconditionally enabled on the system (mode "    \
+          "\"always\"), the JVM will prevent THP from forming in "      \
+          "committed metaspace, whose small commit granules otherwise " \
+          "get collapsed into mostly unused huge pages.")               \
+                                                                        \
   product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
-          "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory.")         \
+          "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory instead "  \
+          "of touching each page.")                                     \
                                                                         \
   product(bool, PrintMemoryMapAtExit, false, DIAGNOSTIC,                \
           "Print an annotated memory map at exit")                      \
                                                                         \
+  product(bool, ZCollapseHugePages, false, EXPERIMENTAL,                \
+          "Let ZGC collapse committed heap memory into transparent "    \
+          "huge pages in a background thread using MADV_COLLAPSE. "     \
+          "Requires -XX:+UseTransparentHugePages.")                     \
+                                                                        \
 // end of RUNTIME_OS_FLAGS
 
 //
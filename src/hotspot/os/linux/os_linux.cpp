@@ -368,6 +368,10 @@ size_t os::rss() {
   return size;
 }
 
+size_t os::malloc_usable_size(void* p) {
+  return ::malloc_usable_size(p);
+}
+
 static uint64_t initial_total_ticks = 0;
 static uint64_t initial_steal_ticks = 0;
 static bool     has_initial_tick_info = false;
@@ -3048,6 +3052,11 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_NOHUGEPAGE here so we can build HotSpot on old systems.
+#ifndef MADV_NOHUGEPAGE
+  #define MADV_NOHUGEPAGE 15
+#endif
+
 // Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
 #define MADV_POPULATE_WRITE_value 23
 #ifndef MADV_POPULATE_WRITE
@@ -3099,6 +3108,11 @@ void os::Linux::madvise_transparent_huge_pages(void* addr, size_t bytes) {
   ::madvise(addr, bytes, MADV_HUGEPAGE);
 }
 
+void os::Linux::madvise_no_transparent_huge_pages(void* addr, size_t bytes) {
+  // Best effort, like madvise_transparent_huge_pages().
+  ::madvise(addr, bytes, MADV_NOHUGEPAGE);
+}
+
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   if (Linux::should_madvise_anonymous_thps() && alignment_hint > vm_page_size()) {
     Linux::madvise_transparent_huge_pages(addr, bytes);
@@ -3111,6 +3125,17 @@ void os::pd_disclaim_memory(char *addr, size_t bytes) {
    ::madvise(addr, bytes, MADV_DONTNEED);
 }
 
+// MADV_FREE needs Linux 4.5. Older kernels reject it, but the memory is
+// not needed anyway, so fall back to MADV_DONTNEED.
+void os::pd_disclaim_memory_lazily(char *addr, size_t bytes) {
+#ifdef MADV_FREE
+  if (::madvise(addr, bytes, MADV_FREE) == 0) {
+    return;
+  }
+#endif
+  ::madvise(addr, bytes, MADV_DONTNEED);
+}
+
 size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
   const size_t len = pointer_delta(last, first, sizeof(char)) + page_size;
   // Use madvise to pretouch on Linux when THP is used, and fallback to the
@@ -3133,6 +3158,12 @@ size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
     }
     return 0;
   }
+  // Without THP, populating the range in a single call still saves taking
+  // a page fault for every page. Fall back to touching if that fails.
+  if (UseMadvPopulateWrite &&
+      ::madvise(first, len, MADV_POPULATE_WRITE) == 0) {
+    return 0;
+  }
   return page_size;
 }
 
@@ -3993,6 +4024,16 @@ void os::Linux::large_page_init() {
     FLAG_SET_ERGO(THPStackMitigation, false); // Mitigation not needed
   }
 
+  // The same applies to metaspace: it commits in small granules, and khugepaged would
+  // happily turn a sparsely used metaspace range into fully backed huge pages.
+  if (HugePages::thp_mode() == THPMode::always) {
+    if (THPMetaspaceMitigation) {
+      log_info(pagesize)("JVM will attempt to prevent THPs in metaspace.");
+    }
+  } else {
+    FLAG_SET_ERGO(THPMetaspaceMitigation, false); // Mitigation not needed
+  }
+
   // Handle the case where we do not want to use huge pages
   if (!UseLargePages &&
       !UseTransparentHugePages) {
@@ -4414,6 +4455,10 @@ jlong os::Linux::sendfile(int out_fd, int in_fd, jlong* offset, jlong count) {
   return ::sendfile(out_fd, in_fd, (off_t*)offset, (size_t)count);
 }
 
+bool os::Linux::punch_hole(int fd, jlong offset, jlong len) {
+  return ::fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, (off_t)offset, (off_t)len) == 0;
+}
+
 // Determine if the vmid is the parent pid for a child in a PID namespace.
 // Return the namespace pid if so, otherwise -1.
 int os::Linux::get_namespace_pid(int vmid) {
@@ -5205,21 +5250,20 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   pid_t  tid = thread->osthread()->thread_id();
   char *s;
   char stat[2048];
-  size_t statlen;
+  ssize_t statlen;
   char proc_name[64];
-  int count;
   long sys_time, user_time;
-  char cdummy;
-  int idummy;
-  long ldummy;
-  FILE *fp;
+  int fd;
 
+  // This is called per thread by JFR and M&M samplers, so read the file with
+  // plain read(2) rather than through a freshly allocated stdio buffer.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = os::fopen(proc_name, "r");
-  if (fp == nullptr) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  fd = os::open(proc_name, O_RDONLY, 0);
+  if (fd == -1) return -1;
+  statlen = ::read(fd, stat, sizeof(stat) - 1);
+  ::close(fd);
+  if (statlen <= 0) return -1;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
@@ -5230,14 +5274,19 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   s = strrchr(stat, ')');
   if (s == nullptr) return -1;
 
-  // Skip blank chars
-  do { s++; } while (s && isspace((unsigned char) *s));
-
-  count = sscanf(s,"%c %d %d %d %d %d %lu %lu %lu %lu %lu %lu %lu",
-                 &cdummy, &idummy, &idummy, &idummy, &idummy, &idummy,
-                 &ldummy, &ldummy, &ldummy, &ldummy, &ldummy,
-                 &user_time, &sys_time);
-  if (count != 13) return -1;
+  // Skip the eleven fields from state to cmajflt; utime and stime follow.
+  s++;
+  for (int i = 0; i < 11; i++) {
+    while (isspace((unsigned char) *s)) s++;
+    if (*s == '\0') return -1;
+    while (*s != '\0' && !isspace((unsigned char) *s)) s++;
+  }
+  char* end;
+  user_time = strtol(s, &end, 10);
+  if (end == s) return -1;
+  s = end;
+  sys_time = strtol(s, &end, 10);
+  if (end == s) return -1;
   if (user_sys_cpu_time) {
     return ((jlong)sys_time + (jlong)user_time) * (1000000000 / clock_tics_per_sec);
   } else {
@@ -5585,6 +5634,20 @@ bool os::trim_native_heap(os::size_change_t* rss_change) {
 #endif
 }
 
+size_t os::native_heap_free_bytes() {
+#ifdef __GLIBC__
+  os::Linux::glibc_mallinfo mi;
+  bool might_have_wrapped = false;
+  os::Linux::get_mallinfo(&mi, &might_have_wrapped);
+  if (might_have_wrapped) {
+    return SIZE_MAX;
+  }
+  return mi.fordblks; // includes free fastbin blocks
+#else
+  return SIZE_MAX; // musl
+#endif
+}
+
 bool os::pd_dll_unload(void* libhandle, char* ebuf, int ebuflen) {
 
   if (ebuf && ebuflen > 0) {
@@ -155,6 +155,9 @@ class os::Linux {
   static jlong fast_thread_cpu_time(clockid_t clockid);
 
   static jlong sendfile(int out_fd, int in_fd, jlong* offset, jlong count);
+  // Deallocate the disk blocks backing a range of a file, keeping its size.
+  // Returns false if the file system does not support it.
+  static bool punch_hole(int fd, jlong offset, jlong len);
 
   // Determine if the vmid is the parent pid for a child in a PID namespace.
   // Return the namespace pid if so, otherwise -1.
@@ -187,6 +190,7 @@ class os::Linux {
   static bool should_madvise_shmem_thps();
 
   static void madvise_transparent_huge_pages(void* addr, size_t bytes);
+  static void madvise_no_transparent_huge_pages(void* addr, size_t bytes);
 
   // Stack repair handling
 
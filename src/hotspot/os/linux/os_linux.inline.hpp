@@ -38,9 +38,14 @@ inline bool os::uses_stack_guard_pages() {
   return true;
 }
 
+// Stacks of threads created by pthread_create() are fully mapped by glibc,
+// so their guard zones only need to be protected, and unprotected again on
+// exit. Only the growable stack of the primordial thread must be committed.
+// Leaving the stacks mapped also lets glibc hand cached stacks to new threads
+// without remapping the guard zone every time a thread starts and exits.
 inline bool os::must_commit_stack_guard_pages() {
   assert(uses_stack_guard_pages(), "sanity check");
-  return true;
+  return os::is_primordial_thread();
 }
 
 // Bang the shadow pages if they need to be touched to be mapped.
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "semaphore_linux.hpp"
+#include "utilities/checkedCast.hpp"
+#include "utilities/debug.hpp"
+
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+// 32-bit RISC-V has no SYS_futex syscall.
+#ifdef RISCV32
+  #if !defined(SYS_futex) && defined(SYS_futex_time64)
+    #define SYS_futex SYS_futex_time64
+  #endif
+#endif
+
+static long futex(volatile int *addr, int futex_op, int op_arg) {
+  return syscall(SYS_futex, addr, futex_op, op_arg, nullptr, nullptr, 0);
+}
+
+LinuxSemaphore::LinuxSemaphore(uint value) : _state(checked_cast<int>(value)) {}
+
+void LinuxSemaphore::signal(uint count) {
+  if (count == 0) {
+    return;
+  }
+  // This add is the only access to the semaphore: once the permits are
+  // visible, a waiter may take one, return and free the semaphore. The
+  // waiter count comes from the same atomic, full fence update; a waiter
+  // registered later sees the new permits when the kernel compares the
+  // futex word in FUTEX_WAIT.
+  uint64_t old_state = Atomic::fetch_then_add(&_state, (uint64_t)count);
+  assert(permits(old_state) + count <= (uint)max_jint, "permit overflow");
+  if (waiters(old_state) > 0) {
+    // The memory may already be freed or reused. A wake on a reused address
+    // is at worst a spurious wakeup, which every futex waiter tolerates, and
+    // an unmapped address fails with EFAULT, like in glibc's sem_post.
+    long s = futex(futex_word(), FUTEX_WAKE_PRIVATE, checked_cast<int>(count));
+    guarantee_with_errno(s > -1 || errno == EFAULT, "futex FUTEX_WAKE failed");
+  }
+}
+
+void LinuxSemaphore::wait() {
+  if (trywait()) {
+    return;
+  }
+  Atomic::add(&_state, uint64_t(1) << WaitersShift);
+  while (true) {
+    // Take a permit and deregister as a waiter in one step, so that no
+    // access to the semaphore follows a successful wait.
+    uint64_t state = Atomic::load(&_state);
+    while (permits(state) > 0) {
+      uint64_t new_state = state - 1 - (uint64_t(1) << WaitersShift);
+      uint64_t prev = Atomic::cmpxchg(&_state, state, new_state);
+      if (prev == state) {
+        return;
+      }
+      state = prev;
+    }
+    long s = futex(futex_word(), FUTEX_WAIT_PRIVATE, 0 /* sleep while no permits */);
+    guarantee_with_errno((s == 0) ||
+                         (s == -1 && errno == EAGAIN) ||
+                         (s == -1 && errno == EINTR),
+                         "futex FUTEX_WAIT failed");
+    // Woken, interrupted or permits already available: retry. A woken thread
+    // may lose the permit to a thread that did not sleep, and sleeps again.
+  }
+}
+
+bool LinuxSemaphore::trywait() {
+  uint64_t state = Atomic::load(&_state);
+  while (permits(state) > 0) {
+    uint64_t prev = Atomic::cmpxchg(&_state, state, state - 1);
+    if (prev == state) {
+      return true;
+    }
+    state = prev;
+  }
+  return false;
+}
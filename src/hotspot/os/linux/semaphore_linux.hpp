@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef OS_LINUX_SEMAPHORE_LINUX_HPP
+#define OS_LINUX_SEMAPHORE_LINUX_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Counting semaphore on a futex word. Unlike sem_post, which wakes at most
+// one waiter per call, signal(count) releases count permits with a single
+// FUTEX_WAKE, so dispatching a task to many parked workers costs one syscall.
+//
+// As in glibc's sem_t, the permits and the number of waiters share one 64-bit
+// word. signal() reads the waiter count from the same atomic add that
+// publishes the permits, and never touches the semaphore after it, so a
+// waiter that takes a permit may destroy the semaphore right away.
+class LinuxSemaphore : public CHeapObj<mtInternal> {
+  static const int WaitersShift = 32;
+  static const uint64_t PermitsMask = (uint64_t(1) << WaitersShift) - 1;
+
+  // Available permits in the low 32 bits (the futex word), threads blocked,
+  // or about to block, in wait() in the high 32 bits.
+  ATTRIBUTE_ALIGNED(8) volatile uint64_t _state;
+
+  NONCOPYABLE(LinuxSemaphore);
+
+  static uint permits(uint64_t state) { return (uint)(state & PermitsMask); }
+  static uint waiters(uint64_t state) { return (uint)(state >> WaitersShift); }
+
+  // The 32-bit half of _state that holds the permits.
+  volatile int* futex_word() {
+#ifdef VM_LITTLE_ENDIAN
+    return (volatile int*)&_state;
+#else
+    return (volatile int*)&_state + 1;
+#endif
+  }
+
+ public:
+  LinuxSemaphore(uint value = 0);
+  ~LinuxSemaphore() {}
+
+  void signal(uint count = 1);
+
+  void wait();
+
+  bool trywait();
+};
+
+typedef LinuxSemaphore SemaphoreImpl;
+
+#endif // OS_LINUX_SEMAPHORE_LINUX_HPP
@@ -113,6 +113,7 @@ static Column* g_col_system_cgrp_limit_in_bytes = NULL;
 static Column* g_col_system_cgrp_soft_limit_in_bytes = NULL;
 static Column* g_col_system_cgrp_usage_in_bytes = NULL;
 static Column* g_col_system_cgrp_kmem_usage_in_bytes = NULL;
+static Column* g_col_system_cgrp_psi_mem = NULL;
 
 static Column* g_col_system_cpu_user = NULL;
 static Column* g_col_system_cpu_system = NULL;
@@ -120,6 +121,10 @@ static Column* g_col_system_cpu_idle = NULL;
 static Column* g_col_system_cpu_steal = NULL;
 static Column* g_col_system_cpu_guest = NULL;
 
+static bool g_show_psi_info = false;
+static Column* g_col_system_psi_cpu = NULL;
+static Column* g_col_system_psi_mem = NULL;
+
 static Column* g_col_process_virt = NULL;
 
 static bool g_show_rss_detail_info = false;
@@ -193,6 +198,13 @@ bool platform_columns_initialize() {
   g_col_system_cpu_guest =
         define_column<CPUTimeColumn>(system_cat, "cpu", "gu", "CPU time spent on guest [host]", true);
 
+  // Pressure stall information needs kernel >= 4.20
+  g_show_psi_info = OSWrapper::syst_psi_mem() != INVALID_VALUE;
+  g_col_system_psi_cpu =
+        define_column<DeltaValueColumn>(system_cat, "psi", "cpu", "Time some threads stalled waiting for cpu (us) [host] [delta] [krn]", g_show_psi_info);
+  g_col_system_psi_mem =
+        define_column<DeltaValueColumn>(system_cat, "psi", "mem", "Time some threads stalled waiting for memory (us) [host] [delta] [krn]", g_show_psi_info);
+
   // I show cgroup information if the container layer thinks we are containerized OR we have limits established
   // (which should come out as the same, but you never know
   g_show_cgroup_info = OSContainer::is_containerized() || (OSWrapper::syst_cgro_lim() != INVALID_VALUE || OSWrapper::syst_cgro_limsw() != INVALID_VALUE);
@@ -204,6 +216,9 @@ bool platform_columns_initialize() {
         define_column<MemorySizeColumn>(system_cat, "cgroup", "usg", "cgroup memory usage [cgrp]", g_show_cgroup_info);
   g_col_system_cgrp_kmem_usage_in_bytes =
         define_column<MemorySizeColumn>(system_cat, "cgroup", "kusg", "cgroup kernel memory usage (cgroup v1 only) [cgrp]", g_show_cgroup_info);
+  g_col_system_cgrp_psi_mem =
+        define_column<DeltaValueColumn>(system_cat, "cgroup", "mpsi", "Time some cgroup threads stalled waiting for memory (us, cgroup v2 only) [cgrp] [delta]",
+                                        g_show_cgroup_info && OSWrapper::syst_cgro_psi_mem() != INVALID_VALUE);
 
   // Process
 
@@ -256,6 +271,10 @@ bool platform_columns_initialize() {
   return true;
 }
 
+const Column* platform_rss_column() {
+  return g_col_process_rss;
+}
+
 static void set_value_in_sample(Column* col, Sample* sample, value_t val) {
   if (col != NULL) {
     int index = col->index();
@@ -286,6 +305,11 @@ void sample_platform_values(Sample* sample) {
   set_value_in_sample(g_col_system_cpu_steal, sample, OSWrapper::syst_cpu_st());
   set_value_in_sample(g_col_system_cpu_guest, sample, OSWrapper::syst_cpu_gu());
 
+  if (g_show_psi_info) {
+    set_value_in_sample(g_col_system_psi_cpu, sample, OSWrapper::syst_psi_cpu());
+    set_value_in_sample(g_col_system_psi_mem, sample, OSWrapper::syst_psi_mem());
+  }
+
   set_value_in_sample(g_col_system_num_procs_running, sample, OSWrapper::syst_tr());
   set_value_in_sample(g_col_system_num_procs_blocked, sample, OSWrapper::syst_tb());
 
@@ -296,6 +320,7 @@ void sample_platform_values(Sample* sample) {
     set_value_in_sample(g_col_system_cgrp_kmem_usage_in_bytes, sample, OSWrapper::syst_cgro_kusg());
     set_value_in_sample(g_col_system_cgrp_limit_in_bytes, sample, OSWrapper::syst_cgro_lim());
     set_value_in_sample(g_col_system_cgrp_soft_limit_in_bytes, sample, OSWrapper::syst_cgro_slim());
+    set_value_in_sample(g_col_system_cgrp_psi_mem, sample, OSWrapper::syst_cgro_psi_mem());
     // set_value_in_sample(g_col_system_cgrp_memsw_limit_in_bytes, sample, OSWrapper::syst_cgro_limsw());
   }
 
@@ -43,6 +43,7 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/ostream.hpp"
+#include "vitals/vitals.hpp"
 #include "vitals/vitals_internals.hpp"
 
 #include <unistd.h>
@@ -783,6 +784,8 @@ void pulse_himem_report() {
       }
       // If the alert level increased to a new value, trigger a new report
       trigger_high_memory_report(new_alvl, spikeno, new_percentage, rss_swap);
+      // Capture the further development in high resolution.
+      request_burst_sampling("himem alert");
 #if INCLUDE_NMT
       // Upon first alert, do a NMT baseline
       if (old_alvl == 0 && new_alvl > 0) {
@@ -30,9 +30,11 @@
 #include "osContainer_linux.hpp"
 #include "vitals_linux_oswrapper.hpp"
 #include "logging/log.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "vitals/vitals_internals.hpp"
+#include "vitals/vitalsLocker.hpp"
 
 #include <fcntl.h>
 #include <string.h>
@@ -54,42 +56,77 @@ ALL_VALUES_DO(DEFINE_VARIABLE)
 
 #undef DEFINE_VARIABLE
 
-time_t OSWrapper::_last_update = 0;
-
-static const int num_seconds_until_update = 1;
+jlong OSWrapper::_last_update_ms = 0;
 
 ///////////// procfs stuff //////////////////////////////////////////////////
 
-class ProcFile {
+// A procfs (or cgroupfs) file. Files read on every sample are kept open, and re-read with pread
+// from offset 0, which makes the kernel regenerate their content, into a buffer we reuse. That
+// saves us the open/close syscalls and the stdio buffer allocations per sample.
+class ProcFile : public CHeapObj<mtInternal> {
+  const char* const _filename; // NULL for a scratch buffer used to read other files
+  int _fd;
+  bool _failed;                // If the file cannot be opened, we don't try again
   char* _buf;
 
   // To keep the code simple, I just use a fixed sized buffer.
   enum { bufsize = 64*K };
 
+  bool read_from(int fd) {
+    size_t bytes_read = 0;
+    ssize_t l = 0;
+    do {
+      l = ::pread(fd, _buf + bytes_read, bufsize - 1 - bytes_read, (off_t)bytes_read);
+      if (l > 0) {
+        bytes_read += (size_t)l;
+      }
+    } while (l > 0 && bytes_read < bufsize - 1);
+    _buf[bytes_read] = '\0';
+    return l >= 0 && bytes_read > 0 && bytes_read < bufsize - 1;
+  }
+
 public:
 
-  ProcFile() : _buf(NULL) {
+  ProcFile(const char* filename = NULL) : _filename(filename), _fd(-1), _failed(false), _buf(NULL) {
     _buf = (char*)os::malloc(bufsize, mtInternal);
   }
 
   ~ProcFile () {
+    if (_fd != -1) {
+      ::close(_fd);
+    }
     os::free(_buf);
   }
 
-  bool read(const char* filename) {
+  const char* filename() const { return _filename; }
 
-    FILE* f = ::fopen(filename, "r");
-    if (f == NULL) {
-      log_debug(vitals)("Failed to fopen %s (%d)", filename, errno);
-      return false;
+  // Re-read the file this object was created for.
+  bool read() {
+    assert(_filename != NULL, "scratch buffer");
+    if (_fd == -1) {
+      if (_failed) {
+        return false;
+      }
+      _fd = os::open(_filename, O_RDONLY, 0);
+      if (_fd == -1) {
+        log_debug(vitals)("Failed to open %s (%d)", _filename, errno);
+        _failed = true;
+        return false;
+      }
     }
+    return read_from(_fd);
+  }
 
-    size_t bytes_read = ::fread(_buf, 1, bufsize - 1, f);
-    _buf[bytes_read] = '\0';
-
-    ::fclose(f);
-
-    return bytes_read > 0 && bytes_read < bufsize;
+  // Read a file once, without keeping it open.
+  bool read(const char* filename) {
+    const int fd = os::open(filename, O_RDONLY, 0);
+    if (fd == -1) {
+      log_debug(vitals)("Failed to open %s (%d)", filename, errno);
+      return false;
+    }
+    const bool rc = read_from(fd);
+    ::close(fd);
+    return rc;
   }
 
   const char* text() const { return _buf; }
@@ -129,6 +166,34 @@ class ProcFile {
     return value;
   }
 
+  // For files consisting of "<key> <value>" lines: parse the values of the given keys in a single
+  // pass over the file, stopping when all keys have been found. Values of keys not found are left
+  // unchanged. Keys must include the delimiter, e.g. "VmRSS:".
+  struct key_value_t {
+    const char* key;
+    value_t* value;
+    size_t scale;
+  };
+
+  void parse_keyed_values(const key_value_t* kv, int num) const {
+    int found = 0;
+    const char* line = _buf;
+    while (line != NULL && *line != '\0' && found < num) {
+      for (int i = 0; i < num; i++) {
+        const size_t len = ::strlen(kv[i].key);
+        if (::strncmp(line, kv[i].key, len) == 0) {
+          *(kv[i].value) = as_value(line + len, kv[i].scale);
+          found++;
+          break;
+        }
+      }
+      line = ::strchr(line, '\n');
+      if (line != NULL) {
+        line++;
+      }
+    }
+  }
+
 };
 
 struct cpu_values_t {
@@ -216,6 +281,22 @@ static void mallinfo_init() {
 
 #endif // __GLIBC__
 
+// Pressure stall files (/proc/pressure/*, cgroup v2 *.pressure) look like
+//  some avg10=0.00 avg60=0.00 avg300=0.00 total=12345
+//  full avg10=0.00 avg60=0.00 avg300=0.00 total=6789
+// Returns the accumulated "some" stall time in microseconds.
+static value_t parse_psi_some_total(const ProcFile* pf) {
+  const char* line = pf->get_prefixed_line("some ");
+  if (line != NULL) {
+    const char* nl = ::strchr(line, '\n');
+    const char* total = ::strstr(line, "total=");
+    if (total != NULL && (nl == NULL || total < nl)) {
+      return ProcFile::as_value(total + ::strlen("total="));
+    }
+  }
+  return INVALID_VALUE;
+}
+
 // Helper function, returns true if string is a numerical id
 static bool is_numerical_id(const char* s) {
   const char* p = s;
@@ -236,12 +317,16 @@ static bool is_numerical_id(const char* s) {
 class CGroups : public AllStatic {
 
   static bool _containerized;
-  static const char* _file_usg;
-  static const char* _file_usgsw;
-  static const char* _file_lim;
-  static const char* _file_limsw;
-  static const char* _file_slim;
-  static const char* _file_kusg;
+  static ProcFile* _file_usg;
+  static ProcFile* _file_usgsw;
+  static ProcFile* _file_lim;
+  static ProcFile* _file_limsw;
+  static ProcFile* _file_slim;
+  static ProcFile* _file_kusg;
+  // cgroup v2 only: memory.stat, from which we read kernel memory usage.
+  static ProcFile* _file_stat;
+  // cgroup v2 only: memory.pressure
+  static ProcFile* _file_psi_mem;
 
 public:
 
@@ -291,10 +376,10 @@ class CGroups : public AllStatic {
       }
     }
 
-    _file_usg = os::strdup(ss.base()); // so, we have that.
+    _file_usg = new ProcFile(os::strdup(ss.base())); // so, we have that.
 
 #define STORE_PATH(variable, filename) \
-  ss.reset(); ss.print("%s%s", path.base(), filename); variable = os::strdup(ss.base());
+  ss.reset(); ss.print("%s%s", path.base(), filename); variable = new ProcFile(os::strdup(ss.base()));
 
     if (isv1) {
       STORE_PATH(_file_usgsw, "memory.memsw.usage_in_bytes");
@@ -304,21 +389,24 @@ class CGroups : public AllStatic {
       STORE_PATH(_file_slim, "memory.soft_limit_in_bytes");
     } else {
       STORE_PATH(_file_usgsw, "memory.swap.current");
-      STORE_PATH(_file_kusg, "memory.kmem.usage_in_bytes");
+      STORE_PATH(_file_stat, "memory.stat");
       STORE_PATH(_file_lim, "memory.max");
       STORE_PATH(_file_limsw, "memory.swap.max");
       STORE_PATH(_file_slim, "memory.low");
+      STORE_PATH(_file_psi_mem, "memory.pressure");
     }
 #undef STORE_PATH
 
 #define LOG_PATH(variable) \
-		log_debug(vitals)("Vitals: %s=%s", #variable, variable == NULL ? "<null>" : variable);
+		log_debug(vitals)("Vitals: %s=%s", #variable, variable == NULL ? "<null>" : variable->filename());
     LOG_PATH(_file_usg)
     LOG_PATH(_file_usgsw)
     LOG_PATH(_file_kusg)
+    LOG_PATH(_file_stat)
     LOG_PATH(_file_lim)
     LOG_PATH(_file_limsw)
     LOG_PATH(_file_slim)
+    LOG_PATH(_file_psi_mem)
 #undef LOG_PATH
 
     // Initialization went through. We show columns if we are containerized.
@@ -332,16 +420,16 @@ class CGroups : public AllStatic {
     value_t usg;
     value_t usgsw;
     value_t kusg;
+    value_t psi_mem;
   };
 
   static bool get_stats(cgroup_values_t* v) {
-    v->lim = v->limsw = v->slim = v->usg = v->usgsw = v->kusg = INVALID_VALUE;
-    ProcFile pf;
+    v->lim = v->limsw = v->slim = v->usg = v->usgsw = v->kusg = v->psi_mem = INVALID_VALUE;
 #define GET_VALUE(var) \
   { \
-    const char* what = _file_ ## var; \
-    if (what != NULL && pf.read(what)) { \
-      v-> var = pf.as_value(1); \
+    ProcFile* const pf = _file_ ## var; \
+    if (pf != NULL && pf->read()) { \
+      v-> var = pf->as_value(1); \
     } \
   }
   GET_VALUE(usg);
@@ -351,6 +439,14 @@ class CGroups : public AllStatic {
   GET_VALUE(limsw);
   GET_VALUE(slim);
 #undef GET_VALUE
+    if (_file_stat != NULL && _file_stat->read()) {
+      // "kernel" exists since Linux 5.18
+      const ProcFile::key_value_t keys[] = { { "kernel ", &v->kusg, 1 } };
+      _file_stat->parse_keyed_values(keys, 1);
+    }
+    if (_file_psi_mem != NULL && _file_psi_mem->read()) {
+      v->psi_mem = parse_psi_some_total(_file_psi_mem);
+    }
     // Cgroup limits defaults to PAGE_COUNTER_MAX in the kernel; so a very large number means "no limit"
     // Note that on 64-bit, the default is LONG_MAX aligned down to pagesize; but I am not sure this is
     // always true, so I just assume a very high value.
@@ -365,22 +461,52 @@ class CGroups : public AllStatic {
 }; // end: CGroups
 
 bool CGroups::_containerized = false;
-const char* CGroups::_file_usg = NULL;
-const char* CGroups::_file_usgsw = NULL;
-const char* CGroups::_file_lim = NULL;
-const char* CGroups::_file_limsw = NULL;
-const char* CGroups::_file_slim = NULL;
-const char* CGroups::_file_kusg = NULL;
+ProcFile* CGroups::_file_usg = NULL;
+ProcFile* CGroups::_file_usgsw = NULL;
+ProcFile* CGroups::_file_lim = NULL;
+ProcFile* CGroups::_file_limsw = NULL;
+ProcFile* CGroups::_file_slim = NULL;
+ProcFile* CGroups::_file_kusg = NULL;
+ProcFile* CGroups::_file_stat = NULL;
+ProcFile* CGroups::_file_psi_mem = NULL;
+
+// Files we read on every update
+static ProcFile* g_proc_meminfo = NULL;
+static ProcFile* g_proc_vmstat = NULL;
+static ProcFile* g_proc_stat = NULL;
+static ProcFile* g_proc_pressure_cpu = NULL;
+static ProcFile* g_proc_pressure_mem = NULL;
+static ProcFile* g_proc_self_status = NULL;
+static ProcFile* g_proc_self_io = NULL;
+static ProcFile* g_proc_self_stat = NULL;
+// Scratch buffer to read /proc/<pid>/stat of all processes
+static ProcFile* g_proc_scratch = NULL;
+
+// Updates may come concurrently from the sampler thread and the HiMemReport thread.
+static Lock g_oswrapper_lock("OSWrapperLock");
 
 void OSWrapper::update_if_needed() {
+  AutoLock autolock(&g_oswrapper_lock);
 
-  time_t t;
-  time(&t);
-  if (t != (time_t)-1 &&
-      t < (_last_update + num_seconds_until_update)) {
+  // Values are cached for a short time since several clients (sampler thread, HiMemReport) read them.
+  // With burst sampling, the cache must not outlive a burst sample interval.
+  const jlong max_age_ms = VitalsBurstSampling ? (jlong)VitalsBurstSampleInterval / 2 : 1000;
+  const jlong now_ms = os::javaTimeNanos() / NANOSECS_PER_MILLISEC;
+  if (_last_update_ms != 0 && now_ms < (_last_update_ms + max_age_ms)) {
     return; // still good
   }
-  _last_update = t;
+  _last_update_ms = now_ms;
+
+  update_locked();
+}
+
+void OSWrapper::update() {
+  AutoLock autolock(&g_oswrapper_lock);
+  _last_update_ms = os::javaTimeNanos() / NANOSECS_PER_MILLISEC;
+  update_locked();
+}
+
+void OSWrapper::update_locked() {
 
   static bool first_call = true;
 
@@ -389,28 +515,34 @@ void OSWrapper::update_if_needed() {
 ALL_VALUES_DO(RESETVAL)
 #undef RESETVAL
 
-  ProcFile bf;
-  if (bf.read("/proc/meminfo")) {
+  if (g_proc_meminfo->read()) {
 
     if (first_call) {
-      log_trace(vitals)("Read /proc/meminfo: \n%s", bf.text());
+      log_trace(vitals)("Read /proc/meminfo: \n%s", g_proc_meminfo->text());
     }
 
     // All values in /proc/meminfo are in KB
     const size_t scale = K;
 
-    _syst_phys = bf.parsed_prefixed_value("MemTotal:", scale);
-    _syst_avail = bf.parsed_prefixed_value("MemAvailable:", scale);
+    value_t swap_total = INVALID_VALUE;
+    value_t swap_free = INVALID_VALUE;
+    value_t commitlimit = INVALID_VALUE;
+    value_t committed = INVALID_VALUE;
+    const ProcFile::key_value_t keys[] = {
+      { "MemTotal:", &_syst_phys, scale },
+      { "MemAvailable:", &_syst_avail, scale },
+      { "SwapTotal:", &swap_total, scale },
+      { "SwapFree:", &swap_free, scale },
+      { "CommitLimit:", &commitlimit, scale },
+      { "Committed_AS:", &committed, scale }
+    };
+    g_proc_meminfo->parse_keyed_values(keys, ARRAY_SIZE(keys));
 
-    const value_t swap_total = bf.parsed_prefixed_value("SwapTotal:", scale);
-    const value_t swap_free = bf.parsed_prefixed_value("SwapFree:", scale);
     if (swap_total != INVALID_VALUE && swap_free != INVALID_VALUE) {
       _syst_swap = swap_total - swap_free;
     }
 
     // Calc committed ratio. Values > 100% indicate overcommitment.
-    const value_t commitlimit = bf.parsed_prefixed_value("CommitLimit:", scale);
-    const value_t committed = bf.parsed_prefixed_value("Committed_AS:", scale);
     if (commitlimit != INVALID_VALUE && commitlimit != 0 && committed != INVALID_VALUE) {
       _syst_comm = committed;
       const value_t ratio = (committed * 100) / commitlimit;
@@ -419,15 +551,18 @@ ALL_VALUES_DO(RESETVAL)
 
   }
 
-  if (bf.read("/proc/vmstat")) {
-    _syst_si = bf.parsed_prefixed_value("pswpin");
-    _syst_so = bf.parsed_prefixed_value("pswpout");
+  if (g_proc_vmstat->read()) {
+    const ProcFile::key_value_t keys[] = {
+      { "pswpin ", &_syst_si, 1 },
+      { "pswpout ", &_syst_so, 1 }
+    };
+    g_proc_vmstat->parse_keyed_values(keys, ARRAY_SIZE(keys));
   }
 
-  if (bf.read("/proc/stat")) {
+  if (g_proc_stat->read()) {
     // Read and parse global cpu values
     cpu_values_t values;
-    const char* line = bf.get_prefixed_line("cpu");
+    const char* line = g_proc_stat->get_prefixed_line("cpu");
     parse_proc_stat_cpu_line(line, &values);
 
     _syst_cpu_us = values.user + values.nice;
@@ -441,8 +576,20 @@ ALL_VALUES_DO(RESETVAL)
     // See https://utcc.utoronto.ca/~cks/space/blog/linux/ProcessStatesAndProcStat
     // and https://lore.kernel.org/lkml/12601530441257@xenotime.net/#t
     // and the canonical man page description at https://www.kernel.org/doc/Documentation/filesystems/proc.txt
-    _syst_tr = bf.parsed_prefixed_value("procs_running");
-    _syst_tb = bf.parsed_prefixed_value("procs_blocked");
+    const ProcFile::key_value_t keys[] = {
+      { "procs_running ", &_syst_tr, 1 },
+      { "procs_blocked ", &_syst_tb, 1 }
+    };
+    g_proc_stat->parse_keyed_values(keys, ARRAY_SIZE(keys));
+  }
+
+  // Pressure stall information needs Linux 4.20 with CONFIG_PSI, and can be
+  // disabled at boot (psi=0); the files are then missing or unreadable.
+  if (g_proc_pressure_cpu->read()) {
+    _syst_psi_cpu = parse_psi_some_total(g_proc_pressure_cpu);
+  }
+  if (g_proc_pressure_mem->read()) {
+    _syst_psi_mem = parse_psi_some_total(g_proc_pressure_mem);
   }
 
   // cgroups business
@@ -454,19 +601,20 @@ ALL_VALUES_DO(RESETVAL)
     _syst_cgro_lim = v.lim;
     _syst_cgro_limsw = v.limsw;
     _syst_cgro_slim = v.slim;
+    _syst_cgro_psi_mem = v.psi_mem;
   }
 
-  if (bf.read("/proc/self/status")) {
-
-    _proc_virt = bf.parsed_prefixed_value("VmSize:", K);
-    _proc_swdo = bf.parsed_prefixed_value("VmSwap:", K);
-    _proc_rss_all = bf.parsed_prefixed_value("VmRSS:", K);
-    _proc_rss_anon = bf.parsed_prefixed_value("RssAnon:", K);
-    _proc_rss_file = bf.parsed_prefixed_value("RssFile:", K);
-    _proc_rss_shm = bf.parsed_prefixed_value("RssShmem:", K);
-
-    _proc_thr = bf.parsed_prefixed_value("Threads:");
-
+  if (g_proc_self_status->read()) {
+    const ProcFile::key_value_t keys[] = {
+      { "VmSize:", &_proc_virt, K },
+      { "VmSwap:", &_proc_swdo, K },
+      { "VmRSS:", &_proc_rss_all, K },
+      { "RssAnon:", &_proc_rss_anon, K },
+      { "RssFile:", &_proc_rss_file, K },
+      { "RssShmem:", &_proc_rss_shm, K },
+      { "Threads:", &_proc_thr, 1 }
+    };
+    g_proc_self_status->parse_keyed_values(keys, ARRAY_SIZE(keys));
   }
 
   // Number of open files: iterate over /proc/self/fd and count.
@@ -503,8 +651,8 @@ ALL_VALUES_DO(RESETVAL)
             v_p ++;
             char tmp[128];
             jio_snprintf(tmp, sizeof(tmp), "/proc/%s/stat", en->d_name);
-            if (bf.read(tmp)) {
-              const char* text = bf.text();
+            if (g_proc_scratch->read(tmp)) {
+              const char* text = g_proc_scratch->text();
               // See man proc(5)
               // (20) num_threads  %ld
               long num_threads = 0;
@@ -520,13 +668,16 @@ ALL_VALUES_DO(RESETVAL)
     }
   }
 
-  if (bf.read("/proc/self/io")) {
-    _proc_io_rd = bf.parsed_prefixed_value("rchar:");
-    _proc_io_wr = bf.parsed_prefixed_value("wchar:");
+  if (g_proc_self_io->read()) {
+    const ProcFile::key_value_t keys[] = {
+      { "rchar:", &_proc_io_rd, 1 },
+      { "wchar:", &_proc_io_wr, 1 }
+    };
+    g_proc_self_io->parse_keyed_values(keys, ARRAY_SIZE(keys));
   }
 
-  if (bf.read("/proc/self/stat")) {
-    const char* text = bf.text();
+  if (g_proc_self_stat->read()) {
+    const char* text = g_proc_self_stat->text();
     // See man proc(5)
     // (14) utime  %lu
     // (15) stime  %lu
@@ -561,6 +712,15 @@ ALL_VALUES_DO(RESETVAL)
 }
 
 bool OSWrapper::initialize() {
+  g_proc_meminfo = new ProcFile("/proc/meminfo");
+  g_proc_vmstat = new ProcFile("/proc/vmstat");
+  g_proc_stat = new ProcFile("/proc/stat");
+  g_proc_pressure_cpu = new ProcFile("/proc/pressure/cpu");
+  g_proc_pressure_mem = new ProcFile("/proc/pressure/memory");
+  g_proc_self_status = new ProcFile("/proc/self/status");
+  g_proc_self_io = new ProcFile("/proc/self/io");
+  g_proc_self_stat = new ProcFile("/proc/self/stat");
+  g_proc_scratch = new ProcFile();
 #ifdef __GLIBC__
   mallinfo_init();
 #endif
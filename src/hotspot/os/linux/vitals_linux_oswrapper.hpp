@@ -34,7 +34,7 @@ namespace sapmachine_vitals {
 
 class OSWrapper {
 
-  static time_t _last_update;
+  static jlong _last_update_ms;
 
 #define ALL_VALUES_DO(f) \
 		f(syst_phys) \
@@ -53,12 +53,15 @@ class OSWrapper {
 	  f(syst_cpu_id) \
 	  f(syst_cpu_st) \
 	  f(syst_cpu_gu) \
+	  f(syst_psi_cpu) \
+	  f(syst_psi_mem) \
 	  f(syst_cgro_lim) \
 	  f(syst_cgro_limsw) \
 	  f(syst_cgro_slim) \
 	  f(syst_cgro_usg) \
 	  f(syst_cgro_usgsw) \
 	  f(syst_cgro_kusg) \
+	  f(syst_cgro_psi_mem) \
 	  f(proc_virt) \
 	  f(proc_rss_all) \
 	  f(proc_rss_anon) \
@@ -81,6 +84,8 @@ ALL_VALUES_DO(DECLARE_VARIABLE)
 
 #undef DECLARE_VARIABLE
 
+  static void update_locked();
+
 public:
 
 #define DEFINE_GETTER(name) \
@@ -90,8 +95,12 @@ ALL_VALUES_DO(DEFINE_GETTER)
 
 #undef DEFINE_GETTER
 
+  // Update values unless they are fresh enough.
   static void update_if_needed();
 
+  // Update values unconditionally.
+  static void update();
+
   static bool initialize();
 
 };
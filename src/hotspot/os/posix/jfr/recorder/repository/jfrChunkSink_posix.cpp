@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/recorder/repository/jfrChunkSink.hpp"
+#include "os_posix.hpp"
+#include "runtime/os.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+int JfrChunkSink::open(const char* path, bool* no_reader) {
+  const int sink_fd = os::open(path, O_WRONLY | O_APPEND | O_CREAT | O_NONBLOCK, S_IRUSR | S_IWUSR);
+  *no_reader = sink_fd == -1 && errno == ENXIO;
+  return sink_fd;
+}
+
+JfrChunkSink::WriteResult JfrChunkSink::write(int sink_fd, const char* data, size_t size, bool* started, int stall_timeout_ms) {
+  static const int poll_interval_ms = 100;
+  int stalled_ms = 0;
+  while (size > 0) {
+    ssize_t n;
+    RESTARTABLE(::write(sink_fd, data, size), n);
+    if (n > 0) {
+      *started = true;
+      data += n;
+      size -= (size_t)n;
+      stalled_ms = 0;
+      continue;
+    }
+    if (n == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      if (!*started) {
+        return SKIPPED;
+      }
+      if (stalled_ms >= stall_timeout_ms) {
+        return TRUNCATED;
+      }
+      struct pollfd pfd = { sink_fd, POLLOUT, 0 };
+      int ret;
+      RESTARTABLE(::poll(&pfd, 1, poll_interval_ms), ret);
+      stalled_ms += poll_interval_ms;
+      continue;
+    }
+    return *started ? TRUNCATED : SKIPPED;
+  }
+  return WRITTEN;
+}
+
+void JfrChunkSink::close(int fd) {
+  ::close(fd);
+}
@@ -39,6 +39,7 @@
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/ticks.hpp"
 
+#include <math.h>
 #include <pthread.h>
 #include <stdlib.h>
 
@@ -75,6 +76,15 @@ static_assert(is_power_of_2(NR_OF_STACK_MAPS), "nr of stack maps must be power o
 constexpr int NR_OF_ALLOC_MAPS = 32;
 static_assert(is_power_of_2(NR_OF_ALLOC_MAPS), "nr of alloc maps must be power of 2");
 
+// The number of allocations a thread can buffer before it has to merge
+// them into the stack maps itself.
+constexpr int THREAD_BUFFER_SIZE = 64;
+static_assert(is_power_of_2(THREAD_BUFFER_SIZE), "thread buffer size must be power of 2");
+static_assert(NR_OF_STACK_MAPS <= 32, "stack maps must fit into a 32 bit mask");
+
+// The interval (in ms) in which the thread buffers are merged in the background.
+constexpr int THREAD_BUFFER_MERGE_INTERVAL = 100;
+
 namespace sap {
 
 // The real allocation funcstions to use. This is be initialized later.
@@ -438,11 +448,11 @@ class StatEntry {
   address    _frames[];
 
 public:
-  StatEntry(uint64_t hash, size_t size, int nr_of_frames, address* frames) :
+  StatEntry(uint64_t hash, uint64_t size, uint64_t count, int nr_of_frames, address* frames) :
     _next(nullptr),
     _hash_and_nr_of_frames((hash * (MAX_FRAMES + 1)) + nr_of_frames),
     _size(size),
-    _count(1) {
+    _count(count) {
     assert(nr_of_frames >= 0, "Must not be negative");
     assert(nr_of_frames <= MAX_FRAMES, "too many frames");
     memcpy(_frames, frames, sizeof(address) * nr_of_frames);
@@ -471,17 +481,17 @@ class StatEntry {
     _next = next;
   }
 
-  void add_allocation(size_t size) {
+  void add_allocation(uint64_t size, uint64_t count) {
     _size += size;
-    _count += 1;
+    _count += count;
   }
 
-  void remove_allocation(size_t size) {
+  void remove_allocation(uint64_t size, uint64_t count) {
     assert(_size >= size, "Size cannot get negative (" UINT64_FORMAT " removed from " \
-           UINT64_FORMAT ", count " UINT64_FORMAT ")", (uint64_t) size, _size, _count);
-    assert(_count >= 1, "Count cannot get negative");
+           UINT64_FORMAT ", count " UINT64_FORMAT ")", size, _size, _count);
+    assert(_count >= count, "Count cannot get negative");
     _size -= size;
-    _count -= 1;
+    _count -= count;
   }
 
   uint64_t size() {
@@ -559,6 +569,99 @@ class AllocEntry {
 
 
 
+// A single allocation recorded in a thread buffer. The frames are stored
+// without the skipped top frames.
+struct BufferedAllocation {
+  uint64_t _hash;
+  uint64_t _size;
+  int      _nr_of_frames;
+  int      _enable_count;
+  address  _frames[MAX_FRAMES];
+};
+
+// Collects the allocations of a single thread, so the thread doesn't have to
+// lock a stack map for every allocation when we don't track frees. Only the
+// owning thread adds entries. The entries are merged into the stack maps
+// either by the owning thread when the buffer is full or by the merge task,
+// both holding the buffer lock.
+class ThreadBuffer {
+private:
+  char               _pre_pad[DEFAULT_CACHE_LINE_SIZE];
+  ThreadBuffer*      _next;
+  pthread_mutex_t    _lock;
+  volatile uint32_t  _head;
+  volatile uint32_t  _tail;
+  BufferedAllocation _entries[THREAD_BUFFER_SIZE];
+  char               _post_pad[DEFAULT_CACHE_LINE_SIZE];
+
+public:
+  ThreadBuffer() :
+    _next(nullptr),
+    _head(0),
+    _tail(0) {
+    if (pthread_mutex_init(&_lock, nullptr) != 0) {
+      fatal("Could not initialize thread buffer lock");
+    }
+  }
+
+  ~ThreadBuffer() {
+    pthread_mutex_destroy(&_lock);
+  }
+
+  ThreadBuffer* next() {
+    return _next;
+  }
+
+  void set_next(ThreadBuffer* next) {
+    _next = next;
+  }
+
+  ThreadBuffer** next_ptr() {
+    return &_next;
+  }
+
+  pthread_mutex_t* lock() {
+    return &_lock;
+  }
+
+  // Only called by the owning thread. Returns false if the buffer is full.
+  bool add(uint64_t hash, size_t size, int nr_of_frames, address* frames, int enable_count) {
+    uint32_t head = _head;
+
+    if (head - Atomic::load_acquire(&_tail) >= (uint32_t) THREAD_BUFFER_SIZE) {
+      return false;
+    }
+
+    BufferedAllocation* entry = &_entries[head & (THREAD_BUFFER_SIZE - 1)];
+    entry->_hash = hash;
+    entry->_size = size;
+    entry->_nr_of_frames = nr_of_frames;
+    entry->_enable_count = enable_count;
+    memcpy(entry->_frames, frames, sizeof(address) * nr_of_frames);
+
+    Atomic::release_store(&_head, head + 1);
+
+    return true;
+  }
+
+  // The following methods must only be called with the buffer lock held.
+  uint32_t tail() {
+    return _tail;
+  }
+
+  uint32_t head() {
+    return Atomic::load_acquire(&_head);
+  }
+
+  BufferedAllocation* at(uint32_t pos) {
+    return &_entries[pos & (THREAD_BUFFER_SIZE - 1)];
+  }
+
+  void set_tail(uint32_t tail) {
+    Atomic::release_store(&_tail, tail);
+  }
+};
+
 static register_hooks_t* register_hooks;
 static get_real_malloc_funcs_t* get_real_malloc_funcs;
 
@@ -718,12 +821,21 @@ class MallocStatisticImpl : public AllStatic {
   static uint64_t           _to_track_mask;
   static uint64_t           _to_track_limit;
 
+  static uint64_t           _sample_interval;
+  static volatile uint64_t  _sample_seed;
+  static pthread_key_t      _bytes_until_sample_key;
+
   static volatile uint64_t  _stack_walk_time;
   static volatile uint64_t  _stack_walk_count;
   static volatile uint64_t  _tracked_ptrs;
   static volatile uint64_t  _not_tracked_ptrs;
   static volatile uint64_t  _failed_frees;
 
+  static pthread_key_t      _thread_buffer_key;
+  static pthread_mutex_t    _thread_buffers_lock;
+  static ThreadBuffer*      _thread_buffers;
+  static int                _nr_of_thread_buffers;
+
   static void*              _rainy_day_fund;
   static registered_hooks_t _rainy_day_hooks;
   static pthread_mutex_t    _rainy_day_fund_lock;
@@ -757,14 +869,24 @@ class MallocStatisticImpl : public AllStatic {
 
   static StatEntry* record_allocation_size(size_t to_add, int nr_of_frames, address* frames,
                                            int* enable_count = nullptr);
+  static StatEntry* add_to_stack_map(int idx, uint64_t hash, size_t to_add, int nr_of_frames,
+                                     address* frames);
+  static void record_allocation_size_buffered(size_t to_add, int nr_of_frames, address* frames);
   static void record_allocation(void* ptr, uint64_t hash, int nr_of_frames, address* frames);
   static StatEntry* record_free(void* ptr, uint64_t hash, size_t size);
 
   static uint64_t ptr_hash_impl(void* ptr);
   static uint64_t ptr_hash(void* ptr);
   static bool should_track(uint64_t hash);
+  static bool should_sample(size_t size);
+  static uint64_t next_sample_interval();
+  static void scale_sample(uint64_t size, uint64_t* scaled_size, uint64_t* scaled_count);
   static int capture_stack(address* frames, address real_func, address caller);
 
+  static ThreadBuffer* thread_buffer();
+  static void thread_buffer_destructor(void* value);
+  static void merge_thread_buffer(ThreadBuffer* buffer);
+
   static bool setup_hooks(registered_hooks_t* hooks, outputStream* st);
   static void cleanup();
 
@@ -779,6 +901,7 @@ class MallocStatisticImpl : public AllStatic {
   static bool disable(outputStream* st);
   static bool dump(outputStream* msg_stream, outputStream* dump_stream, DumpSpec const& spec);
   static void shutdown();
+  static void merge_thread_buffers();
 };
 
 registered_hooks_t MallocStatisticImpl::_malloc_stat_hooks = {
@@ -823,15 +946,64 @@ StackMapData      MallocStatisticImpl::_stack_maps_data[NR_OF_STACK_MAPS];
 AllocMapData      MallocStatisticImpl::_alloc_maps_data[NR_OF_ALLOC_MAPS];
 uint64_t          MallocStatisticImpl::_to_track_mask;
 uint64_t          MallocStatisticImpl::_to_track_limit;
+uint64_t          MallocStatisticImpl::_sample_interval;
+volatile uint64_t MallocStatisticImpl::_sample_seed;
+pthread_key_t     MallocStatisticImpl::_bytes_until_sample_key;
 volatile uint64_t MallocStatisticImpl::_stack_walk_time;
 volatile uint64_t MallocStatisticImpl::_stack_walk_count;
 volatile uint64_t MallocStatisticImpl::_tracked_ptrs;
 volatile uint64_t MallocStatisticImpl::_not_tracked_ptrs;
 volatile uint64_t MallocStatisticImpl::_failed_frees;
+pthread_key_t     MallocStatisticImpl::_thread_buffer_key;
+pthread_mutex_t   MallocStatisticImpl::_thread_buffers_lock;
+ThreadBuffer*     MallocStatisticImpl::_thread_buffers;
+int               MallocStatisticImpl::_nr_of_thread_buffers;
 void*             MallocStatisticImpl::_rainy_day_fund;
 pthread_mutex_t   MallocStatisticImpl::_rainy_day_fund_lock;
 volatile bool     MallocStatisticImpl::_rainy_day_fund_used;
 
+#if defined(AMD64) || defined(AARCH64)
+#define HAS_FAST_FRAME_WALK
+
+// Walks the frame pointer chain starting at the given frame. Since we only
+// follow frame pointers pointing into the stack of the thread and going up
+// the stack, we never read invalid memory, so we don't need SafeFetch. Code
+// compiled without frame pointers just ends the walk early. The walk is
+// bounded by the given maximum number of frames (at most MAX_FRAMES).
+static ALWAYSINLINE int fast_frame_walk(address* frames, int max_frames, intptr_t* fp,
+                                        address stack_low, address stack_high) {
+  int nr_of_frames = 0;
+
+  while (nr_of_frames < max_frames) {
+    if (((address) fp < stack_low) || ((address) (fp + 2) > stack_high) ||
+        !is_aligned(fp, sizeof(intptr_t))) {
+      break;
+    }
+
+    // The saved frame pointer is followed by the return address.
+    intptr_t* sender_fp = (intptr_t*) fp[0];
+    address pc = (address) fp[1];
+
+    if (pc == nullptr) {
+      break;
+    }
+
+    frames[nr_of_frames] = pc;
+    nr_of_frames += 1;
+
+    // Like the fallback we stop at Java frames, since compiled code doesn't
+    // necessarily maintain the frame pointer.
+    if ((sender_fp <= fp) || ((pc >= CodeCache::low_bound()) && (pc < CodeCache::high_bound()))) {
+      break;
+    }
+
+    fp = sender_fp;
+  }
+
+  return nr_of_frames;
+}
+#endif
+
 ALWAYSINLINE int MallocStatisticImpl::capture_stack(address* frames, address real_func, address caller) {
   uint64_t ticks = _detailed_stats ? Ticks::now().nanoseconds() : 0;
   int nr_of_frames = 0;
@@ -841,30 +1013,43 @@ ALWAYSINLINE int MallocStatisticImpl::capture_stack(address* frames, address rea
   } else if (_use_backtrace) {
     nr_of_frames = _backtrace((void**) frames, _max_frames + FRAMES_TO_SKIP);
   } else {
-    // We have to unblock SIGSEGV signal handling, since os::is_first_C_frame()
-    // calls SafeFetch, which needs the proper handling of SIGSEGV.
-    sigset_t curr, old;
-    sigemptyset(&curr);
-    sigaddset(&curr, SIGSEGV);
-    pthread_sigmask(SIG_UNBLOCK, &curr, &old);
-    frame fr = os::current_frame();
-
-    while (fr.pc() && nr_of_frames < _max_frames + FRAMES_TO_SKIP) {
-      frames[nr_of_frames] = fr.pc();
-      nr_of_frames += 1;
-
-      if (nr_of_frames >= _max_frames + FRAMES_TO_SKIP) {
-        break;
-      }
+#if defined(HAS_FAST_FRAME_WALK)
+    // If we know the stack bounds of this thread, we can just walk the frame
+    // pointers directly. This avoids changing the signal mask twice per stack.
+    Thread* thread = Thread::current_or_null();
+
+    if ((thread != nullptr) && (thread->stack_size() != 0)) {
+      nr_of_frames = fast_frame_walk(frames, _max_frames + FRAMES_TO_SKIP,
+                                     (intptr_t*) __builtin_frame_address(0),
+                                     thread->stack_end(), thread->stack_base());
+    } else
+#endif
+    {
+      // We have to unblock SIGSEGV signal handling, since os::is_first_C_frame()
+      // calls SafeFetch, which needs the proper handling of SIGSEGV.
+      sigset_t curr, old;
+      sigemptyset(&curr);
+      sigaddset(&curr, SIGSEGV);
+      pthread_sigmask(SIG_UNBLOCK, &curr, &old);
+      frame fr = os::current_frame();
+
+      while (fr.pc() && nr_of_frames < _max_frames + FRAMES_TO_SKIP) {
+        frames[nr_of_frames] = fr.pc();
+        nr_of_frames += 1;
+
+        if (nr_of_frames >= _max_frames + FRAMES_TO_SKIP) {
+          break;
+        }
 
-      if (fr.fp() == nullptr || fr.cb() != nullptr || fr.sender_pc() == nullptr || os::is_first_C_frame(&fr)) {
-        break;
+        if (fr.fp() == nullptr || fr.cb() != nullptr || fr.sender_pc() == nullptr || os::is_first_C_frame(&fr)) {
+          break;
+        }
+
+        fr = os::get_sender_for_C_frame(&fr);
       }
 
-      fr = os::get_sender_for_C_frame(&fr);
+      pthread_sigmask(SIG_SETMASK, &old, nullptr);
     }
-
-    pthread_sigmask(SIG_SETMASK, &old, nullptr);
   }
 
   // We know at least the function and the caller.
@@ -959,6 +1144,64 @@ bool MallocStatisticImpl::should_track(uint64_t hash) {
   return (hash & _to_track_mask) < _to_track_limit;
 }
 
+// The bytes a thread still has to allocate until the next sample are
+// stored directly as the value of the thread key (plus one, to tell an
+// unset value apart). The key is created early, so setting it never
+// allocates memory.
+bool MallocStatisticImpl::should_sample(size_t size) {
+  if (_sample_interval == 0) {
+    return true;
+  }
+
+  uintptr_t value = (uintptr_t) pthread_getspecific(_bytes_until_sample_key);
+  uint64_t left = value == 0 ? next_sample_interval() : (uint64_t) (value - 1);
+
+  if (size < left) {
+    pthread_setspecific(_bytes_until_sample_key, (void*) (uintptr_t) (left - size + 1));
+
+    return false;
+  }
+
+  pthread_setspecific(_bytes_until_sample_key, (void*) (uintptr_t) (next_sample_interval() + 1));
+
+  return true;
+}
+
+// Picks the bytes until the next sample from an exponential distribution
+// with the sample interval as the mean, like the ThreadHeapSampler does.
+// This makes the sampled allocations a Poisson process over the allocated
+// bytes, so every byte has the same chance to be sampled.
+uint64_t MallocStatisticImpl::next_sample_interval() {
+  // Racy, but we only get here once per sample and any value is fine.
+  uint64_t rnd = _sample_seed;
+  rnd ^= rnd << 13;
+  rnd ^= rnd >> 7;
+  rnd ^= rnd << 17;
+  _sample_seed = rnd;
+
+  // A uniformly distributed value in (0, 1].
+  double q = ((rnd >> 11) + 1) * (1.0 / (((uint64_t) 1) << 53));
+  double interval = -log(q) * _sample_interval;
+
+  return (uint64_t) MIN2(interval, (double) (UINTPTR_MAX >> 2));
+}
+
+// An allocation of the given size is sampled with the probability
+// p = 1 - exp(-size / interval), so it stands for 1 / p allocations of
+// that size. Since frees are scaled the same way, the size must be the one
+// we use when recording the free.
+void MallocStatisticImpl::scale_sample(uint64_t size, uint64_t* scaled_size, uint64_t* scaled_count) {
+  double p = _sample_interval == 0 ? 1.0 : -expm1(-(double) size / _sample_interval);
+
+  if (p <= 0.0) {
+    *scaled_size = size;
+    *scaled_count = 1;
+  } else {
+    *scaled_size = (uint64_t) (size / p + 0.5);
+    *scaled_count = (uint64_t) (1.0 / p + 0.5);
+  }
+}
+
 void MallocStatisticImpl::set_malloc_suspended(bool suspended) {
   _check_malloc_suspended = suspended;
   pthread_setspecific(_malloc_suspended, suspended ? (void*) 1 : nullptr);
@@ -972,14 +1215,15 @@ void* MallocStatisticImpl::malloc_hook(size_t size, void* caller_address) {
   void* result = real_malloc_funcs->malloc(size);
   uint64_t hash = ptr_hash(result);
 
-  if ((result != nullptr) && should_track(hash) && !malloc_suspended()) {
+  if ((result != nullptr) && should_track(hash) && !malloc_suspended() &&
+      should_sample(size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, (address) malloc, (address) caller_address);
 
     if (_track_free) {
       record_allocation(result, hash, nr_of_frames, frames);
     } else {
-      record_allocation_size(size, nr_of_frames, frames);
+      record_allocation_size_buffered(size, nr_of_frames, frames);
     }
   }
 
@@ -990,14 +1234,15 @@ void* MallocStatisticImpl::calloc_hook(size_t elems, size_t size, void* caller_a
   void* result = real_malloc_funcs->calloc(elems, size);
   uint64_t hash = ptr_hash(result);
 
-  if ((result != nullptr) && should_track(hash) && !malloc_suspended()) {
+  if ((result != nullptr) && should_track(hash) && !malloc_suspended() &&
+      should_sample(elems * size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, (address) calloc, (address) caller_address);
 
     if (_track_free) {
       record_allocation(result, hash, nr_of_frames, frames);
     } else {
-      record_allocation_size(elems * size, nr_of_frames, frames);
+      record_allocation_size_buffered(elems * size, nr_of_frames, frames);
     }
   }
 
@@ -1028,7 +1273,8 @@ void* MallocStatisticImpl::realloc_hook(void* ptr, size_t size, void* caller_add
 
   uint64_t hash = ptr_hash(result);
 
-  if ((result != nullptr) && should_track(hash) && !malloc_suspended()) {
+  if ((result != nullptr) && should_track(hash) && !malloc_suspended() &&
+      should_sample(size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, (address) realloc, (address) caller_address);
 
@@ -1038,7 +1284,7 @@ void* MallocStatisticImpl::realloc_hook(void* ptr, size_t size, void* caller_add
       // Track the additional allocate bytes. This is somewhat wrong, since
       // we don't know the requested size of the original allocation and
       // old_size might be greater.
-      record_allocation_size(size - old_size, nr_of_frames, frames);
+      record_allocation_size_buffered(size - old_size, nr_of_frames, frames);
     }
   }
 
@@ -1061,7 +1307,8 @@ int MallocStatisticImpl::posix_memalign_hook(void** ptr, size_t align, size_t si
   int result = real_malloc_funcs->posix_memalign(ptr, align, size);
   uint64_t hash = ptr_hash(*ptr);
 
-  if ((result == 0) && should_track(hash) && !malloc_suspended()) {
+  if ((result == 0) && should_track(hash) && !malloc_suspended() &&
+      should_sample(size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, (address) posix_memalign, (address) caller_address);
 
@@ -1070,7 +1317,7 @@ int MallocStatisticImpl::posix_memalign_hook(void** ptr, size_t align, size_t si
     } else {
       // Here we track the really allocated size, since it might be very different
       // from the requested one.
-      record_allocation_size(real_malloc_funcs->malloc_size(*ptr), nr_of_frames, frames);
+      record_allocation_size_buffered(real_malloc_funcs->malloc_size(*ptr), nr_of_frames, frames);
     }
   }
 
@@ -1086,7 +1333,8 @@ void* MallocStatisticImpl::memalign_hook(size_t align, size_t size, void* caller
   address real_func = (address) memalign_hook;
 #endif
 
-  if ((result != nullptr) && should_track(hash) && !malloc_suspended()) {
+  if ((result != nullptr) && should_track(hash) && !malloc_suspended() &&
+      should_sample(size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, real_func, (address) caller_address);
 
@@ -1095,7 +1343,7 @@ void* MallocStatisticImpl::memalign_hook(size_t align, size_t size, void* caller
     } else {
       // Here we track the really allocated size, since it might be very different
       // from the requested one.
-      record_allocation_size(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
+      record_allocation_size_buffered(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
     }
   }
 
@@ -1111,7 +1359,8 @@ void* MallocStatisticImpl::aligned_alloc_hook(size_t align, size_t size, void* c
   address real_func = (address) aligned_alloc_hook;
 #endif
 
-  if ((result != nullptr) && should_track(hash) && !malloc_suspended()) {
+  if ((result != nullptr) && should_track(hash) && !malloc_suspended() &&
+      should_sample(size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, real_func, (address) caller_address);
 
@@ -1120,7 +1369,7 @@ void* MallocStatisticImpl::aligned_alloc_hook(size_t align, size_t size, void* c
     } else {
       // Here we track the really allocated size, since it might be very different
       // from the requested one.
-      record_allocation_size(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
+      record_allocation_size_buffered(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
     }
   }
 
@@ -1136,7 +1385,8 @@ void* MallocStatisticImpl::valloc_hook(size_t size, void* caller_address) {
   address real_func = (address) valloc_hook;
 #endif
 
-  if ((result != nullptr) && should_track(hash) && !malloc_suspended()) {
+  if ((result != nullptr) && should_track(hash) && !malloc_suspended() &&
+      should_sample(size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, real_func, (address) caller_address);
 
@@ -1145,7 +1395,7 @@ void* MallocStatisticImpl::valloc_hook(size_t size, void* caller_address) {
     } else {
       // Here we track the really allocated size, since it might be very different
       // from the requested one.
-      record_allocation_size(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
+      record_allocation_size_buffered(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
     }
   }
 
@@ -1161,7 +1411,8 @@ void* MallocStatisticImpl::pvalloc_hook(size_t size, void* caller_address) {
   address real_func = (address) pvalloc_hook;
 #endif
 
-  if ((result != nullptr) && should_track(hash) && !malloc_suspended()) {
+  if ((result != nullptr) && should_track(hash) && !malloc_suspended() &&
+      should_sample(size)) {
     address frames[MAX_FRAMES + FRAMES_TO_SKIP];
     int nr_of_frames = capture_stack(frames, real_func, (address) caller_address);
 
@@ -1170,7 +1421,7 @@ void* MallocStatisticImpl::pvalloc_hook(size_t size, void* caller_address) {
     } else {
       // Here we track the really allocated size, since it might be very different
       // from the requested one.
-      record_allocation_size(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
+      record_allocation_size_buffered(real_malloc_funcs->malloc_size(result), nr_of_frames, frames);
     }
   }
 
@@ -1270,8 +1521,7 @@ StatEntry*  MallocStatisticImpl::record_allocation_size(size_t to_add, int nr_of
   int idx = hash & (NR_OF_STACK_MAPS - 1);
   assert((idx >= 0) && (idx < NR_OF_STACK_MAPS), "invalid map index");
 
-  StackMapData& map = _stack_maps_data[idx];
-  Locker locker(&map._lock);
+  Locker locker(&_stack_maps_data[idx]._lock);
 
   if (enable_count != nullptr) {
     *enable_count = _enable_count;
@@ -1281,6 +1531,17 @@ StatEntry*  MallocStatisticImpl::record_allocation_size(size_t to_add, int nr_of
     return nullptr;
   }
 
+  return add_to_stack_map(idx, hash, to_add, nr_of_frames, frames);
+}
+
+// Must be called with the lock of the stack map at the given index held.
+StatEntry* MallocStatisticImpl::add_to_stack_map(int idx, uint64_t hash, size_t to_add,
+                                                 int nr_of_frames, address* frames) {
+  StackMapData& map = _stack_maps_data[idx];
+  uint64_t scaled_size;
+  uint64_t scaled_count;
+  scale_sample(to_add, &scaled_size, &scaled_count);
+
   int slot = StatEntry::scaled_hash(hash) & map._mask;
   assert((slot >= 0) || (slot <= map._mask), "Invalid slot");
   StatEntry* to_check = map._entries[slot];
@@ -1289,7 +1550,7 @@ StatEntry*  MallocStatisticImpl::record_allocation_size(size_t to_add, int nr_of
   while (to_check != nullptr) {
     if ((to_check->hash() == hash) && (to_check->nr_of_frames() == nr_of_frames)) {
       if (is_same_stack(to_check, nr_of_frames, frames)) {
-        to_check->add_allocation(to_add);
+        to_check->add_allocation(scaled_size, scaled_count);
 
         return to_check;
       }
@@ -1302,7 +1563,7 @@ StatEntry*  MallocStatisticImpl::record_allocation_size(size_t to_add, int nr_of
   void* mem = map._alloc->allocate();
 
   if (mem != nullptr) {
-    StatEntry* entry = new (mem) StatEntry(hash, to_add, nr_of_frames, frames);
+    StatEntry* entry = new (mem) StatEntry(hash, scaled_size, scaled_count, nr_of_frames, frames);
     entry->set_next(map._entries[slot]);
     map._entries[slot] = entry;
     map._size += 1;
@@ -1317,6 +1578,160 @@ StatEntry*  MallocStatisticImpl::record_allocation_size(size_t to_add, int nr_of
   return nullptr;
 }
 
+void MallocStatisticImpl::record_allocation_size_buffered(size_t to_add, int nr_of_frames, address* frames) {
+  ThreadBuffer* buffer = thread_buffer();
+
+  if (buffer == nullptr) {
+    record_allocation_size(to_add, nr_of_frames, frames);
+
+    return;
+  }
+
+  // Skip the top frame since it is always from the hooks.
+  nr_of_frames = MAX2(nr_of_frames - FRAMES_TO_SKIP, 0);
+  frames += FRAMES_TO_SKIP;
+
+  assert(nr_of_frames <= _max_frames, "Overflow");
+
+  uint64_t hash = hash_for_frames(nr_of_frames, frames);
+  int enable_count = _enable_count;
+
+  if (buffer->add(hash, to_add, nr_of_frames, frames, enable_count)) {
+    return;
+  }
+
+  // The buffer is full, so merge it now. Since only we add to the buffer,
+  // there is room afterwards.
+  {
+    Locker locker(buffer->lock());
+    merge_thread_buffer(buffer);
+  }
+
+  bool added = buffer->add(hash, to_add, nr_of_frames, frames, enable_count);
+  assert(added, "Must have room after merging");
+}
+
+// The value of the thread buffer key for threads which are exiting.
+#define THREAD_EXITING ((void*) 1)
+
+ThreadBuffer* MallocStatisticImpl::thread_buffer() {
+  void* value = pthread_getspecific(_thread_buffer_key);
+
+  if (value == THREAD_EXITING) {
+    return nullptr;
+  }
+
+  if (value != nullptr) {
+    return (ThreadBuffer*) value;
+  }
+
+  void* mem = real_malloc_funcs->malloc(sizeof(ThreadBuffer));
+
+  // Fall back to recording directly if we don't get the memory.
+  if (mem == nullptr) {
+    return nullptr;
+  }
+
+  ThreadBuffer* buffer = new (mem) ThreadBuffer();
+
+  // The key is created early during VM initialization, so setting the value
+  // does not allocate memory, which would call the hooks again.
+  if (pthread_setspecific(_thread_buffer_key, buffer) != 0) {
+    buffer->~ThreadBuffer();
+    real_malloc_funcs->free(mem);
+
+    return nullptr;
+  }
+
+  Locker locker(&_thread_buffers_lock);
+  buffer->set_next(_thread_buffers);
+  _thread_buffers = buffer;
+  _nr_of_thread_buffers += 1;
+
+  return buffer;
+}
+
+void MallocStatisticImpl::thread_buffer_destructor(void* value) {
+  // Allocations done later during thread exit are recorded directly. Note that
+  // setting a non-null value means we get called again, which is harmless.
+  pthread_setspecific(_thread_buffer_key, THREAD_EXITING);
+
+  if (value == THREAD_EXITING) {
+    return;
+  }
+
+  ThreadBuffer* buffer = (ThreadBuffer*) value;
+
+  {
+    Locker locker(&_thread_buffers_lock);
+    ThreadBuffer** to_check = &_thread_buffers;
+
+    while (*to_check != buffer) {
+      assert(*to_check != nullptr, "Must be in the list");
+      to_check = (*to_check)->next_ptr();
+    }
+
+    *to_check = buffer->next();
+    _nr_of_thread_buffers -= 1;
+
+    Locker buffer_locker(buffer->lock());
+    merge_thread_buffer(buffer);
+  }
+
+  buffer->~ThreadBuffer();
+  real_malloc_funcs->free(buffer);
+}
+
+// Must be called with the lock of the buffer held.
+void MallocStatisticImpl::merge_thread_buffer(ThreadBuffer* buffer) {
+  uint32_t tail = buffer->tail();
+  uint32_t head = buffer->head();
+
+  if (tail == head) {
+    return;
+  }
+
+  // Collect the affected stack maps first, so we lock each only once.
+  uint32_t used_maps = 0;
+
+  for (uint32_t pos = tail; pos != head; ++pos) {
+    used_maps |= 1 << (buffer->at(pos)->_hash & (NR_OF_STACK_MAPS - 1));
+  }
+
+  for (int idx = 0; idx < NR_OF_STACK_MAPS; ++idx) {
+    if ((used_maps & (1 << idx)) == 0) {
+      continue;
+    }
+
+    Locker locker(&_stack_maps_data[idx]._lock);
+
+    if (!_enabled) {
+      break;
+    }
+
+    for (uint32_t pos = tail; pos != head; ++pos) {
+      BufferedAllocation* entry = buffer->at(pos);
+
+      // Skip allocations recorded for a previous trace.
+      if (((int) (entry->_hash & (NR_OF_STACK_MAPS - 1)) == idx) &&
+          (entry->_enable_count == _enable_count)) {
+        add_to_stack_map(idx, entry->_hash, entry->_size, entry->_nr_of_frames, entry->_frames);
+      }
+    }
+  }
+
+  buffer->set_tail(head);
+}
+
+void MallocStatisticImpl::merge_thread_buffers() {
+  Locker locker(&_thread_buffers_lock);
+
+  for (ThreadBuffer* buffer = _thread_buffers; buffer != nullptr; buffer = buffer->next()) {
+    Locker buffer_locker(buffer->lock());
+    merge_thread_buffer(buffer);
+  }
+}
+
 void MallocStatisticImpl::record_allocation(void* ptr, uint64_t hash, int nr_of_frames, address* frames) {
   // Use the size that the malloc implementation used, since we don't store
   // the size and have to account for it later in realloc/free.
@@ -1463,7 +1878,10 @@ StatEntry* MallocStatisticImpl::record_free(void* ptr, uint64_t hash, size_t siz
       // races when changing the size and count fields.
       int idx2 = (int) (stat_entry->hash() & (NR_OF_STACK_MAPS - 1));
       Locker locker2(&_stack_maps_data[idx2]._lock);
-      stat_entry->remove_allocation(size);
+      uint64_t scaled_size;
+      uint64_t scaled_count;
+      scale_sample(size, &scaled_size, &scaled_count);
+      stat_entry->remove_allocation(scaled_size, scaled_count);
 
       return stat_entry;
     }
@@ -1526,6 +1944,18 @@ void MallocStatisticImpl::initialize() {
     fatal("Could not initialize malloc suspend key");
   }
 
+  if (pthread_key_create(&_bytes_until_sample_key, nullptr) != 0) {
+    fatal("Could not initialize sample key");
+  }
+
+  if (pthread_key_create(&_thread_buffer_key, thread_buffer_destructor) != 0) {
+    fatal("Could not initialize thread buffer key");
+  }
+
+  if (pthread_mutex_init(&_thread_buffers_lock, nullptr) != 0) {
+    fatal("Could not initialize thread buffers lock");
+  }
+
   for (int i = 0; i < NR_OF_STACK_MAPS; ++i) {
     if (pthread_mutex_init(&_stack_maps_data[i]._lock, nullptr) != 0) {
       fatal("Could not initialize stack maps lock");
@@ -1625,6 +2055,19 @@ bool MallocStatisticImpl::enable(outputStream* st, TraceSpec const& spec) {
     st->print_raw_cr("Collecting detailed statistics.");
   }
 
+  if ((spec._sample_interval > 0) && (spec._only_nth > 1)) {
+    st->print_raw_cr("Sampling by bytes cannot be combined with only tracking every n'th allocation.");
+
+    return false;
+  }
+
+  _sample_interval = spec._sample_interval;
+  _sample_seed = ((uint64_t) os::javaTimeNanos()) | 1;
+
+  if (_sample_interval > 0) {
+    st->print_cr("Sampling about every " UINT64_FORMAT " bytes allocated per thread.", _sample_interval);
+  }
+
   int only_nth = MIN2(1000, MAX2(1, spec._only_nth));
 
   if (only_nth > 1) {
@@ -1655,6 +2098,12 @@ bool MallocStatisticImpl::enable(outputStream* st, TraceSpec const& spec) {
     st->print_raw_cr("Using fallback mechanism to sample stacks.");
   }
 
+#if defined(HAS_FAST_FRAME_WALK)
+  if (!_use_backtrace) {
+    st->print_raw_cr("Walking frame pointers directly for threads with known stack bounds.");
+  }
+#endif
+
   _max_frames = spec._stack_depth;
 
   if (!setup_hooks(&_malloc_stat_hooks, st)) {
@@ -2038,12 +2487,24 @@ bool MallocStatisticImpl::dump(outputStream* msg_stream, outputStream* dump_stre
     dump_stream->print_raw_cr("Contains every allocation done since enabling.");
   }
 
+  if (_sample_interval > 0) {
+    dump_stream->print_cr("Allocations were sampled about every " UINT64_FORMAT " bytes per thread, " \
+                          "sizes and counts are estimated from the samples.", _sample_interval);
+  }
+
   bool uses_filter = is_non_empty_string(spec._filter);
 
   if (uses_filter) {
     dump_stream->print_cr("Only printing stacks in which frames contain '%s'.", spec._filter);
   }
 
+  // Make the allocations still buffered by the threads visible. We skip this
+  // on error, since the crashing thread might hold one of the locks. This
+  // only loses the last few allocations of each thread.
+  if (!spec._on_error) {
+    merge_thread_buffers();
+  }
+
   // We make a copy of each hash map, since we don't want to lock for the whole operation.
   StatEntryCopy* entries[NR_OF_STACK_MAPS];
   int nr_of_entries[NR_OF_STACK_MAPS];
@@ -2278,6 +2739,15 @@ bool MallocStatisticImpl::dump(outputStream* msg_stream, outputStream* dump_stre
     print_allocation_stats(msg_stream, (HashMapData<void*>*) _stack_maps_data,
                            NR_OF_STACK_MAPS, "stack maps");
 
+    if (!_track_free) {
+      msg_stream->cr();
+      msg_stream->print_raw_cr("Statistic for thread buffers:");
+      msg_stream->print_cr("Nr. of buffers  : %'d", _nr_of_thread_buffers);
+      msg_stream->print_raw("Allocated memory: ");
+      print_mem(msg_stream, (uint64_t) _nr_of_thread_buffers * sizeof(ThreadBuffer));
+      msg_stream->cr();
+    }
+
     if (_track_free) {
       print_allocation_stats(msg_stream, (HashMapData<void*>*) _alloc_maps_data,
                              NR_OF_ALLOC_MAPS, "alloc maps");
@@ -2413,6 +2883,7 @@ void enable_from_flags() {
   spec._only_nth = (int) MallocTraceOnlyNth;
   spec._track_free = MallocTraceTrackFree;
   spec._detailed_stats = MallocTraceDetailedStats;
+  spec._sample_interval = (size_t) MallocTraceSampleInterval;
 
   if (MallocTraceDumpOnError) {
     spec._rainy_day_fund = (int) MallocTraceRainyDayFund;
@@ -2448,6 +2919,21 @@ void MallocTraceEnablePeriodicTask::task() {
   disenroll();
 }
 
+// Merges the allocations buffered by the threads into the stack maps.
+class MallocTraceMergePeriodicTask : public PeriodicTask {
+
+public:
+  MallocTraceMergePeriodicTask() :
+    PeriodicTask(THREAD_BUFFER_MERGE_INTERVAL) {
+  }
+
+  virtual void task();
+};
+
+void MallocTraceMergePeriodicTask::task() {
+  MallocStatisticImpl::merge_thread_buffers();
+}
+
 } // namespace mallocStatImpl
 
 void MallocStatistic::initialize() {
@@ -2461,6 +2947,13 @@ void MallocStatistic::initialize() {
 
   mallocStatImpl::MallocStatisticImpl::initialize();
 
+  // Only use the merge task if we are likely to trace at all. Otherwise the
+  // buffers are still merged when the owning thread fills them or on dumping.
+  if (UseMallocHooks || MallocTraceAtStartup) {
+    mallocStatImpl::MallocTraceMergePeriodicTask* task = new mallocStatImpl::MallocTraceMergePeriodicTask();
+    task->enroll();
+  }
+
   if (MallocTraceAtStartup) {
 #define CHECK_TIMESPAN_ARG(argument) \
     char const* error_##argument; \
@@ -2553,13 +3046,17 @@ MallocTraceEnableDCmd::MallocTraceEnableDCmd(outputStream* output, bool heap) :
               "and not just the total allocated amount. This costs some performance and memory.",
               "BOOLEAN", false, "false"),
   _detailed_stats("-detailed-stats", "Collect more detailed statistics. This will costs some " \
-                  "CPU time, but no memory.", "BOOLEAN", false, "false") {
+                  "CPU time, but no memory.", "BOOLEAN", false, "false"),
+  _sample_interval("-sample-interval", "If > 0 each thread only records about one allocation " \
+                   "per the given number of bytes allocated. The dump then shows estimated " \
+                   "sizes and counts.", "INT", false, "0") {
   _dcmdparser.add_dcmd_option(&_stack_depth);
   _dcmdparser.add_dcmd_option(&_use_backtrace);
   _dcmdparser.add_dcmd_option(&_only_nth);
   _dcmdparser.add_dcmd_option(&_force);
   _dcmdparser.add_dcmd_option(&_track_free);
   _dcmdparser.add_dcmd_option(&_detailed_stats);
+  _dcmdparser.add_dcmd_option(&_sample_interval);
 }
 
 void MallocTraceEnableDCmd::execute(DCmdSource source, TRAPS) {
@@ -2573,6 +3070,7 @@ void MallocTraceEnableDCmd::execute(DCmdSource source, TRAPS) {
   spec._force = _force.value();
   spec._track_free = _track_free.value();
   spec._detailed_stats = _detailed_stats.value();
+  spec._sample_interval = (size_t) MAX2((jlong) 0, _sample_interval.value());
 
   if (MallocStatistic::enable(_output, spec)) {
     _output->print_raw_cr("Malloc statistic enabled");
@@ -43,6 +43,7 @@ struct TraceSpec {
   bool _track_free;
   bool _detailed_stats;
   int _rainy_day_fund;
+  size_t _sample_interval;
 
   TraceSpec() :
     _stack_depth(10),
@@ -51,7 +52,8 @@ struct TraceSpec {
     _force(false),
     _track_free(false),
     _detailed_stats(false),
-    _rainy_day_fund(0) {
+    _rainy_day_fund(0),
+    _sample_interval(0) {
   }
 };
 
@@ -111,10 +113,11 @@ class MallocTraceEnableDCmd : public DCmdWithParser {
   DCmdArgument<bool>  _force;
   DCmdArgument<bool>  _track_free;
   DCmdArgument<bool>  _detailed_stats;
+  DCmdArgument<jlong> _sample_interval;
 
 public:
   static int num_arguments() {
-    return 6;
+    return 7;
   }
 
   MallocTraceEnableDCmd(outputStream* output, bool heap);
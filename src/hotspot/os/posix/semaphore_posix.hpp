@@ -50,6 +50,9 @@ class PosixSemaphore : public CHeapObj<mtInternal> {
   bool timedwait(int64_t millis);
 };
 
+// Linux uses the futex based LinuxSemaphore as its Semaphore implementation.
+#ifndef LINUX
 typedef PosixSemaphore SemaphoreImpl;
+#endif
 
 #endif // OS_POSIX_SEMAPHORE_POSIX_HPP
@@ -40,6 +40,7 @@
 #include "runtime/semaphore.inline.hpp"
 #include "runtime/suspendedThreadTask.hpp"
 #include "runtime/threadCrashProtection.hpp"
+#include "semaphore_posix.hpp"
 #include "signals_posix.hpp"
 #include "suspendResume_posix.hpp"
 #include "utilities/checkedCast.hpp"
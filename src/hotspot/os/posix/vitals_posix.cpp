@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 SAP SE. All rights reserved.
+ *
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "logging/log.hpp"
+#include "runtime/os.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "vitals/vitals_internals.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sapmachine_vitals {
+
+void* platform_create_shared_file_mapping(const char* name, size_t size) {
+  const int fd = os::open(name, O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (fd == -1) {
+    log_warning(vitals)("Failed to create vitals history file %s (%s)", name, os::strerror(errno));
+    return NULL;
+  }
+  void* p = NULL;
+  if (::ftruncate(fd, (off_t)size) == 0) {
+    p = ::mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+      p = NULL;
+    }
+  }
+  if (p == NULL) {
+    log_warning(vitals)("Failed to map vitals history file %s (%s)", name, os::strerror(errno));
+  }
+  ::close(fd);
+  return p;
+}
+
+const void* platform_map_file_readonly(const char* name, size_t* size) {
+  const int fd = os::open(name, O_RDONLY, 0);
+  if (fd == -1) {
+    return NULL;
+  }
+  void* p = NULL;
+  struct stat st;
+  if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+    p = ::mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+      p = NULL;
+    } else {
+      *size = (size_t)st.st_size;
+    }
+  }
+  ::close(fd);
+  return p;
+}
+
+void platform_unmap_file(const void* p, size_t size) {
+  ::munmap(const_cast<void*>(p), size);
+}
+
+} // namespace sapmachine_vitals
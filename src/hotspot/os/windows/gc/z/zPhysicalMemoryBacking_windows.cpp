@@ -251,3 +251,7 @@ void ZPhysicalMemoryBacking::unmap(zaddress_unsafe addr, size_t size) const {
 
   _impl->unmap(addr, size);
 }
+
+void ZPhysicalMemoryBacking::threads_do(ThreadClosure* tc) const {
+  // Does nothing
+}
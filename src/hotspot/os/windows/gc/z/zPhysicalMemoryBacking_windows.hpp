@@ -29,6 +29,7 @@
 
 #include <Windows.h>
 
+class ThreadClosure;
 class ZPhysicalMemoryBackingImpl;
 
 class ZPhysicalMemoryBacking {
@@ -47,6 +48,8 @@ class ZPhysicalMemoryBacking {
 
   void map(zaddress_unsafe addr, size_t size, zoffset offset) const;
   void unmap(zaddress_unsafe addr, size_t size) const;
+
+  void threads_do(ThreadClosure* tc) const;
 };
 
 #endif // OS_WINDOWS_GC_Z_ZPHYSICALMEMORYBACKING_WINDOWS_HPP
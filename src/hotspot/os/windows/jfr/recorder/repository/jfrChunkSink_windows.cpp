@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/recorder/repository/jfrChunkSink.hpp"
+#include "runtime/os.hpp"
+
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+
+// There are no non-blocking writes to files or named pipes through the C
+// runtime, so writes to the sink block until they complete or fail.
+int JfrChunkSink::open(const char* path, bool* no_reader) {
+  *no_reader = false;
+  return os::open(path, O_WRONLY | O_APPEND | O_CREAT | O_BINARY, S_IREAD | S_IWRITE);
+}
+
+JfrChunkSink::WriteResult JfrChunkSink::write(int sink_fd, const char* data, size_t size, bool* started, int stall_timeout_ms) {
+  if (os::write(sink_fd, data, size)) {
+    *started = true;
+    return WRITTEN;
+  }
+  // Part of the data may have been written, so the sink stream cannot be
+  // trusted any more.
+  return TRUNCATED;
+}
+
+void JfrChunkSink::close(int fd) {
+  ::close(fd);
+}
@@ -877,6 +877,10 @@ size_t os::rss() {
   return rss;
 }
 
+size_t os::malloc_usable_size(void* p) {
+  return ::_msize(p);
+}
+
 bool os::has_allocatable_memory_limit(size_t* limit) {
   MEMORYSTATUSEX ms;
   ms.dwLength = sizeof(ms);
@@ -3745,6 +3749,7 @@ bool os::unguard_memory(char* addr, size_t bytes) {
 
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) { }
 void os::pd_disclaim_memory(char *addr, size_t bytes) { }
+void os::pd_disclaim_memory_lazily(char *addr, size_t bytes) { }
 
 size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
   return page_size;
@@ -58,6 +58,10 @@ bool platform_columns_initialize() {
   return true;
 }
 
+const Column* platform_rss_column() {
+  return g_col_process_working_set_size;
+}
+
 static void set_value_in_sample(Column* col, Sample* sample, value_t val) {
   if (col != NULL) {
     int index = col->index();
@@ -83,4 +87,17 @@ void sample_platform_values(Sample* sample) {
 
 }
 
+// The vitals history file (-XX:VitalsHistoryFile) is not supported on Windows.
+void* platform_create_shared_file_mapping(const char* name, size_t size) {
+  return NULL;
+}
+
+const void* platform_map_file_readonly(const char* name, size_t* size) {
+  return NULL;
+}
+
+void platform_unmap_file(const void* p, size_t size) {
+  ShouldNotReachHere();
+}
+
 } // namespace sapmachine_vitals
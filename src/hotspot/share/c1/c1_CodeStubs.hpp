@@ -127,6 +127,40 @@ class CounterOverflowStub: public CodeStub {
 
 };
 
+// Slow path of a sampled profile update (C1ProfileSampleRate > 1): resets
+// the thread's sample countdown and adds the scaled increment to the
+// profile counter. Keeping the update out of line means the register
+// allocator never places moves in code that is skipped at runtime.
+class ProfileSampleStub: public CodeStub {
+ private:
+  LIR_Opr _counter_addr;
+  LIR_Opr _countdown_addr;
+  LIR_Opr _counter_tmp;
+  LIR_Opr _countdown_tmp;
+  int     _increment;
+  int     _sample_rate;
+
+ public:
+  ProfileSampleStub(LIR_Address* counter_addr, LIR_Address* countdown_addr,
+                    LIR_Opr counter_tmp, LIR_Opr countdown_tmp, int increment, int sample_rate) :
+    _counter_addr(LIR_OprFact::address(counter_addr)), _countdown_addr(LIR_OprFact::address(countdown_addr)),
+    _counter_tmp(counter_tmp), _countdown_tmp(countdown_tmp), _increment(increment), _sample_rate(sample_rate) {}
+
+  virtual void emit_code(LIR_Assembler* e);
+
+  virtual void visit(LIR_OpVisitState* visitor) {
+    visitor->do_slow_case();
+    visitor->do_input(_counter_addr);
+    visitor->do_input(_countdown_addr);
+    visitor->do_temp(_counter_tmp);
+    visitor->do_temp(_countdown_tmp);
+  }
+
+#ifndef PRODUCT
+  virtual void print_name(outputStream* out) const { out->print("ProfileSampleStub"); }
+#endif // PRODUCT
+};
+
 class ConversionStub: public CodeStub {
  private:
   Bytecodes::Code _bytecode;
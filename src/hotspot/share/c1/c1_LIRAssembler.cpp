@@ -156,6 +156,19 @@ void LIR_Assembler::emit_stubs(CodeStubList* stub_list) {
   }
 }
 
+// Only uses LIR_Assembler primitives, so unlike the other stubs it needs no
+// platform-specific version.
+void ProfileSampleStub::emit_code(LIR_Assembler* ce) {
+  ce->masm()->bind(_entry);
+  ce->move_op(LIR_OprFact::intConst(_sample_rate), _countdown_tmp, T_INT, lir_patch_none, nullptr, false, false);
+  ce->move_op(_countdown_tmp, _countdown_addr, T_INT, lir_patch_none, nullptr, false, false);
+  ce->move_op(_counter_addr, _counter_tmp, _counter_tmp->type(), lir_patch_none, nullptr, false, false);
+  LIR_Address* incremented = new LIR_Address(_counter_tmp, _increment, T_INT);
+  ce->leal(LIR_OprFact::address(incremented), _counter_tmp);
+  ce->move_op(_counter_tmp, _counter_addr, _counter_tmp->type(), lir_patch_none, nullptr, false, false);
+  ce->emit_opBranch(new LIR_OpBranch(lir_cond_always, &_continuation));
+}
+
 
 void LIR_Assembler::emit_slow_case_stubs() {
   emit_stubs(_slow_case_stubs);
@@ -922,7 +922,34 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
-void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
+// With C1ProfileSampleRate > 1, only every Nth execution of a sampled profile
+// update is performed, counted down in a thread-local counter, and it adds N
+// times the normal increment. This keeps the ratios seen by C2 while writing
+// the shared MethodData far less often.
+int LIRGenerator::profile_counter_increment() const {
+  return DataLayout::counter_increment * (int)C1ProfileSampleRate;
+}
+
+// The countdown is decremented inline and the counter update itself is done
+// in a ProfileSampleStub, so no operands are live only in skipped code.
+// Kills the condition codes.
+void LIRGenerator::sampled_profile_update(LIR_Address* counter_addr) {
+  assert(C1ProfileSampleRate > 1, "updates are not sampled");
+  LIR_Address* countdown_addr = new LIR_Address(getThreadPointer(),
+                                                in_bytes(JavaThread::profile_sample_countdown_offset()), T_INT);
+  LIR_Opr countdown = new_register(T_INT);
+  __ move(countdown_addr, countdown);
+  __ sub(countdown, LIR_OprFact::intConst(1), countdown);
+  __ move(countdown, countdown_addr);
+  CodeStub* stub = new ProfileSampleStub(counter_addr, countdown_addr,
+                                         new_register(counter_addr->type()), new_register(T_INT),
+                                         profile_counter_increment(), (int)C1ProfileSampleRate);
+  __ cmp(lir_cond_lessEqual, countdown, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_lessEqual, stub);
+  __ branch_destination(stub->continuation());
+}
+
+void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != nullptr, "method should be set if branch is profiled");
@@ -951,11 +978,17 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
     // MDO cells are intptr_t, so the data_reg width is arch-dependent.
     LIR_Opr data_reg = new_pointer_register();
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
-    __ move(data_addr, data_reg);
-    // Use leal instead of add to avoid destroying condition codes on x86
-    LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment, T_INT);
-    __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
-    __ move(data_reg, data_addr);
+    if (C1ProfileSampleRate > 1 && left->is_valid()) {
+      sampled_profile_update(data_addr);
+      // The sampling test needs the compare to be redone for the branch.
+      __ cmp(lir_cond(cond), left, right);
+    } else {
+      __ move(data_addr, data_reg);
+      // Use leal instead of add to avoid destroying condition codes on x86
+      LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment, T_INT);
+      __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
+      __ move(data_reg, data_addr);
+    }
   }
 }
 
@@ -2477,8 +2510,12 @@ void LIRGenerator::do_Goto(Goto* x) {
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
-    increment_counter(new LIR_Address(md_reg, offset,
-                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+    LIR_Address* counter_addr = new LIR_Address(md_reg, offset, NOT_LP64(T_INT) LP64_ONLY(T_LONG));
+    if (C1ProfileSampleRate > 1) {
+      sampled_profile_update(counter_addr);
+    } else {
+      increment_counter(counter_addr, DataLayout::counter_increment);
+    }
   }
 
   // emit phi-instruction move after safepoint since this simplifies
@@ -398,7 +398,12 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
 
   LIR_Opr safepoint_poll_register();
 
-  void profile_branch(If* if_instr, If::Condition cond);
+  // Passing the operands of the compare allows the update to be sampled,
+  // the compare is then redone after the update.
+  void profile_branch(If* if_instr, If::Condition cond,
+                      LIR_Opr left = LIR_OprFact::illegalOpr, LIR_Opr right = LIR_OprFact::illegalOpr);
+  void sampled_profile_update(LIR_Address* counter_addr);
+  int profile_counter_increment() const;
   void increment_event_counter_impl(CodeEmitInfo* info,
                                     ciMethod *method, LIR_Opr step, int frequency,
                                     int bci, bool backedge, bool notify);
@@ -86,6 +86,7 @@ LinearScan::LinearScan(IR* ir, LIRGenerator* gen, FrameMap* frame_map)
  , _new_intervals_from_allocation(nullptr)
  , _sorted_intervals(nullptr)
  , _needs_full_resort(false)
+ , _fast_mode(C1FastLinearScanBlockLimit > 0 && ir->linear_scan_order()->length() > C1FastLinearScanBlockLimit)
  , _lir_ops(0)     // initialized later with correct length
  , _block_of_op(0) // initialized later with correct length
  , _has_info(0)
@@ -3138,7 +3139,8 @@ void LinearScan::do_linear_scan() {
 #ifndef RISCV
   // Disable these optimizations on riscv temporarily, because it does not
   // work when the comparison operands are bound to branches or cmoves.
-  { TIME_LINEAR_SCAN(timer_optimize_lir);
+  if (!fast_mode()) {
+    TIME_LINEAR_SCAN(timer_optimize_lir);
 
     EdgeMoveOptimizer::optimize(ir()->code());
     ControlFlowOptimizer::optimize(ir()->code());
@@ -5145,6 +5147,11 @@ int LinearScanWalker::find_optimal_split_pos(Interval* it, int min_split_pos, in
     TRACE_LINEAR_SCAN(4, tty->print_cr("      min-pos and max-pos are equal, no optimization possible"));
     optimal_split_pos = min_split_pos;
 
+  } else if (allocator()->fast_mode()) {
+    // searching the blocks in between is too expensive for huge methods
+    TRACE_LINEAR_SCAN(4, tty->print_cr("      fast mode, splitting at max_split_pos"));
+    optimal_split_pos = max_split_pos;
+
   } else {
     assert(min_split_pos < max_split_pos, "must be true then");
     assert(min_split_pos > 0, "cannot access min_split_pos - 1 otherwise");
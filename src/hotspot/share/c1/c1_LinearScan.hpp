@@ -139,6 +139,7 @@ class LinearScan : public CompilationResourceObj {
   IntervalList*             _new_intervals_from_allocation; // list with all intervals created during allocation when an existing interval is split
   IntervalArray*            _sorted_intervals;  // intervals sorted by Interval::from()
   bool                      _needs_full_resort; // set to true if an Interval::from() is changed and _sorted_intervals must be resorted
+  bool                      _fast_mode;         // true for huge methods: split intervals as late as possible and skip the LIR optimizations
 
   LIR_OpArray               _lir_ops;           // mapping from LIR_Op id to LIR_Op node
   BlockBeginArray           _block_of_op;       // mapping from LIR_Op id to the BlockBegin containing this instruction
@@ -176,6 +177,7 @@ class LinearScan : public CompilationResourceObj {
   bool          has_fpu_registers() const        { return _has_fpu_registers; }
   int           num_loops() const                { return ir()->num_loops(); }
   bool          is_interval_in_loop(int interval, int loop) const { return _interval_in_loop.at(interval, loop); }
+  bool          fast_mode() const                { return _fast_mode; }
 
   // handling of fpu stack allocation (platform dependent, needed for debug information generation)
 #ifdef IA32
@@ -218,6 +218,13 @@
   develop(bool, CountLinearScan, false,                                     \
           "collect statistic counters during LinearScan")                   \
                                                                             \
+  product(intx, C1FastLinearScanBlockLimit, 2000,                           \
+          "Number of blocks above which LinearScan splits intervals as "    \
+          "late as possible and skips the LIR optimizations after "         \
+          "allocation, to reduce compile time of huge methods. "            \
+          "0 disables the fast mode")                                       \
+          range(0, max_jint)                                                \
+                                                                            \
   /* C1 variable */                                                         \
                                                                             \
   develop(bool, C1Breakpoint, false,                                        \
@@ -305,6 +312,12 @@
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
+  product(intx, C1ProfileSampleRate, 1, EXPERIMENTAL,                       \
+          "Update branch profiles in Tier 3 C1 generated code only once "   \
+          "every N executions, adding N times the increment; 1 updates "    \
+          "them every time")                                                \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, C1ProfileCheckcasts, true,                                  \
           "Profile checkcasts when generating code for updating MDOs")      \
                                                                             \
@@ -442,6 +442,40 @@ bool AOTConstantPoolResolver::check_lambda_metafactory_methodhandle_arg(Constant
   return check_methodtype_signature(cp, sig);
 }
 
+static bool is_string_concat_bsm(Symbol* bsm_klass, Symbol* bsm_name, Symbol* bsm_signature) {
+  return bsm_klass->equals("java/lang/invoke/StringConcatFactory") &&
+         bsm_name->equals("makeConcatWithConstants") &&
+         bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
+                                "Ljava/lang/String;"
+                                "Ljava/lang/invoke/MethodType;"
+                                "Ljava/lang/String;"
+                                "[Ljava/lang/Object;"
+                               ")Ljava/lang/invoke/CallSite;");
+}
+
+static bool is_lambda_metafactory_bsm(Symbol* bsm_klass, Symbol* bsm_name, Symbol* bsm_signature) {
+  return bsm_klass->equals("java/lang/invoke/LambdaMetafactory") &&
+         bsm_name->equals("metafactory") &&
+         bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
+                                "Ljava/lang/String;"
+                                "Ljava/lang/invoke/MethodType;"
+                                "Ljava/lang/invoke/MethodType;"
+                                "Ljava/lang/invoke/MethodHandle;"
+                                "Ljava/lang/invoke/MethodType;"
+                               ")Ljava/lang/invoke/CallSite;");
+}
+
+bool AOTConstantPoolResolver::is_supported_indy_bootstrap(ConstantPool* cp, int cp_index) {
+  assert(cp->tag_at(cp_index).is_invoke_dynamic(), "sanity");
+  int bsm = cp->bootstrap_method_ref_index_at(cp_index);
+  int bsm_ref = cp->method_handle_index_at(bsm);
+  Symbol* bsm_name = cp->uncached_name_ref_at(bsm_ref);
+  Symbol* bsm_signature = cp->uncached_signature_ref_at(bsm_ref);
+  Symbol* bsm_klass = cp->klass_name_at(cp->uncached_klass_ref_index_at(bsm_ref));
+  return is_string_concat_bsm(bsm_klass, bsm_name, bsm_signature) ||
+         is_lambda_metafactory_bsm(bsm_klass, bsm_name, bsm_signature);
+}
+
 bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp, int cp_index) {
   assert(cp->tag_at(cp_index).is_invoke_dynamic(), "sanity");
   if (!CDSConfig::is_dumping_invokedynamic()) {
@@ -463,14 +497,7 @@ bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp,
   // We should mark the allowed BSMs in the JDK code using a private annotation.
   // See notes on RFE JDK-8342481.
 
-  if (bsm_klass->equals("java/lang/invoke/StringConcatFactory") &&
-      bsm_name->equals("makeConcatWithConstants") &&
-      bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
-                             "Ljava/lang/String;"
-                             "Ljava/lang/invoke/MethodType;"
-                             "Ljava/lang/String;"
-                             "[Ljava/lang/Object;"
-                            ")Ljava/lang/invoke/CallSite;")) {
+  if (is_string_concat_bsm(bsm_klass, bsm_name, bsm_signature)) {
     Symbol* factory_type_sig = cp->uncached_signature_ref_at(cp_index);
     if (log_is_enabled(Debug, cds, resolve)) {
       ResourceMark rm;
@@ -489,15 +516,7 @@ bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp,
     return true;
   }
 
-  if (bsm_klass->equals("java/lang/invoke/LambdaMetafactory") &&
-      bsm_name->equals("metafactory") &&
-      bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
-                             "Ljava/lang/String;"
-                             "Ljava/lang/invoke/MethodType;"
-                             "Ljava/lang/invoke/MethodType;"
-                             "Ljava/lang/invoke/MethodHandle;"
-                             "Ljava/lang/invoke/MethodType;"
-                            ")Ljava/lang/invoke/CallSite;")) {
+  if (is_lambda_metafactory_bsm(bsm_klass, bsm_name, bsm_signature)) {
     /*
      * An indy callsite is associated with the following MethodType and MethodHandles:
      *
@@ -93,6 +93,9 @@ class AOTConstantPoolResolver :  AllStatic {
   static void dumptime_resolve_constants(InstanceKlass* ik, TRAPS);
 
   static bool is_resolution_deterministic(ConstantPool* cp, int cp_index);
+
+  // Is the bootstrap method of this indy one whose call sites can be archived at all?
+  static bool is_supported_indy_bootstrap(ConstantPool* cp, int cp_index);
 };
 
 #endif // SHARE_CDS_AOTCONSTANTPOOLRESOLVER_HPP
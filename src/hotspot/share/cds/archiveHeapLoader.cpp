@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "cds/archiveHeapLoader.inline.hpp"
+#include "cds/archiveUtils.hpp"
 #include "cds/cdsConfig.hpp"
 #include "cds/heapShared.hpp"
 #include "cds/metaspaceShared.hpp"
@@ -34,6 +35,7 @@
 #include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "runtime/timer.hpp"
 #include "sanitizers/ub.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/copy.hpp"
@@ -290,6 +292,41 @@ bool ArchiveHeapLoader::init_loaded_region(FileMapInfo* mapinfo, LoadedArchiveHe
   return true;
 }
 
+// Patches the embedded pointers of a loaded region, with each worker taking
+// a slice of the oopmap. The patchers keep no mutable state, so one instance
+// is shared by all workers.
+template <typename PatcherType>
+class LoadedRegionPatchingTask : public ArchiveWorkerTask {
+private:
+  BitMapView* const _bm;
+  PatcherType* const _patcher;
+
+public:
+  LoadedRegionPatchingTask(BitMapView* bm, PatcherType* patcher) :
+                           ArchiveWorkerTask("Loaded Heap Region Patching"),
+                           _bm(bm), _patcher(patcher) {}
+
+  void work(int chunk, int max_chunks) override {
+    BitMap::idx_t size  = _bm->size();
+    BitMap::idx_t start = MIN2(size, size * chunk / max_chunks);
+    BitMap::idx_t end   = MIN2(size, size * (chunk + 1) / max_chunks);
+    if (start < end) {
+      _bm->iterate(_patcher, start, end);
+    }
+  }
+};
+
+template <typename PatcherType>
+static void patch_loaded_region(BitMapView* bm, PatcherType* patcher) {
+  if (AOTCacheParallelRelocation) {
+    ArchiveWorkers workers;
+    LoadedRegionPatchingTask<PatcherType> task(bm, patcher);
+    workers.run_task(&task);
+  } else {
+    bm->iterate(patcher);
+  }
+}
+
 bool ArchiveHeapLoader::load_heap_region_impl(FileMapInfo* mapinfo, LoadedArchiveHeapRegion* loaded_region,
                                               uintptr_t load_address) {
   uintptr_t bitmap_base = (uintptr_t)mapinfo->map_bitmap_region();
@@ -315,13 +352,18 @@ bool ArchiveHeapLoader::load_heap_region_impl(FileMapInfo* mapinfo, LoadedArchiv
   uintptr_t oopmap = bitmap_base + r->oopmap_offset();
   BitMapView bm((BitMap::bm_word_t*)oopmap, r->oopmap_size_in_bits());
 
+  elapsedTimer patch_timer;
+  patch_timer.start();
   if (UseCompressedOops) {
     PatchLoadedRegionPointers patcher((narrowOop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos(), loaded_region);
-    bm.iterate(&patcher);
+    patch_loaded_region(&bm, &patcher);
   } else {
     PatchUncompressedEmbeddedPointers patcher((oop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos(), loaded_region->_runtime_offset);
-    bm.iterate(&patcher);
+    patch_loaded_region(&bm, &patcher);
   }
+  patch_timer.stop();
+  log_info(cds, reloc)("Patched loaded heap region in %.3f ms (%s)", patch_timer.seconds() * 1000.0,
+                       AOTCacheParallelRelocation ? "parallel" : "serial");
   return true;
 }
 
@@ -66,6 +66,12 @@
   product(bool, AllowArchivingWithJavaAgent, false, DIAGNOSTIC,             \
           "Allow Java agent to be run with CDS dumping")                    \
                                                                             \
+  product(size_t, ArchiveCompressionEstimateBlockSize, 0, DIAGNOSTIC,       \
+          "If non-zero, report at dump time how well each archive "         \
+          "region would compress when split into independently "            \
+          "compressed blocks of this many bytes. 0 means off")              \
+          range(0, 64*M)                                                    \
+                                                                            \
   develop(ccstr, ArchiveHeapTestClass, nullptr,                             \
           "For JVM internal testing only. The static field named "          \
           "\"archivedObjects\" of the specified class is stored in the "    \
@@ -121,6 +127,11 @@
   product(bool, AOTCacheParallelRelocation, true, DIAGNOSTIC,               \
           "Use parallel relocation code to speed up startup.")              \
                                                                             \
+  product(bool, ArchiveHotMethodHints, false, DIAGNOSTIC,                   \
+          "Record methods compiled at full optimization while dumping "     \
+          "the archive, and start profiling them without waiting for "      \
+          "the interpreter thresholds when the archive is used")            \
+                                                                            \
 // end of CDS_FLAGS
 
 DECLARE_FLAGS(CDS_FLAGS)
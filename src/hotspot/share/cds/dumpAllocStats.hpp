@@ -71,6 +71,7 @@ class DumpAllocStats : public StackObj {
   int _num_indy_cp_entries;
   int _num_indy_cp_entries_archived;
   int _num_indy_cp_entries_reverted;
+  int _num_indy_cp_entries_unsupported_bsm;
   int _num_klass_cp_entries;
   int _num_klass_cp_entries_archived;
   int _num_klass_cp_entries_reverted;
@@ -90,6 +91,7 @@ class DumpAllocStats : public StackObj {
     _num_indy_cp_entries            = 0;
     _num_indy_cp_entries_archived   = 0;
     _num_indy_cp_entries_reverted   = 0;
+    _num_indy_cp_entries_unsupported_bsm = 0;
     _num_klass_cp_entries           = 0;
     _num_klass_cp_entries_archived  = 0;
     _num_klass_cp_entries_reverted  = 0;
@@ -128,10 +130,11 @@ class DumpAllocStats : public StackObj {
     _num_field_cp_entries_reverted += reverted ? 1 : 0;
   }
 
-  void record_indy_cp_entry(bool archived, bool reverted) {
+  void record_indy_cp_entry(bool archived, bool reverted, bool unsupported_bsm) {
     _num_indy_cp_entries ++;
     _num_indy_cp_entries_archived += archived ? 1 : 0;
     _num_indy_cp_entries_reverted += reverted ? 1 : 0;
+    _num_indy_cp_entries_unsupported_bsm += unsupported_bsm ? 1 : 0;
   }
 
   void record_klass_cp_entry(bool archived, bool reverted) {
@@ -67,12 +67,14 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/timer.hpp"
 #include "runtime/vm_version.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/classpathStream.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/zipLibrary.hpp"
 #if INCLUDE_G1GC
 #include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1HeapRegion.hpp"
@@ -1588,6 +1590,43 @@ void FileMapRegion::print(outputStream* st, int region_index) {
   st->print_cr("- mapped_base:                    " INTPTR_FORMAT, p2i(_mapped_base));
 }
 
+// Estimate how much a region would shrink if it were stored as a sequence of
+// independently decompressible blocks of ArchiveCompressionEstimateBlockSize
+// bytes. Only used to evaluate a compressed archive layout; nothing is written.
+static void log_compression_estimate(const char* name, char* base, size_t size) {
+  size_t block_size = MIN2(ArchiveCompressionEstimateBlockSize, size);
+  size_t out_size = 0;
+  size_t tmp_size = 0;
+  const char* msg = ZipLibrary::init_params(block_size, &out_size, &tmp_size, 1);
+  if (msg != nullptr) {
+    log_info(cds)("Cannot estimate compression of region (%s): %s", name, msg);
+    return;
+  }
+  char* out = NEW_C_HEAP_ARRAY(char, out_size, mtClassShared);
+  char* tmp = tmp_size > 0 ? NEW_C_HEAP_ARRAY(char, tmp_size, mtClassShared) : nullptr;
+  size_t compressed = 0;
+  size_t blocks = 0;
+  size_t small_blocks = 0; // blocks that compress to less than a quarter
+  for (size_t offset = 0; offset < size && msg == nullptr; offset += block_size) {
+    size_t in_size = MIN2(block_size, size - offset);
+    size_t c = ZipLibrary::compress(base + offset, in_size, out, out_size, tmp, tmp_size, 1, nullptr, &msg);
+    compressed += c;
+    blocks++;
+    if (c < in_size / 4) {
+      small_blocks++;
+    }
+  }
+  if (msg != nullptr) {
+    log_info(cds)("Cannot estimate compression of region (%s): %s", name, msg);
+  } else {
+    log_info(cds)("Region (%s) compression estimate: " SIZE_FORMAT " -> " SIZE_FORMAT " bytes (%.1f%%) in "
+                  SIZE_FORMAT " blocks of " SIZE_FORMAT " bytes, " SIZE_FORMAT " blocks below 25%%",
+                  name, size, compressed, percent_of(compressed, size), blocks, block_size, small_blocks);
+  }
+  FREE_C_HEAP_ARRAY(char, tmp);
+  FREE_C_HEAP_ARRAY(char, out);
+}
+
 void FileMapInfo::write_region(int region, char* base, size_t size,
                                bool read_only, bool allow_exec) {
   assert(CDSConfig::is_dumping_archive(), "sanity");
@@ -1631,6 +1670,10 @@ void FileMapInfo::write_region(int region, char* base, size_t size,
 
   r->init(region, mapping_offset, size, read_only, allow_exec, crc);
 
+  if (ArchiveCompressionEstimateBlockSize > 0 && base != nullptr && size > 0) {
+    log_compression_estimate(region_name(region), base, size);
+  }
+
   if (base != nullptr) {
     write_bytes_aligned(base, size);
   }
@@ -2049,6 +2092,8 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
     SharedDataRelocator ro_patcher((address*)ro_patch_base + header()->ro_ptrmap_start_pos(), (address*)ro_patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
 
+    elapsedTimer reloc_timer;
+    reloc_timer.start();
     if (AOTCacheParallelRelocation) {
       ArchiveWorkers workers;
       SharedDataRelocationTask task(&rw_ptrmap, &ro_ptrmap, &rw_patcher, &ro_patcher);
@@ -2057,6 +2102,11 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
       rw_ptrmap.iterate(&rw_patcher);
       ro_ptrmap.iterate(&ro_patcher);
     }
+    reloc_timer.stop();
+    log_info(cds, reloc)("Relocated %zu + %zu ptrmap bits (rw + ro) by %zd bytes in %.3f ms (%s)",
+                         rw_ptrmap.size(), ro_ptrmap.size(), addr_delta,
+                         reloc_timer.seconds() * 1000.0,
+                         AOTCacheParallelRelocation ? "parallel" : "serial");
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
@@ -40,6 +40,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "compiler/compileBroker.hpp"
@@ -1494,6 +1495,8 @@ void ClassLoader::initialize(TRAPS) {
   load_java_library();
   // jimage library entry points are loaded below, in lookup_vm_options
   setup_bootstrap_search_path(THREAD);
+
+  VerificationCache::initialize();
 }
 
 static char* lookup_vm_resource(JImageFile *jimage, const char *jimage_version, const char *path) {
@@ -26,6 +26,7 @@
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/classLoaderStats.hpp"
+#include "classfile/dictionary.hpp"
 #include "memory/classLoaderMetaspace.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/oop.inline.hpp"
@@ -79,6 +80,11 @@ void ClassLoaderStatsClosure::do_cld(ClassLoaderData* cld) {
     cls->_hidden_classes_count += csc._num_classes;
   } else {
     cls->_classes_count = csc._num_classes;
+    Dictionary* dictionary = cld->dictionary();
+    if (dictionary != nullptr) {
+      cls->_lookup_hits = dictionary->lookup_hits();
+      cls->_lookup_misses = dictionary->lookup_misses();
+    }
   }
   _total_classes += csc._num_classes;
 
@@ -128,6 +134,13 @@ bool ClassLoaderStatsClosure::do_entry(oop const& key, ClassLoaderStats const& c
         cls._hidden_classes_count,
         cls._hidden_chunk_sz, cls._hidden_block_sz);
   }
+  size_t lookups = cls._lookup_hits + cls._lookup_misses;
+  if (lookups > 0) {
+    _out->print_cr(SPACE SPACE SPACE "                                    %zu hits, %zu misses (%.1f%%)   + resolve lookups",
+        "", "", "",
+        cls._lookup_hits, cls._lookup_misses,
+        percent_of(cls._lookup_hits, lookups));
+  }
   return true;
 }
 
@@ -143,6 +156,9 @@ void ClassLoaderStatsClosure::print() {
       _total_block_sz);
   _out->print_cr("ChunkSz: Total size of all allocated metaspace chunks");
   _out->print_cr("BlockSz: Total size of all allocated metaspace blocks (each chunk has several blocks)");
+  if (CountDictionaryLookups) {
+    _out->print_cr("Resolve lookups: Dictionary probes for classes resolved through this loader, found vs. loaded via the loader");
+  }
 }
 
 
@@ -75,6 +75,9 @@ class ClassLoaderStats : public ResourceObj {
   size_t            _hidden_block_sz;
   uintx             _hidden_classes_count;
 
+  size_t            _lookup_hits;
+  size_t            _lookup_misses;
+
   ClassLoaderStats() :
     _cld(nullptr),
     _class_loader(),
@@ -84,7 +87,9 @@ class ClassLoaderStats : public ResourceObj {
     _classes_count(0),
     _hidden_chunk_sz(0),
     _hidden_block_sz(0),
-    _hidden_classes_count(0) {
+    _hidden_classes_count(0),
+    _lookup_hits(0),
+    _lookup_misses(0) {
   }
 };
 
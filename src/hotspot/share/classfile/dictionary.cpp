@@ -42,7 +42,7 @@ const size_t END_SIZE = 24;
 const size_t REHASH_LEN = 100;
 
 Dictionary::Dictionary(ClassLoaderData* loader_data, size_t table_size)
-  : _number_of_entries(0), _loader_data(loader_data) {
+  : _number_of_entries(0), _loader_data(loader_data), _lookup_hits(0), _lookup_misses(0) {
 
   size_t start_size_log_2 = MAX2(log2i_ceil(table_size), 2); // 2 is minimum size even though some dictionaries only have one entry
   size_t current_size = ((size_t)1) << start_size_log_2;
@@ -25,6 +25,7 @@
 #ifndef SHARE_CLASSFILE_DICTIONARY_HPP
 #define SHARE_CLASSFILE_DICTIONARY_HPP
 
+#include "runtime/atomic.hpp"
 #include "utilities/concurrentHashTable.hpp"
 
 class ClassLoaderData;
@@ -49,6 +50,12 @@ class Dictionary : public CHeapObj<mtClass> {
   ConcurrentTable* _table;
 
   ClassLoaderData* _loader_data;  // backpointer to owning loader
+
+  // Outcome of the dictionary probes done when resolving a class
+  // initiated by this loader, e.g. from Class.forName. Only counted
+  // with CountDictionaryLookups.
+  volatile size_t _lookup_hits;
+  volatile size_t _lookup_misses;
   ClassLoaderData* loader_data() const { return _loader_data; }
 
   bool check_if_needs_resize();
@@ -62,6 +69,12 @@ class Dictionary : public CHeapObj<mtClass> {
 
   InstanceKlass* find_class(Thread* current, Symbol* name);
 
+  void record_lookup(bool hit) {
+    Atomic::inc(hit ? &_lookup_hits : &_lookup_misses, memory_order_relaxed);
+  }
+  size_t lookup_hits() const   { return Atomic::load(&_lookup_hits); }
+  size_t lookup_misses() const { return Atomic::load(&_lookup_misses); }
+
   void classes_do(void f(InstanceKlass*));
   void all_entries_do(KlassClosure* closure);
   void classes_do(MetaspaceClosure* it);
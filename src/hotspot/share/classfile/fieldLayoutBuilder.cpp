@@ -492,6 +492,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _field_info(field_info),
   _info(info),
   _root_group(nullptr),
+  _hot_group(nullptr),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(nullptr),
   _layout(nullptr),
@@ -525,6 +526,40 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  if (HotFields != nullptr && HotFields[0] != '\0') {
+    _hot_group = new FieldGroup();
+  }
+}
+
+// Returns true if -XX:HotFields names this field of the class being laid out.
+// Entries are "class.field", with the class name in either internal (a/b/C) or
+// external (a.b.C) form.
+bool FieldLayoutBuilder::is_hot_field(const Symbol* field_name) const {
+  const char* p = HotFields;
+  while (*p != '\0') {
+    const size_t len = strcspn(p, ", \n");
+    const char* dot = nullptr;
+    for (const char* q = p; q < p + len; q++) {
+      if (*q == '.') {
+        dot = q;
+      }
+    }
+    if (dot != nullptr &&
+        field_name->equals(dot + 1, (int)(p + len - dot - 1)) &&
+        _classname->utf8_length() == (int)(dot - p)) {
+      bool match = true;
+      for (int i = 0; match && i < _classname->utf8_length(); i++) {
+        const char c = p[i] == '.' ? '/' : p[i];
+        match = (c == _classname->char_at(i));
+      }
+      if (match) {
+        return true;
+      }
+    }
+    p += len;
+    p += strspn(p, ", \n");
+  }
+  return false;
 }
 
 // Field sorting for regular classes:
@@ -550,6 +585,8 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (_hot_group != nullptr && is_hot_field(fieldinfo.name(_constant_pool))) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -577,6 +614,9 @@ void FieldLayoutBuilder::regular_field_sorting() {
     }
   }
   _root_group->sort_by_size();
+  if (_hot_group != nullptr) {
+    _hot_group->sort_by_size();
+  }
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
@@ -594,6 +634,8 @@ void FieldLayoutBuilder::insert_contended_padding(LayoutRawBlock* slot) {
 
 // Computation of regular classes layout is an evolution of the previous default layout
 // (FieldAllocationStyle 1):
+//   - fields named by -XX:HotFields are allocated before all others, so that they
+//     share the cache line of the object header when possible
 //   - primitive fields are allocated first (from the biggest to the smallest)
 //   - then oop fields are allocated, either in existing gaps or at the end of
 //     the layout
@@ -609,6 +651,10 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  if (_hot_group != nullptr) {
+    _layout->add(_hot_group->primitive_fields());
+    _layout->add(_hot_group->oop_fields());
+  }
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -652,6 +698,13 @@ void FieldLayoutBuilder::epilogue() {
     }
   }
 
+  if (_hot_group != nullptr && _hot_group->oop_fields() != nullptr) {
+    for (int i = 0; i < _hot_group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = _hot_group->oop_fields()->at(i);
+      nonstatic_oop_maps->add(b->offset(), 1);
+    }
+  }
+
   if (!_contended_groups.is_empty()) {
     for (int i = 0; i < _contended_groups.length(); i++) {
       FieldGroup* cg = _contended_groups.at(i);
@@ -229,6 +229,7 @@ class FieldLayoutBuilder : public ResourceObj {
   GrowableArray<FieldInfo>* _field_info;
   FieldLayoutInfo* _info;
   FieldGroup* _root_group;
+  FieldGroup* _hot_group;   // fields named by -XX:HotFields, laid out first
   GrowableArray<FieldGroup*> _contended_groups;
   FieldGroup* _static_fields;
   FieldLayout* _layout;
@@ -256,6 +257,7 @@ class FieldLayoutBuilder : public ResourceObj {
   void epilogue();
   void regular_field_sorting();
   FieldGroup* get_or_create_contended_group(int g);
+  bool is_hot_field(const Symbol* field_name) const;
 };
 
 #endif // SHARE_CLASSFILE_FIELDLAYOUTBUILDER_HPP
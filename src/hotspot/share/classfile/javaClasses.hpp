@@ -176,6 +176,16 @@ class java_lang_String : AllStatic {
 
   static unsigned int hash_code(const jbyte* s, int len) {
     unsigned int h = 0;
+    // Four bytes per step, with the powers of 31 folded in, so that the
+    // multiplications don't form one long dependency chain. This gives
+    // the same result as the byte-at-a-time loop below.
+    for (; len >= 4; len -= 4, s += 4) {
+      h = 31*31*31*31 * h +
+          31*31*31 * (((unsigned int) s[0]) & 0xFF) +
+          31*31    * (((unsigned int) s[1]) & 0xFF) +
+          31       * (((unsigned int) s[2]) & 0xFF) +
+                     (((unsigned int) s[3]) & 0xFF);
+    }
     while (len-- > 0) {
       h = 31*h + (((unsigned int) *s) & 0xFF);
       s++;
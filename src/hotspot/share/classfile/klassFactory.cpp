@@ -32,6 +32,7 @@
 #include "classfile/classLoaderData.inline.hpp"
 #include "classfile/classLoadInfo.hpp"
 #include "classfile/klassFactory.hpp"
+#include "classfile/verificationCache.hpp"
 #include "memory/resourceArea.hpp"
 #include "prims/jvmtiEnvBase.hpp"
 #include "prims/jvmtiRedefineClasses.hpp"
@@ -210,6 +211,10 @@ InstanceKlass* KlassFactory::create_from_stream(ClassFileStream* stream,
 
   JFR_ONLY(ON_KLASS_CREATION(result, parser, THREAD);)
 
+  if (VerificationCache::is_enabled()) {
+    VerificationCache::record_class_file(result, stream);
+  }
+
 #if INCLUDE_CDS
   if (CDSConfig::is_dumping_archive()) {
     ClassLoader::record_result(THREAD, result, stream, old_stream != stream);
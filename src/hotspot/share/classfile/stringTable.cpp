@@ -35,6 +35,7 @@
 #include "classfile/stringTable.hpp"
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/freeListAllocator.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
@@ -186,6 +187,26 @@ bool StringTable::wrapped_string_equals(oop java_string, const StringWrapper& wr
   return false;
 }
 
+// All String table nodes have the same size. With StringTableNodeFreeList, the
+// nodes of dead entries are kept for reuse by later interns rather than going
+// back to malloc, which avoids heap fragmentation from interning churn. Nodes
+// are only released to the free list after the table has synchronized with
+// concurrent readers, so reuse is safe.
+class StringTableNodeFreeListConfig : public FreeListConfig {
+  const size_t _node_size;
+
+ public:
+  explicit StringTableNodeFreeListConfig(size_t node_size) : _node_size(node_size) {}
+
+  size_t node_size() const { return _node_size; }
+
+  void* allocate() override { return AllocateHeap(_node_size, mtSymbol); }
+  void deallocate(void* node) override { FreeHeap(node); }
+};
+
+static StringTableNodeFreeListConfig* _node_free_list_config = nullptr;
+static FreeListAllocator* _node_free_list = nullptr;
+
 class StringTableConfig : public StackObj {
  private:
  public:
@@ -211,11 +232,19 @@ class StringTableConfig : public StackObj {
   // We use default allocation/deallocation but counted
   static void* allocate_node(void* context, size_t size, Value const& value) {
     StringTable::item_added();
+    if (_node_free_list != nullptr) {
+      assert(size == _node_free_list_config->node_size(), "unexpected node size %zu", size);
+      return _node_free_list->allocate();
+    }
     return AllocateHeap(size, mtSymbol);
   }
   static void free_node(void* context, void* memory, Value& value) {
     value.release(StringTable::_oop_storage);
-    FreeHeap(memory);
+    if (_node_free_list != nullptr) {
+      _node_free_list->release(memory);
+    } else {
+      FreeHeap(memory);
+    }
     StringTable::item_removed();
   }
 };
@@ -313,6 +342,10 @@ void StringTable::create_table() {
   _current_size = ((size_t)1) << start_size_log_2;
   log_trace(stringtable)("Start size: " SIZE_FORMAT " (" SIZE_FORMAT ")",
                          _current_size, start_size_log_2);
+  if (StringTableNodeFreeList) {
+    _node_free_list_config = new StringTableNodeFreeListConfig(StringTableHash::get_node_size());
+    _node_free_list = new FreeListAllocator("StringTable nodes", _node_free_list_config);
+  }
   _local_table = new StringTableHash(start_size_log_2, END_SIZE, REHASH_LEN, true);
   _oop_storage = OopStorageSet::create_weak("StringTable Weak", mtSymbol);
   _oop_storage->register_num_dead_callback(&gc_notification);
@@ -750,9 +783,23 @@ TableStatistics StringTable::get_table_statistics() {
   return ts;
 }
 
+bool StringTable::get_node_free_list_statistics(size_t* nodes, size_t* bytes) {
+  if (_node_free_list == nullptr) {
+    return false;
+  }
+  *nodes = _node_free_list->free_count() + _node_free_list->pending_count();
+  *bytes = *nodes * _node_free_list_config->node_size();
+  return true;
+}
+
 void StringTable::print_table_statistics(outputStream* st) {
   SizeFunc sz;
   _local_table->statistics_to(Thread::current(), sz, st, "StringTable");
+  size_t nodes = 0;
+  size_t bytes = 0;
+  if (get_node_free_list_statistics(&nodes, &bytes)) {
+    st->print_cr("Free list nodes: %zu (%zu bytes)", nodes, bytes);
+  }
 #if INCLUDE_CDS_JAVA_HEAP
   if (!_shared_table.empty()) {
     _shared_table.print_table_statistics(st, "Shared String Table");
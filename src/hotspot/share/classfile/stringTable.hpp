@@ -86,6 +86,9 @@ class StringTable : AllStatic {
  public:
   static size_t table_size();
   static TableStatistics get_table_statistics();
+  // Nodes held by the StringTableNodeFreeList free list and their size in
+  // bytes. Returns false if the free list is not in use.
+  static bool get_node_free_list_statistics(size_t* nodes, size_t* bytes);
 
   static void create_table();
 
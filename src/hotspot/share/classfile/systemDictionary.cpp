@@ -597,6 +597,9 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
 
   // Do lookup to see if class already exists.
   InstanceKlass* probe = dictionary->find_class(THREAD, name);
+  if (CountDictionaryLookups) {
+    dictionary->record_lookup(probe != nullptr);
+  }
   if (probe != nullptr) return probe;
 
   // Non-bootstrap class loaders will call out to class loader and
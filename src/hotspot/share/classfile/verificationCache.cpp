@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "cds/cdsConfig.hpp"
+#include "classfile/classFileStream.hpp"
+#include "classfile/classLoader.hpp"
+#include "classfile/classLoaderData.inline.hpp"
+#include "classfile/verificationCache.hpp"
+#include "classfile/verifier.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/instanceKlass.hpp"
+#include "runtime/arguments.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/vm_version.hpp"
+#include "utilities/classpathStream.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+#include "utilities/sha256.hpp"
+
+#ifndef O_BINARY       // if defined (Win32) use binary files.
+#define O_BINARY 0     // otherwise do nothing.
+#endif
+
+static const int VERIFICATION_CACHE_VERSION = 3;
+
+// A SHA-256 digest. The cache file is only as trustworthy as the class path,
+// but a digest that can be forged would let a crafted class file take the
+// place of one that was verified.
+struct Fingerprint {
+  u1 _bytes[SHA256::DIGEST_LENGTH];
+
+  static unsigned hash(const Fingerprint& fp) {
+    unsigned h;
+    memcpy(&h, fp._bytes, sizeof(h));
+    return h;
+  }
+
+  static bool equals(const Fingerprint& fp1, const Fingerprint& fp2) {
+    return memcmp(fp1._bytes, fp2._bytes, sizeof(fp1._bytes)) == 0;
+  }
+
+  void print_on(outputStream* st) const {
+    for (size_t i = 0; i < sizeof(_bytes); i++) {
+      st->print("%02x", _bytes[i]);
+    }
+  }
+
+  static int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+  }
+
+  // Parses the lower case hex digits written by print_on() at s.
+  bool parse(const char* s) {
+    for (size_t i = 0; i < sizeof(_bytes); i++) {
+      int hi = hex_value(s[2 * i]);
+      int lo = (hi < 0) ? -1 : hex_value(s[2 * i + 1]);
+      if (lo < 0) {
+        return false;
+      }
+      _bytes[i] = (u1)((hi << 4) | lo);
+    }
+    return true;
+  }
+};
+
+using FingerprintTable = ResourceHashtable<Fingerprint, bool, 16411, AnyObj::C_HEAP, mtClass,
+                                           Fingerprint::hash, Fingerprint::equals>;
+using PendingTable = ResourceHashtable<InstanceKlass*, Fingerprint, 1031, AnyObj::C_HEAP, mtClass>;
+
+// Fingerprints of the classes known to pass verification.
+static FingerprintTable* _verified = nullptr;
+// Fingerprints of classes that have been parsed but not yet verified.
+static PendingTable* _pending = nullptr;
+// Identifies the VM build and class path entries the fingerprints are valid for.
+static Fingerprint _context;
+// The class path entries covered by _context, as given and as real paths.
+static GrowableArrayCHeap<const char*, mtClass>* _entries = nullptr;
+
+bool   VerificationCache::_is_enabled = false;
+bool   VerificationCache::_is_dirty = false;
+size_t VerificationCache::_hits = 0;
+size_t VerificationCache::_misses = 0;
+
+static void digest_string(SHA256* sha, const char* s) {
+  if (s != nullptr) {
+    // Include the terminator so that adjacent strings cannot run together.
+    sha->update(s, strlen(s) + 1);
+  }
+}
+
+static juint read_u4_le(const u1* p) {
+  return (juint)p[0] | ((juint)p[1] << 8) | ((juint)p[2] << 16) | ((juint)p[3] << 24);
+}
+
+// Adds the central directory of the zip file at path to sha. It holds the
+// name, size and CRC32 of every entry, so it changes whenever any class in
+// the jar does. Files that are not zip files (the runtime image) add nothing.
+static void digest_zip_central_directory(SHA256* sha, const char* path, jlong file_size) {
+  const jlong end_record_size = 22;
+  if (file_size < end_record_size) {
+    return;
+  }
+  int fd = os::open(path, O_RDONLY | O_BINARY, 0);
+  if (fd < 0) {
+    return;
+  }
+  // The end of central directory record is followed by a comment of at most 64K.
+  unsigned int tail_size = (unsigned int)MIN2(file_size, end_record_size + 0xFFFF);
+  u1* tail = NEW_C_HEAP_ARRAY(u1, tail_size, mtClass);
+  if (os::read_at(fd, tail, tail_size, file_size - tail_size) == (ssize_t)tail_size) {
+    for (int i = (int)(tail_size - end_record_size); i >= 0; i--) {
+      if (tail[i] == 'P' && tail[i + 1] == 'K' && tail[i + 2] == 5 && tail[i + 3] == 6) {
+        juint cd_size = read_u4_le(tail + i + 12);
+        juint cd_offset = read_u4_le(tail + i + 16);
+        u1* cd = nullptr;
+        if ((jlong)cd_offset + cd_size <= file_size && cd_size <= 64 * M) {
+          cd = NEW_C_HEAP_ARRAY_RETURN_NULL(u1, MAX2(cd_size, 1u), mtClass);
+        }
+        if (cd != nullptr && os::read_at(fd, cd, cd_size, cd_offset) == (ssize_t)cd_size) {
+          sha->update(cd, cd_size);
+        } else {
+          // Zip64 or unreadable: the tail still holds the end records.
+          sha->update(tail, tail_size);
+        }
+        FREE_C_HEAP_ARRAY(u1, cd);
+        break;
+      }
+    }
+  }
+  FREE_C_HEAP_ARRAY(u1, tail);
+  ::close(fd);
+}
+
+static void add_entry(const char* path) {
+  _entries->append(os::strdup_check_oom(path, mtClass));
+  char buf[JVM_MAXPATHLEN];
+  if (os::realpath(path, buf, sizeof(buf)) != nullptr && strcmp(buf, path) != 0) {
+    _entries->append(os::strdup_check_oom(buf, mtClass));
+  }
+}
+
+// Adds the identity of each entry of the class path cp to sha: its size and
+// modification time, and for jar files the central directory. The
+// fingerprint of a class covers only its own bytes, so this is what detects a
+// replaced jar that would give the verifier a different class hierarchy.
+// Returns false if an entry is a directory, whose contents cannot be
+// identified cheaply.
+static bool digest_class_path(SHA256* sha, const char* cp) {
+  if (cp == nullptr) {
+    return true;
+  }
+  ResourceMark rm;
+  ClasspathStream cps(cp);
+  while (cps.has_next()) {
+    const char* path = cps.get_next();
+    digest_string(sha, path);
+    struct stat st;
+    if (os::stat(path, &st) != 0) {
+      continue; // contributes no classes
+    }
+    if ((st.st_mode & S_IFMT) == S_IFDIR) {
+      log_info(verification)("Verification cache is disabled, class path entry %s is a directory", path);
+      return false;
+    }
+    jlong size = (jlong)st.st_size;
+    jlong mtime = (jlong)st.st_mtime;
+    sha->update(&size, sizeof(size));
+    sha->update(&mtime, sizeof(mtime));
+    digest_zip_central_directory(sha, path, size);
+    add_entry(path);
+  }
+  return true;
+}
+
+static bool compute_context(Fingerprint* context) {
+  SHA256 sha;
+  digest_string(&sha, VM_Version::internal_vm_info_string());
+  if (!digest_class_path(&sha, Arguments::get_boot_class_path()) ||
+      !digest_class_path(&sha, Arguments::get_appclasspath()) ||
+      !digest_class_path(&sha, Arguments::get_property("jdk.module.path"))) {
+    return false;
+  }
+  sha.finish(context->_bytes);
+  return true;
+}
+
+// Returns true if stream was read from the runtime image or from one of the
+// class path entries that _context covers. The builtin loaders also define
+// classes from bytes supplied by Java code (Lookup.defineClass, JNI
+// DefineClass), whose source is a marker, a class name or nothing; those are
+// never looked up in the cache.
+static bool is_fingerprinted_source(const ClassFileStream* stream) {
+  if (stream->from_boot_loader_modules_image()) {
+    return true;
+  }
+  const char* source = stream->source();
+  if (source == nullptr) {
+    return false;
+  }
+  if (strncmp(source, "jrt:/", 5) == 0) {
+    // A module of the runtime image, defined by the platform or app loader.
+    return true;
+  }
+  if (strncmp(source, "file:", 5) == 0) {
+    // The code source of the app loader, a file URL of a canonical path.
+    // A path that needed escaping in the URL does not match, which only
+    // costs a miss.
+    source += 5;
+    if (strncmp(source, "//", 2) == 0) {
+      source += 2;
+    }
+  }
+  for (int i = 0; i < _entries->length(); i++) {
+    if (strcmp(_entries->at(i), source) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static Fingerprint fingerprint(Symbol* name, const ClassFileStream* stream) {
+  SHA256 sha;
+  jint length = stream->length();
+  sha.update(&length, sizeof(length));
+  sha.update(stream->buffer(), stream->length());
+  sha.update(name->base(), name->utf8_length());
+  Fingerprint fp;
+  sha.finish(fp._bytes);
+  return fp;
+}
+
+void VerificationCache::initialize() {
+  if (VerificationCacheFile == nullptr) {
+    return;
+  }
+  if (CDSConfig::is_dumping_archive()) {
+    // Archived classes must be verified so that their verification
+    // constraints can be recorded.
+    log_info(verification)("Verification cache is disabled when dumping a CDS archive");
+    return;
+  }
+  _entries = new GrowableArrayCHeap<const char*, mtClass>(8);
+  if (!compute_context(&_context)) {
+    return;
+  }
+  _verified = new (mtClass) FingerprintTable();
+  _pending = new (mtClass) PendingTable();
+  _is_enabled = true;
+  load(VerificationCacheFile);
+}
+
+void VerificationCache::load(const char* path) {
+  FILE* file = os::fopen(path, "r");
+  if (file == nullptr) {
+    log_info(verification)("Verification cache %s not found, starting empty", path);
+    return;
+  }
+
+  char line[128];
+  bool valid = false;
+  size_t count = 0;
+  juint checksum = 0;
+  int version = 0;
+  int offset = 0;
+  Fingerprint context;
+  if (fgets(line, sizeof(line), file) != nullptr &&
+      sscanf(line, "VerificationCache %d %n", &version, &offset) == 1 && offset > 0 &&
+      version == VERIFICATION_CACHE_VERSION &&
+      context.parse(line + offset) && Fingerprint::equals(context, _context)) {
+    while (fgets(line, sizeof(line), file) != nullptr) {
+      size_t end_count = 0;
+      unsigned end_checksum = 0;
+      if (sscanf(line, "end " SIZE_FORMAT " %x", &end_count, &end_checksum) == 2) {
+        valid = (end_count == count && (juint)end_checksum == checksum);
+        break;
+      }
+      Fingerprint fp;
+      if (!fp.parse(line)) {
+        break;
+      }
+      _verified->put(fp, true);
+      checksum = (juint)ClassLoader::crc32((int)checksum, (const char*)fp._bytes, (int)sizeof(fp._bytes));
+      count++;
+    }
+  }
+  fclose(file);
+
+  if (valid) {
+    log_info(verification)("Loaded " SIZE_FORMAT " entries from verification cache %s", count, path);
+  } else {
+    // Written by a different VM or class path, or damaged: ignore it and
+    // replace it at exit.
+    log_info(verification)("Ignoring stale or damaged verification cache %s", path);
+    delete _verified;
+    _verified = new (mtClass) FingerprintTable();
+    _is_dirty = true;
+  }
+}
+
+void VerificationCache::record_class_file(InstanceKlass* ik, const ClassFileStream* stream) {
+  assert(is_enabled(), "must be");
+  if (ik->is_hidden() || !ik->class_loader_data()->is_builtin_class_loader_data() ||
+      !is_fingerprinted_source(stream) || !Verifier::should_verify_for(ik->class_loader())) {
+    return;
+  }
+  Fingerprint fp = fingerprint(ik->name(), stream);
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  _pending->put(ik, fp);
+}
+
+bool VerificationCache::is_verified(InstanceKlass* ik) {
+  assert(is_enabled(), "must be");
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  Fingerprint* fp = _pending->get(ik);
+  if (fp == nullptr) {
+    return false; // not eligible
+  }
+  if (_verified->contains(*fp)) {
+    _pending->remove(ik);
+    _hits++;
+    return true;
+  }
+  _misses++;
+  return false;
+}
+
+void VerificationCache::record_verified(InstanceKlass* ik) {
+  assert(is_enabled(), "must be");
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  Fingerprint* fp = _pending->get(ik);
+  if (fp != nullptr) {
+    _verified->put(*fp, true);
+    _pending->remove(ik);
+    _is_dirty = true;
+  }
+}
+
+void VerificationCache::forget(InstanceKlass* ik) {
+  assert(is_enabled(), "must be");
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  _pending->remove(ik);
+}
+
+void VerificationCache::write_at_exit() {
+  if (!is_enabled()) {
+    return;
+  }
+  MutexLocker ml(VerificationCache_lock, Mutex::_no_safepoint_check_flag);
+  log_info(verification)("Verification cache: " SIZE_FORMAT " hits, " SIZE_FORMAT " misses (%.1f%% hit rate)",
+                         _hits, _misses, percent_of(_hits, _hits + _misses));
+  if (!_is_dirty) {
+    return;
+  }
+
+  fileStream out(VerificationCacheFile, "w");
+  if (!out.is_open()) {
+    log_warning(verification)("Cannot write verification cache %s", VerificationCacheFile);
+    return;
+  }
+  out.print("VerificationCache %d ", VERIFICATION_CACHE_VERSION);
+  _context.print_on(&out);
+  out.cr();
+  size_t count = 0;
+  juint checksum = 0;
+  _verified->iterate_all([&] (const Fingerprint& fp, bool& ignored) {
+    fp.print_on(&out);
+    out.cr();
+    checksum = (juint)ClassLoader::crc32((int)checksum, (const char*)fp._bytes, (int)sizeof(fp._bytes));
+    count++;
+  });
+  out.print_cr("end " SIZE_FORMAT " %08x", count, checksum);
+  _is_dirty = false;
+  log_info(verification)("Wrote " SIZE_FORMAT " entries to verification cache %s", count, VerificationCacheFile);
+}
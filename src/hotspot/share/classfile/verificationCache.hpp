@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_VERIFICATIONCACHE_HPP
+#define SHARE_CLASSFILE_VERIFICATIONCACHE_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ClassFileStream;
+class InstanceKlass;
+
+// An optional on-disk record of the classes that passed verification in an
+// earlier run (-XX:VerificationCacheFile). A class is identified by a SHA-256
+// digest of its name and class file bytes. The cache is only valid for the
+// same VM build and class/module path entries it was written with (their
+// names, sizes, modification times and jar central directories), and only
+// classes that the builtin loaders read from those entries or the runtime
+// image are looked up, so the file must be trusted as much as the jars on
+// those paths. Classes defined from bytes supplied at run time, such as by
+// Lookup.defineClass, are always verified.
+class VerificationCache : AllStatic {
+  static bool _is_enabled;
+  static bool _is_dirty;
+  static size_t _hits;
+  static size_t _misses;
+
+  static void load(const char* path);
+
+ public:
+  static bool is_enabled() { return _is_enabled; }
+
+  static void initialize();
+
+  // Remember the fingerprint of ik's class file, to be used when ik is verified.
+  static void record_class_file(InstanceKlass* ik, const ClassFileStream* stream);
+
+  // Returns true if ik was already verified in an earlier run.
+  static bool is_verified(InstanceKlass* ik);
+
+  // ik passed verification in this run.
+  static void record_verified(InstanceKlass* ik);
+
+  // ik failed verification or is being deallocated.
+  static void forget(InstanceKlass* ik);
+
+  static void write_at_exit();
+};
+
+#endif // SHARE_CLASSFILE_VERIFICATIONCACHE_HPP
@@ -33,6 +33,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -197,6 +198,11 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
     return true;
   }
 
+  if (VerificationCache::is_enabled() && VerificationCache::is_verified(klass)) {
+    log_info(verification)("Skipping verification of %s, found in verification cache", klass->external_name());
+    return true;
+  }
+
   // Timer includes any side effects of class verification (resolution,
   // etc), but not recursive calls to Verifier::verify().
   JavaThread* jt = THREAD;
@@ -266,9 +272,16 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
     log_end_verification(&ls, klass->external_name(), exception_name, PENDING_EXCEPTION);
   }
 
+  if (VerificationCache::is_enabled() && (HAS_PENDING_EXCEPTION || exception_name != nullptr)) {
+    VerificationCache::forget(klass);
+  }
+
   if (HAS_PENDING_EXCEPTION) {
     return false; // use the existing exception
   } else if (exception_name == nullptr) {
+    if (VerificationCache::is_enabled()) {
+      VerificationCache::record_verified(klass);
+    }
     return true; // verification succeeded
   } else { // VerifyError or ClassFormatError to be created and thrown
     Klass* kls =
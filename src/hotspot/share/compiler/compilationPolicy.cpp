@@ -1106,6 +1106,15 @@ CompLevel CompilationPolicy::call_event(const methodHandle& method, CompLevel cu
   CompLevel osr_level = MIN2((CompLevel) method->highest_osr_comp_level(), common<LoopPredicate>(method, cur_level, true));
   CompLevel next_level = common<CallPredicate>(method, cur_level, is_old(method));
 
+  // A method that reached full optimization while the archive was dumped is
+  // very likely to be hot again; start profiling it without waiting for the
+  // tier 0 thresholds.
+  if (ArchiveHotMethodHints && next_level == CompLevel_none && cur_level == CompLevel_none &&
+      method->is_shared() && method->was_hot_at_dump_time() &&
+      !CompilationModeFlag::disable_intermediate()) {
+    next_level = limit_level(CompLevel_full_profile);
+  }
+
   // If OSR method level is greater than the regular method level, the levels should be
   // equalized by raising the regular method level in order to avoid OSRs during each
   // invocation of the method.
@@ -432,7 +432,9 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
   CompileTask* task;
   {
     NoSafepointVerifier nsv;
+    const jlong select_start = os::javaTimeNanos();
     task = CompilationPolicy::select_task(this);
+    _total_select_nanos += os::javaTimeNanos() - select_start;
     if (task != nullptr) {
       task = task->select_for_compilation();
     }
@@ -445,6 +447,8 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
     save_method = methodHandle(thread, task->method());
     save_hot_method = methodHandle(thread, task->hot_method());
 
+    jlong wait = (jlong)TimeHelper::counter_to_millis(os::elapsed_counter() - task->time_queued());
+    Atomic::store(&_last_wait_millis, wait);
     remove(task);
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
@@ -498,6 +502,7 @@ void CompileQueue::remove(CompileTask* task) {
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
   remove(task);
+  ++_total_dropped;
 
   // Enqueue the task for reclamation (should be done outside MCQ lock)
   task->set_next(_first_stale);
@@ -1021,6 +1026,18 @@ void CompileBroker::init_compiler_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
+// Upper bound for the number of threads of one compiler when threads are added
+// dynamically. The active processor count follows container CPU quotas, and
+// the pool does not grow while tasks are picked up quickly enough.
+static int dynamic_compiler_thread_limit(CompileQueue* queue, int old_count) {
+  int cpu_limit = MAX2(1, (int)(os::active_processor_count() * DynamicCompilerThreadsCPUPercentage / 100));
+  if (DynamicCompilerThreadsMinQueueWait > 0 &&
+      queue->last_wait_millis() < DynamicCompilerThreadsMinQueueWait) {
+    return MIN2(old_count, cpu_limit);
+  }
+  return cpu_limit;
+}
+
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   int old_c2_count = 0, new_c2_count = 0, old_c1_count = 0, new_c1_count = 0;
@@ -1053,6 +1070,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / c2_tasks_per_thread,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = MIN2(new_c2_count, dynamic_compiler_thread_limit(_c2_compile_queue, old_c2_count));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1114,6 +1132,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / c1_tasks_per_thread,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    new_c1_count = MIN2(new_c1_count, dynamic_compiler_thread_limit(_c1_compile_queue, old_c1_count));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -1975,6 +1994,10 @@ void CompileBroker::compiler_thread_loop() {
         // Compile the method.
         if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
           invoke_compiler_on_method(task);
+          if (thread->chunk_cache() != nullptr) {
+            // All arenas of the compilation are gone, drop back to the high watermark.
+            thread->chunk_cache()->trim(CompilerThreadChunkCacheSize);
+          }
           thread->start_idle_timer();
         } else {
           // After compilation is disabled, remove remaining methods from queue
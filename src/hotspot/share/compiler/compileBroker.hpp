@@ -91,6 +91,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int _peak_size;
   uint _total_added;
   uint _total_removed;
+  uint _total_dropped;       // removed without being compiled
+  jlong _total_select_nanos; // time spent in CompilationPolicy::select_task()
+  volatile jlong _last_wait_millis; // time the last selected task spent in the queue
 
   void purge_stale_tasks();
  public:
@@ -101,6 +104,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _size = 0;
     _total_added = 0;
     _total_removed = 0;
+    _total_dropped = 0;
+    _total_select_nanos = 0;
+    _last_wait_millis = 0;
     _peak_size = 0;
     _first_stale = nullptr;
   }
@@ -121,6 +127,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int         get_peak_size()     const          { return _peak_size; }
   uint        get_total_added()   const          { return _total_added; }
   uint        get_total_removed() const          { return _total_removed; }
+  uint        get_total_dropped() const          { return _total_dropped; }
+  jlong       get_total_select_nanos() const     { return _total_select_nanos; }
+  jlong       last_wait_millis() const           { return Atomic::load(&_last_wait_millis); }
 
   // Redefine Classes support
   void mark_on_stack();
@@ -27,6 +27,8 @@
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileTask.hpp"
 #include "compiler/compilerThread.hpp"
+#include "compiler/compiler_globals.hpp"
+#include "memory/arena.hpp"
 #include "runtime/javaThread.inline.hpp"
 
 // Create a CompilerThread
@@ -42,6 +44,7 @@ CompilerThread::CompilerThread(CompileQueue* queue,
   _can_call_java = false;
   _compiler = nullptr;
   _arena_stat = CompilationMemoryStatistic::enabled() ? new ArenaStatCounter : nullptr;
+  _chunk_cache = CompilerThreadChunkCacheSize > 0 ? new ChunkCache() : nullptr;
 
 #ifndef PRODUCT
   _ideal_graph_printer = nullptr;
@@ -52,6 +55,10 @@ CompilerThread::~CompilerThread() {
   // Delete objects which were allocated on heap.
   delete _counters;
   delete _arena_stat;
+  // Chunks freed from here on go back to the global pool.
+  ChunkCache* cache = _chunk_cache;
+  _chunk_cache = nullptr;
+  delete cache;
 }
 
 void CompilerThread::set_compiler(AbstractCompiler* c) {
@@ -30,6 +30,7 @@
 class AbstractCompiler;
 class ArenaStatCounter;
 class BufferBlob;
+class ChunkCache;
 class ciEnv;
 class CompilerThread;
 class CompileLog;
@@ -56,6 +57,7 @@ class CompilerThread : public JavaThread {
   TimeStamp             _idle_time;
 
   ArenaStatCounter*     _arena_stat;
+  ChunkCache*           _chunk_cache;
 
  public:
 
@@ -85,6 +87,7 @@ class CompilerThread : public JavaThread {
   CompileQueue* queue()        const             { return _queue; }
   CompilerCounters* counters() const             { return _counters; }
   ArenaStatCounter* arena_stat() const           { return _arena_stat; }
+  ChunkCache* chunk_cache() const                { return _chunk_cache; }
 
   // Get/set the thread's compilation environment.
   ciEnv*        env()                            { return _env; }
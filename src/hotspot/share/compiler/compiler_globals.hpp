@@ -382,6 +382,13 @@
           "If compilation is stopped with an error, capture diagnostic "    \
           "information at the bailout point")                               \
                                                                             \
+  product(size_t, CompilerThreadChunkCacheSize, 0, EXPERIMENTAL,            \
+          "Bytes of arena chunks each compiler thread keeps for reuse "     \
+          "by its next compilation, outside of the chunk pool cleaner. "    \
+          "Larger kept chunks are released lazily to the OS. 0 disables "   \
+          "the cache.")                                                     \
+          range(0, max_uintx)                                               \
+                                                                            \
 
 // end of COMPILER_FLAGS
 
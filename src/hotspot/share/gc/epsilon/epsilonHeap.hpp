@@ -108,6 +108,8 @@ class EpsilonHeap : public CollectedHeap {
   void pin_object(JavaThread* thread, oop obj) override { }
   void unpin_object(JavaThread* thread, oop obj) override { }
 
+  bool can_clear_arrays_in_segments() const override { return true; }
+
   // No support for block parsing.
   HeapWord* block_start(const void* addr) const { return nullptr;  }
   bool block_is_obj(const HeapWord* addr) const { return false; }
@@ -45,6 +45,7 @@ G1Allocator::G1Allocator(G1CollectedHeap* heap) :
   _old_is_full(false),
   _num_alloc_regions(_numa->num_active_nodes()),
   _mutator_alloc_regions(nullptr),
+  _pinnable_alloc_region(G1NUMA::AnyNodeIndex),
   _survivor_gc_alloc_regions(nullptr),
   _old_gc_alloc_region(heap->alloc_buffer_stats(G1HeapRegionAttr::Old)),
   _retained_old_gc_alloc_region(nullptr) {
@@ -80,6 +81,8 @@ void G1Allocator::init_mutator_alloc_regions() {
     assert(mutator_alloc_region(i)->get() == nullptr, "pre-condition");
     mutator_alloc_region(i)->init();
   }
+  assert(_pinnable_alloc_region.get() == nullptr, "pre-condition");
+  _pinnable_alloc_region.init();
 }
 
 void G1Allocator::release_mutator_alloc_regions() {
@@ -87,6 +90,8 @@ void G1Allocator::release_mutator_alloc_regions() {
     mutator_alloc_region(i)->release();
     assert(mutator_alloc_region(i)->get() == nullptr, "post-condition");
   }
+  _pinnable_alloc_region.release();
+  assert(_pinnable_alloc_region.get() == nullptr, "post-condition");
 }
 
 bool G1Allocator::is_retained_old_region(G1HeapRegion* hr) {
@@ -208,6 +213,7 @@ size_t G1Allocator::used_in_alloc_regions() {
   for (uint i = 0; i < _num_alloc_regions; i++) {
     used += mutator_alloc_region(i)->used_in_alloc_regions();
   }
+  used += _pinnable_alloc_region.used_in_alloc_regions();
   return used;
 }
 
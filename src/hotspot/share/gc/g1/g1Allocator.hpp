@@ -52,6 +52,11 @@ class G1Allocator : public CHeapObj<mtGC> {
   // Alloc region used to satisfy mutator allocation requests.
   MutatorAllocRegion* _mutator_alloc_regions;
 
+  // Alloc region for primitive arrays that are likely to be pinned, see
+  // G1PinnableArrayMinSize. Keeping them apart means that pinning them
+  // does not hold other objects' eden regions in place.
+  MutatorAllocRegion _pinnable_alloc_region;
+
   // Alloc region used to satisfy allocation requests by the GC for
   // survivor objects.
   SurvivorGCAllocRegion* _survivor_gc_alloc_regions;
@@ -74,6 +79,7 @@ class G1Allocator : public CHeapObj<mtGC> {
 
   // Accessors to the allocation regions.
   inline MutatorAllocRegion* mutator_alloc_region(uint node_index);
+  inline MutatorAllocRegion* mutator_alloc_region_for(bool pinnable);
   inline SurvivorGCAllocRegion* survivor_gc_alloc_region(uint node_index);
   inline OldGCAllocRegion* old_gc_alloc_region();
 
@@ -112,14 +118,16 @@ class G1Allocator : public CHeapObj<mtGC> {
 
   // Allocate blocks of memory during mutator time.
 
-  // Attempt allocation in the current alloc region.
+  // Attempt allocation in the current alloc region. With pinnable, use the
+  // alloc region for likely pinned primitive arrays.
   inline HeapWord* attempt_allocation(size_t min_word_size,
                                       size_t desired_word_size,
-                                      size_t* actual_word_size);
+                                      size_t* actual_word_size,
+                                      bool pinnable = false);
 
   // This is to be called when holding an appropriate lock. It first tries in the
   // current allocation region, and then attempts an allocation using a new region.
-  inline HeapWord* attempt_allocation_locked(size_t word_size);
+  inline HeapWord* attempt_allocation_locked(size_t word_size, bool pinnable = false);
 
   size_t unsafe_max_tlab_alloc();
   size_t used_in_alloc_regions();
@@ -49,25 +49,30 @@ inline OldGCAllocRegion* G1Allocator::old_gc_alloc_region() {
   return &_old_gc_alloc_region;
 }
 
+inline MutatorAllocRegion* G1Allocator::mutator_alloc_region_for(bool pinnable) {
+  return pinnable ? &_pinnable_alloc_region : mutator_alloc_region(current_node_index());
+}
+
 inline HeapWord* G1Allocator::attempt_allocation(size_t min_word_size,
                                                  size_t desired_word_size,
-                                                 size_t* actual_word_size) {
-  uint node_index = current_node_index();
+                                                 size_t* actual_word_size,
+                                                 bool pinnable) {
+  MutatorAllocRegion* alloc_region = mutator_alloc_region_for(pinnable);
 
-  HeapWord* result = mutator_alloc_region(node_index)->attempt_retained_allocation(min_word_size, desired_word_size, actual_word_size);
+  HeapWord* result = alloc_region->attempt_retained_allocation(min_word_size, desired_word_size, actual_word_size);
   if (result != nullptr) {
     return result;
   }
 
-  return mutator_alloc_region(node_index)->attempt_allocation(min_word_size, desired_word_size, actual_word_size);
+  return alloc_region->attempt_allocation(min_word_size, desired_word_size, actual_word_size);
 }
 
-inline HeapWord* G1Allocator::attempt_allocation_locked(size_t word_size) {
-  uint node_index = current_node_index();
-  HeapWord* result = mutator_alloc_region(node_index)->attempt_allocation_locked(word_size);
+inline HeapWord* G1Allocator::attempt_allocation_locked(size_t word_size, bool pinnable) {
+  MutatorAllocRegion* alloc_region = mutator_alloc_region_for(pinnable);
+  HeapWord* result = alloc_region->attempt_allocation_locked(word_size);
 
-  assert(result != nullptr || mutator_alloc_region(node_index)->get() == nullptr,
-         "Must not have a mutator alloc region if there is no memory, but is " PTR_FORMAT, p2i(mutator_alloc_region(node_index)->get()));
+  assert(result != nullptr || alloc_region->get() == nullptr,
+         "Must not have a mutator alloc region if there is no memory, but is " PTR_FORMAT, p2i(alloc_region->get()));
   return result;
 }
 
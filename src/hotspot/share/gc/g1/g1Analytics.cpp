@@ -181,24 +181,28 @@ void G1Analytics::report_dirtied_cards_in_thread_buffers(size_t cards) {
   _dirtied_cards_in_thread_buffers_seq.add(double(cards));
 }
 
-void G1Analytics::report_cost_per_card_scan_ms(double cost_per_card_ms, bool for_young_only_phase) {
-  _cost_per_card_scan_ms_seq.add(cost_per_card_ms, for_young_only_phase);
+void G1Analytics::report_card_scan_time_ms(size_t num_cards, double time_ms, bool for_young_only_phase) {
+  _cost_per_card_scan_ms_seq.add(time_ms / num_cards, for_young_only_phase);
+  _card_scan_time_ms_seq.add(num_cards, time_ms, for_young_only_phase);
 }
 
-void G1Analytics::report_cost_per_card_merge_ms(double cost_per_card_ms, bool for_young_only_phase) {
-  _cost_per_card_merge_ms_seq.add(cost_per_card_ms, for_young_only_phase);
+void G1Analytics::report_card_merge_time_ms(size_t num_cards, double time_ms, bool for_young_only_phase) {
+  _cost_per_card_merge_ms_seq.add(time_ms / num_cards, for_young_only_phase);
+  _card_merge_time_ms_seq.add(num_cards, time_ms, for_young_only_phase);
 }
 
-void G1Analytics::report_cost_per_code_root_scan_ms(double cost_per_code_root_ms, bool for_young_only_phase) {
-  _cost_per_code_root_ms_seq.add(cost_per_code_root_ms, for_young_only_phase);
+void G1Analytics::report_code_root_scan_time_ms(size_t num_code_roots, double time_ms, bool for_young_only_phase) {
+  _cost_per_code_root_ms_seq.add(time_ms / num_code_roots, for_young_only_phase);
+  _code_root_scan_time_ms_seq.add(num_code_roots, time_ms, for_young_only_phase);
 }
 
 void G1Analytics::report_card_scan_to_merge_ratio(double merge_to_scan_ratio, bool for_young_only_phase) {
   _card_scan_to_merge_ratio_seq.add(merge_to_scan_ratio, for_young_only_phase);
 }
 
-void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_only_phase) {
-  _cost_per_byte_copied_ms_seq.add(cost_per_byte_ms, for_young_only_phase);
+void G1Analytics::report_object_copy_time_ms(size_t bytes_copied, double time_ms, bool for_young_only_phase) {
+  _cost_per_byte_copied_ms_seq.add(time_ms / bytes_copied, for_young_only_phase);
+  _object_copy_time_ms_seq.add(bytes_copied, time_ms, for_young_only_phase);
 }
 
 void G1Analytics::report_young_other_cost_per_region_ms(double other_cost_per_region_ms) {
@@ -249,20 +253,31 @@ size_t G1Analytics::predict_scan_card_num(size_t card_rs_length, bool for_young_
   return card_rs_length * predict_in_unit_interval(&_card_scan_to_merge_ratio_seq, for_young_only_phase);
 }
 
+double G1Analytics::predict_time_ms(G1PhaseDependentLinearCostSeq const* time_seq,
+                                    G1PhaseDependentSeq const* cost_per_item_seq,
+                                    size_t num_items,
+                                    bool for_young_only_phase) const {
+  double time_ms;
+  if (G1UseLinearCostModel && time_seq->predict(_predictor, num_items, for_young_only_phase, time_ms)) {
+    return MAX2(time_ms, 0.0);
+  }
+  return num_items * predict_zero_bounded(cost_per_item_seq, for_young_only_phase);
+}
+
 double G1Analytics::predict_card_merge_time_ms(size_t card_num, bool for_young_only_phase) const {
-  return card_num * predict_zero_bounded(&_cost_per_card_merge_ms_seq, for_young_only_phase);
+  return predict_time_ms(&_card_merge_time_ms_seq, &_cost_per_card_merge_ms_seq, card_num, for_young_only_phase);
 }
 
 double G1Analytics::predict_code_root_scan_time_ms(size_t code_root_num, bool for_young_only_phase) const {
-  return code_root_num * predict_zero_bounded(&_cost_per_code_root_ms_seq, for_young_only_phase);
+  return predict_time_ms(&_code_root_scan_time_ms_seq, &_cost_per_code_root_ms_seq, code_root_num, for_young_only_phase);
 }
 
 double G1Analytics::predict_card_scan_time_ms(size_t card_num, bool for_young_only_phase) const {
-  return card_num * predict_zero_bounded(&_cost_per_card_scan_ms_seq, for_young_only_phase);
+  return predict_time_ms(&_card_scan_time_ms_seq, &_cost_per_card_scan_ms_seq, card_num, for_young_only_phase);
 }
 
 double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_only_phase) const {
-  return bytes_to_copy * predict_zero_bounded(&_cost_per_byte_copied_ms_seq, for_young_only_phase);
+  return predict_time_ms(&_object_copy_time_ms_seq, &_cost_per_byte_copied_ms_seq, bytes_to_copy, for_young_only_phase);
 }
 
 double G1Analytics::predict_constant_other_time_ms() const {
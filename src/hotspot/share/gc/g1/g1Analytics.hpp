@@ -62,6 +62,13 @@ class G1Analytics: public CHeapObj<mtGC> {
   // The cost to copy a byte in ms.
   G1PhaseDependentSeq _cost_per_byte_copied_ms_seq;
 
+  // Phase times in ms against the number of cards merged, cards scanned, code
+  // roots scanned and bytes copied, for G1UseLinearCostModel.
+  G1PhaseDependentLinearCostSeq _card_merge_time_ms_seq;
+  G1PhaseDependentLinearCostSeq _card_scan_time_ms_seq;
+  G1PhaseDependentLinearCostSeq _code_root_scan_time_ms_seq;
+  G1PhaseDependentLinearCostSeq _object_copy_time_ms_seq;
+
   G1PhaseDependentSeq _pending_cards_seq;
   G1PhaseDependentSeq _card_rs_length_seq;
   G1PhaseDependentSeq _code_root_rs_length_seq;
@@ -88,6 +95,13 @@ class G1Analytics: public CHeapObj<mtGC> {
   size_t predict_size(G1PhaseDependentSeq const* seq, bool for_young_only_phase) const;
   double predict_zero_bounded(G1PhaseDependentSeq const* seq, bool for_young_only_phase) const;
 
+  // Predicts the time for the given number of items, from the linear fit if
+  // enabled and available, otherwise from the cost per item.
+  double predict_time_ms(G1PhaseDependentLinearCostSeq const* time_seq,
+                         G1PhaseDependentSeq const* cost_per_item_seq,
+                         size_t num_items,
+                         bool for_young_only_phase) const;
+
   double oldest_known_gc_end_time_sec() const;
   double most_recent_gc_end_time_sec() const;
 
@@ -128,11 +142,11 @@ class G1Analytics: public CHeapObj<mtGC> {
   void report_concurrent_refine_rate_ms(double cards_per_ms);
   void report_dirtied_cards_rate_ms(double cards_per_ms);
   void report_dirtied_cards_in_thread_buffers(size_t num_cards);
-  void report_cost_per_card_scan_ms(double cost_per_remset_card_ms, bool for_young_only_phase);
-  void report_cost_per_card_merge_ms(double cost_per_card_ms, bool for_young_only_phase);
-  void report_cost_per_code_root_scan_ms(double cost_per_code_root_ms, bool for_young_only_phase);
+  void report_card_scan_time_ms(size_t num_cards, double time_ms, bool for_young_only_phase);
+  void report_card_merge_time_ms(size_t num_cards, double time_ms, bool for_young_only_phase);
+  void report_code_root_scan_time_ms(size_t num_code_roots, double time_ms, bool for_young_only_phase);
   void report_card_scan_to_merge_ratio(double cards_per_entry_ratio, bool for_young_only_phase);
-  void report_cost_per_byte_ms(double cost_per_byte_ms, bool for_young_only_phase);
+  void report_object_copy_time_ms(size_t bytes_copied, double time_ms, bool for_young_only_phase);
   void report_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_non_young_other_cost_per_region_ms(double other_cost_per_region_ms);
   void report_constant_other_time_ms(double constant_other_time_ms);
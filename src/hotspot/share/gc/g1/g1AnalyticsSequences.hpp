@@ -53,4 +53,45 @@ class G1PhaseDependentSeq {
   double predict(const G1Predictions* predictor, bool use_young_only_phase_seq) const;
 };
 
+// Least squares fit of the time of a GC phase against the amount of work items
+// (e.g. cards or bytes) over a window of recent samples. Compared to a decaying
+// average of the cost per item it separates fixed and per-item costs, and follows
+// a change in that relation once the new samples dominate the window.
+class G1LinearCostSeq {
+  static const int WindowLength = 6;
+
+  double _items[WindowLength];
+  double _time_ms[WindowLength];
+  int _next;
+  int _num;
+
+public:
+  G1LinearCostSeq();
+
+  void add(double items, double time_ms);
+  int num() const { return _num; }
+
+  // Sets the fitted time for the given number of items and the standard error
+  // of that prediction, and returns true. Returns false if the samples do not
+  // give a usable fit, i.e. there are too few of them, the number of items does
+  // not vary enough or the cost would decrease with more items.
+  bool fit(double items, double& time_ms, double& stderr_ms) const;
+};
+
+// Container for G1LinearCostSeqs that need separate predictors by GC phase.
+class G1PhaseDependentLinearCostSeq {
+  G1LinearCostSeq _young_only_seq;
+  G1LinearCostSeq _mixed_seq;
+
+  NONCOPYABLE(G1PhaseDependentLinearCostSeq);
+
+public:
+  G1PhaseDependentLinearCostSeq() = default;
+
+  void add(double items, double time_ms, bool for_young_only_phase);
+
+  // Returns false if there is no usable fit; see G1LinearCostSeq::fit().
+  bool predict(const G1Predictions* predictor, double items, bool use_young_only_phase_seq, double& time_ms) const;
+};
+
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_HPP */
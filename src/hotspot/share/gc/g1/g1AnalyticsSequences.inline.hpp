@@ -62,4 +62,87 @@ double G1PhaseDependentSeq::predict(const G1Predictions* predictor, bool use_you
   }
 }
 
+G1LinearCostSeq::G1LinearCostSeq() : _next(0), _num(0) {
+  for (int i = 0; i < WindowLength; i++) {
+    _items[i] = 0.0;
+    _time_ms[i] = 0.0;
+  }
+}
+
+void G1LinearCostSeq::add(double items, double time_ms) {
+  _items[_next] = items;
+  _time_ms[_next] = time_ms;
+  _next = (_next + 1) % WindowLength;
+  _num = MIN2(_num + 1, WindowLength);
+}
+
+bool G1LinearCostSeq::fit(double items, double& time_ms, double& stderr_ms) const {
+  // Need at least one degree of freedom for the residuals.
+  if (_num < 3) {
+    return false;
+  }
+
+  double items_avg = 0.0;
+  double time_avg = 0.0;
+  for (int i = 0; i < _num; i++) {
+    items_avg += _items[i];
+    time_avg += _time_ms[i];
+  }
+  items_avg /= _num;
+  time_avg /= _num;
+
+  double sxx = 0.0;
+  double sxy = 0.0;
+  for (int i = 0; i < _num; i++) {
+    sxx += (_items[i] - items_avg) * (_items[i] - items_avg);
+    sxy += (_items[i] - items_avg) * (_time_ms[i] - time_avg);
+  }
+  // The number of items must vary by a few percent to separate fixed and
+  // per-item cost.
+  const double min_relative_spread = 0.02;
+  if (sxx <= _num * (items_avg * min_relative_spread) * (items_avg * min_relative_spread)) {
+    return false;
+  }
+
+  const double slope = sxy / sxx;
+  if (slope < 0.0) {
+    return false;
+  }
+  const double intercept = time_avg - slope * items_avg;
+
+  double sse = 0.0;
+  for (int i = 0; i < _num; i++) {
+    double residual = _time_ms[i] - (intercept + slope * _items[i]);
+    sse += residual * residual;
+  }
+  const double residual_sd = sqrt(sse / (_num - 2));
+
+  time_ms = intercept + slope * items;
+  // Standard error of prediction for a new sample at items.
+  stderr_ms = residual_sd * sqrt(1.0 + 1.0 / _num + (items - items_avg) * (items - items_avg) / sxx);
+  return true;
+}
+
+void G1PhaseDependentLinearCostSeq::add(double items, double time_ms, bool for_young_only_phase) {
+  if (for_young_only_phase) {
+    _young_only_seq.add(items, time_ms);
+  } else {
+    _mixed_seq.add(items, time_ms);
+  }
+}
+
+bool G1PhaseDependentLinearCostSeq::predict(const G1Predictions* predictor,
+                                            double items,
+                                            bool use_young_only_phase_seq,
+                                            double& time_ms) const {
+  const G1LinearCostSeq* seq = (use_young_only_phase_seq || _mixed_seq.num() < 3) ? &_young_only_seq : &_mixed_seq;
+  double fit_ms;
+  double stderr_ms;
+  if (!seq->fit(items, fit_ms, stderr_ms)) {
+    return false;
+  }
+  time_ms = predictor->predict(fit_ms, stderr_ms);
+  return true;
+}
+
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_INLINE_HPP */
@@ -834,6 +834,103 @@ G1AddCardResult G1CardSet::add_card(uint card_region, uint card_in_region, bool
   return add_result;
 }
 
+G1CardSet::ContainerPtr G1CardSet::create_container_for_cards(const uintptr_t* cards, size_t num_cards) {
+  uint card_region;
+  uint card_in_region;
+  split_card(cards[0], card_region, card_in_region);
+
+  if (num_cards <= _config->max_cards_in_array()) {
+    uint8_t* data = allocate_mem_object(ContainerArrayOfCards);
+    G1CardSetArray* array = new (data) G1CardSetArray(card_in_region, _config->max_cards_in_array());
+    for (size_t i = 1; i < num_cards; i++) {
+      split_card(cards[i], card_region, card_in_region);
+      G1AddCardResult res = array->add(card_in_region);
+      assert(res == Added, "card %u must be new", card_in_region);
+    }
+    return make_container_ptr(data, ContainerArrayOfCards);
+  }
+  // The remaining cards are added to the Howl after publishing it since its
+  // buckets may need to be coarsened.
+  uint8_t* data = allocate_mem_object(ContainerHowl);
+  G1CardSetHowl* howl = new (data) G1CardSetHowl(card_in_region, _config);
+  // Not created by coarsening an Array, so there are no cards to be transferred.
+  howl->_num_entries = 1;
+  return make_container_ptr(data, ContainerHowl);
+}
+
+void G1CardSet::add_cards_to_card_region(uint card_region, const uintptr_t* cards, size_t num_cards) {
+  if (num_cards <= _config->max_cards_in_inline_ptr()) {
+    // Fits into the hash table entry, no need for anything special.
+    for (size_t i = 0; i < num_cards; i++) {
+      add_card(cards[i]);
+    }
+    return;
+  }
+
+  bool should_grow_table = false;
+  G1CardSetHashTableValue* table_entry = get_or_add_container(card_region, &should_grow_table);
+  if (should_grow_table) {
+    _table->grow();
+  }
+
+  ContainerPtr const empty = G1CardSetInlinePtr();
+  if (Atomic::load(&table_entry->_container) != empty) {
+    // Somebody else already added cards for this card region; merge into the
+    // existing container.
+    for (size_t i = 0; i < num_cards; i++) {
+      add_card(cards[i]);
+    }
+    return;
+  }
+
+  ContainerPtr new_container;
+  size_t num_added;
+  if (num_cards > _config->cards_in_howl_threshold()) {
+    new_container = FullCardSet;
+    num_added = num_cards;
+  } else {
+    new_container = create_container_for_cards(cards, num_cards);
+    num_added = (container_type(new_container) == ContainerHowl) ? 1 : num_cards;
+  }
+
+  if (Atomic::cmpxchg(&table_entry->_container, empty, new_container) != empty) {
+    // Lost the race against a concurrent add_card.
+    if (new_container != FullCardSet) {
+      release_and_must_free_container(new_container);
+    }
+    for (size_t i = 0; i < num_cards; i++) {
+      add_card(cards[i]);
+    }
+    return;
+  }
+
+  Atomic::add(&table_entry->_num_occupied, checked_cast<uint>(num_added), memory_order_relaxed);
+  if (new_container == FullCardSet) {
+    // Like after coarsening, Full occupies all cards of the card region.
+    Atomic::add(&_num_occupied, (size_t)_config->max_cards_in_region(), memory_order_relaxed);
+    return;
+  }
+  Atomic::add(&_num_occupied, num_added, memory_order_relaxed);
+
+  for (size_t i = num_added; i < num_cards; i++) {
+    add_card(cards[i]);
+  }
+}
+
+void G1CardSet::add_cards(const uintptr_t* cards, size_t num_cards) {
+  size_t start = 0;
+  while (start < num_cards) {
+    uint card_region = (uint)(cards[start] >> _split_card_shift);
+    size_t end = start + 1;
+    while (end < num_cards && (uint)(cards[end] >> _split_card_shift) == card_region) {
+      assert(cards[end - 1] < cards[end], "cards must be sorted and unique");
+      end++;
+    }
+    add_cards_to_card_region(card_region, cards + start, end - start);
+    start = end;
+  }
+}
+
 bool G1CardSet::contains_card(uint card_region, uint card_in_region) {
   assert(card_in_region < _config->max_cards_in_region(),
          "Card %u is beyond max %u", card_in_region, _config->max_cards_in_region());
@@ -327,6 +327,11 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
 
   G1AddCardResult add_card(uint card_region, uint card_in_region, bool increment_total = true);
 
+  // Helpers for add_cards(). The cards are sorted, unique and all in the same
+  // card region.
+  ContainerPtr create_container_for_cards(const uintptr_t* cards, size_t num_cards);
+  void add_cards_to_card_region(uint card_region, const uintptr_t* cards, size_t num_cards);
+
   bool contains_card(uint card_region, uint card_in_region);
 
   // Testing API
@@ -350,6 +355,11 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   // If incremental_count is true and the card has been added, updates the total count.
   G1AddCardResult add_card(uintptr_t card);
 
+  // Adds the given sorted and unique cards to this set. Cards of card regions
+  // that have no entries yet are put directly into a container of the type
+  // their number requires, instead of coarsening one step at a time.
+  void add_cards(const uintptr_t* cards, size_t num_cards);
+
   bool contains_card(uintptr_t card);
 
   void print_info(outputStream* st, uintptr_t card);
@@ -28,6 +28,7 @@
 #include "gc/g1/g1CardTable.hpp"
 
 #include "gc/g1/g1HeapRegion.hpp"
+#include "utilities/align.hpp"
 
 inline uint G1CardTable::region_idx_for(CardValue* p) {
   size_t const card_idx = pointer_delta(p, _byte_map, sizeof(CardValue));
@@ -73,10 +74,25 @@ inline void G1CardTable::mark_range_dirty(size_t start_card_index, size_t num_ca
 }
 
 inline void G1CardTable::change_dirty_cards_to(CardValue* start_card, CardValue* end_card, CardValue which) {
-  for (CardValue* i_card = start_card; i_card < end_card; ++i_card) {
-    CardValue value = *i_card;
-    assert(value == dirty_card_val(),
-           "Must have been dirty %d start " PTR_FORMAT " " PTR_FORMAT, value, p2i(start_card), p2i(end_card));
+  CardValue* i_card = start_card;
+  // Unaligned head, then whole words, then the tail.
+  for (; i_card < end_card && !is_aligned(i_card, sizeof(size_t)); ++i_card) {
+    assert(*i_card == dirty_card_val(),
+           "Must have been dirty %d start " PTR_FORMAT " " PTR_FORMAT, *i_card, p2i(start_card), p2i(end_card));
+    *i_card = which;
+  }
+
+  size_t const which_word = (SIZE_MAX / 255) * which;
+  for (; pointer_delta(end_card, i_card, sizeof(CardValue)) >= sizeof(size_t); i_card += sizeof(size_t)) {
+    size_t* cur_word = reinterpret_cast<size_t*>(i_card);
+    assert(*cur_word == WordAllDirty,
+           "Must have been dirty " SIZE_FORMAT_X " start " PTR_FORMAT " " PTR_FORMAT, *cur_word, p2i(start_card), p2i(end_card));
+    *cur_word = which_word;
+  }
+
+  for (; i_card < end_card; ++i_card) {
+    assert(*i_card == dirty_card_val(),
+           "Must have been dirty %d start " PTR_FORMAT " " PTR_FORMAT, *i_card, p2i(start_card), p2i(end_card));
     *i_card = which;
   }
 }
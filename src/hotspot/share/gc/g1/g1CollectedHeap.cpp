@@ -60,7 +60,9 @@
 #include "gc/g1/g1ParallelCleaning.hpp"
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1PeriodicGCTask.hpp"
+#include "gc/g1/g1PinnableArrayAllocator.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1PreTouchRegionTask.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RegionPinCache.inline.hpp"
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
@@ -403,7 +405,30 @@ G1CollectedHeap::mem_allocate(size_t word_size,
   return attempt_allocation(word_size, word_size, &dummy);
 }
 
-HeapWord* G1CollectedHeap::attempt_allocation_slow(size_t word_size) {
+bool G1CollectedHeap::is_pinnable_array(Klass* klass, size_t word_size) const {
+  return G1PinnableArrayMinSize > 0 &&
+         klass->is_typeArray_klass() &&
+         word_size * HeapWordSize >= G1PinnableArrayMinSize &&
+         !is_humongous(word_size);
+}
+
+oop G1CollectedHeap::array_allocate(Klass* klass, size_t size, int length, bool do_zero, TRAPS) {
+  if (is_pinnable_array(klass, size)) {
+    G1PinnableArrayAllocator allocator(klass, size, length, do_zero, THREAD);
+    return allocator.allocate();
+  }
+  return CollectedHeap::array_allocate(klass, size, length, do_zero, THREAD);
+}
+
+HeapWord* G1CollectedHeap::mem_allocate_pinnable(size_t word_size) {
+  assert_heap_not_locked_and_not_at_safepoint();
+  assert(!is_humongous(word_size), "humongous arrays are not pinnable allocations");
+
+  size_t dummy = 0;
+  return attempt_allocation(word_size, word_size, &dummy, true /* pinnable */);
+}
+
+HeapWord* G1CollectedHeap::attempt_allocation_slow(size_t word_size, bool pinnable) {
   ResourceMark rm; // For retrieving the thread names in log messages.
 
   // Make sure you read the note in attempt_allocation_humongous().
@@ -427,7 +452,7 @@ HeapWord* G1CollectedHeap::attempt_allocation_slow(size_t word_size) {
 
       // Now that we have the lock, we first retry the allocation in case another
       // thread changed the region while we were waiting to acquire the lock.
-      result = _allocator->attempt_allocation_locked(word_size);
+      result = _allocator->attempt_allocation_locked(word_size, pinnable);
       if (result != nullptr) {
         return result;
       }
@@ -454,7 +479,7 @@ HeapWord* G1CollectedHeap::attempt_allocation_slow(size_t word_size) {
     // here and the follow-on attempt will be at the start of the next loop
     // iteration (after taking the Heap_lock).
     size_t dummy = 0;
-    result = _allocator->attempt_allocation(word_size, word_size, &dummy);
+    result = _allocator->attempt_allocation(word_size, word_size, &dummy, pinnable);
     if (result != nullptr) {
       return result;
     }
@@ -583,16 +608,17 @@ void G1CollectedHeap::dealloc_archive_regions(MemRegion range) {
 
 inline HeapWord* G1CollectedHeap::attempt_allocation(size_t min_word_size,
                                                      size_t desired_word_size,
-                                                     size_t* actual_word_size) {
+                                                     size_t* actual_word_size,
+                                                     bool pinnable) {
   assert_heap_not_locked_and_not_at_safepoint();
   assert(!is_humongous(desired_word_size), "attempt_allocation() should not "
          "be called for humongous allocation requests");
 
-  HeapWord* result = _allocator->attempt_allocation(min_word_size, desired_word_size, actual_word_size);
+  HeapWord* result = _allocator->attempt_allocation(min_word_size, desired_word_size, actual_word_size, pinnable);
 
   if (result == nullptr) {
     *actual_word_size = desired_word_size;
-    result = attempt_allocation_slow(desired_word_size);
+    result = attempt_allocation_slow(desired_word_size, pinnable);
   }
 
   assert_heap_not_locked();
@@ -1018,6 +1044,12 @@ bool G1CollectedHeap::expand(size_t expand_bytes, WorkerThreads* pretouch_worker
   assert(actual_expand_bytes <= aligned_expand_bytes, "post-condition");
   policy()->record_new_heap_size(num_regions());
 
+  // The initial expansion happens before the service thread exists; that
+  // memory is scheduled for touching once the thread has been created.
+  if (_service_thread != nullptr) {
+    pretouch_regions_if_necessary();
+  }
+
   return true;
 }
 
@@ -1424,6 +1456,8 @@ jint G1CollectedHeap::initialize() {
   _free_arena_memory_task = new G1MonotonicArenaFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_arena_memory_task);
 
+  pretouch_regions_if_necessary();
+
   // Here we allocate the dummy G1HeapRegion that is required by the
   // G1AllocRegion class.
   G1HeapRegion* dummy_region = _hrm.get_dummy_region();
@@ -2258,6 +2292,20 @@ void G1CollectedHeap::uncommit_regions_if_necessary() {
   }
 }
 
+uint G1CollectedHeap::pretouch_regions(uint region_limit) {
+  return _hrm.pretouch_untouched_regions(region_limit);
+}
+
+bool G1CollectedHeap::has_untouched_regions() {
+  return _hrm.has_untouched_regions();
+}
+
+void G1CollectedHeap::pretouch_regions_if_necessary() {
+  if (has_untouched_regions()) {
+    G1PreTouchRegionTask::enqueue();
+  }
+}
+
 void G1CollectedHeap::verify_numa_regions(const char* desc) {
   LogTarget(Trace, gc, heap, verify) lt;
 
@@ -2302,8 +2350,9 @@ void G1CollectedHeap::start_concurrent_cycle(bool concurrent_operation_is_full_m
 }
 
 bool G1CollectedHeap::is_potential_eager_reclaim_candidate(G1HeapRegion* r) const {
-  // We don't nominate objects with many remembered set entries, on
-  // the assumption that such objects are likely still live.
+  // Optionally, do not nominate objects with many remembered set entries, on
+  // the assumption that such objects are likely still live. Merging their
+  // remembered sets is distributed across all workers.
   G1HeapRegionRemSet* rem_set = r->rem_set();
 
   return rem_set->occupancy_less_or_equal_than(G1EagerReclaimRemSetThreshold);
@@ -2615,6 +2664,26 @@ void G1CollectedHeap::set_young_gen_card_set_stats(const G1MonotonicArenaMemoryS
   _young_gen_card_set_stats = stats;
 }
 
+void G1CollectedHeap::free_excess_card_set_memory(const char* pause_name) {
+  if (!G1RemSetFreeMemoryInMarkPauses) {
+    return;
+  }
+
+  class G1SumCardSetMemoryStatsClosure : public G1HeapRegionClosure {
+  public:
+    G1MonotonicArenaMemoryStats _total;
+
+    bool do_heap_region(G1HeapRegion* r) override {
+      _total.add(r->rem_set()->card_set_memory_stats());
+      return false;
+    }
+  } cl;
+  heap_region_iterate(&cl);
+  cl._total.add(_young_regions_cardset_mm.memory_stats());
+
+  _free_arena_memory_task->free_excess_memory_at_safepoint(cl._total, pause_name);
+}
+
 void G1CollectedHeap::record_obj_copy_mem_stats() {
   size_t total_old_allocated = _old_evac_stats.allocated() + _old_evac_stats.direct_allocated();
   policy()->old_gen_alloc_tracker()->
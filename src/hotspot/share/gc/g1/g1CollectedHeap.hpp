@@ -262,6 +262,10 @@ class G1CollectedHeap : public CollectedHeap {
   void set_collection_set_candidates_stats(G1MonotonicArenaMemoryStats& stats);
   void set_young_gen_card_set_stats(const G1MonotonicArenaMemoryStats& stats);
 
+  // Returns free card set memory exceeding G1RemSetFreeMemoryKeepExcessRatio of
+  // the currently used card set memory to the OS right away.
+  void free_excess_card_set_memory(const char* pause_name);
+
   void update_parallel_gc_threads_cpu_time();
 private:
 
@@ -442,15 +446,17 @@ class G1CollectedHeap : public CollectedHeap {
 
   // First-level mutator allocation attempt: try to allocate out of
   // the mutator alloc region without taking the Heap_lock. This
-  // should only be used for non-humongous allocations.
+  // should only be used for non-humongous allocations. With pinnable,
+  // allocate out of the alloc region for likely pinned primitive arrays.
   inline HeapWord* attempt_allocation(size_t min_word_size,
                                       size_t desired_word_size,
-                                      size_t* actual_word_size);
+                                      size_t* actual_word_size,
+                                      bool pinnable = false);
 
   // Second-level mutator allocation attempt: take the Heap_lock and
   // retry the allocation attempt, potentially scheduling a GC
   // pause. This should only be used for non-humongous allocations.
-  HeapWord* attempt_allocation_slow(size_t word_size);
+  HeapWord* attempt_allocation_slow(size_t word_size, bool pinnable = false);
 
   // Takes the Heap_lock and attempts a humongous allocation. It can
   // potentially schedule a GC pause.
@@ -560,6 +566,17 @@ class G1CollectedHeap : public CollectedHeap {
   void pin_object(JavaThread* thread, oop obj) override;
   void unpin_object(JavaThread* thread, oop obj) override;
 
+  bool can_clear_arrays_in_segments() const override { return true; }
+
+  oop array_allocate(Klass* klass, size_t size, int length, bool do_zero, TRAPS) override;
+
+  // Whether a primitive array of the given size is likely to be pinned and
+  // is allocated into the pinnable alloc region (G1PinnableArrayMinSize).
+  bool is_pinnable_array(Klass* klass, size_t word_size) const;
+
+  // Allocates memory for a likely pinned primitive array outside TLABs.
+  HeapWord* mem_allocate_pinnable(size_t word_size);
+
   void resize_heap_if_necessary();
 
   // Check if there is memory to uncommit and if so schedule a task to do it.
@@ -568,6 +585,13 @@ class G1CollectedHeap : public CollectedHeap {
   uint uncommit_regions(uint region_limit);
   bool has_uncommittable_regions();
 
+  // Check if there are regions committed by expansion that have not been
+  // touched yet and if so schedule a task to touch them (G1ConcurrentPreTouch).
+  void pretouch_regions_if_necessary();
+  // Immediately touch untouched regions.
+  uint pretouch_regions(uint region_limit);
+  bool has_untouched_regions();
+
   G1NUMA* numa() const { return _numa; }
 
   // Expand the garbage-first heap by at least the given size (in bytes!).
@@ -1448,6 +1448,11 @@ void G1ConcurrentMark::remark() {
       }
     }
 
+    {
+      GCTraceTime(Debug, gc, phases) debug("Free Excess Card Set Memory", _gc_timer_cm);
+      _g1h->free_excess_card_set_memory("Remark");
+    }
+
     if (log_is_enabled(Trace, gc, liveness)) {
       G1PrintRegionLivenessInfoClosure cl("Post-Marking");
       _g1h->heap_region_iterate(&cl);
@@ -1535,6 +1540,11 @@ void G1ConcurrentMark::cleanup() {
     log_debug(gc, phases)("No Remembered Sets to update after rebuild");
   }
 
+  {
+    GCTraceTime(Debug, gc, phases) debug("Free Excess Card Set Memory", _gc_timer_cm);
+    _g1h->free_excess_card_set_memory("Cleanup");
+  }
+
   verify_during_pause(G1HeapVerifier::G1VerifyCleanup, VerifyLocation::CleanupAfter);
 
   // Local statistics
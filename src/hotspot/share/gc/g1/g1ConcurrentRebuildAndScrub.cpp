@@ -36,6 +36,7 @@
 #include "logging/log.hpp"
 #include "memory/memRegion.hpp"
 #include "oops/oopsHierarchy.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -79,6 +80,14 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
 
     const size_t ProcessingYieldLimitInWords = G1RebuildRemSetChunkSize / HeapWordSize;
 
+    // Thread CPU time and elapsed time at the start of the current chunk.
+    const bool _should_throttle;
+    jlong _chunk_start_cpu_ns;
+    jlong _chunk_start_ns;
+
+    // Maximum time to back off after a single chunk.
+    static const jlong MaxThrottleMillis = 10;
+
     void reset_processed_words() {
       _processed_words = 0;
     }
@@ -87,15 +96,47 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       _processed_words += processed;
     }
 
+    void start_chunk() {
+      if (_should_throttle) {
+        _chunk_start_cpu_ns = os::current_thread_cpu_time();
+        _chunk_start_ns = os::javaTimeNanos();
+      }
+    }
+
+    // If this thread did not get a CPU for a large part of the last chunk,
+    // other (mutator) threads compete for it. Back off for about the time
+    // we were waiting, so that the rebuild adapts to the available CPU.
+    void throttle_if_necessary() {
+      if (!_should_throttle) {
+        return;
+      }
+      jlong const elapsed_ns = os::javaTimeNanos() - _chunk_start_ns;
+      jlong const cpu_ns = os::current_thread_cpu_time() - _chunk_start_cpu_ns;
+      if (cpu_ns * 100 >= elapsed_ns * G1RebuildRemSetThrottlePercent) {
+        return;
+      }
+      jlong const backoff_ms = MIN2((elapsed_ns - cpu_ns) / NANOSECS_PER_MILLISEC, MaxThrottleMillis);
+      if (backoff_ms > 0) {
+        SuspendibleThreadSetLeaver sts_leave;
+        os::naked_short_sleep(backoff_ms);
+      }
+    }
+
     // Yield if enough has been processed. Return whether we should stop
     // processing this region because either the concurrent marking cycle has been
     // aborted or the region has been reclaimed.
     bool yield_if_necessary(G1HeapRegion* hr) {
       if (_processed_words >= ProcessingYieldLimitInWords) {
         reset_processed_words();
+        // Buffered remembered set entries must not survive a safepoint as
+        // their target regions may be reclaimed.
+        _rebuild_closure.flush();
+        throttle_if_necessary();
         // If a yield occurs (potential young-gc pause), must recheck for
         // potential regions reclamation.
-        if (_cm->do_yield_check() && !should_rebuild_or_scrub(hr)) {
+        bool yielded = _cm->do_yield_check();
+        start_chunk();
+        if (yielded && !should_rebuild_or_scrub(hr)) {
           return true;
         }
       }
@@ -249,11 +290,19 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       _bitmap(_cm->mark_bitmap()),
       _rebuild_closure(G1CollectedHeap::heap(), worker_id),
       _should_rebuild_remset(should_rebuild_remset),
-      _processed_words(0) { }
+      _processed_words(0),
+      _should_throttle(should_rebuild_remset &&
+                       G1RebuildRemSetThrottlePercent > 0 &&
+                       os::is_thread_cpu_time_supported()),
+      _chunk_start_cpu_ns(0),
+      _chunk_start_ns(0) {
+      start_chunk();
+    }
 
     bool do_heap_region(G1HeapRegion* hr) {
       // Avoid stalling safepoints and stop iteration if mark cycle has been aborted.
       _cm->do_yield_check();
+      start_chunk();
       if (_cm->has_aborted()) {
         return true;
       }
@@ -277,6 +326,7 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
         // No need to scrub humongous, but we should scan it to rebuild remsets.
         scan_humongous_region(hr, pb);
       }
+      _rebuild_closure.flush();
 
       return _cm->has_aborted();
     }
@@ -31,6 +31,7 @@
 #include "gc/g1/g1DirtyCardQueue.hpp"
 #include "gc/g1/g1FreeIdSet.hpp"
 #include "gc/g1/g1HeapRegionRemSet.inline.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RemSet.hpp"
 #include "gc/g1/g1ThreadLocalData.hpp"
@@ -69,14 +70,37 @@ G1DirtyCardQueueSet::G1DirtyCardQueueSet(BufferNode::Allocator* allocator) :
   PtrQueueSet(allocator),
   _num_cards(0),
   _mutator_refinement_threshold(SIZE_MAX),
-  _completed(),
+  _completed(nullptr),
+  _num_shards(G1NUMA::numa()->num_active_nodes()),
   _paused(),
   _free_ids(par_ids_start(), num_par_ids()),
   _detached_refinement_stats()
-{}
+{
+  _completed = NEW_C_HEAP_ARRAY(PaddedEnd<CompletedQueue>, _num_shards, mtGC);
+  for (uint i = 0; i < _num_shards; i++) {
+    ::new (&_completed[i]) PaddedEnd<CompletedQueue>();
+  }
+}
 
 G1DirtyCardQueueSet::~G1DirtyCardQueueSet() {
   abandon_completed_buffers();
+  for (uint i = 0; i < _num_shards; i++) {
+    _completed[i].~PaddedEnd<CompletedQueue>();
+  }
+  FREE_C_HEAP_ARRAY(PaddedEnd<CompletedQueue>, _completed);
+}
+
+uint G1DirtyCardQueueSet::current_shard() const {
+  if (_num_shards == 1) {
+    return 0;
+  }
+  uint shard = G1NUMA::numa()->index_of_current_thread();
+  return shard < _num_shards ? shard : 0;
+}
+
+G1DirtyCardQueueSet::CompletedQueue& G1DirtyCardQueueSet::completed(uint shard) const {
+  assert(shard < _num_shards, "invalid shard %u", shard);
+  return _completed[shard];
 }
 
 // Determines how many mutator threads can process the buffers in parallel.
@@ -130,28 +154,35 @@ void G1DirtyCardQueueSet::enqueue_completed_buffer(BufferNode* cbn) {
   // observing it (attaching it to the new buffer).  We need to ensure it
   // can't be reused until the push completes, to avoid ABA problems.
   GlobalCounter::CriticalSection cs(Thread::current());
-  _completed.push(*cbn);
+  completed(current_shard()).push(*cbn);
 }
 
 // Thread-safe attempt to remove and return the first buffer from
-// the _completed queue, using the NonblockingQueue::try_pop() underneath.
-// It has a limitation that it may return null when there are objects
+// the _completed queues, using the NonblockingQueue::try_pop() underneath.
+// The current thread's shard is tried first, then the other shards.
+// try_pop() has a limitation that it may return null when there are objects
 // in the queue if there is a concurrent push/append operation.
 BufferNode* G1DirtyCardQueueSet::dequeue_completed_buffer() {
   Thread* current_thread = Thread::current();
-  BufferNode* result = nullptr;
-  while (true) {
-    // Use GlobalCounter critical section to avoid ABA problem.
-    // The release of a buffer to its allocator's free list uses
-    // GlobalCounter::write_synchronize() to coordinate with this
-    // dequeuing operation.
-    // We use a CS per iteration, rather than over the whole loop,
-    // because we're not guaranteed to make progress. Lingering in
-    // one CS could defer releasing buffer to the free list for reuse,
-    // leading to excessive allocations.
-    GlobalCounter::CriticalSection cs(current_thread);
-    if (_completed.try_pop(&result)) return result;
+  const uint start_shard = current_shard();
+  for (uint i = 0; i < _num_shards; i++) {
+    CompletedQueue& queue = completed((start_shard + i) % _num_shards);
+    BufferNode* result = nullptr;
+    while (true) {
+      // Use GlobalCounter critical section to avoid ABA problem.
+      // The release of a buffer to its allocator's free list uses
+      // GlobalCounter::write_synchronize() to coordinate with this
+      // dequeuing operation.
+      // We use a CS per iteration, rather than over the whole loop,
+      // because we're not guaranteed to make progress. Lingering in
+      // one CS could defer releasing buffer to the free list for reuse,
+      // leading to excessive allocations.
+      GlobalCounter::CriticalSection cs(current_thread);
+      if (queue.try_pop(&result)) break;
+    }
+    if (result != nullptr) return result;
   }
+  return nullptr;
 }
 
 BufferNode* G1DirtyCardQueueSet::get_completed_buffer() {
@@ -168,10 +199,13 @@ BufferNode* G1DirtyCardQueueSet::get_completed_buffer() {
 #ifdef ASSERT
 void G1DirtyCardQueueSet::verify_num_cards() const {
   size_t actual = 0;
-  for (BufferNode* cur = _completed.first();
-       !_completed.is_end(cur);
-       cur = cur->next()) {
-    actual += cur->size();
+  for (uint i = 0; i < _num_shards; i++) {
+    const CompletedQueue& queue = completed(i);
+    for (BufferNode* cur = queue.first();
+         !queue.is_end(cur);
+         cur = cur->next()) {
+      actual += cur->size();
+    }
   }
   assert(actual == Atomic::load(&_num_cards),
          "Num entries in completed buffers should be " SIZE_FORMAT " but are " SIZE_FORMAT,
@@ -295,7 +329,7 @@ void G1DirtyCardQueueSet::enqueue_paused_buffers_aux(const HeadTail& paused) {
   if (paused._head != nullptr) {
     assert(paused._tail != nullptr, "invariant");
     // Cards from paused buffers are already recorded in the queue count.
-    _completed.append(*paused._head, *paused._tail);
+    completed(current_shard()).append(*paused._head, *paused._tail);
   }
 }
 
@@ -327,17 +361,30 @@ void G1DirtyCardQueueSet::merge_bufferlists(G1RedirtyCardsQueueSet* src) {
   const BufferNodeList from = src->take_all_completed_buffers();
   if (from._head != nullptr) {
     Atomic::add(&_num_cards, from._entry_count);
-    _completed.append(*from._head, *from._tail);
+    completed(current_shard()).append(*from._head, *from._tail);
   }
 }
 
 BufferNodeList G1DirtyCardQueueSet::take_all_completed_buffers() {
   enqueue_all_paused_buffers();
   verify_num_cards();
-  Pair<BufferNode*, BufferNode*> pair = _completed.take_all();
+  BufferNode* head = nullptr;
+  BufferNode* tail = nullptr;
+  for (uint i = 0; i < _num_shards; i++) {
+    Pair<BufferNode*, BufferNode*> pair = completed(i).take_all();
+    if (pair.first == nullptr) {
+      continue;
+    }
+    if (head == nullptr) {
+      head = pair.first;
+    } else {
+      tail->set_next(pair.first);
+    }
+    tail = pair.second;
+  }
   size_t num_cards = Atomic::load(&_num_cards);
   Atomic::store(&_num_cards, size_t(0));
-  return BufferNodeList(pair.first, pair.second, num_cards);
+  return BufferNodeList(head, tail, num_cards);
 }
 
 class G1RefineBufferedCards : public StackObj {
@@ -165,11 +165,15 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // mutator must start doing some of the concurrent refinement work.
   volatile size_t _mutator_refinement_threshold;
   DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(size_t));
-  // Buffers ready for refinement.
-  // NonblockingQueue has inner padding of one cache line.
-  NonblockingQueue<BufferNode, &BufferNode::next_ptr> _completed;
-  // Add a trailer padding after NonblockingQueue.
-  DEFINE_PAD_MINUS_SIZE(3, DEFAULT_PADDING_SIZE, sizeof(BufferNode*));
+  // Buffers ready for refinement, sharded by NUMA node so that threads
+  // enqueue to and dequeue from the queue of their own node first. There is
+  // a single shard if NUMA support is not enabled.
+  // NonblockingQueue has inner padding of one cache line, PaddedEnd adds a
+  // trailer padding.
+  using CompletedQueue = NonblockingQueue<BufferNode, &BufferNode::next_ptr>;
+  PaddedEnd<CompletedQueue>* _completed;
+  uint _num_shards;
+  DEFINE_PAD_MINUS_SIZE(3, DEFAULT_PADDING_SIZE, sizeof(PaddedEnd<CompletedQueue>*) + sizeof(uint));
   // Buffers for which refinement is temporarily paused.
   // PausedBuffers has inner padding, including trailer.
   PausedBuffers _paused;
@@ -182,6 +186,10 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // Verify _num_cards == sum of cards in the completed queue.
   void verify_num_cards() const NOT_DEBUG_RETURN;
 
+  // The completed queue shard of the NUMA node the current thread runs on.
+  uint current_shard() const;
+  CompletedQueue& completed(uint shard) const;
+
   // Thread-safe add a buffer to paused list for next safepoint.
   // precondition: not at safepoint.
   void record_paused_buffer(BufferNode* node);
@@ -211,9 +219,9 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   void handle_refined_buffer(BufferNode* node, bool fully_processed);
 
   // Thread-safe attempt to remove and return the first buffer from
-  // the _completed queue.
-  // Returns null if the queue is empty, or if a concurrent push/append
-  // interferes. It uses GlobalCounter critical section to avoid ABA problem.
+  // the _completed queues, starting with the current thread's shard.
+  // Returns null if the queues are empty. It uses GlobalCounter critical
+  // section to avoid ABA problem.
   BufferNode* dequeue_completed_buffer();
   // Remove and return a completed buffer from the list, or return null
   // if none available.
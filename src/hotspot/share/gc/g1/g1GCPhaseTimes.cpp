@@ -147,6 +147,10 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
 
   _gc_par_phases[SampleCollectionSetCandidates] = new WorkerDataArray<double>("SampleCandidates", "Sample CSet Candidates (ms):", max_gc_threads);
 
+  _gc_par_phases[ObjCopy]->create_thread_work_items("Stolen Tasks:");
+
+  _gc_par_phases[OptObjCopy]->create_thread_work_items("Optional Stolen Tasks:");
+
   _gc_par_phases[Termination]->create_thread_work_items("Termination Attempts:");
 
   _gc_par_phases[OptTermination]->create_thread_work_items("Optional Termination Attempts:");
@@ -28,7 +28,12 @@
 #include "gc/g1/g1HeapRegionEventSender.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "memory/allocation.hpp"
 #include "runtime/vmThread.hpp"
+#include "utilities/macros.hpp"
+#if INCLUDE_JFR
+#include "jfr/recorder/repository/jfrRepository.hpp"
+#endif
 
 class DumpEventInfoClosure : public G1HeapRegionClosure {
 public:
@@ -57,3 +62,74 @@ void G1HeapRegionEventSender::send_events() {
     VMThread::execute(&op);
   }
 }
+
+// The last reported state of each reserved region, used to only report changed
+// regions between full snapshots. Uncommitted regions are recorded with the
+// sentinel type. The state belongs to the chunk that started at
+// _reported_chunk_start, the first request in any other chunk reports every
+// committed region again. Only accessed by the VM thread, inside the operation
+// below.
+struct G1ReportedRegionState {
+  size_t _used;
+  G1HeapRegionTraceType::Type _type;
+};
+
+static G1ReportedRegionState* _reported = nullptr;
+static jlong _reported_chunk_start = 0;
+
+static void send_delta_event(uint index, G1HeapRegionTraceType::Type type, HeapWord* bottom, size_t used) {
+  EventG1HeapRegionInformationDelta evt;
+  evt.set_index(index);
+  evt.set_type(type);
+  evt.set_start((uintptr_t)bottom);
+  evt.set_used(used);
+  evt.commit();
+}
+
+class VM_G1SendHeapRegionDeltaEvents : public VM_Operation {
+  virtual void doit() {
+    G1CollectedHeap* const g1h = G1CollectedHeap::heap();
+    const uint length = g1h->max_reserved_regions();
+    if (_reported == nullptr) {
+      _reported = NEW_C_HEAP_ARRAY(G1ReportedRegionState, length, mtGC);
+    }
+    jlong chunk_start = 0;
+    JFR_ONLY(chunk_start = JfrRepository::current_chunk_start_nanos();)
+    const bool full = chunk_start != _reported_chunk_start;
+    if (full) {
+      for (uint i = 0; i < length; i++) {
+        _reported[i]._used = 0;
+        _reported[i]._type = G1HeapRegionTraceType::G1HeapRegionTypeEndSentinel;
+      }
+      _reported_chunk_start = chunk_start;
+    }
+    for (uint i = 0; i < length; i++) {
+      G1ReportedRegionState& reported = _reported[i];
+      G1HeapRegion* const r = g1h->region_at_or_null(i);
+      if (r == nullptr) {
+        // An uncommitted region is reported once as empty and free, then omitted.
+        if (reported._type != G1HeapRegionTraceType::G1HeapRegionTypeEndSentinel) {
+          send_delta_event(i, G1HeapRegionTraceType::Free, g1h->bottom_addr_for_region(i), 0);
+          reported._type = G1HeapRegionTraceType::G1HeapRegionTypeEndSentinel;
+          reported._used = 0;
+        }
+        continue;
+      }
+      const G1HeapRegionTraceType::Type type = r->get_trace_type();
+      const size_t used = r->used();
+      if (full || type != reported._type || used != reported._used) {
+        send_delta_event(i, type, r->bottom(), used);
+        reported._type = type;
+        reported._used = used;
+      }
+    }
+  }
+  virtual VMOp_Type type() const { return VMOp_HeapIterateOperation; }
+};
+
+void G1HeapRegionEventSender::send_delta_events() {
+  if (UseG1GC) {
+    VM_G1SendHeapRegionDeltaEvents op;
+    VMThread::execute(&op);
+  }
+}
@@ -30,6 +30,9 @@
 class G1HeapRegionEventSender : public AllStatic {
 public:
   static void send_events();
+  // The first call in a chunk reports every committed region, later calls in
+  // the same chunk only report regions whose type or used bytes changed.
+  static void send_delta_events();
 };
 
 #endif // SHARE_GC_G1_G1HEAPREGIONEVENTSENDER_HPP
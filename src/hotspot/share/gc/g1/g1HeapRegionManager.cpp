@@ -32,12 +32,14 @@
 #include "gc/g1/g1HeapRegionPrinter.hpp"
 #include "gc/g1/g1HeapRegionSet.inline.hpp"
 #include "gc/g1/g1NUMAStats.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 class G1MasterFreeRegionListChecker : public G1HeapRegionSetChecker {
@@ -66,6 +68,7 @@ G1HeapRegionManager::G1HeapRegionManager() :
   _bot_mapper(nullptr),
   _cardtable_mapper(nullptr),
   _committed_map(),
+  _untouched_map(mtGC),
   _next_highest_used_hrm_index(0),
   _regions(), _heap_mapper(nullptr),
   _bitmap_mapper(nullptr),
@@ -88,6 +91,10 @@ void G1HeapRegionManager::initialize(G1RegionToSpaceMapper* heap_storage,
   _regions.initialize(heap_storage->reserved(), G1HeapRegion::GrainBytes);
 
   _committed_map.initialize(reserved_length());
+
+  if (G1ConcurrentPreTouch && !AlwaysPreTouch) {
+    _untouched_map.initialize(reserved_length());
+  }
 }
 
 G1HeapRegion* G1HeapRegionManager::allocate_free_region(G1HeapRegionType type, uint requested_node_index) {
@@ -173,6 +180,9 @@ void G1HeapRegionManager::expand(uint start, uint num_regions, WorkerThreads* pr
     }
     G1HeapRegionPrinter::commit(hr);
   }
+  if (_untouched_map.size() > 0) {
+    _untouched_map.par_at_put_range(start, start + num_regions, true);
+  }
   activate_regions(start, num_regions);
 }
 
@@ -203,6 +213,10 @@ void G1HeapRegionManager::uncommit_regions(uint start, uint num_regions) {
     }
   }
 
+  if (_untouched_map.size() > 0) {
+    _untouched_map.par_at_put_range(start, end, false);
+  }
+
   // Uncommit heap memory
   _heap_mapper->uncommit_regions(start, num_regions);
 
@@ -307,6 +321,37 @@ uint G1HeapRegionManager::uncommit_inactive_regions(uint limit) {
   return uncommitted;
 }
 
+bool G1HeapRegionManager::has_untouched_regions() const {
+  return _untouched_map.size() > 0 &&
+         _untouched_map.find_first_set_bit(0) < _untouched_map.size();
+}
+
+uint G1HeapRegionManager::pretouch_untouched_regions(uint limit) {
+  assert(limit > 0, "Need to specify at least one region to pre-touch");
+  assert(Thread::current()->is_suspendible_thread(), "must be joined to touch regions safely");
+
+  // Regions are only uncommitted by the service thread, so an active region
+  // stays committed while it is touched. Mutators may allocate into it
+  // concurrently, which is fine as os::pretouch_memory() does not change
+  // memory contents.
+  const size_t page_size = _heap_mapper->page_size();
+  uint touched = 0;
+  BitMap::idx_t i = _untouched_map.find_first_set_bit(0);
+  while (i < _untouched_map.size() && touched < limit) {
+    if (SuspendibleThreadSet::should_yield()) {
+      break;
+    }
+    _untouched_map.par_clear_bit(i);
+    if (is_available((uint)i)) {
+      G1HeapRegion* hr = at((uint)i);
+      os::pretouch_memory(hr->bottom(), hr->end(), page_size);
+      touched++;
+    }
+    i = _untouched_map.find_first_set_bit(i + 1);
+  }
+  return touched;
+}
+
 uint G1HeapRegionManager::expand_inactive(uint num_regions) {
   uint offset = 0;
   uint expanded = 0;
@@ -31,6 +31,7 @@
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "memory/allocation.hpp"
 #include "services/memoryUsage.hpp"
+#include "utilities/bitMap.hpp"
 
 class G1HeapRegion;
 class G1HeapRegionClaimer;
@@ -81,6 +82,10 @@ class G1HeapRegionManager: public CHeapObj<mtGC> {
   // can either be active (ready for use) or inactive (ready for uncommit).
   G1CommittedRegionMap _committed_map;
 
+  // Regions committed by expansion whose memory has not been touched yet. Only
+  // used with G1ConcurrentPreTouch.
+  CHeapBitMap _untouched_map;
+
   // Internal only. The highest heap region index +1 we allocated a G1HeapRegion instance for.
   uint _next_highest_used_hrm_index;
 
@@ -283,6 +288,15 @@ class G1HeapRegionManager: public CHeapObj<mtGC> {
   // actual number uncommitted.
   uint uncommit_inactive_regions(uint limit);
 
+  // Check if there are committed regions that have not been touched yet.
+  bool has_untouched_regions() const;
+
+  // Touch the memory of active untouched regions. Limit the number of regions
+  // to touch, stop early if a safepoint is pending, and return the actual
+  // number touched. Must be called by a thread joined to the suspendible
+  // thread set.
+  uint pretouch_untouched_regions(uint limit);
+
   void verify();
 
   // Do some sanity checking.
@@ -135,6 +135,9 @@ class G1HeapRegionRemSet : public CHeapObj<mtGC> {
 
   inline void add_reference(OopOrNarrowOopStar from, uint tid);
 
+  // Adds the given sorted and unique cards (as returned by to_card()).
+  inline void add_cards(const uintptr_t* cards, size_t num_cards);
+
   // The region is being reclaimed; clear its remset, and any mention of
   // entries for this region in other remsets.
   void clear(bool only_cardset = false, bool keep_tracked = false);
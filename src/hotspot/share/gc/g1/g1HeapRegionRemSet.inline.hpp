@@ -140,6 +140,11 @@ void G1HeapRegionRemSet::add_reference(OopOrNarrowOopStar from, uint tid) {
   _card_set->add_card(to_card(from));
 }
 
+void G1HeapRegionRemSet::add_cards(const uintptr_t* cards, size_t num_cards) {
+  assert(_state != Untracked, "must be");
+  _card_set->add_cards(cards, num_cards);
+}
+
 bool G1HeapRegionRemSet::contains_reference(OopOrNarrowOopStar from) {
   return _card_set->contains_card(to_card(from));
 }
@@ -193,6 +193,36 @@ void G1MonotonicArenaFreeMemoryTask::execute() {
   }
 }
 
+void G1MonotonicArenaFreeMemoryTask::free_excess_memory_at_safepoint(const G1MonotonicArenaMemoryStats& total_used,
+                                                                     const char* pause_name) {
+  assert_at_safepoint_on_vm_thread();
+
+  G1MonotonicArenaFreePool* freelist_pool = G1CollectedHeap::heap()->card_set_freelist_pool();
+  G1MonotonicArenaMemoryStats free_before = freelist_pool->memory_sizes();
+
+  G1MonotonicArenaMemoryStats keep;
+  size_t used_size = 0;
+  for (uint i = 0; i < total_used.num_pools(); i++) {
+    keep._num_mem_sizes[i] = keep_size(free_before._num_mem_sizes[i],
+                                       total_used._num_mem_sizes[i],
+                                       G1RemSetFreeMemoryKeepExcessRatio);
+    used_size += total_used._num_mem_sizes[i];
+  }
+  freelist_pool->return_excess_to_os(keep);
+
+  G1MonotonicArenaMemoryStats free_after = freelist_pool->memory_sizes();
+  size_t returned_size = 0;
+  size_t returned_segments = 0;
+  size_t free_size = 0;
+  for (uint i = 0; i < free_after.num_pools(); i++) {
+    returned_size += free_before._num_mem_sizes[i] - MIN2(free_before._num_mem_sizes[i], free_after._num_mem_sizes[i]);
+    returned_segments += free_before._num_segments[i] - MIN2(free_before._num_segments[i], free_after._num_segments[i]);
+    free_size += free_after._num_mem_sizes[i];
+  }
+  log_info(gc, remset)("%s: Card set memory returned to the OS: %zu segments, %zuB; used %zuB, free %zuB",
+                       pause_name, returned_segments, returned_size, used_size, free_size);
+}
+
 void G1MonotonicArenaFreeMemoryTask::notify_new_stats(G1MonotonicArenaMemoryStats* young_gen_stats,
                                                       G1MonotonicArenaMemoryStats* collection_set_candidate_stats) {
   assert_at_safepoint_on_vm_thread();
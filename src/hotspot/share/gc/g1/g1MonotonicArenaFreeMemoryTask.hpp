@@ -91,6 +91,10 @@ class G1MonotonicArenaFreeMemoryTask : public G1ServiceTask {
   // generation and the collection set candidate sets.
   void notify_new_stats(G1MonotonicArenaMemoryStats* young_gen_stats,
                         G1MonotonicArenaMemoryStats* collection_set_candidate_stats);
+
+  // Immediately returns free monotonic arena memory exceeding what is kept for
+  // the given usage to the OS. Used in pauses that cleared many remembered sets.
+  void free_excess_memory_at_safepoint(const G1MonotonicArenaMemoryStats& total_used, const char* pause_name);
 };
 
 #endif // SHARE_GC_G1_G1MONOTONICARENAFREEMEMORYTASK_HPP
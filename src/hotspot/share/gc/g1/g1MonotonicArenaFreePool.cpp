@@ -181,6 +181,21 @@ size_t G1MonotonicArenaFreePool::mem_size() const {
   return result;
 }
 
+void G1MonotonicArenaFreePool::return_excess_to_os(const G1MonotonicArenaMemoryStats& keep) {
+  for (uint i = 0; i < num_free_lists(); i++) {
+    G1ReturnMemoryProcessor processor(keep._num_mem_sizes[i]);
+    processor.visit_free_list(free_list(i));
+    // Without a deadline, both steps complete in a single call.
+    if (!processor.finished_return_to_vm()) {
+      processor.return_to_vm(max_jlong);
+    }
+    if (!processor.finished_return_to_os()) {
+      processor.return_to_os(max_jlong);
+    }
+    assert(processor.finished_return_to_os(), "must be");
+  }
+}
+
 void G1MonotonicArenaFreePool::print_on(outputStream* out) const {
   out->print_cr("  Free Pool: size %zu", mem_size());
   for (uint i = 0; i < _num_free_lists; i++) {
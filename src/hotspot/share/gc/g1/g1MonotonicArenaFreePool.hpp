@@ -81,6 +81,10 @@ class G1MonotonicArenaFreePool {
   G1MonotonicArenaMemoryStats memory_sizes() const;
   size_t mem_size() const;
 
+  // Deletes segments from each free list until at most the corresponding
+  // keep size is left.
+  void return_excess_to_os(const G1MonotonicArenaMemoryStats& keep);
+
   void print_on(outputStream* out) const;
 };
 
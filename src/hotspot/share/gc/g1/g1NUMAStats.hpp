@@ -87,6 +87,8 @@ class G1NUMAStats : public CHeapObj<mtGC> {
     NewRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
+    // Words copied to survivor regions, by node of the source and destination region.
+    CopyToSurvVolume,
     NodeDataItemsSentinel
   };
 
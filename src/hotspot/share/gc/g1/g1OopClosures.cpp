@@ -27,6 +27,7 @@
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1ParScanThreadState.hpp"
 #include "memory/iterator.inline.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/stack.inline.hpp"
 
 G1ParCopyHelper::G1ParCopyHelper(G1CollectedHeap* g1h,  G1ParScanThreadState* par_scan_state) :
@@ -58,3 +59,44 @@ void G1CLDScanClosure::do_cld(ClassLoaderData* cld) {
   }
   _count++;
 }
+
+G1RebuildRemSetClosure::G1RebuildRemSetClosure(G1CollectedHeap* g1h, uint worker_id) :
+  _g1h(g1h),
+  _worker_id(worker_id),
+  _buffer(NEW_C_HEAP_ARRAY(Entry, BufferSize, mtGC)),
+  _cards(NEW_C_HEAP_ARRAY(uintptr_t, BufferSize, mtGC)),
+  _num_buffered(0)
+{ }
+
+G1RebuildRemSetClosure::~G1RebuildRemSetClosure() {
+  assert(_num_buffered == 0, "must have been flushed");
+  FREE_C_HEAP_ARRAY(Entry, _buffer);
+  FREE_C_HEAP_ARRAY(uintptr_t, _cards);
+}
+
+int G1RebuildRemSetClosure::compare_entries(Entry a, Entry b) {
+  if (a._region_idx != b._region_idx) {
+    return a._region_idx < b._region_idx ? -1 : 1;
+  }
+  if (a._card != b._card) {
+    return a._card < b._card ? -1 : 1;
+  }
+  return 0;
+}
+
+void G1RebuildRemSetClosure::flush() {
+  QuickSort::sort(_buffer, _num_buffered, compare_entries);
+
+  size_t i = 0;
+  while (i < _num_buffered) {
+    uint const region_idx = _buffer[i]._region_idx;
+    size_t num_cards = 0;
+    for (; i < _num_buffered && _buffer[i]._region_idx == region_idx; i++) {
+      if (num_cards == 0 || _cards[num_cards - 1] != _buffer[i]._card) {
+        _cards[num_cards++] = _buffer[i]._card;
+      }
+    }
+    _g1h->region_at(region_idx)->rem_set()->add_cards(_cards, num_cards);
+  }
+  _num_buffered = 0;
+}
@@ -216,12 +216,34 @@ class G1ConcurrentRefineOopClosure: public BasicOopIterateClosure {
   virtual void do_oop(oop* p)       { do_oop_work(p); }
 };
 
+// Collects the remembered set entries found while rebuilding remembered sets.
+// Entries are buffered and added to the remembered sets in bulk, sorted by
+// region and card, so that card set containers are created once for the number
+// of cards they need to hold. The buffer must be flushed before the caller
+// yields for a safepoint.
 class G1RebuildRemSetClosure : public BasicOopIterateClosure {
+  struct Entry {
+    uint _region_idx;
+    uintptr_t _card;
+  };
+
+  static const size_t BufferSize = 4096;
+
   G1CollectedHeap* _g1h;
   uint _worker_id;
+
+  Entry* _buffer;
+  uintptr_t* _cards;
+  size_t _num_buffered;
+
+  static int compare_entries(Entry a, Entry b);
+
 public:
-  G1RebuildRemSetClosure(G1CollectedHeap* g1h, uint worker_id) : _g1h(g1h), _worker_id(worker_id) {
-  }
+  G1RebuildRemSetClosure(G1CollectedHeap* g1h, uint worker_id);
+  ~G1RebuildRemSetClosure();
+
+  // Adds all buffered entries to their remembered sets.
+  void flush();
 
   template <class T> void do_oop_work(T* p);
   virtual void do_oop(oop* p)       { do_oop_work(p); }
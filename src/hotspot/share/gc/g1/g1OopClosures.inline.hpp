@@ -268,7 +268,19 @@ template <class T> void G1RebuildRemSetClosure::do_oop_work(T* p) {
   G1HeapRegion* to = _g1h->heap_region_containing(obj);
   G1HeapRegionRemSet* rem_set = to->rem_set();
   if (rem_set->is_tracked()) {
-    rem_set->add_reference(p, _worker_id);
+    uint const region_idx = to->hrm_index();
+    uintptr_t const card = rem_set->to_card(p);
+    if (_num_buffered > 0 &&
+        _buffer[_num_buffered - 1]._region_idx == region_idx &&
+        _buffer[_num_buffered - 1]._card == card) {
+      // Consecutive fields of an object often refer to the same region.
+      return;
+    }
+    _buffer[_num_buffered]._region_idx = region_idx;
+    _buffer[_num_buffered]._card = card;
+    if (++_num_buffered == BufferSize) {
+      flush();
+    }
   }
 }
 
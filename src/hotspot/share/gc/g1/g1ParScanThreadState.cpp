@@ -62,7 +62,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
                                            uint worker_id,
                                            uint num_workers,
                                            G1CollectionSet* collection_set,
-                                           G1EvacFailureRegions* evac_failure_regions)
+                                           G1EvacFailureRegions* evac_failure_regions,
+                                           volatile uint* worker_node_index)
   : _g1h(g1h),
     _task_queue(g1h->task_queue(worker_id)),
     _rdc_local_qset(rdcqs),
@@ -73,6 +74,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _tenuring_threshold(g1h->policy()->tenuring_threshold()),
     _scanner(g1h, this),
     _worker_id(worker_id),
+    _num_workers(num_workers),
     _last_enqueued_card(SIZE_MAX),
     _stack_trim_upper_threshold(GCDrainStackTargetSize * 2 + 1),
     _stack_trim_lower_threshold(GCDrainStackTargetSize),
@@ -85,7 +87,11 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _string_dedup_requests(),
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
+    _node_index(G1NUMA::UnknownNodeIndex),
+    _worker_node_index(worker_node_index),
+    _same_node_workers(nullptr),
     _obj_alloc_stat(nullptr),
+    _copy_volume_stat(nullptr),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _evacuation_failed_info(),
     _evac_failure_regions(evac_failure_regions),
@@ -138,6 +144,8 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  FREE_C_HEAP_ARRAY(size_t, _copy_volume_stat);
+  FREE_C_HEAP_ARRAY(uint, _same_node_workers);
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -233,9 +241,12 @@ void G1ParScanThreadState::do_partial_array(PartialArrayState* state, bool stole
   G1HeapRegionAttr dest_attr = _g1h->region_attr(to_array);
   G1SkipCardEnqueueSetter x(&_scanner, dest_attr.is_new_survivor());
   // Process claimed task.
+  size_t queued = PartialArraySplitter::queued_tasks(_task_queue);
   to_array->oop_iterate_range(&_scanner,
                               checked_cast<int>(claim._start),
                               checked_cast<int>(claim._end));
+  _partial_array_splitter.record_chunk(claim._end - claim._start,
+                                       queued, PartialArraySplitter::queued_tasks(_task_queue));
 }
 
 MAYBE_INLINE_EVACUATION
@@ -261,7 +272,10 @@ void G1ParScanThreadState::start_partial_objarray(G1HeapRegionAttr dest_attr,
   // Process the initial chunk.  No need to process the type in the
   // klass, as it will already be handled by processing the built-in
   // module.
+  size_t queued = PartialArraySplitter::queued_tasks(_task_queue);
   to_array->oop_iterate_range(&_scanner, 0, checked_cast<int>(initial_chunk_size));
+  _partial_array_splitter.record_chunk(initial_chunk_size,
+                                       queued, PartialArraySplitter::queued_tasks(_task_queue));
 }
 
 MAYBE_INLINE_EVACUATION
@@ -294,14 +308,48 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
   } while (!_task_queue->overflow_empty());
 }
 
+void G1ParScanThreadState::update_node_index() {
+  if (!G1NUMALocalEvacuation || !_numa->is_enabled()) {
+    return;
+  }
+  uint node_index = _numa->index_of_current_thread();
+  if (node_index >= _numa->num_active_nodes()) {
+    node_index = G1NUMA::UnknownNodeIndex;
+  }
+  _node_index = node_index;
+  Atomic::store(&_worker_node_index[_worker_id], node_index);
+}
+
+bool G1ParScanThreadState::steal(G1ScannerTasksQueueSet* task_queues, ScannerTask& t) {
+  if (_node_index != G1NUMA::UnknownNodeIndex) {
+    // Prefer tasks of workers on our node; their objects are likely node-local too.
+    if (_same_node_workers == nullptr) {
+      _same_node_workers = NEW_C_HEAP_ARRAY(uint, _num_workers, mtGC);
+    }
+    uint num_candidates = 0;
+    for (uint i = 0; i < _num_workers; i++) {
+      if (i != _worker_id && Atomic::load(&_worker_node_index[i]) == _node_index) {
+        _same_node_workers[num_candidates++] = i;
+      }
+    }
+    if (task_queues->steal_from(_worker_id, _same_node_workers, num_candidates, t)) {
+      return true;
+    }
+  }
+  return task_queues->steal(_worker_id, t);
+}
+
 ATTRIBUTE_FLATTEN
-void G1ParScanThreadState::steal_and_trim_queue(G1ScannerTasksQueueSet* task_queues) {
+size_t G1ParScanThreadState::steal_and_trim_queue(G1ScannerTasksQueueSet* task_queues) {
   ScannerTask stolen_task;
-  while (task_queues->steal(_worker_id, stolen_task)) {
+  size_t num_stolen = 0;
+  while (steal(task_queues, stolen_task)) {
+    num_stolen++;
     dispatch_task(stolen_task, true);
     // Processing stolen task may have added tasks to our queue.
     trim_queue();
   }
+  return num_stolen;
 }
 
 HeapWord* G1ParScanThreadState::allocate_in_next_plab(G1HeapRegionAttr* dest,
@@ -377,7 +425,8 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
                                                    Klass* klass,
                                                    size_t word_sz,
                                                    uint age,
-                                                   uint node_index) {
+                                                   uint node_index,
+                                                   uint from_node_index) {
   HeapWord* obj_ptr = nullptr;
   // Try slow-path allocation unless we're allocating old and old is already full.
   if (!(dest_attr->is_old() && _old_gen_is_full)) {
@@ -394,7 +443,7 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
     }
   }
   if (obj_ptr != nullptr) {
-    update_numa_stats(node_index);
+    update_numa_stats(from_node_index);
     if (_g1h->gc_tracer_stw()->should_report_promotion_events()) {
       // The events are checked individually as part of the actual commit
       report_promotion_event(*dest_attr, klass, word_sz, age, obj_ptr, node_index);
@@ -453,14 +502,14 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   G1HeapRegion* const from_region = _g1h->heap_region_containing(old);
-  uint node_index = from_region->node_index();
+  uint node_index = dest_node_index(from_region);
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
 
   // PLAB allocations should succeed most of the time, so we'll
   // normally check against null once and that's it.
   if (obj_ptr == nullptr) {
-    obj_ptr = allocate_copy_slow(&dest_attr, klass, word_sz, age, node_index);
+    obj_ptr = allocate_copy_slow(&dest_attr, klass, word_sz, age, node_index, from_region->node_index());
     if (obj_ptr == nullptr) {
       // This will either forward-to-self, or detect that someone else has
       // installed a forwarding pointer.
@@ -504,6 +553,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
         obj->incr_age();
       }
       _age_table.add(age, word_sz);
+      update_copy_volume_stats(from_region->node_index(), node_index, word_sz);
     } else {
       update_bot_after_copying(obj, word_sz);
     }
@@ -564,7 +614,8 @@ G1ParScanThreadState* G1ParScanThreadStateSet::state_for_worker(uint worker_id)
                                worker_id,
                                _num_workers,
                                _collection_set,
-                               _evac_failure_regions);
+                               _evac_failure_regions,
+                               _worker_node_index);
   }
   return _states[worker_id];
 }
@@ -665,15 +716,23 @@ void G1ParScanThreadState::initialize_numa_stats() {
       // Record only if there are multiple active nodes.
       _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
       memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _copy_volume_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes * num_nodes, mtGC);
+      memset(_copy_volume_stat, 0, sizeof(size_t) * num_nodes * num_nodes);
     }
   }
 }
 
 void G1ParScanThreadState::flush_numa_stats() {
   if (_obj_alloc_stat != nullptr) {
-    uint node_index = _numa->index_of_current_thread();
+    uint node_index = _node_index != G1NUMA::UnknownNodeIndex ? _node_index : _numa->index_of_current_thread();
     _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
   }
+  if (_copy_volume_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
+    for (uint from = 0; from < num_nodes; from++) {
+      _numa->copy_statistics(G1NUMAStats::CopyToSurvVolume, from, _copy_volume_stat + from * num_nodes);
+    }
+  }
 }
 
 void G1ParScanThreadState::update_numa_stats(uint node_index) {
@@ -682,6 +741,19 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+void G1ParScanThreadState::update_copy_volume_stats(uint from_node_index, uint to_node_index, size_t word_sz) {
+  if (_copy_volume_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
+    if (from_node_index < num_nodes && to_node_index < num_nodes) {
+      _copy_volume_stat[from_node_index * num_nodes + to_node_index] += word_sz;
+    }
+  }
+}
+
+uint G1ParScanThreadState::dest_node_index(const G1HeapRegion* from_region) const {
+  return _node_index != G1NUMA::UnknownNodeIndex ? _node_index : from_region->node_index();
+}
+
 #if TASKQUEUE_STATS
 
 PartialArrayTaskStats* G1ParScanThreadState::partial_array_task_stats() {
@@ -698,6 +770,7 @@ G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
     _collection_set(collection_set),
     _rdcqs(G1BarrierSet::dirty_card_queue_set().allocator()),
     _states(NEW_C_HEAP_ARRAY(G1ParScanThreadState*, num_workers, mtGC)),
+    _worker_node_index(NEW_C_HEAP_ARRAY(uint, num_workers, mtGC)),
     _rdc_buffers(NEW_C_HEAP_ARRAY(BufferNodeList, num_workers, mtGC)),
     _surviving_young_words_total(NEW_C_HEAP_ARRAY(size_t, collection_set->young_region_length() + 1, mtGC)),
     _num_workers(num_workers),
@@ -706,6 +779,7 @@ G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
 {
   for (uint i = 0; i < num_workers; ++i) {
     _states[i] = nullptr;
+    _worker_node_index[i] = G1NUMA::UnknownNodeIndex;
     _rdc_buffers[i] = BufferNodeList();
   }
   memset(_surviving_young_words_total, 0, (collection_set->young_region_length() + 1) * sizeof(size_t));
@@ -714,6 +788,7 @@ G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
 G1ParScanThreadStateSet::~G1ParScanThreadStateSet() {
   assert(_flushed, "thread local state from the per thread states should have been flushed");
   FREE_C_HEAP_ARRAY(G1ParScanThreadState*, _states);
+  FREE_C_HEAP_ARRAY(uint, _worker_node_index);
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_total);
   FREE_C_HEAP_ARRAY(BufferNodeList, _rdc_buffers);
 }
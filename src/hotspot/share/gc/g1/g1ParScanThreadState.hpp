@@ -64,6 +64,7 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   G1ScanEvacuatedObjClosure _scanner;
 
   uint _worker_id;
+  uint _num_workers;
 
   // Remember the last enqueued card to avoid enqueuing the same card over and over;
   // since we only ever scan a card once, this is sufficient.
@@ -94,10 +95,20 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   G1OopStarChunkedList* _oops_into_optional_regions;
 
   G1NUMA* _numa;
+  // NUMA node index of the worker using this state, or G1NUMA::UnknownNodeIndex if
+  // evacuation is not node-local (see G1NUMALocalEvacuation).
+  uint _node_index;
+  // Node index per worker, shared by all states of the G1ParScanThreadStateSet.
+  volatile uint* _worker_node_index;
+  // Scratch array of workers on the same node, to steal from first.
+  uint* _same_node_workers;
   // Records how many object allocations happened at each node during copy to survivor.
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Words copied to survivor regions, indexed by source node * number of nodes +
+  // destination node. Recorded and transferred like _obj_alloc_stat.
+  size_t* _copy_volume_stat;
 
   // Per-thread evacuation failure data structures.
   ALLOCATION_FAILURE_INJECTOR_ONLY(size_t _allocation_failure_inject_counter;)
@@ -123,9 +134,15 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
                        uint worker_id,
                        uint num_workers,
                        G1CollectionSet* collection_set,
-                       G1EvacFailureRegions* evac_failure_regions);
+                       G1EvacFailureRegions* evac_failure_regions,
+                       volatile uint* worker_node_index);
   virtual ~G1ParScanThreadState();
 
+  // Determine the NUMA node of the current (worker) thread. Subsequent evacuation
+  // copies survivors into PLABs of that node and prefers stealing from tasks of
+  // workers on the same node.
+  void update_node_index();
+
   void set_ref_discoverer(ReferenceDiscoverer* rd) { _scanner.set_ref_discoverer(rd); }
 
 #ifdef ASSERT
@@ -174,7 +191,8 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
                                Klass* klass,
                                size_t word_sz,
                                uint age,
-                               uint node_index);
+                               uint node_index,
+                               uint from_node_index);
 
   void undo_allocation(G1HeapRegionAttr dest_addr,
                        HeapWord* obj_ptr,
@@ -217,13 +235,21 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  inline void update_copy_volume_stats(uint from_node_index, uint to_node_index, size_t word_sz);
+
+  // Node index of the PLAB to copy an object from from_region to.
+  inline uint dest_node_index(const G1HeapRegion* from_region) const;
+
+  bool steal(G1ScannerTasksQueueSet* task_queues, ScannerTask& t);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
 
   inline void trim_queue();
   inline void trim_queue_partially();
-  void steal_and_trim_queue(G1ScannerTasksQueueSet *task_queues);
+  // Steal and process tasks from other workers until there are none left.
+  // Returns the number of tasks stolen.
+  size_t steal_and_trim_queue(G1ScannerTasksQueueSet *task_queues);
 
   Tickspan trim_ticks() const;
   void reset_trim_ticks();
@@ -244,6 +270,7 @@ class G1ParScanThreadStateSet : public StackObj {
   G1CollectionSet* _collection_set;
   G1RedirtyCardsQueueSet _rdcqs;
   G1ParScanThreadState** _states;
+  volatile uint* _worker_node_index;
   BufferNodeList* _rdc_buffers;
   size_t* _surviving_young_words_total;
   uint _num_workers;
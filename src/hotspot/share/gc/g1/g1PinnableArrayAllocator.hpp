@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1PINNABLEARRAYALLOCATOR_HPP
+#define SHARE_GC_G1_G1PINNABLEARRAYALLOCATOR_HPP
+
+#include "gc/shared/memAllocator.hpp"
+
+// Allocates primitive arrays that are likely to be pinned by JNI critical
+// sections outside of TLABs into G1's pinnable alloc region.
+class G1PinnableArrayAllocator : public ObjArrayAllocator {
+protected:
+  bool use_tlab() const override { return false; }
+  HeapWord* mem_allocate_shared(bool* gc_overhead_limit_was_exceeded) const override;
+
+public:
+  G1PinnableArrayAllocator(Klass* klass, size_t word_size, int length, bool do_zero, Thread* thread)
+    : ObjArrayAllocator(klass, word_size, length, do_zero, thread) {}
+};
+
+#endif // SHARE_GC_G1_G1PINNABLEARRAYALLOCATOR_HPP
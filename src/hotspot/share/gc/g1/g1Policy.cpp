@@ -880,7 +880,7 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
                                     average_time_ms(G1GCPhaseTimes::MergeLB) +
                                     p->cur_distribute_log_buffers_time_ms() +
                                     average_time_ms(G1GCPhaseTimes::OptMergeRS);
-      _analytics->report_cost_per_card_merge_ms(avg_time_merge_cards / total_cards_merged, is_young_only_pause);
+      _analytics->report_card_merge_time_ms(total_cards_merged, avg_time_merge_cards, is_young_only_pause);
     }
 
     // Update prediction for card scan
@@ -891,7 +891,7 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
       double avg_time_dirty_card_scan = average_time_ms(G1GCPhaseTimes::ScanHR) +
                                         average_time_ms(G1GCPhaseTimes::OptScanHR);
 
-      _analytics->report_cost_per_card_scan_ms(avg_time_dirty_card_scan / total_cards_scanned, is_young_only_pause);
+      _analytics->report_card_scan_time_ms(total_cards_scanned, avg_time_dirty_card_scan, is_young_only_pause);
     }
 
     // Update prediction for the ratio between cards from the remembered
@@ -913,15 +913,15 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
       double avg_time_code_root_scan = average_time_ms(G1GCPhaseTimes::CodeRoots) +
                                        average_time_ms(G1GCPhaseTimes::OptCodeRoots);
 
-      _analytics->report_cost_per_code_root_scan_ms(avg_time_code_root_scan / total_code_roots_scanned, is_young_only_pause);
+      _analytics->report_code_root_scan_time_ms(total_code_roots_scanned, avg_time_code_root_scan, is_young_only_pause);
     }
 
     // Update prediction for copy cost per byte
     size_t copied_bytes = p->sum_thread_work_items(G1GCPhaseTimes::MergePSS, G1GCPhaseTimes::MergePSSCopiedBytes);
 
     if (copied_bytes > 0) {
-      double cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / copied_bytes;
-      _analytics->report_cost_per_byte_ms(cost_per_byte_ms, is_young_only_pause);
+      double obj_copy_time_ms = average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy);
+      _analytics->report_object_copy_time_ms(copied_bytes, obj_copy_time_ms, is_young_only_pause);
     }
 
     if (_collection_set->young_region_length() > 0) {
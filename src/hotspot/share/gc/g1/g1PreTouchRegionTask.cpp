@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1PreTouchRegionTask.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/init.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/ticks.hpp"
+
+G1PreTouchRegionTask* G1PreTouchRegionTask::_instance = nullptr;
+
+G1PreTouchRegionTask::G1PreTouchRegionTask() :
+    G1ServiceTask("G1 Pre-Touch Region Task"),
+    _active(false),
+    _summary_duration(),
+    _summary_region_count(0) { }
+
+void G1PreTouchRegionTask::initialize() {
+  assert(_instance == nullptr, "Already initialized");
+  _instance = new G1PreTouchRegionTask();
+
+  // Register the task with the service thread. This will automatically
+  // schedule the task so we change the state to active.
+  _instance->set_active(true);
+  G1CollectedHeap::heap()->service_thread()->register_task(_instance);
+}
+
+G1PreTouchRegionTask* G1PreTouchRegionTask::instance() {
+  if (_instance == nullptr) {
+    initialize();
+  }
+  return _instance;
+}
+
+void G1PreTouchRegionTask::enqueue() {
+  assert(!is_init_completed() || SafepointSynchronize::is_at_safepoint(),
+         "must be during initialization or at safepoint");
+
+  G1PreTouchRegionTask* pretouch_task = instance();
+  if (!pretouch_task->is_active()) {
+    pretouch_task->set_active(true);
+    G1CollectedHeap::heap()->service_thread()->schedule_task(pretouch_task, 0);
+  }
+}
+
+bool G1PreTouchRegionTask::is_active() {
+  return _active;
+}
+
+void G1PreTouchRegionTask::set_active(bool state) {
+  assert(_active != state, "Must do a state change");
+  // Same protocol as for G1UncommitRegionTask: set to true only during
+  // initialization or in a safepoint, and set to false on the service thread
+  // while joined with the suspendible thread set.
+  _active = state;
+}
+
+void G1PreTouchRegionTask::report_execution(Tickspan time, uint regions) {
+  _summary_region_count += regions;
+  _summary_duration += time;
+
+  log_trace(gc, heap)("Concurrent Pre-Touch: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                      byte_size_in_proper_unit(regions * G1HeapRegion::GrainBytes),
+                      proper_unit_for_byte_size(regions * G1HeapRegion::GrainBytes),
+                      regions,
+                      time.seconds() * 1000);
+}
+
+void G1PreTouchRegionTask::report_summary() {
+  log_debug(gc, heap)("Concurrent Pre-Touch Summary: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                      byte_size_in_proper_unit(_summary_region_count * G1HeapRegion::GrainBytes),
+                      proper_unit_for_byte_size(_summary_region_count * G1HeapRegion::GrainBytes),
+                      _summary_region_count,
+                      _summary_duration.seconds() * 1000);
+}
+
+void G1PreTouchRegionTask::clear_summary() {
+  _summary_duration = Tickspan();
+  _summary_region_count = 0;
+}
+
+void G1PreTouchRegionTask::execute() {
+  assert(_active, "Must be active");
+
+  static const uint region_limit = (uint) (PreTouchSizeLimit / G1HeapRegionSize);
+
+  // Prevent from running during a GC pause. Touching regions is stopped
+  // early if a safepoint is pending.
+  SuspendibleThreadSetJoiner sts;
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+
+  Ticks start = Ticks::now();
+  uint pretouch_count = g1h->pretouch_regions(region_limit);
+  Tickspan pretouch_time = (Ticks::now() - start);
+
+  if (pretouch_count > 0) {
+    report_execution(pretouch_time, pretouch_count);
+  }
+
+  if (g1h->has_untouched_regions()) {
+    // Delay to avoid starving application.
+    schedule(PreTouchTaskDelayMs);
+  } else {
+    set_active(false);
+    report_summary();
+    clear_summary();
+  }
+}
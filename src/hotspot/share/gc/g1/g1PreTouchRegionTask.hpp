@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1PRETOUCHREGIONTASK_HPP
+#define SHARE_GC_G1_G1PRETOUCHREGIONTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
+
+// Service task that touches the memory of regions committed by heap expansion
+// (G1ConcurrentPreTouch), so that mutators allocating into them later do not
+// take the page faults.
+class G1PreTouchRegionTask : public G1ServiceTask {
+  // Each execution of the pre-touch task is limited to touch at most 128M,
+  // like the uncommit task.
+  static const uint PreTouchSizeLimit = 128 * M;
+  // The delay between two pre-touch task executions.
+  static const uint PreTouchTaskDelayMs = 10;
+
+  static G1PreTouchRegionTask* _instance;
+  static void initialize();
+  static G1PreTouchRegionTask* instance();
+
+  // Prevents the task from being enqueued on the service thread multiple
+  // times, see G1UncommitRegionTask.
+  bool _active;
+
+  Tickspan _summary_duration;
+  uint _summary_region_count;
+
+  G1PreTouchRegionTask();
+  bool is_active();
+  void set_active(bool state);
+
+  void report_execution(Tickspan time, uint regions);
+  void report_summary();
+  void clear_summary();
+
+public:
+  static void enqueue();
+  virtual void execute();
+};
+
+#endif // SHARE_GC_G1_G1PRETOUCHREGIONTASK_HPP
@@ -64,6 +64,11 @@ class G1Predictions {
   double predict_zero_bounded(TruncatedSeq const* seq) const {
     return MAX2(predict(seq), 0.0);
   }
+
+  // Prediction for a fitted value with the given standard error.
+  double predict(double fit, double std_error) const {
+    return fit + _stddev_scale * std_error;
+  }
 };
 
 #endif // SHARE_GC_G1_G1PREDICTIONS_HPP
@@ -64,6 +64,8 @@ class G1RegionToSpaceMapper : public CHeapObj<mtGC> {
   size_t reserved_size() { return _storage.reserved_size(); }
   size_t committed_size() { return _storage.committed_size(); }
 
+  size_t page_size() const { return _storage.page_size(); }
+
   void set_mapping_changed_listener(G1MappingChangedListener* listener) { _listener = listener; }
 
   void signal_mapping_changed(uint start_idx, size_t num_regions);
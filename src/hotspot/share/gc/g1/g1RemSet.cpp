@@ -54,6 +54,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -559,6 +561,27 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
       return ((uintptr_t)addr) % sizeof(Word) == 0;
     }
 
+    // Number of words examined together when looking for the first card to
+    // scan. Most words are clean in sparse chunks, so OR-ing several of them
+    // before testing saves branches, and the compiler can vectorize it.
+    static const uint WordsPerBlock = 4;
+
+    // Index of the first card in memory order that has its bit set in
+    // card_bits, a word of per-card bits at their ToScanMask position.
+    static uint first_card_index(Word card_bits) {
+      assert(card_bits != 0, "precondition");
+#ifdef VM_LITTLE_ENDIAN
+      return count_trailing_zeros(card_bits) / BitsPerByte;
+#else
+      return count_leading_zeros(card_bits) / BitsPerByte;
+#endif
+    }
+
+    // Per-card bits of the cards in the word that need to be scanned.
+    static Word dirty_card_bits(Word word_value) {
+      return ~word_value & ExpandedToScanMask;
+    }
+
     CardValue* find_first_dirty_card(CardValue* i_card) const {
       while (!is_word_aligned(i_card)) {
         if (is_card_dirty(i_card)) {
@@ -567,18 +590,23 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
         i_card++;
       }
 
+      const size_t block_size = WordsPerBlock * sizeof(Word);
+      while (pointer_delta(_end_card, i_card, sizeof(CardValue)) >= block_size) {
+        const Word* words = reinterpret_cast<const Word*>(i_card);
+        Word any_dirty = 0;
+        for (uint i = 0; i < WordsPerBlock; ++i) {
+          any_dirty |= dirty_card_bits(words[i]);
+        }
+        if (any_dirty != 0) {
+          break;
+        }
+        i_card += block_size;
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word dirty_bits = dirty_card_bits(*reinterpret_cast<Word*>(i_card));
+        if (dirty_bits != 0) {
+          return i_card + first_card_index(dirty_bits);
         }
       }
 
@@ -594,17 +622,9 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
       }
 
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word non_dirty_bits = *reinterpret_cast<Word*>(i_card) & ExpandedToScanMask;
+        if (non_dirty_bits != 0) {
+          return i_card + first_card_index(non_dirty_bits);
         }
       }
 
@@ -1178,22 +1198,20 @@ class G1MergeHeapRootsTask : public WorkerTask {
   };
 
   // Visitor for the remembered sets of humongous candidate regions to merge their
-  // remembered set into the card table.
-  class G1FlushHumongousCandidateRemSets : public G1HeapRegionIndexClosure {
+  // remembered set into the card table. Applied by all workers in parallel.
+  class G1FlushHumongousCandidateRemSets : public G1HeapRegionClosure {
     G1MergeCardSetClosure _cl;
 
   public:
     G1FlushHumongousCandidateRemSets(G1RemSetScanState* scan_state) : _cl(scan_state) { }
 
-    bool do_heap_region_index(uint region_index) override {
+    bool do_heap_region(G1HeapRegion* r) override {
       G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
-      if (!g1h->region_attr(region_index).is_humongous_candidate()) {
+      if (!g1h->region_attr(r->hrm_index()).is_humongous_candidate()) {
         return false;
       }
 
-      G1HeapRegion* r = g1h->region_at(region_index);
-
       assert(r->rem_set()->is_complete(), "humongous candidates must have complete remset");
 
       guarantee(r->rem_set()->occupancy_less_or_equal_than(G1EagerReclaimRemSetThreshold),
@@ -1289,7 +1307,8 @@ class G1MergeHeapRootsTask : public WorkerTask {
 
   bool _initial_evacuation;
 
-  volatile bool _fast_reclaim_handled;
+  // Distributes merging the remembered sets of eager reclaim candidates.
+  G1HeapRegionClaimer _humongous_claimer;
 
   void apply_closure_to_dirty_card_buffers(G1MergeLogBufferCardsClosure* cl, uint worker_id) {
     G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
@@ -1309,7 +1328,7 @@ class G1MergeHeapRootsTask : public WorkerTask {
     _scan_state(scan_state),
     _dirty_card_buffers(nullptr),
     _initial_evacuation(initial_evacuation),
-    _fast_reclaim_handled(false)
+    _humongous_claimer(num_workers)
   {
     if (initial_evacuation) {
       Ticks start = Ticks::now();
@@ -1376,14 +1395,12 @@ class G1MergeHeapRootsTask : public WorkerTask {
       {
         // 1. eager-reclaim candidates
         if (_initial_evacuation &&
-            g1h->has_humongous_reclaim_candidates() &&
-            !_fast_reclaim_handled &&
-            !Atomic::cmpxchg(&_fast_reclaim_handled, false, true)) {
+            g1h->has_humongous_reclaim_candidates()) {
 
           G1GCParPhaseTimesTracker subphase_x(p, G1GCPhaseTimes::MergeER, worker_id);
 
           G1FlushHumongousCandidateRemSets cl(_scan_state);
-          g1h->heap_region_iterate(&cl);
+          g1h->heap_region_par_iterate_from_worker_offset(&cl, &_humongous_claimer, worker_id);
           G1MergeCardSetStats stats = cl.stats();
 
           for (uint i = 0; i < G1GCPhaseTimes::MergeRSContainersSentinel; i++) {
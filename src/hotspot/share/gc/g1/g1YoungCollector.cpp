@@ -537,6 +537,7 @@ class G1ParEvacuateFollowersClosure : public VoidClosure {
   double _start_term;
   double _term_time;
   size_t _term_attempts;
+  size_t _stolen_tasks;
 
   void start_term_time() { _term_attempts++; _start_term = os::elapsedTime(); }
   void end_term_time() { _term_time += (os::elapsedTime() - _start_term); }
@@ -567,7 +568,7 @@ class G1ParEvacuateFollowersClosure : public VoidClosure {
                                 G1ScannerTasksQueueSet* queues,
                                 TaskTerminator* terminator,
                                 G1GCPhaseTimes::GCParPhases phase)
-    : _start_term(0.0), _term_time(0.0), _term_attempts(0),
+    : _start_term(0.0), _term_time(0.0), _term_attempts(0), _stolen_tasks(0),
       _g1h(g1h), _par_scan_state(par_scan_state),
       _queues(queues), _terminator(terminator), _phase(phase) {}
 
@@ -578,13 +579,14 @@ class G1ParEvacuateFollowersClosure : public VoidClosure {
     event.commit(GCId::current(), pss->worker_id(), G1GCPhaseTimes::phase_name(_phase));
     do {
       EventGCPhaseParallel event;
-      pss->steal_and_trim_queue(queues());
+      _stolen_tasks += pss->steal_and_trim_queue(queues());
       event.commit(GCId::current(), pss->worker_id(), G1GCPhaseTimes::phase_name(_phase));
     } while (!offer_termination());
   }
 
   double term_time() const { return _term_time; }
   size_t term_attempts() const { return _term_attempts; }
+  size_t stolen_tasks() const { return _stolen_tasks; }
 };
 
 class G1EvacuateRegionsBaseTask : public WorkerTask {
@@ -611,6 +613,7 @@ class G1EvacuateRegionsBaseTask : public WorkerTask {
 
     Tickspan evac_time = (Ticks::now() - start);
     p->record_or_add_time_secs(objcopy_phase, worker_id, evac_time.seconds() - cl.term_time());
+    p->record_or_add_thread_work_item(objcopy_phase, worker_id, cl.stolen_tasks());
 
     if (termination_phase == G1GCPhaseTimes::Termination) {
       p->record_time_secs(termination_phase, worker_id, cl.term_time());
@@ -653,6 +656,7 @@ class G1EvacuateRegionsBaseTask : public WorkerTask {
 
       G1ParScanThreadState* pss = _per_thread_states->state_for_worker(worker_id);
       pss->set_ref_discoverer(_g1h->ref_processor_stw());
+      pss->update_node_index();
 
       scan_roots(pss, worker_id);
       evacuate_live_objects(pss, worker_id);
@@ -931,6 +935,7 @@ class G1STWRefProcProxyTask : public RefProcProxyTask {
 
     G1ParScanThreadState* pss = _pss.state_for_worker(index);
     pss->set_ref_discoverer(nullptr);
+    pss->update_node_index();
 
     G1STWIsAliveClosure is_alive(&_g1h);
     G1CopyingKeepAliveClosure keep_alive(&_g1h, pss);
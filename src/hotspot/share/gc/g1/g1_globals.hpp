@@ -115,6 +115,13 @@
           "means that G1 will use less safety margin for its predictions.") \
           range(1, 100)                                                     \
                                                                             \
+  product(bool, G1UseLinearCostModel, false, EXPERIMENTAL,                  \
+          "Predict card merge, card scan, code root scan and object "       \
+          "copy times from a linear fit of phase time against work "        \
+          "items over the last few pauses, using a confidence band "        \
+          "based on G1ConfidencePercent, instead of from the average "      \
+          "cost per item.")                                                 \
+                                                                            \
   product(uintx, G1SummarizeRSetStatsPeriod, 0, DIAGNOSTIC,                 \
           "The period (in number of GCs) at which we will generate "        \
           "update buffer processing info "                                  \
@@ -263,15 +270,23 @@
           "The target number of mixed GCs after a marking cycle.")          \
           range(0, max_uintx)                                               \
                                                                             \
-  product(uint, G1EagerReclaimRemSetThreshold, 0, EXPERIMENTAL,             \
+  product(uint, G1EagerReclaimRemSetThreshold, max_juint, EXPERIMENTAL,     \
           "Maximum number of remembered set entries a humongous region "    \
-          "otherwise eligible for eager reclaim may have to be a candidate "\
-          "for eager reclaim. Will be selected ergonomically by default.")  \
+          "otherwise eligible for eager reclaim may have to be a "          \
+          "candidate for eager reclaim. By default there is no limit: "     \
+          "unreferenced humongous type arrays are always reclaimed.")       \
                                                                             \
   product(size_t, G1RebuildRemSetChunkSize, 256 * K, EXPERIMENTAL,          \
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
                                                                             \
+  product(uint, G1RebuildRemSetThrottlePercent, 0, EXPERIMENTAL,            \
+          "Remembered set rebuild threads that got less than this "         \
+          "percentage of CPU time while processing a chunk back off for "   \
+          "up to the time they were waiting for a CPU, leaving it to "      \
+          "mutator threads. 0 disables throttling.")                        \
+          range(0, 100)                                                     \
+                                                                            \
   product(uint, G1OldCSetRegionThresholdPercent, 10, EXPERIMENTAL,         \
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
@@ -283,6 +298,13 @@
   develop(bool, G1VerifyBitmaps, false,                                     \
           "Verifies the consistency of the marking bitmaps")                \
                                                                             \
+  product(bool, G1ConcurrentPreTouch, false, EXPERIMENTAL,                  \
+          "Touch the memory of regions committed at startup and by heap "   \
+          "expansion on the service thread, so that mutators allocating "   \
+          "into them do not take the page faults, without delaying VM "     \
+          "initialization like AlwaysPreTouch. Ignored with "               \
+          "AlwaysPreTouch.")                                                \
+                                                                            \
   product(uintx, G1PeriodicGCInterval, 0, MANAGEABLE,                       \
           "Number of milliseconds after a previous GC to wait before "      \
           "triggering a periodic gc. A value of zero disables periodically "\
@@ -316,6 +338,12 @@
           "percentage of the currently used memory.")                       \
           range(0.0, 1.0)                                                   \
                                                                             \
+  product(bool, G1RemSetFreeMemoryInMarkPauses, true, EXPERIMENTAL,         \
+          "Return free card set memory exceeding "                          \
+          "G1RemSetFreeMemoryKeepExcessRatio to the operating system "      \
+          "in the Remark and Cleanup pauses, which may clear many "         \
+          "remembered sets.")                                               \
+                                                                            \
   product(uint, G1RestoreRetainedRegionChunksPerWorker, 16, DIAGNOSTIC,     \
           "The number of chunks assigned per worker thread for "            \
           "retained region restore purposes.")                              \
@@ -335,6 +363,19 @@
           "scan cost related prediction samples. A sample must involve "    \
           "the same or more than this number of code roots to be used.")    \
                                                                             \
+  product(bool, G1NUMALocalEvacuation, false, EXPERIMENTAL,                 \
+          "With UseNUMA, copy survivors into regions on the NUMA node of "  \
+          "the copying worker and let workers steal work from workers on "  \
+          "the same node first. Otherwise survivors are placed on the "     \
+          "node of the region they are evacuated from.")                    \
+                                                                            \
+  product(size_t, G1PinnableArrayMinSize, 0, EXPERIMENTAL,                  \
+          "Primitive arrays of at least this size (in bytes) that are "     \
+          "allocated by the runtime are placed into dedicated eden "        \
+          "regions instead of TLABs, so that pinning them in JNI critical " \
+          "sections does not keep other objects from being evacuated. "     \
+          "0 disables.")                                                    \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
@@ -182,6 +182,13 @@ size_t MutableNUMASpace::unsafe_max_tlab_alloc(Thread *thr) const {
   // Please see the comments for tlab_capacity().
   guarantee(thr != nullptr, "No thread");
   int lgrp_id = thr->lgrp_id();
+  if (!os::numa_has_group_homing() && thr == Thread::current()) {
+    // This is called to size a tlab refill. Look up the node the thread
+    // is running on now, as cas_allocate() does, so that the new tlab is
+    // sized against the space it will actually come from. cas_allocate()
+    // updates the thread's cached lgrp_id.
+    lgrp_id = os::numa_get_group_id();
+  }
   if (lgrp_id == -1) {
     if (lgrp_spaces()->length() > 0) {
       return free_in_bytes() / lgrp_spaces()->length();
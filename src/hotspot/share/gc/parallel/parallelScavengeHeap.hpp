@@ -253,6 +253,8 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   void pin_object(JavaThread* thread, oop obj) override;
   void unpin_object(JavaThread* thread, oop obj) override;
+
+  bool can_clear_arrays_in_segments() const override { return true; }
 };
 
 // Class that can be used to print information about the
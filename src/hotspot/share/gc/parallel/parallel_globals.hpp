@@ -41,7 +41,17 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, UseNUMAOldGenChunks, false, EXPERIMENTAL,                   \
+          "With UseNUMA, promote objects into chunks of the old "           \
+          "generation that are bound to the NUMA node of the promoting "    \
+          "GC thread, instead of the interleaved old generation memory")    \
+                                                                            \
+  product(size_t, NUMAOldGenChunkSize, 1*M, EXPERIMENTAL,                   \
+          "Size in bytes of the node-local old generation chunks used by "  \
+          "UseNUMAOldGenChunks")                                            \
+          range(64*K, 256*M)
 
 // end of GC_PARALLEL_FLAGS
 
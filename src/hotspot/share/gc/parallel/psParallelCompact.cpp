@@ -747,30 +747,57 @@ void PSParallelCompact::post_compact()
   Universe::heap()->record_whole_heap_examined_timestamp();
 }
 
+// Split [start, end) evenly for a number of workers and return the
+// range for worker_id.
+static void split_regions_for_worker(size_t start, size_t end,
+                                     uint worker_id, uint num_workers,
+                                     size_t* worker_start, size_t* worker_end) {
+  assert(start < end, "precondition");
+  assert(num_workers > 0, "precondition");
+  assert(worker_id < num_workers, "precondition");
+
+  size_t num_regions = end - start;
+  size_t num_regions_per_worker = num_regions / num_workers;
+  size_t remainder = num_regions % num_workers;
+  // The first few workers will get one extra.
+  *worker_start = start + worker_id * num_regions_per_worker
+                  + MIN2(checked_cast<size_t>(worker_id), remainder);
+  *worker_end = *worker_start + num_regions_per_worker
+                + (worker_id < remainder ? 1 : 0);
+}
+
+// Returns the first region in [beg_region, end_region) whose dead words no
+// longer fit into max_waste, or end_region. The dead words of the regions
+// skipped are deducted from max_waste.
+static size_t first_region_exceeding_waste(size_t beg_region, size_t end_region, size_t* max_waste) {
+  const size_t region_size = ParallelCompactData::RegionSize;
+  const ParallelCompactData& sd = PSParallelCompact::summary_data();
+  size_t cur_region = beg_region;
+  for (/* empty */; cur_region < end_region; ++cur_region) {
+    size_t data_size = sd.region(cur_region)->data_size();
+    assert(region_size >= data_size, "inv");
+    size_t dead_size = region_size - data_size;
+    if (*max_waste < dead_size) {
+      break;
+    }
+    *max_waste -= dead_size;
+  }
+  return cur_region;
+}
+
 HeapWord* PSParallelCompact::compute_dense_prefix_for_old_space(MutableSpace* old_space,
                                                                 HeapWord* full_region_prefix_end) {
-  const size_t region_size = ParallelCompactData::RegionSize;
   const ParallelCompactData& sd = summary_data();
 
   // Iteration starts with the region *after* the full-region-prefix-end.
-  const RegionData* const start_region = sd.addr_to_region_ptr(full_region_prefix_end);
+  const size_t start_region = sd.addr_to_region_idx(full_region_prefix_end);
   // If final region is not full, iteration stops before that region,
   // because fill_dense_prefix_end assumes that prefix_end <= top.
-  const RegionData* const end_region = sd.addr_to_region_ptr(old_space->top());
+  const size_t end_region = sd.addr_to_region_idx(old_space->top());
   assert(start_region <= end_region, "inv");
 
   size_t max_waste = old_space->capacity_in_words() * (MarkSweepDeadRatio / 100.0);
-  const RegionData* cur_region = start_region;
-  for (/* empty */; cur_region < end_region; ++cur_region) {
-    assert(region_size >= cur_region->data_size(), "inv");
-    size_t dead_size = region_size - cur_region->data_size();
-    if (max_waste < dead_size) {
-      break;
-    }
-    max_waste -= dead_size;
-  }
-
-  HeapWord* const prefix_end = sd.region_to_addr(cur_region);
+  HeapWord* const prefix_end = sd.region_to_addr(first_region_exceeding_waste(start_region, end_region, &max_waste));
   assert(sd.is_region_aligned(prefix_end), "postcondition");
   assert(prefix_end >= full_region_prefix_end, "in-range");
   assert(prefix_end <= old_space->top(), "in-range");
@@ -860,18 +887,232 @@ bool PSParallelCompact::check_maximum_compaction(size_t total_live_words,
   return false;
 }
 
+// Summarizes the old space in parallel when it spans enough regions to make
+// the serial walks over its region data noticeable. The old space is split
+// into one stripe of regions per worker. A first parallel pass collects the
+// live and dead words of every stripe, from which the dense prefix is found
+// by walking the stripes rather than the regions. The destination of the
+// first region of each stripe is then a prefix sum over the stripes, so a
+// second parallel pass can summarize all stripes independently.
+class PSOldSpaceSummary : public StackObj {
+  // Below this many regions per worker the serial summary is used.
+  static const size_t MinRegionsPerWorker = 1024;
+
+  struct Stripe {
+    size_t    _beg_region;
+    size_t    _end_region;
+    // Sum of data_size() over [_beg_region, _end_region).
+    size_t    _live_words;
+    // Dead words of the regions below the region containing top.
+    size_t    _dead_words;
+    // First region with data_size() < RegionSize, or _end_region.
+    size_t    _first_non_full_region;
+    // Destination of the first compacted region of this stripe.
+    HeapWord* _destination;
+  };
+
+  MutableSpace* const _space;
+  SplitInfo&          _split_info;
+  const uint          _num_stripes;
+  Stripe*             _stripes;
+
+  class LiveWordsTask final : public WorkerTask {
+    PSOldSpaceSummary* _summary;
+  public:
+    explicit LiveWordsTask(PSOldSpaceSummary* summary) :
+      WorkerTask("PSOldSpaceSummary live words"),
+      _summary(summary) {}
+
+    void work(uint worker_id) override {
+      _summary->collect_live_words(worker_id);
+    }
+  };
+
+  class SummarizeTask final : public WorkerTask {
+    PSOldSpaceSummary* _summary;
+    HeapWord* const    _dense_prefix_end;
+  public:
+    SummarizeTask(PSOldSpaceSummary* summary, HeapWord* dense_prefix_end) :
+      WorkerTask("PSOldSpaceSummary summarize"),
+      _summary(summary),
+      _dense_prefix_end(dense_prefix_end) {}
+
+    void work(uint worker_id) override {
+      _summary->summarize_stripe(worker_id, _dense_prefix_end);
+    }
+  };
+
+  void collect_live_words(uint stripe_id) {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    Stripe* const stripe = &_stripes[stripe_id];
+    const size_t dead_end_region = sd.addr_to_region_idx(_space->top());
+    size_t live_words = 0;
+    size_t dead_words = 0;
+    size_t first_non_full_region = stripe->_end_region;
+    for (size_t cur_region = stripe->_beg_region; cur_region < stripe->_end_region; ++cur_region) {
+      size_t live_words_in_region = sd.region(cur_region)->data_size();
+      if (first_non_full_region == stripe->_end_region && live_words_in_region < ParallelCompactData::RegionSize) {
+        first_non_full_region = cur_region;
+      }
+      if (cur_region < dead_end_region) {
+        dead_words += ParallelCompactData::RegionSize - live_words_in_region;
+      }
+      live_words += live_words_in_region;
+    }
+    stripe->_live_words = live_words;
+    stripe->_dead_words = dead_words;
+    stripe->_first_non_full_region = first_non_full_region;
+  }
+
+  void summarize_stripe(uint stripe_id, HeapWord* dense_prefix_end) {
+    ParallelCompactData& sd = PSParallelCompact::summary_data();
+    const Stripe* const stripe = &_stripes[stripe_id];
+    const size_t dense_prefix_region = sd.addr_to_region_idx(dense_prefix_end);
+
+    const size_t dense_end = MIN2(stripe->_end_region, dense_prefix_region);
+    if (stripe->_beg_region < dense_end) {
+      sd.summarize_dense_prefix(sd.region_to_addr(stripe->_beg_region), sd.region_to_addr(dense_end));
+    }
+
+    const size_t compact_beg = MAX2(stripe->_beg_region, dense_prefix_region);
+    if (compact_beg < stripe->_end_region) {
+      HeapWord* next = nullptr;
+      bool done = sd.summarize(_split_info,
+                               sd.region_to_addr(compact_beg), sd.region_to_addr(stripe->_end_region),
+                               nullptr,
+                               stripe->_destination, _space->end(),
+                               &next);
+      assert(done, "old space must fit when compacted into itself");
+    }
+  }
+
+public:
+  // A summary with no stripes is inert; it lets the caller keep a single code
+  // path when the serial summary is used.
+  PSOldSpaceSummary(MutableSpace* space, SplitInfo& split_info, uint num_stripes) :
+    _space(space),
+    _split_info(split_info),
+    _num_stripes(num_stripes),
+    _stripes(num_stripes > 0 ? NEW_C_HEAP_ARRAY(Stripe, num_stripes, mtGC) : nullptr) {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    const size_t beg_region = sd.addr_to_region_idx(space->bottom());
+    const size_t end_region = sd.addr_to_region_idx(sd.region_align_up(space->top()));
+    for (uint i = 0; i < num_stripes; i++) {
+      split_regions_for_worker(beg_region, end_region, i, num_stripes,
+                               &_stripes[i]._beg_region, &_stripes[i]._end_region);
+      _stripes[i]._destination = nullptr;
+    }
+  }
+
+  ~PSOldSpaceSummary() {
+    if (_stripes != nullptr) {
+      FREE_C_HEAP_ARRAY(Stripe, _stripes);
+    }
+  }
+
+  static bool should_use(MutableSpace* space, uint num_workers) {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    const size_t num_regions = pointer_delta(sd.region_align_up(space->top()), space->bottom()) / ParallelCompactData::RegionSize;
+    return num_workers > 1 && num_regions >= MinRegionsPerWorker * num_workers;
+  }
+
+  // Parallel counterpart of ParallelCompactData::live_words_in_space.
+  size_t live_words(HeapWord** full_region_prefix_end) {
+    LiveWordsTask task(this);
+    ParallelScavengeHeap::heap()->workers().run_task(&task, _num_stripes);
+
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    size_t live_words = 0;
+    *full_region_prefix_end = nullptr;
+    for (uint i = 0; i < _num_stripes; i++) {
+      const Stripe* stripe = &_stripes[i];
+      if (*full_region_prefix_end == nullptr && stripe->_first_non_full_region < stripe->_end_region) {
+        *full_region_prefix_end = sd.region_to_addr(stripe->_first_non_full_region);
+      }
+      live_words += stripe->_live_words;
+    }
+    if (*full_region_prefix_end == nullptr) {
+      // All regions are full of live objs.
+      assert(sd.is_region_aligned(_space->top()), "inv");
+      *full_region_prefix_end = _space->top();
+    }
+    return live_words;
+  }
+
+  // Parallel counterpart of PSParallelCompact::compute_dense_prefix_for_old_space.
+  // Stripes whose dead words fit into the remaining waste are skipped as a
+  // whole; only the stripe containing the dense prefix end is walked.
+  HeapWord* compute_dense_prefix(HeapWord* full_region_prefix_end) const {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    const size_t end_region = sd.addr_to_region_idx(_space->top());
+    size_t max_waste = _space->capacity_in_words() * (MarkSweepDeadRatio / 100.0);
+    size_t prefix_end_region = end_region;
+    for (uint i = 0; i < _num_stripes; i++) {
+      const Stripe* stripe = &_stripes[i];
+      if (stripe->_dead_words <= max_waste) {
+        max_waste -= stripe->_dead_words;
+        continue;
+      }
+      prefix_end_region = first_region_exceeding_waste(stripe->_beg_region,
+                                                       MIN2(stripe->_end_region, end_region),
+                                                       &max_waste);
+      break;
+    }
+
+    HeapWord* const prefix_end = sd.region_to_addr(prefix_end_region);
+    assert(prefix_end >= full_region_prefix_end, "in-range");
+    assert(prefix_end <= _space->top(), "in-range");
+    return prefix_end;
+  }
+
+  // Parallel counterpart of summarize_dense_prefix and summarize for the old
+  // space compacted into itself. Must be called after fill_dense_prefix_end,
+  // which may add words to the region at the dense prefix end.
+  HeapWord* summarize(HeapWord* dense_prefix_end) {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    const size_t dense_prefix_region = sd.addr_to_region_idx(dense_prefix_end);
+    HeapWord* destination = dense_prefix_end;
+    for (uint i = 0; i < _num_stripes; i++) {
+      Stripe* stripe = &_stripes[i];
+      if (stripe->_end_region <= dense_prefix_region) {
+        continue;
+      }
+      size_t live_words = stripe->_live_words;
+      if (stripe->_beg_region <= dense_prefix_region) {
+        live_words = 0;
+        for (size_t cur_region = dense_prefix_region; cur_region < stripe->_end_region; ++cur_region) {
+          live_words += sd.region(cur_region)->data_size();
+        }
+      }
+      stripe->_destination = destination;
+      destination += live_words;
+    }
+
+    SummarizeTask task(this, dense_prefix_end);
+    ParallelScavengeHeap::heap()->workers().run_task(&task, _num_stripes);
+    return destination;
+  }
+};
+
 void PSParallelCompact::summary_phase()
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
 
   MutableSpace* const old_space = _space_info[old_space_id].space();
   {
+    const uint nworkers = ParallelScavengeHeap::heap()->workers().active_workers();
+    const bool parallel_summary = PSOldSpaceSummary::should_use(old_space, nworkers);
+    PSOldSpaceSummary old_summary(old_space, _space_info[old_space_id].split_info(),
+                                  parallel_summary ? nworkers : 0);
+
     size_t total_live_words = 0;
     HeapWord* full_region_prefix_end = nullptr;
     {
       // old-gen
-      size_t live_words = _summary_data.live_words_in_space(old_space,
-                                                            &full_region_prefix_end);
+      size_t live_words = parallel_summary
+                          ? old_summary.live_words(&full_region_prefix_end)
+                          : _summary_data.live_words_in_space(old_space,
+                                                              &full_region_prefix_end);
       total_live_words += live_words;
     }
     // young-gen
@@ -888,21 +1129,30 @@ void PSParallelCompact::summary_phase()
                                                        full_region_prefix_end);
     HeapWord* dense_prefix_end = maximum_compaction
                                  ? full_region_prefix_end
-                                 : compute_dense_prefix_for_old_space(old_space,
-                                                                      full_region_prefix_end);
+                                 : parallel_summary
+                                   ? old_summary.compute_dense_prefix(full_region_prefix_end)
+                                   : compute_dense_prefix_for_old_space(old_space,
+                                                                        full_region_prefix_end);
     SpaceId id = old_space_id;
     _space_info[id].set_dense_prefix(dense_prefix_end);
 
     if (dense_prefix_end != old_space->bottom()) {
       fill_dense_prefix_end(id);
-      _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
     }
 
-    // Compacting objs in [dense_prefix_end, old_space->top())
-    _summary_data.summarize(_space_info[id].split_info(),
-                            dense_prefix_end, old_space->top(), nullptr,
-                            dense_prefix_end, old_space->end(),
-                            _space_info[id].new_top_addr());
+    if (parallel_summary) {
+      _space_info[id].set_new_top(old_summary.summarize(dense_prefix_end));
+    } else {
+      if (dense_prefix_end != old_space->bottom()) {
+        _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
+      }
+
+      // Compacting objs in [dense_prefix_end, old_space->top())
+      _summary_data.summarize(_space_info[id].split_info(),
+                              dense_prefix_end, old_space->top(), nullptr,
+                              dense_prefix_end, old_space->end(),
+                              _space_info[id].new_top_addr());
+    }
   }
 
   // Summarize the remaining spaces in the young gen.  The initial target space
@@ -1528,25 +1778,6 @@ void PSParallelCompact::adjust_pointers() {
   ParallelScavengeHeap::heap()->workers().run_task(&task);
 }
 
-// Split [start, end) evenly for a number of workers and return the
-// range for worker_id.
-static void split_regions_for_worker(size_t start, size_t end,
-                                     uint worker_id, uint num_workers,
-                                     size_t* worker_start, size_t* worker_end) {
-  assert(start < end, "precondition");
-  assert(num_workers > 0, "precondition");
-  assert(worker_id < num_workers, "precondition");
-
-  size_t num_regions = end - start;
-  size_t num_regions_per_worker = num_regions / num_workers;
-  size_t remainder = num_regions % num_workers;
-  // The first few workers will get one extra.
-  *worker_start = start + worker_id * num_regions_per_worker
-                  + MIN2(checked_cast<size_t>(worker_id), remainder);
-  *worker_end = *worker_start + num_regions_per_worker
-                + (worker_id < remainder ? 1 : 0);
-}
-
 void PSParallelCompact::forward_to_new_addr() {
   GCTraceTime(Info, gc, phases) tm("Forward", &_gc_timer);
   uint nworkers = ParallelScavengeHeap::heap()->workers().active_workers();
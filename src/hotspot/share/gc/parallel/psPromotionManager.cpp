@@ -44,6 +44,8 @@
 #include "memory/resourceArea.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
 #include "utilities/checkedCast.hpp"
 
 PaddedEnd<PSPromotionManager>* PSPromotionManager::_manager_array = nullptr;
@@ -199,6 +201,8 @@ void PSPromotionManager::reset() {
   lab_base = old_gen()->object_space()->top();
   _old_lab.initialize(MemRegion(lab_base, (size_t)0));
   _old_gen_is_full = false;
+  _old_chunk_top = nullptr;
+  _old_chunk_end = nullptr;
 
   _promotion_failed_info.reset();
 }
@@ -250,6 +254,7 @@ void PSPromotionManager::flush_labs() {
   assert(!_old_lab.is_flushed() || _old_gen_is_full, "Sanity");
   if (!_old_lab.is_flushed())
     _old_lab.flush();
+  retire_old_chunk();
 
   // Let PSScavenge know if we overflowed
   if (_young_gen_is_full) {
@@ -257,6 +262,63 @@ void PSPromotionManager::flush_labs() {
   }
 }
 
+// The chunk holds no objects yet, so the pages lying entirely inside it can be
+// discarded and refaulted on the local node rather than being migrated. The
+// page size is the one the old gen is backed with (the large page size with
+// UseLargePages), as in MutableNUMASpace::bias_region, so a page shared with a
+// neighbouring chunk that another promotion manager is filling is never
+// discarded. Chunks smaller than a page are left alone.
+static void bias_to_current_node(HeapWord* chunk, size_t words, size_t page_size) {
+  HeapWord* start = align_up(chunk, page_size);
+  HeapWord* end = align_down(chunk + words, page_size);
+  if (end > start) {
+    size_t size = pointer_delta(end, start, sizeof(char));
+    os::disclaim_memory((char*)start, size);
+    os::numa_make_local((char*)start, size, os::numa_get_group_id());
+  }
+}
+
+HeapWord* PSPromotionManager::allocate_old_lab() {
+  if (!UseNUMA || !UseNUMAOldGenChunks) {
+    return old_gen()->allocate(OldPLABSize);
+  }
+
+  if (pointer_delta(_old_chunk_end, _old_chunk_top) < OldPLABSize) {
+    retire_old_chunk();
+
+    // A multiple of OldPLABSize, so the chunk is used up by whole PLABs.
+    const size_t chunk_words = align_up(NUMAOldGenChunkSize / HeapWordSize, OldPLABSize);
+    HeapWord* chunk = old_gen()->allocate(chunk_words);
+    if (chunk == nullptr) {
+      // No room for a whole chunk; the remaining space goes to plain PLABs.
+      return old_gen()->allocate(OldPLABSize);
+    }
+    bias_to_current_node(chunk, chunk_words, old_gen()->object_space()->alignment());
+    _old_chunk_top = chunk;
+    _old_chunk_end = chunk + chunk_words;
+  }
+
+  HeapWord* lab_base = _old_chunk_top;
+  _old_chunk_top += OldPLABSize;
+  return lab_base;
+}
+
+void PSPromotionManager::retire_old_chunk() {
+  if (_old_chunk_top == _old_chunk_end) {
+    return;
+  }
+
+  // Give the unused tail back if nothing was allocated after the chunk,
+  // otherwise fill it to keep the old gen parsable.
+  const size_t words = pointer_delta(_old_chunk_end, _old_chunk_top);
+  if (!old_gen()->object_space()->cas_deallocate(_old_chunk_top, words)) {
+    CollectedHeap::fill_with_object(_old_chunk_top, words);
+    old_gen()->start_array()->update_for_block(_old_chunk_top, _old_chunk_end);
+  }
+  _old_chunk_top = nullptr;
+  _old_chunk_end = nullptr;
+}
+
 template <class T>
 void PSPromotionManager::process_array_chunk_work(oop obj, int start, int end) {
   assert(start <= end, "invariant");
@@ -276,11 +338,14 @@ void PSPromotionManager::process_array_chunk(PartialArrayState* state, bool stol
     _partial_array_splitter.claim(state, &_claimed_stack_depth, stolen);
   int start = checked_cast<int>(claim._start);
   int end = checked_cast<int>(claim._end);
+  size_t queued = PartialArraySplitter::queued_tasks(&_claimed_stack_depth);
   if (UseCompressedOops) {
     process_array_chunk_work<narrowOop>(new_obj, start, end);
   } else {
     process_array_chunk_work<oop>(new_obj, start, end);
   }
+  _partial_array_splitter.record_chunk(claim._end - claim._start,
+                                       queued, PartialArraySplitter::queued_tasks(&_claimed_stack_depth));
 }
 
 void PSPromotionManager::push_objArray(oop old_obj, oop new_obj) {
@@ -294,11 +359,14 @@ void PSPromotionManager::push_objArray(oop old_obj, oop new_obj) {
     // The source array is unused when processing states.
     _partial_array_splitter.start(&_claimed_stack_depth, nullptr, to_array, array_length);
   int end = checked_cast<int>(initial_chunk_size);
+  size_t queued = PartialArraySplitter::queued_tasks(&_claimed_stack_depth);
   if (UseCompressedOops) {
     process_array_chunk_work<narrowOop>(to_array, 0, end);
   } else {
     process_array_chunk_work<oop>(to_array, 0, end);
   }
+  _partial_array_splitter.record_chunk(initial_chunk_size,
+                                       queued, PartialArraySplitter::queued_tasks(&_claimed_stack_depth));
 }
 
 oop PSPromotionManager::oop_promotion_failed(oop obj, markWord obj_mark) {
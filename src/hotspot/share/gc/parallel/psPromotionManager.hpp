@@ -77,6 +77,12 @@ class PSPromotionManager {
   bool                                _young_gen_is_full;
   bool                                _old_gen_is_full;
 
+  // With UseNUMAOldGenChunks, old PLABs are carved from a chunk of the old
+  // gen bound to the NUMA node this manager's thread ran on when the chunk
+  // was allocated.
+  HeapWord*                           _old_chunk_top;
+  HeapWord*                           _old_chunk_end;
+
   PSScannerTasksQueue                 _claimed_stack_depth;
 
   uint                                _target_stack_size;
@@ -109,6 +115,10 @@ class PSPromotionManager {
 
   static PSScannerTasksQueueSet* stack_array_depth() { return _stack_array_depth; }
 
+  // Returns the base of a new old PLAB of OldPLABSize words, or null.
+  HeapWord* allocate_old_lab();
+  void retire_old_chunk();
+
   template<bool promote_immediately>
   oop copy_unmarked_to_survivor_space(oop o, markWord m);
 
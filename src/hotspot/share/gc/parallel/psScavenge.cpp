@@ -66,6 +66,7 @@
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/os.hpp"
 #include "runtime/threadCritical.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/vmThread.hpp"
@@ -84,6 +85,7 @@ elapsedTimer                  PSScavenge::_accumulated_time;
 STWGCTimer                    PSScavenge::_gc_timer;
 ParallelScavengeTracer        PSScavenge::_gc_tracer;
 CollectorCounters*            PSScavenge::_counters = nullptr;
+WorkerEfficiency*             PSScavenge::_roots_task_efficiency = nullptr;
 
 static void scavenge_roots_work(ParallelRootType::Value root_type, uint worker_id) {
   assert(ParallelScavengeHeap::heap()->is_stw_gc_active(), "called outside gc");
@@ -116,7 +118,8 @@ static void scavenge_roots_work(ParallelRootType::Value root_type, uint worker_i
   pm->drain_stacks(false);
 }
 
-static void steal_work(TaskTerminator& terminator, uint worker_id) {
+// If idle_secs is given, the time spent offering termination is added to it.
+static void steal_work(TaskTerminator& terminator, uint worker_id, double* idle_secs = nullptr) {
   assert(ParallelScavengeHeap::heap()->is_stw_gc_active(), "called outside gc");
 
   PSPromotionManager* pm =
@@ -131,7 +134,12 @@ static void steal_work(TaskTerminator& terminator, uint worker_id) {
       pm->process_popped_location_depth(task, true);
       pm->drain_stacks_depth(true);
     } else {
-      if (terminator.offer_termination()) {
+      double offer_start = (idle_secs != nullptr) ? os::elapsedTime() : 0.0;
+      bool terminated = terminator.offer_termination();
+      if (idle_secs != nullptr) {
+        *idle_secs += os::elapsedTime() - offer_start;
+      }
+      if (terminated) {
         break;
       }
     }
@@ -149,6 +157,13 @@ class PSIsAliveClosure: public BoolObjectClosure {
 
 PSIsAliveClosure PSScavenge::_is_alive_closure;
 
+class PSIsYoungClosure: public BoolObjectClosure {
+public:
+  bool do_object_b(oop p) {
+    return PSScavenge::is_obj_in_young(p);
+  }
+};
+
 class PSKeepAliveClosure: public OopClosure {
 protected:
   MutableSpace* _to_space;
@@ -249,10 +264,12 @@ class ScavengeRootsTask : public WorkerTask {
   uint _active_workers;
   bool _is_old_gen_empty;
   TaskTerminator _terminator;
+  WorkerEfficiency* _efficiency;
 
 public:
   ScavengeRootsTask(PSOldGen* old_gen,
-                    uint active_workers) :
+                    uint active_workers,
+                    WorkerEfficiency* efficiency) :
     WorkerTask("ScavengeRootsTask"),
     _strong_roots_scope(active_workers),
     _subtasks(ParallelRootType::sentinel),
@@ -260,7 +277,8 @@ class ScavengeRootsTask : public WorkerTask {
     _gen_top(old_gen->object_space()->top()),
     _active_workers(active_workers),
     _is_old_gen_empty(old_gen->object_space()->is_empty()),
-    _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()) {
+    _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()),
+    _efficiency(efficiency) {
     if (!_is_old_gen_empty) {
       PSCardTable* card_table = ParallelScavengeHeap::heap()->card_table();
       card_table->pre_scavenge(active_workers);
@@ -270,6 +288,7 @@ class ScavengeRootsTask : public WorkerTask {
   virtual void work(uint worker_id) {
     assert(worker_id < _active_workers, "Sanity");
     ResourceMark rm;
+    double start = os::elapsedTime();
 
     if (!_is_old_gen_empty) {
       // There are only old-to-young pointers if there are objects
@@ -302,7 +321,8 @@ class ScavengeRootsTask : public WorkerTask {
     {
       PSPromotionManager* pm = PSPromotionManager::gc_thread_promotion_manager(worker_id);
       PSScavengeRootsClosure closure(pm);
-      _oop_storage_strong_par_state.oops_do(&closure);
+      PSIsYoungClosure is_young;
+      _oop_storage_strong_par_state.young_oops_do(&closure, &is_young);
       // Do the real work
       pm->drain_stacks(false);
     }
@@ -312,9 +332,11 @@ class ScavengeRootsTask : public WorkerTask {
     // stacks and expects a steal_work() to complete the draining if
     // ParallelGCThreads is > 1.
 
+    double idle_secs = 0.0;
     if (_active_workers > 1) {
-      steal_work(_terminator, worker_id);
+      steal_work(_terminator, worker_id, &idle_secs);
     }
+    _efficiency->record_busy_time(worker_id, os::elapsedTime() - start - idle_secs);
   }
 };
 
@@ -393,10 +415,11 @@ bool PSScavenge::invoke(bool clear_soft_refs) {
     // Reset our survivor overflow.
     set_survivor_overflow(false);
 
-    const uint active_workers =
+    const uint policy_workers =
       WorkerPolicy::calc_active_workers(ParallelScavengeHeap::heap()->workers().max_workers(),
                                         ParallelScavengeHeap::heap()->workers().active_workers(),
                                         Threads::number_of_non_daemon_threads());
+    const uint active_workers = _roots_task_efficiency->calc_active_workers(policy_workers);
     ParallelScavengeHeap::heap()->workers().set_active_workers(active_workers);
 
     PSPromotionManager::pre_scavenge();
@@ -404,8 +427,11 @@ bool PSScavenge::invoke(bool clear_soft_refs) {
     {
       GCTraceTime(Debug, gc, phases) tm("Scavenge", &_gc_timer);
 
-      ScavengeRootsTask task(old_gen, active_workers);
+      ScavengeRootsTask task(old_gen, active_workers, _roots_task_efficiency);
+      _roots_task_efficiency->start(active_workers);
+      double start = os::elapsedTime();
       ParallelScavengeHeap::heap()->workers().run_task(&task);
+      _roots_task_efficiency->end(os::elapsedTime() - start);
     }
 
     // Process reference objects discovered during scavenge
@@ -679,4 +705,6 @@ void PSScavenge::initialize() {
   _card_table = heap->card_table();
 
   _counters = new CollectorCounters("Parallel young collection pauses", 0);
+
+  _roots_task_efficiency = new WorkerEfficiency("Scavenge", heap->workers().max_workers());
 }
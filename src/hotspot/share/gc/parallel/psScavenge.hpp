@@ -37,6 +37,7 @@
 class ParallelScavengeHeap;
 class PSIsAliveClosure;
 class STWGCTimer;
+class WorkerEfficiency;
 
 class PSScavenge: AllStatic {
   friend class PSIsAliveClosure;
@@ -61,6 +62,7 @@ class PSScavenge: AllStatic {
   // Used to optimize compressed oops young gen boundary checking.
   static uintptr_t            _young_generation_boundary_compressed;
   static CollectorCounters*   _counters;             // collector performance counters
+  static WorkerEfficiency*    _roots_task_efficiency; // parallel efficiency of ScavengeRootsTask
 
   static void clean_up_failed_promotion();
 
@@ -39,6 +39,7 @@
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/gcUtil.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessorPhaseTimes.hpp"
 #include "gc/shared/space.hpp"
@@ -52,6 +53,7 @@
 #include "oops/instanceRefKlass.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/threads.hpp"
@@ -228,6 +230,11 @@ DefNewGeneration::DefNewGeneration(ReservedSpace rs,
   : Generation(rs, initial_size),
     _promotion_failed(false),
     _promo_failure_drain_in_progress(false),
+    _eden_limit(0),
+    _avg_survived(nullptr),
+    _avg_gc_cost(nullptr),
+    _last_gc_end(0.0),
+    _survivor_overflow_words(0),
     _string_dedup_requests()
 {
   MemRegion cmr((HeapWord*)_virtual_space.low(),
@@ -262,6 +269,14 @@ DefNewGeneration::DefNewGeneration(ReservedSpace rs,
                                     _gen_counters);
 
   compute_space_boundaries(0, SpaceDecorator::Clear, SpaceDecorator::Mangle);
+  if (SerialAdaptiveYoungSizing) {
+    _avg_survived = new AdaptivePaddedAverage(AdaptiveSizePolicyWeight, SurvivorPadding);
+    _avg_gc_cost = new AdaptiveWeightedAverage(AdaptiveSizePolicyWeight);
+    // Start with an eighth of eden; the first collections tell how much is
+    // actually needed.
+    _eden_limit = MAX2(align_down(eden()->capacity() / 8, SpaceAlignment), SpaceAlignment);
+    apply_eden_limit();
+  }
   update_counters();
   _old_gen = nullptr;
   _tenuring_threshold = MaxTenuringThreshold;
@@ -478,6 +493,9 @@ void DefNewGeneration::compute_new_size() {
     MemRegion cmr((HeapWord*)_virtual_space.low(),
                   (HeapWord*)_virtual_space.high());
     gch->rem_set()->resize_covered_region(cmr);
+    if (SerialAdaptiveYoungSizing) {
+      apply_eden_limit();
+    }
 
     log_debug(gc, ergo, heap)(
         "New generation size %zuK->%zuK [eden=%zuK,survivor=%zuK]",
@@ -489,6 +507,65 @@ void DefNewGeneration::compute_new_size() {
       }
 }
 
+// Sizes the part of eden in use from two observations. The average GC cost,
+// pause time over the time since the previous young collection, is held
+// against GCTimeRatio: eden doubles while young collections are too frequent
+// and shrinks slowly while they are much cheaper than allowed. Independent of
+// that, eden stays at least SurvivorRatio times the survivor space the
+// surviving objects call for, so that copying does not dominate.
+void DefNewGeneration::update_eden_limit(double gc_start) {
+  const double now = os::elapsedTime();
+  const double interval = now - _last_gc_end;
+  _last_gc_end = now;
+  if (interval > 0.0) {
+    _avg_gc_cost->sample((float)((now - gc_start) / interval));
+  }
+  _avg_survived->sample((float)(from()->used() + _survivor_overflow_words * HeapWordSize));
+
+  const double target_cost = 1.0 / (1.0 + GCTimeRatio);
+  const double gc_cost = _avg_gc_cost->average();
+  size_t limit = _eden_limit;
+  if (gc_cost > target_cost) {
+    limit *= 2;
+  } else if (gc_cost < target_cost / 4) {
+    limit -= limit / 4;
+  }
+
+  const size_t survived = (size_t)_avg_survived->padded_average();
+  const size_t desired_survivor_size = survived / MAX2(TargetSurvivorRatio, 1u) * 100;
+  limit = MAX2(limit, desired_survivor_size * SurvivorRatio);
+
+  const size_t old_limit = _eden_limit;
+  _eden_limit = align_up(limit, SpaceAlignment);
+  apply_eden_limit();
+
+  log_debug(gc, ergo, heap)("Eden limit %zuK->%zuK (survived %zuK, gc cost %.4f, target %.4f)",
+                            old_limit / K, eden()->capacity() / K, survived / K, gc_cost, target_cost);
+}
+
+// Moves the end of eden to the current limit, but never below its top and
+// never beyond the committed eden. Must be called with eden at rest.
+void DefNewGeneration::apply_eden_limit() {
+  HeapWord* const region_end = MIN2(from()->bottom(), to()->bottom());
+  HeapWord* const bottom = eden()->bottom();
+  const size_t region_bytes = pointer_delta(region_end, bottom, 1);
+  const size_t min_bytes = MAX2(align_up(eden()->used(), SpaceAlignment), SpaceAlignment);
+  _eden_limit = clamp(_eden_limit, MIN2(min_bytes, region_bytes), region_bytes);
+
+  HeapWord* const old_end = eden()->end();
+  HeapWord* const new_end = (HeapWord*)((char*)bottom + _eden_limit);
+  if (new_end < old_end) {
+    if (!UseLargePages) {
+      // Let the OS take the pages back; they are faulted in again if eden
+      // grows into them.
+      os::disclaim_memory((char*)new_end, pointer_delta(old_end, new_end, 1));
+    }
+  } else if (new_end > old_end && ZapUnusedHeapArea) {
+    SpaceMangler::mangle_region(MemRegion(old_end, new_end));
+  }
+  eden()->set_end(new_end);
+}
+
 void DefNewGeneration::ref_processor_init() {
   assert(_ref_processor == nullptr, "a reference processor already exists");
   assert(!_reserved.is_empty(), "empty generation?");
@@ -598,6 +675,8 @@ bool DefNewGeneration::collect(bool clear_all_soft_refs) {
   _old_gen = heap->old_gen();
 
   init_assuming_no_promotion_failure();
+  const double gc_start = os::elapsedTime();
+  _survivor_overflow_words = 0;
 
   GCTraceTime(Trace, gc, phases) tm("DefNew", nullptr, heap->gc_cause());
 
@@ -666,6 +745,10 @@ bool DefNewGeneration::collect(bool clear_all_soft_refs) {
     assert(to()->is_empty(), "to space should be empty now");
 
     adjust_desired_tenuring_threshold();
+
+    if (SerialAdaptiveYoungSizing) {
+      update_eden_limit(gc_start);
+    }
   } else {
     assert(_promo_failure_scan_stack.is_empty(), "post condition");
     _promo_failure_scan_stack.clear(true); // Clear cached segments.
@@ -744,6 +827,9 @@ oop DefNewGeneration::copy_to_survivor_space(oop old) {
   // Try allocating obj in to-space (unless too old)
   if (old->age() < tenuring_threshold()) {
     obj = cast_to_oop(to()->allocate(s));
+    if (obj == nullptr) {
+      _survivor_overflow_words += s;
+    }
   }
 
   bool new_obj_is_tenured = false;
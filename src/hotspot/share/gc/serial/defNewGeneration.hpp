@@ -37,6 +37,8 @@
 #include "utilities/align.hpp"
 #include "utilities/stack.hpp"
 
+class AdaptivePaddedAverage;
+class AdaptiveWeightedAverage;
 class ContiguousSpace;
 class CSpaceCounters;
 class OldGenScanClosure;
@@ -115,6 +117,19 @@ class DefNewGeneration: public Generation {
   // Tenuring
   void adjust_desired_tenuring_threshold();
 
+  // Eden limit for SerialAdaptiveYoungSizing. Only the first _eden_limit
+  // bytes of the committed eden are handed out; the rest is left untouched.
+  size_t                   _eden_limit;
+  AdaptivePaddedAverage*   _avg_survived;
+  AdaptiveWeightedAverage* _avg_gc_cost;
+  double                   _last_gc_end;
+  // Words that did not fit into to-space although they were below the
+  // tenuring threshold, in the current young collection.
+  size_t                   _survivor_overflow_words;
+
+  void update_eden_limit(double gc_start);
+  void apply_eden_limit();
+
   // Spaces
   ContiguousSpace* _eden_space;
   ContiguousSpace* _from_space;
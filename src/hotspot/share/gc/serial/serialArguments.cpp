@@ -27,10 +27,19 @@
 #include "gc/shared/gcArguments.hpp"
 #include "gc/serial/serialArguments.hpp"
 #include "gc/serial/serialHeap.hpp"
+#include "logging/log.hpp"
+#include "runtime/globals_extension.hpp"
 
 void SerialArguments::initialize() {
   GCArguments::initialize();
   FullGCForwarding::initialize_flags(MaxHeapSize);
+
+  if (SerialAdaptiveYoungSizing && AlwaysPreTouch) {
+    // Pre-touching faults in all of eden up front, which is exactly what
+    // the adaptive eden limit is meant to avoid.
+    log_warning(gc)("Disabling SerialAdaptiveYoungSizing because AlwaysPreTouch is enabled");
+    FLAG_SET_DEFAULT(SerialAdaptiveYoungSizing, false);
+  }
 }
 
 CollectedHeap* SerialArguments::create_heap() {
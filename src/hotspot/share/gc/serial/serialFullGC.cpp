@@ -49,6 +49,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
 #include "gc/shared/modRefBarrierSet.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/referencePolicy.hpp"
@@ -66,8 +67,10 @@
 #include "oops/objArrayKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "runtime/os.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
+#include "utilities/checkedCast.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/events.hpp"
 #include "utilities/stack.inline.hpp"
@@ -90,12 +93,173 @@ ReferenceProcessor* SerialFullGC::_ref_processor;
 
 StringDedup::Requests*  SerialFullGC::_string_dedup_requests = nullptr;
 
+SerialFullGCSideTables* SerialFullGC::_side_tables = nullptr;
+
 SerialFullGC::FollowRootClosure  SerialFullGC::follow_root_closure;
 
 MarkAndPushClosure SerialFullGC::mark_and_push_closure(ClassLoaderData::_claim_stw_fullgc_mark);
 CLDToOopClosure    SerialFullGC::follow_cld_closure(&mark_and_push_closure, ClassLoaderData::_claim_stw_fullgc_mark);
 CLDToOopClosure    SerialFullGC::adjust_cld_closure(&adjust_pointer_closure, ClassLoaderData::_claim_stw_fullgc_adjust);
 
+// Side tables for UseSerialFullGCSideTables. Live objects are marked in a
+// bitmap instead of their mark words, and forwarding addresses are computed
+// on demand instead of being installed in the mark words: for every block of
+// BlockWords heap words the table holds the destination of the first live
+// object starting in that block, and the destination of any later object in
+// the block follows from the sizes of the live objects before it. Objects
+// keep their original headers throughout, so nothing needs to be preserved.
+//
+// The only places where the destinations within a block are not contiguous
+// are where compaction moves on to the next space; these few objects are
+// recorded in _splits.
+class SerialFullGCSideTables : public CHeapObj<mtGC> {
+  static const int    LogBlockWords = 6;
+  static const size_t BlockWords = size_t(1) << LogBlockWords;
+  static const uint   MaxSplits = 4;
+
+  struct Split {
+    HeapWord* _addr;
+    HeapWord* _destination;
+  };
+
+  HeapWord* const _heap_start;
+  char* const     _storage;
+  const size_t    _storage_bytes;
+  MarkBitMap      _bitmap;
+  juint*          _block_destination;
+
+  Split _splits[MaxSplits];
+  uint  _num_splits;
+
+  // Cursor for the walks in phase 2 and phase 4, which visit live objects in
+  // address order within each space.
+  size_t    _last_block;
+  HeapWord* _next_destination;
+
+  SerialFullGCSideTables(MemRegion heap, char* storage, size_t storage_bytes, size_t bitmap_bytes) :
+    _heap_start(heap.start()),
+    _storage(storage),
+    _storage_bytes(storage_bytes),
+    _bitmap(),
+    _block_destination((juint*)(storage + bitmap_bytes)),
+    _num_splits(0) {
+    _bitmap.initialize(heap, MemRegion((HeapWord*)storage, bitmap_bytes / HeapWordSize));
+    reset_cursor();
+  }
+
+  size_t block_index(HeapWord* addr) const {
+    return pointer_delta(addr, _heap_start) >> LogBlockWords;
+  }
+
+  HeapWord* block_start(size_t block) const {
+    return _heap_start + (block << LogBlockWords);
+  }
+
+public:
+  // Returns null if the tables cannot be set up; the full GC then uses the
+  // mark words as usual.
+  static SerialFullGCSideTables* create(MemRegion heap) {
+    if (heap.word_size() > max_juint) {
+      log_info(gc)("Heap too large for full GC side tables");
+      return nullptr;
+    }
+    const size_t bitmap_bytes = align_up(MarkBitMap::compute_size(heap.byte_size()), HeapWordSize);
+    const size_t table_bytes = align_up(heap.word_size(), BlockWords) / BlockWords * sizeof(juint);
+    const size_t storage_bytes = align_up(bitmap_bytes + table_bytes, os::vm_page_size());
+
+    char* storage = os::reserve_memory(storage_bytes, false, mtGC);
+    if (storage == nullptr) {
+      log_info(gc)("Failed to reserve %zuB for full GC side tables", storage_bytes);
+      return nullptr;
+    }
+    if (!os::commit_memory(storage, storage_bytes, false)) {
+      os::release_memory(storage, storage_bytes);
+      log_info(gc)("Failed to commit %zuB for full GC side tables", storage_bytes);
+      return nullptr;
+    }
+    // Freshly committed memory is zeroed, so the bitmap starts out clear.
+    return new SerialFullGCSideTables(heap, storage, storage_bytes, bitmap_bytes);
+  }
+
+  ~SerialFullGCSideTables() {
+    os::release_memory(_storage, _storage_bytes);
+  }
+
+  bool is_marked(oop obj) const { return _bitmap.is_marked(obj); }
+  void mark(oop obj)            { _bitmap.mark(obj); }
+
+  HeapWord* next_marked_addr(HeapWord* addr, HeapWord* limit) const {
+    return _bitmap.get_next_marked_addr(addr, limit);
+  }
+
+  void reset_cursor() {
+    _last_block = SIZE_MAX;
+    _next_destination = nullptr;
+  }
+
+  // Phase 2: record that the live object at addr of the given size moves to
+  // destination. Must be called in address order within each space.
+  void record_forwarding(HeapWord* addr, HeapWord* destination, size_t size) {
+    const size_t block = block_index(addr);
+    if (block != _last_block) {
+      _block_destination[block] = checked_cast<juint>(pointer_delta(destination, _heap_start));
+      _last_block = block;
+    } else if (destination != _next_destination) {
+      guarantee(_num_splits < MaxSplits, "too many compaction space switches");
+      _splits[_num_splits++] = { addr, destination };
+    }
+    _next_destination = destination + size;
+  }
+
+  // Phase 3: the destination of the live object at addr.
+  HeapWord* forwardee(HeapWord* addr) const {
+    const size_t block = block_index(addr);
+    HeapWord* cur = block_start(block);
+    HeapWord* destination = _heap_start + _block_destination[block];
+    for (uint i = 0; i < _num_splits; i++) {
+      const Split& s = _splits[i];
+      if (s._addr >= cur && s._addr <= addr) {
+        cur = s._addr;
+        destination = s._destination;
+      }
+    }
+    for (cur = next_marked_addr(cur, addr); cur < addr; cur = next_marked_addr(cur, addr)) {
+      const size_t size = cast_to_oop(cur)->size();
+      destination += size;
+      cur += size;
+    }
+    return destination;
+  }
+
+  // Phase 4: the destination of the live object at addr, which must be the
+  // next live object in address order after the previous call. Live objects
+  // before addr in its block that have not been visited yet must still be
+  // in place.
+  HeapWord* next_forwardee(HeapWord* addr, size_t size) {
+    const size_t block = block_index(addr);
+    if (block != _last_block) {
+      _last_block = block;
+      _next_destination = forwardee(addr);
+    } else {
+      for (uint i = 0; i < _num_splits; i++) {
+        if (_splits[i]._addr == addr) {
+          _next_destination = _splits[i]._destination;
+        }
+      }
+    }
+    HeapWord* result = _next_destination;
+    _next_destination += size;
+    return result;
+  }
+};
+
+inline bool SerialFullGC::is_marked(oop obj) {
+  if (_side_tables != nullptr) {
+    return _side_tables->is_marked(obj);
+  }
+  return obj->mark().is_marked();
+}
+
 class DeadSpacer : StackObj {
   size_t _allowed_deadspace_words;
   bool _active;
@@ -228,9 +392,13 @@ class Compacter {
     }
   }
 
-  static void forward_obj(oop obj, HeapWord* new_addr) {
+  static void forward_obj(oop obj, HeapWord* new_addr, size_t obj_size) {
     prefetch_write_scan(obj);
-    if (cast_from_oop<HeapWord*>(obj) != new_addr) {
+    SerialFullGCSideTables* side_tables = SerialFullGC::side_tables();
+    if (side_tables != nullptr) {
+      // The header is left untouched.
+      side_tables->record_forwarding(cast_from_oop<HeapWord*>(obj), new_addr, obj_size);
+    } else if (cast_from_oop<HeapWord*>(obj) != new_addr) {
       FullGCForwarding::forward_to(obj, cast_to_oop(new_addr));
     } else {
       assert(obj->is_gc_marked(), "inv");
@@ -240,6 +408,10 @@ class Compacter {
   }
 
   static HeapWord* find_next_live_addr(HeapWord* start, HeapWord* end) {
+    SerialFullGCSideTables* side_tables = SerialFullGC::side_tables();
+    if (side_tables != nullptr) {
+      return side_tables->next_marked_addr(start, end);
+    }
     for (HeapWord* i_addr = start; i_addr < end; /* empty */) {
       prefetch_read_scan(i_addr);
       oop obj = cast_to_oop(i_addr);
@@ -299,16 +471,24 @@ class Compacter {
       while (cur_addr < top) {
         oop obj = cast_to_oop(cur_addr);
         size_t obj_size = obj->size();
-        if (obj->is_gc_marked()) {
+        if (SerialFullGC::is_marked(obj)) {
           HeapWord* new_addr = alloc(obj_size);
-          forward_obj(obj, new_addr);
+          forward_obj(obj, new_addr, obj_size);
           cur_addr += obj_size;
         } else {
           // Skipping the current known-unmarked obj
           HeapWord* next_live_addr = find_next_live_addr(cur_addr + obj_size, top);
           if (dead_spacer.insert_deadspace(cur_addr, next_live_addr)) {
             // Register space for the filler obj
-            alloc(pointer_delta(next_live_addr, cur_addr));
+            size_t filler_size = pointer_delta(next_live_addr, cur_addr);
+            HeapWord* filler_addr = alloc(filler_size);
+            SerialFullGCSideTables* side_tables = SerialFullGC::side_tables();
+            if (side_tables != nullptr) {
+              // The filler takes part in computing the forwardees of the
+              // objects after it in its block.
+              side_tables->mark(obj);
+              side_tables->record_forwarding(cur_addr, filler_addr, filler_size);
+            }
           } else {
             if (!record_first_dead_done) {
               record_first_dead(i, cur_addr);
@@ -335,7 +515,7 @@ class Compacter {
 
       while (cur_addr < top) {
         prefetch_write_scan(cur_addr);
-        if (cur_addr < first_dead || cast_to_oop(cur_addr)->is_gc_marked()) {
+        if (cur_addr < first_dead || SerialFullGC::is_marked(cast_to_oop(cur_addr))) {
           size_t size = cast_to_oop(cur_addr)->oop_iterate_size(&SerialFullGC::adjust_pointer_closure);
           cur_addr += size;
         } else {
@@ -346,24 +526,53 @@ class Compacter {
     }
   }
 
+  void compact_with_side_tables(SerialFullGCSideTables* side_tables, HeapWord* cur_addr, HeapWord* top) {
+    side_tables->reset_cursor();
+    for (cur_addr = side_tables->next_marked_addr(cur_addr, top);
+         cur_addr < top;
+         cur_addr = side_tables->next_marked_addr(cur_addr, top)) {
+      prefetch_read_scan(cur_addr);
+      // Read the size before the copy may overwrite the source.
+      size_t obj_size = cast_to_oop(cur_addr)->size();
+      HeapWord* new_addr = side_tables->next_forwardee(cur_addr, obj_size);
+      if (new_addr != cur_addr) {
+        prefetch_write_copy(new_addr);
+        Copy::aligned_conjoint_words(cur_addr, new_addr, obj_size);
+      }
+      cur_addr += obj_size;
+    }
+  }
+
   void phase4_compact() {
+    SerialFullGCSideTables* side_tables = SerialFullGC::side_tables();
     for (uint i = 0; i < _num_spaces; ++i) {
       ContiguousSpace* space = get_space(i);
       HeapWord* cur_addr = space->bottom();
       HeapWord* top = space->top();
 
-      // Check if the first obj inside this space is forwarded.
-      if (!FullGCForwarding::is_forwarded(cast_to_oop(cur_addr))) {
-        // Jump over consecutive (in-place) live-objs-chunk
-        cur_addr = get_first_dead(i);
-      }
-
-      while (cur_addr < top) {
+      if (side_tables != nullptr) {
+        oop first = cast_to_oop(cur_addr);
+        if (cur_addr == top ||
+            !side_tables->is_marked(first) ||
+            side_tables->forwardee(cur_addr) == cur_addr) {
+          // Jump over consecutive (in-place) live-objs-chunk
+          cur_addr = get_first_dead(i);
+        }
+        compact_with_side_tables(side_tables, cur_addr, top);
+      } else {
+        // Check if the first obj inside this space is forwarded.
         if (!FullGCForwarding::is_forwarded(cast_to_oop(cur_addr))) {
-          cur_addr = *(HeapWord**) cur_addr;
-          continue;
+          // Jump over consecutive (in-place) live-objs-chunk
+          cur_addr = get_first_dead(i);
+        }
+
+        while (cur_addr < top) {
+          if (!FullGCForwarding::is_forwarded(cast_to_oop(cur_addr))) {
+            cur_addr = *(HeapWord**) cur_addr;
+            continue;
+          }
+          cur_addr += relocate(cur_addr);
         }
-        cur_addr += relocate(cur_addr);
       }
 
       // Reset top and unused memory
@@ -395,7 +604,7 @@ void SerialFullGC::follow_array(objArrayOop array) {
 }
 
 void SerialFullGC::follow_object(oop obj) {
-  assert(obj->is_gc_marked(), "should be marked");
+  assert(is_marked(obj), "should be marked");
   if (obj->is_objArray()) {
     // Handle object arrays explicitly to allow them to
     // be split into chunks if needed.
@@ -424,7 +633,7 @@ void SerialFullGC::follow_stack() {
   do {
     while (!_marking_stack.is_empty()) {
       oop obj = _marking_stack.pop();
-      assert (obj->is_gc_marked(), "p must be marked");
+      assert (is_marked(obj), "p must be marked");
       follow_object(obj);
     }
     // Process ObjArrays one at a time to avoid marking stack bloat.
@@ -445,7 +654,7 @@ template <class T> void SerialFullGC::follow_root(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
+    if (!is_marked(obj)) {
       mark_object(obj);
       follow_object(obj);
     }
@@ -591,6 +800,13 @@ void SerialFullGC::mark_object(oop obj) {
     _string_dedup_requests->add(obj);
   }
 
+  if (_side_tables != nullptr) {
+    // The mark word stays as is and needs no preserving.
+    _side_tables->mark(obj);
+    ContinuationGCSupport::transform_stack_chunk(obj);
+    return;
+  }
+
   // some marks may contain information we need to preserve so we store them away
   // and overwrite the mark.  We'll restore it at the end of serial full GC.
   markWord mark = obj->mark();
@@ -607,7 +823,7 @@ template <class T> void SerialFullGC::mark_and_push(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
+    if (!is_marked(obj)) {
       mark_object(obj);
       _marking_stack.push(obj);
     }
@@ -625,7 +841,12 @@ template <class T> void SerialFullGC::adjust_pointer(T* p) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
     assert(Universe::heap()->is_in(obj), "should be in heap");
 
-    if (FullGCForwarding::is_forwarded(obj)) {
+    if (_side_tables != nullptr) {
+      HeapWord* new_addr = _side_tables->forwardee(cast_from_oop<HeapWord*>(obj));
+      if (new_addr != cast_from_oop<HeapWord*>(obj)) {
+        RawAccess<IS_NOT_NULL>::oop_store(p, cast_to_oop(new_addr));
+      }
+    } else if (FullGCForwarding::is_forwarded(obj)) {
       oop new_obj = FullGCForwarding::forwardee(obj);
       assert(is_object_aligned(new_obj), "oop must be aligned");
       RawAccess<IS_NOT_NULL>::oop_store(p, new_obj);
@@ -664,7 +885,7 @@ void SerialFullGC::restore_marks() {
 
 SerialFullGC::IsAliveClosure   SerialFullGC::is_alive;
 
-bool SerialFullGC::IsAliveClosure::do_object_b(oop p) { return p->is_gc_marked(); }
+bool SerialFullGC::IsAliveClosure::do_object_b(oop p) { return SerialFullGC::is_marked(p); }
 
 SerialFullGC::KeepAliveClosure SerialFullGC::keep_alive;
 
@@ -695,6 +916,15 @@ void SerialFullGC::invoke_at_safepoint(bool clear_all_softrefs) {
 
   allocate_stacks();
 
+  if (UseSerialFullGCSideTables) {
+    // Young gen is below old gen in one contiguous reservation.
+    MemRegion heap(gch->young_gen()->reserved().start(), gch->old_gen()->reserved().end());
+    _side_tables = SerialFullGCSideTables::create(heap);
+  }
+  // Without marks in the headers, reference discovery needs to ask the
+  // bitmap whether a referent is already known to be alive.
+  ref_processor()->set_is_alive_non_header(_side_tables != nullptr ? &is_alive : nullptr);
+
   phase1_mark(clear_all_softrefs);
 
   Compacter compacter{gch};
@@ -738,6 +968,12 @@ void SerialFullGC::invoke_at_safepoint(bool clear_all_softrefs) {
     compacter.phase4_compact();
   }
 
+  if (_side_tables != nullptr) {
+    delete _side_tables;
+    _side_tables = nullptr;
+    ref_processor()->set_is_alive_non_header(nullptr);
+  }
+
   restore_marks();
 
   deallocate_stacks();
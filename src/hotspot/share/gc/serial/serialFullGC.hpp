@@ -37,6 +37,7 @@
 #include "utilities/growableArray.hpp"
 #include "utilities/stack.hpp"
 
+class SerialFullGCSideTables;
 class SerialOldTracer;
 class STWGCTimer;
 
@@ -99,6 +100,9 @@ class SerialFullGC : AllStatic {
 
   static StringDedup::Requests* _string_dedup_requests;
 
+  // Non-null during a full GC that uses UseSerialFullGCSideTables.
+  static SerialFullGCSideTables* _side_tables;
+
   // Non public closures
   static KeepAliveClosure keep_alive;
 
@@ -129,6 +133,9 @@ class SerialFullGC : AllStatic {
 
   static void follow_stack();   // Empty marking stack.
 
+  static SerialFullGCSideTables* side_tables() { return _side_tables; }
+  static inline bool is_marked(oop obj);
+
   template <class T> static void adjust_pointer(T* p);
 
   // Check mark and maybe push on marking stack
@@ -586,7 +586,12 @@ void SerialHeap::process_roots(ScanningOption so,
 
   Threads::oops_do(strong_roots, roots_from_code_p);
 
-  OopStorageSet::strong_oops_do(strong_roots);
+  if (so & SO_ScavengeCodeCache) {
+    // Young collections only need the blocks that may refer to young objects.
+    OopStorageSet::young_strong_oops_do(strong_roots, &_is_scavengable);
+  } else {
+    OopStorageSet::strong_oops_do(strong_roots);
+  }
 
   if (so & SO_ScavengeCodeCache) {
     assert(code_roots != nullptr, "must supply closure for code cache");
@@ -297,6 +297,8 @@ class SerialHeap : public CollectedHeap {
 
   void pin_object(JavaThread* thread, oop obj) override;
   void unpin_object(JavaThread* thread, oop obj) override;
+
+  bool can_clear_arrays_in_segments() const override { return true; }
 };
 
 #endif // SHARE_GC_SERIAL_SERIALHEAP_HPP
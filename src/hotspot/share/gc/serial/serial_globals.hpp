@@ -35,6 +35,18 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(bool, UseSerialFullGCSideTables, false, EXPERIMENTAL,             \
+          "Mark and forward objects in side tables during full GC instead " \
+          "of in their mark words, so that no mark words need to be "       \
+          "preserved. The tables take about 2.5% of the heap size for the " \
+          "duration of the full GC.")                                       \
+                                                                            \
+  product(bool, SerialAdaptiveYoungSizing, false, EXPERIMENTAL,             \
+          "Start with a small part of eden in use and size it from the "    \
+          "survival rate and GC time ratio seen at young collections. "     \
+          "Unused eden pages are not touched or are returned to the OS, "   \
+          "which keeps the footprint of small heaps low")                   \
 
 // end of GC_SERIAL_FLAGS
 
@@ -27,8 +27,10 @@
 #include "classfile/classLoaderData.inline.hpp"
 #include "code/nmethod.hpp"
 #include "gc/shared/classUnloadingContext.hpp"
+#include "logging/log.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/growableArray.hpp"
+#include "utilities/ticks.hpp"
 
 ClassUnloadingContext* ClassUnloadingContext::_context = nullptr;
 
@@ -76,12 +78,21 @@ void ClassUnloadingContext::register_unloading_class_loader_data(ClassLoaderData
 }
 
 void ClassUnloadingContext::purge_class_loader_data() {
+  Ticks start = Ticks::now();
+  size_t num_purged = 0;
+
   for (ClassLoaderData* cld = _cld_head; cld != nullptr;) {
     assert(cld->is_unloading(), "invariant");
 
     ClassLoaderData* next = cld->unloading_next();
     delete cld;
     cld = next;
+    num_purged++;
+  }
+
+  if (num_purged > 0) {
+    log_debug(class, unload)("Purged %zu class loader data in %.3fms",
+                             num_purged, (Ticks::now() - start).seconds() * MILLIUNITS);
   }
 }
 
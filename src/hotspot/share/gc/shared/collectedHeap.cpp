@@ -454,8 +454,13 @@ size_t CollectedHeap::filler_array_min_size() {
 }
 
 void CollectedHeap::zap_filler_array_with(HeapWord* start, size_t words, juint value) {
-  Copy::fill_to_words(start + filler_array_hdr_size(),
-                      words - filler_array_hdr_size(), value);
+  if (UseNonTemporalGCFill) {
+    Copy::fill_to_words_nontemporal(start + filler_array_hdr_size(),
+                                    words - filler_array_hdr_size(), value);
+  } else {
+    Copy::fill_to_words(start + filler_array_hdr_size(),
+                        words - filler_array_hdr_size(), value);
+  }
 }
 
 #ifdef ASSERT
@@ -496,6 +496,12 @@ class CollectedHeap : public CHeapObj<mtGC> {
   virtual void pin_object(JavaThread* thread, oop obj) = 0;
   virtual void unpin_object(JavaThread* thread, oop obj) = 0;
 
+  // Whether large primitive arrays may be cleared in segments, with safepoint
+  // checks in between, after their header has been installed. Requires that
+  // the collector never moves the array concurrently with the allocating
+  // thread, which keeps it in a handle and re-resolves it after each check.
+  virtual bool can_clear_arrays_in_segments() const { return false; }
+
   // Support for loading objects from CDS archive into the heap
   // (usually as a snapshot of the old generation).
   virtual bool can_load_archived_objects() const { return false; }
@@ -188,9 +188,9 @@ void VM_GC_HeapInspection::doit() {
     // Can't run with more threads than provided by the WorkerThreads.
     const uint capped_parallel_thread_num = MIN2(_parallel_thread_num, workers->max_workers());
     WithActiveWorkers with_active_workers(workers, capped_parallel_thread_num);
-    inspect.heap_inspection(_out, workers);
+    inspect.heap_inspection(_out, workers, _print_referenced);
   } else {
-    inspect.heap_inspection(_out, nullptr);
+    inspect.heap_inspection(_out, nullptr, _print_referenced);
   }
 }
 
@@ -132,6 +132,18 @@
           "ParallelGCThreads parallel collectors will use for garbage "     \
           "collection work")                                                \
                                                                             \
+  product(bool, UseAdaptiveGCWorkersPerPhase, false, EXPERIMENTAL,          \
+          "Adjust the number of workers of a parallel GC phase from the "   \
+          "parallel efficiency measured in its previous runs. Currently "   \
+          "used by the Parallel GC young collection")                       \
+                                                                            \
+  product(size_t, GCWorkerChunkCacheSize, 0, EXPERIMENTAL,                  \
+          "Bytes of arena chunks each GC worker thread keeps for reuse "    \
+          "by its next task, outside of the chunk pool cleaner. Larger "    \
+          "kept chunks are released lazily to the OS. 0 disables the "      \
+          "cache.")                                                         \
+          range(0, max_uintx)                                               \
+                                                                            \
   product(bool, InjectGCWorkerCreationFailure, false, DIAGNOSTIC,           \
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
@@ -182,6 +194,12 @@
           "bigger than this")                                               \
           range(1, INT_MAX/3)                                               \
                                                                             \
+  product(uint, ParGCArrayScanChunkMaxScale, 1, EXPERIMENTAL,               \
+          "Maximum factor by which the object array scan chunk grows "      \
+          "above ParGCArrayScanChunk for arrays whose elements rarely "     \
+          "need to be copied. 1 disables adaptive chunk sizing")            \
+          range(1, 1024)                                                    \
+                                                                            \
                                                                             \
   product(bool, AlwaysPreTouch, false,                                      \
           "Force all freshly committed pages to be pre-touched")            \
@@ -189,6 +207,11 @@
   product(bool, AlwaysPreTouchStacks, false, DIAGNOSTIC,                    \
           "Force java thread stacks to be fully pre-touched")               \
                                                                             \
+  product(bool, UseNonTemporalGCFill, false, DIAGNOSTIC,                    \
+          "Use non-temporal stores on x86_64 when filling filler "          \
+          "objects and mangling GC regions of at least 4M, so that "        \
+          "the fill does not evict the last-level cache")                   \
+                                                                            \
   product_pd(size_t, PreTouchParallelChunkSize,                             \
           "Per-thread chunk size for parallel memory pre-touch.")           \
           range(4*K, SIZE_MAX / 2)                                          \
@@ -209,6 +232,12 @@
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(bool, ParallelRefProcSplitFinalLists, false, EXPERIMENTAL,        \
+          "In multi-threaded reference processing, let workers claim "      \
+          "FinalReference lists in the keep-alive phase and split off "     \
+          "the rest of a long list for idle workers, instead of "           \
+          "balancing the lists beforehand")                                 \
+                                                                            \
   product(size_t, ReferencesPerThread, 1000, EXPERIMENTAL,                  \
                "Ergonomically start one thread for this amount of "         \
                "references for reference processing if "                    \
@@ -262,6 +291,17 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(uint, TaskQueueStealBatch, 0, EXPERIMENTAL,                       \
+          "After a successful steal, move up to this many more tasks, but " \
+          "at most half of the rest, from the victim's queue to the own "   \
+          "queue. 0 steals one task at a time")                             \
+          range(0, 4096)                                                    \
+                                                                            \
+  product(bool, OopStorageSkipCleanBlocks, true, DIAGNOSTIC,                \
+          "Young collections skip OopStorage blocks without allocations "   \
+          "or young referents since the last young scan, for storages "     \
+          "that support it")                                                \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
@@ -33,9 +33,11 @@
 #include "memory/universe.hpp"
 #include "oops/arrayOop.hpp"
 #include "oops/oop.inline.hpp"
+#include "oops/arrayKlass.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/continuationJavaClasses.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/javaThread.hpp"
 #include "services/lowMemoryDetector.hpp"
@@ -239,7 +241,7 @@ void MemAllocator::Allocation::notify_allocation() {
 
 HeapWord* MemAllocator::mem_allocate_outside_tlab(Allocation& allocation) const {
   allocation._allocated_outside_tlab = true;
-  HeapWord* mem = Universe::heap()->mem_allocate(_word_size, &allocation._overhead_limit_exceeded);
+  HeapWord* mem = mem_allocate_shared(&allocation._overhead_limit_exceeded);
   if (mem == nullptr) {
     return mem;
   }
@@ -250,6 +252,14 @@ HeapWord* MemAllocator::mem_allocate_outside_tlab(Allocation& allocation) const
   return mem;
 }
 
+bool MemAllocator::use_tlab() const {
+  return UseTLAB;
+}
+
+HeapWord* MemAllocator::mem_allocate_shared(bool* gc_overhead_limit_was_exceeded) const {
+  return Universe::heap()->mem_allocate(_word_size, gc_overhead_limit_was_exceeded);
+}
+
 HeapWord* MemAllocator::mem_allocate_inside_tlab_fast() const {
   return _thread->tlab().allocate(_word_size);
 }
@@ -319,7 +329,8 @@ HeapWord* MemAllocator::mem_allocate_inside_tlab_slow(Allocation& allocation) co
 }
 
 HeapWord* MemAllocator::mem_allocate(Allocation& allocation) const {
-  if (UseTLAB) {
+  const bool use_tlab = this->use_tlab();
+  if (use_tlab) {
     // Try allocating from an existing TLAB.
     HeapWord* mem = mem_allocate_inside_tlab_fast();
     if (mem != nullptr) {
@@ -330,7 +341,7 @@ HeapWord* MemAllocator::mem_allocate(Allocation& allocation) const {
   // Allocation of an oop can always invoke a safepoint.
   debug_only(allocation._thread->check_for_valid_safepoint_state());
 
-  if (UseTLAB) {
+  if (use_tlab) {
     // Try refilling the TLAB and allocating the object in it.
     HeapWord* mem = mem_allocate_inside_tlab_slow(allocation);
     if (mem != nullptr) {
@@ -386,7 +397,57 @@ oop ObjAllocator::initialize(HeapWord* mem) const {
   return finish(mem);
 }
 
+// The same segment size as ZObjArrayAllocator, which microbenchmarking
+// showed to be a good trade-off between allocation time and time-to-safepoint.
+static const size_t array_clearing_segment_words = 64 * K / HeapWordSize;
+
+bool ObjArrayAllocator::use_segmented_clearing() const {
+  return _do_zero &&
+         _word_size > array_clearing_segment_words &&
+         _klass->is_typeArray_klass() &&
+         _thread->is_Java_thread() &&
+         Universe::heap()->can_clear_arrays_in_segments();
+}
+
+oop ObjArrayAllocator::initialize_in_segments(HeapWord* mem) const {
+  // A primitive array is parsable whatever its elements contain, so it can
+  // be published before they are cleared. The array is not yet reachable by
+  // Java code and may be moved by a GC at the safepoint checks, so it is
+  // kept in a handle.
+  const BasicType element_type = ArrayKlass::cast(_klass)->element_type();
+  const size_t base_offset_in_bytes = (size_t)arrayOopDesc::base_offset_in_bytes(element_type);
+  const size_t start_offset_in_bytes = align_up(base_offset_in_bytes, (size_t)BytesPerWord);
+  if (start_offset_in_bytes != base_offset_in_bytes) {
+    // Clear the leading 4 bytes that the word fill below does not cover.
+    assert(start_offset_in_bytes - base_offset_in_bytes == 4, "Must be 4-byte aligned");
+    *reinterpret_cast<jint*>(reinterpret_cast<char*>(mem) + base_offset_in_bytes) = 0;
+  }
+  mem_zap_start_padding(mem);
+  arrayOopDesc::set_length(mem, _length);
+
+  JavaThread* const thread = JavaThread::cast(_thread);
+  HandleMark hm(thread);
+  Handle array(thread, finish(mem));
+
+  const size_t start = start_offset_in_bytes / HeapWordSize;
+  for (size_t processed = start; processed < _word_size; ) {
+    const size_t segment = MIN2(_word_size - processed, array_clearing_segment_words);
+    Copy::fill_to_words(cast_from_oop<HeapWord*>(array()) + processed, segment);
+    processed += segment;
+    if (processed < _word_size) {
+      ThreadBlockInVM tbivm(thread);
+    }
+  }
+
+  mem_zap_end_padding(cast_from_oop<HeapWord*>(array()));
+  return array();
+}
+
 oop ObjArrayAllocator::initialize(HeapWord* mem) const {
+  if (use_segmented_clearing()) {
+    return initialize_in_segments(mem);
+  }
+
   // Set array length before setting the _klass field because a
   // non-null klass field indicates that the object is parsable by
   // concurrent GC.
@@ -64,6 +64,13 @@ class MemAllocator: StackObj {
   // Initialization provided by subclasses.
   virtual oop initialize(HeapWord* mem) const = 0;
 
+  // Whether the object may be allocated in a TLAB.
+  virtual bool use_tlab() const;
+
+  // Raw memory allocation outside a TLAB. Subclasses may use this to place
+  // objects into a dedicated part of the heap.
+  virtual HeapWord* mem_allocate_shared(bool* gc_overhead_limit_was_exceeded) const;
+
   // This function clears the memory of the object.
   void mem_clear(HeapWord* mem) const;
 
@@ -97,6 +104,11 @@ class ObjArrayAllocator: public MemAllocator {
   void mem_zap_start_padding(HeapWord* mem) const PRODUCT_RETURN;
   void mem_zap_end_padding(HeapWord* mem) const PRODUCT_RETURN;
 
+  // Clears a large primitive array in segments, with safepoint checks in
+  // between so that the allocating thread does not delay safepoints.
+  bool use_segmented_clearing() const;
+  oop initialize_in_segments(HeapWord* mem) const;
+
 public:
   ObjArrayAllocator(Klass* klass, size_t word_size, int length, bool do_zero,
                     Thread* thread = Thread::current())
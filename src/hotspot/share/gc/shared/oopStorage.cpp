@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageParState.inline.hpp"
 #include "logging/log.hpp"
@@ -222,7 +223,8 @@ OopStorage::Block::Block(const OopStorage* owner, void* memory) :
   _active_index(0),
   _allocation_list_entry(),
   _deferred_updates_next(nullptr),
-  _release_refcount(0)
+  _release_refcount(0),
+  _needs_young_scan(true)
 {
   STATIC_ASSERT(_data_pos == 0);
   STATIC_ASSERT(section_size * section_count == ARRAY_SIZE(_data));
@@ -333,6 +335,7 @@ oop* OopStorage::Block::allocate() {
   unsigned index = count_trailing_zeros(~allocated);
   // Use atomic update because release may change bitmask.
   atomic_add_allocated(bitmask_for_index(index));
+  _needs_young_scan = true;
   return get_pointer(index);
 }
 
@@ -341,6 +344,7 @@ uintx OopStorage::Block::allocate_all() {
   assert(new_allocated != 0, "attempt to allocate from full block");
   // Use atomic update because release may change bitmask.
   atomic_add_allocated(new_allocated);
+  _needs_young_scan = true;
   return new_allocated;
 }
 
@@ -836,7 +840,9 @@ OopStorage::OopStorage(const char* name, MemTag mem_tag) :
   _allocation_count(0),
   _concurrent_iteration_count(0),
   _mem_tag(mem_tag),
-  _needs_cleanup(false)
+  _needs_cleanup(false),
+  _tracks_young_blocks(false),
+  _young_scan_all(true)
 {
   _active_array->increment_refcount();
   assert(_active_mutex->rank() < _allocation_mutex->rank(),
@@ -994,6 +1000,14 @@ bool OopStorage::delete_empty_blocks() {
   return true;
 }
 
+void OopStorage::enable_young_block_tracking() {
+  _tracks_young_blocks = true;
+}
+
+bool OopStorage::young_scan_all() const {
+  return !_tracks_young_blocks || !OopStorageSkipCleanBlocks || _young_scan_all;
+}
+
 OopStorage::EntryStatus OopStorage::allocation_status(const oop* ptr) const {
   if (ptr == nullptr) return INVALID_ENTRY;
   const Block* block = block_for_ptr(ptr);
@@ -1055,7 +1069,9 @@ OopStorage::BasicParState::BasicParState(const OopStorage* storage,
   _next_block(0),
   _estimated_thread_count(estimated_thread_count),
   _concurrent(concurrent),
-  _num_dead(0)
+  _num_dead(0),
+  _young_scan_all(storage->young_scan_all()),
+  _did_young_scan(false)
 {
   assert(estimated_thread_count > 0, "estimated thread count must be positive");
   update_concurrent_iteration_count(1);
@@ -1069,6 +1085,9 @@ OopStorage::BasicParState::BasicParState(const OopStorage* storage,
 OopStorage::BasicParState::~BasicParState() {
   _storage->relinquish_block_array(_active_array);
   update_concurrent_iteration_count(-1);
+  if (_did_young_scan) {
+    _storage->_young_scan_all = false;
+  }
   if (_concurrent) {
     // We may have deferred some cleanup work.
     const_cast<OopStorage*>(_storage)->record_needs_cleanup();
@@ -166,6 +166,21 @@ class OopStorage : public CHeapObjBase {
   template<typename IsAliveClosure, typename Closure>
   inline void weak_oops_do(IsAliveClosure* is_alive, Closure* closure);
 
+  // Young collection support.  A storage whose entries are only set right
+  // after allocation, without an intervening safepoint, and are cleared
+  // before release, can let young collections skip blocks that have had no
+  // allocations and referred to no young objects since the last young scan.
+  void enable_young_block_tracking();
+
+  // Applies closure->do_oop(p) to the entries that may refer to young
+  // objects, recording per block whether is_young->do_object_b(*p) holds for
+  // any entry afterwards.  Visits all entries if tracking is not enabled or
+  // -XX:-OopStorageSkipCleanBlocks, and after any non-const iteration (e.g.
+  // by a full collection) since the last young scan.
+  // precondition: at safepoint.
+  template<typename Closure, typename IsYoung>
+  inline void young_oops_do(Closure* closure, IsYoung* is_young);
+
   // Parallel iteration is for the exclusive use of the GC.
   // Other clients must use serial iteration.
   template<bool concurrent, bool is_const> class ParState;
@@ -280,6 +295,15 @@ class OopStorage : public CHeapObjBase {
   // Flag indicating this storage object is a candidate for empty block deletion.
   volatile bool _needs_cleanup;
 
+  // Young block tracking; see enable_young_block_tracking.  _young_scan_all
+  // is set by non-const iteration, which may have stored young objects into
+  // blocks considered clean.  mutable because it is reset by ParState.
+  bool _tracks_young_blocks;
+  mutable volatile bool _young_scan_all;
+
+  // Returns true if the next young scan must visit all blocks.
+  bool young_scan_all() const;
+
   // Clients construct via "create" factory function.
   OopStorage(const char* name, MemTag mem_tag);
   NONCOPYABLE(OopStorage);
@@ -321,6 +345,10 @@ class OopStorage : public CHeapObjBase {
   // Wrapper for iteration handler, automatically skipping null entries.
   template<typename F> class SkipNullFn;
   template<typename F> static SkipNullFn<F> skip_null_fn(F f);
+
+  // Wrapper for OopClosure-style function that records whether any entry
+  // refers to a young object after the closure has been applied to it.
+  template<typename Closure, typename IsYoung> class YoungOopFn;
 };
 
 #endif // SHARE_GC_SHARED_OOPSTORAGE_HPP
@@ -143,6 +143,8 @@ class OopStorage::Block /* No base class, to avoid messing up alignment. */ {
   AllocationListEntry _allocation_list_entry;
   Block* volatile _deferred_updates_next;
   volatile uintx _release_refcount;
+  // Set by allocation, and by a young scan that leaves young referents.
+  volatile bool _needs_young_scan;
 
   Block(const OopStorage* owner, void* memory);
   ~Block();
@@ -200,6 +202,9 @@ class OopStorage::Block /* No base class, to avoid messing up alignment. */ {
   template<typename F> bool iterate(F f);
   template<typename F> bool iterate(F f) const;
 
+  template<typename Closure, typename IsYoung>
+  void young_oops_do(Closure* cl, IsYoung* is_young, bool scan_all);
+
   bool print_containing(const oop* addr, outputStream* st);
 }; // class Block
 
@@ -302,6 +307,27 @@ inline OopStorage::SkipNullFn<F> OopStorage::skip_null_fn(F f) {
   return SkipNullFn<F>(f);
 }
 
+template<typename Closure, typename IsYoung>
+class OopStorage::YoungOopFn {
+public:
+  YoungOopFn(Closure* cl, IsYoung* is_young, bool* found_young) :
+    _cl(cl), _is_young(is_young), _found_young(found_young) {}
+
+  bool operator()(oop* ptr) const {
+    _cl->do_oop(ptr);
+    oop v = *ptr;
+    if (v != nullptr && _is_young->do_object_b(v)) {
+      *_found_young = true;
+    }
+    return true;
+  }
+
+private:
+  Closure* _cl;
+  IsYoung* _is_young;
+  bool* _found_young;
+};
+
 // Inline Block accesses for use in iteration loops.
 
 inline const OopStorage::AllocationListEntry& OopStorage::Block::allocation_list_entry() const {
@@ -356,6 +382,15 @@ inline bool OopStorage::Block::iterate(F f) const {
   return iterate_impl(f, this);
 }
 
+template<typename Closure, typename IsYoung>
+inline void OopStorage::Block::young_oops_do(Closure* cl, IsYoung* is_young, bool scan_all) {
+  if (scan_all || _needs_young_scan) {
+    bool found_young = false;
+    iterate(YoungOopFn<Closure, IsYoung>(cl, is_young, &found_young));
+    _needs_young_scan = found_young;
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Support for serial iteration, always at a safepoint.
 
@@ -380,6 +415,7 @@ inline bool OopStorage::iterate_impl(F f, Storage* storage) {
 
 template<typename F>
 inline bool OopStorage::iterate_safepoint(F f) {
+  _young_scan_all = true;
   return iterate_impl(f, this);
 }
 
@@ -408,4 +444,16 @@ inline void OopStorage::weak_oops_do(IsAliveClosure* is_alive, Closure* cl) {
   iterate_safepoint(if_alive_fn(is_alive, oop_fn(cl)));
 }
 
+template<typename Closure, typename IsYoung>
+inline void OopStorage::young_oops_do(Closure* cl, IsYoung* is_young) {
+  assert_at_safepoint();
+  bool const scan_all = young_scan_all();
+  ActiveArray* blocks = _active_array;
+  size_t limit = blocks->block_count();
+  for (size_t i = 0; i < limit; ++i) {
+    blocks->at(i)->young_oops_do(cl, is_young, scan_all);
+  }
+  _young_scan_all = false;
+}
+
 #endif // SHARE_GC_SHARED_OOPSTORAGE_INLINE_HPP
@@ -136,6 +136,8 @@ class OopStorage::BasicParState {
   uint _estimated_thread_count;
   bool _concurrent;
   volatile size_t _num_dead;
+  const bool _young_scan_all;
+  volatile bool _did_young_scan;
 
   NONCOPYABLE(BasicParState);
 
@@ -148,6 +150,9 @@ class OopStorage::BasicParState {
   // Wrapper for iteration handler; ignore handler result and return true.
   template<typename F> class AlwaysTrueFn;
 
+  // Applies f to each block in the claimed segments.
+  template<typename BlockPtr, typename F> void iterate_blocks(F f);
+
 public:
   BasicParState(const OopStorage* storage,
                 uint estimated_thread_count,
@@ -158,6 +163,9 @@ class OopStorage::BasicParState {
 
   template<bool is_const, typename F> void iterate(F f);
 
+  template<typename Closure, typename IsYoung>
+  void young_oops_do(Closure* cl, IsYoung* is_young);
+
   static uint default_estimated_thread_count(bool concurrent);
 
   size_t num_dead() const;
@@ -202,6 +210,9 @@ class OopStorage::ParState<false, false> {
   template<typename Closure> void weak_oops_do(Closure* cl);
   template<typename IsAliveClosure, typename Closure>
   void weak_oops_do(IsAliveClosure* is_alive, Closure* cl);
+  // Parallel version of OopStorage::young_oops_do.
+  template<typename Closure, typename IsYoung>
+  void young_oops_do(Closure* cl, IsYoung* is_young);
 
   size_t num_dead() const { return _basic_state.num_dead(); }
   void increment_num_dead(size_t num_dead) { _basic_state.increment_num_dead(num_dead); }
@@ -49,23 +49,40 @@ struct OopStorage::BasicParState::IterationData {
   size_t _processed;
 };
 
-template<bool is_const, typename F>
-inline void OopStorage::BasicParState::iterate(F f) {
-  // Wrap f in ATF so we can use Block::iterate.
-  AlwaysTrueFn<F> atf_f(f);
+template<typename BlockPtr, typename F>
+inline void OopStorage::BasicParState::iterate_blocks(F f) {
   IterationData data = {};      // zero initialize.
   while (claim_next_segment(&data)) {
     assert(data._segment_start < data._segment_end, "invariant");
     assert(data._segment_end <= _block_count, "invariant");
-    using BlockPtr = std::conditional_t<is_const, const Block*, Block*>;
     size_t i = data._segment_start;
     do {
       BlockPtr block = _active_array->at(i);
-      block->iterate(atf_f);
+      f(block);
     } while (++i < data._segment_end);
   }
 }
 
+template<bool is_const, typename F>
+inline void OopStorage::BasicParState::iterate(F f) {
+  if (!is_const) {
+    _storage->_young_scan_all = true;
+  }
+  // Wrap f in ATF so we can use Block::iterate.
+  AlwaysTrueFn<F> atf_f(f);
+  using BlockPtr = std::conditional_t<is_const, const Block*, Block*>;
+  iterate_blocks<BlockPtr>([&](BlockPtr block) { block->iterate(atf_f); });
+}
+
+template<typename Closure, typename IsYoung>
+inline void OopStorage::BasicParState::young_oops_do(Closure* cl, IsYoung* is_young) {
+  assert(!_concurrent, "young scans are done at a safepoint");
+  _did_young_scan = true;
+  iterate_blocks<Block*>([&](Block* block) {
+    block->young_oops_do(cl, is_young, _young_scan_all);
+  });
+}
+
 template<bool concurrent, bool is_const>
 template<typename F>
 inline void OopStorage::ParState<concurrent, is_const>::iterate(F f) {
@@ -98,4 +115,9 @@ inline void OopStorage::ParState<false, false>::weak_oops_do(IsAliveClosure* is_
   this->iterate(if_alive_fn(is_alive, oop_fn(cl)));
 }
 
+template<typename Closure, typename IsYoung>
+inline void OopStorage::ParState<false, false>::young_oops_do(Closure* cl, IsYoung* is_young) {
+  _basic_state.young_oops_do(cl, is_young);
+}
+
 #endif // SHARE_GC_SHARED_OOPSTORAGEPARSTATE_INLINE_HPP
@@ -90,6 +90,10 @@ class OopStorageSet : public AllStatic {
   template <typename Closure>
   static void strong_oops_do(Closure* cl);
 
+  // Young collection version of strong_oops_do; see OopStorage::young_oops_do.
+  template <typename Closure, typename IsYoung>
+  static void young_strong_oops_do(Closure* cl, IsYoung* is_young);
+
   // Debugging: print location info, if in storage.
   static bool print_containing(const void* addr, outputStream* st);
 };
@@ -37,4 +37,11 @@ void OopStorageSet::strong_oops_do(Closure* cl) {
   }
 }
 
+template <typename Closure, typename IsYoung>
+void OopStorageSet::young_strong_oops_do(Closure* cl, IsYoung* is_young) {
+  for (auto id : EnumRange<StrongId>()) {
+    storage(id)->young_oops_do(cl, is_young);
+  }
+}
+
 #endif // SHARE_GC_SHARED_OOPSTORAGESET_INLINE_HPP
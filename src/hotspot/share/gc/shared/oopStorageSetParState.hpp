@@ -59,6 +59,10 @@ class OopStorageSetStrongParState
 public:
   template<typename Closure>
   void oops_do(Closure* cl);
+
+  // Only for the non-concurrent, non-const states used by young collections.
+  template<typename Closure, typename IsYoung>
+  void young_oops_do(Closure* cl, IsYoung* is_young);
 };
 
 // Set of weak parallel states.
@@ -42,6 +42,14 @@ void OopStorageSetStrongParState<concurrent, is_const>::oops_do(Closure* cl) {
   }
 }
 
+template <bool concurrent, bool is_const>
+template <typename Closure, typename IsYoung>
+void OopStorageSetStrongParState<concurrent, is_const>::young_oops_do(Closure* cl, IsYoung* is_young) {
+  for (auto id : EnumRange<OopStorageSet::StrongId>()) {
+    this->par_state(id)->young_oops_do(cl, is_young);
+  }
+}
+
 template <typename ClosureType>
 class DeadCounterClosure : public OopClosure {
 private:
@@ -31,10 +31,47 @@
 PartialArraySplitter::PartialArraySplitter(PartialArrayStateManager* manager,
                                            uint num_workers)
   : _allocator(manager),
-    _stepper(num_workers, ParGCArrayScanChunk)
+    _stepper(num_workers),
+    // Chunk indices are ints, see the callers of claim().
+    _chunk_sizer(ParGCArrayScanChunk,
+                 (size_t)MIN2((uint64_t)ParGCArrayScanChunk * ParGCArrayScanChunkMaxScale,
+                              (uint64_t)max_jint))
     TASKQUEUE_STATS_ONLY(COMMA _stats())
 {}
 
+PartialArrayChunkSizer::PartialArrayChunkSizer(size_t min_chunk_size, size_t max_chunk_size)
+  : _min_chunk_size(min_chunk_size),
+    _max_chunk_size(MAX2(min_chunk_size, max_chunk_size)),
+    // Start out with the smallest chunks, as without adaptation.
+    _push_density(1.0)
+{
+  assert(min_chunk_size > 0, "must be");
+}
+
+size_t PartialArrayChunkSizer::chunk_size() const {
+  if (_max_chunk_size == _min_chunk_size) {
+    return _min_chunk_size;
+  }
+  // Count pushing a task as costing as much as scanning scale elements, and
+  // aim for the same amount of work per chunk as a minimum sized chunk of
+  // elements that all push a task.
+  const double scale = (double)_max_chunk_size / _min_chunk_size;
+  const size_t result = (size_t)(_max_chunk_size / (1.0 + (scale - 1.0) * _push_density));
+  return clamp(result, _min_chunk_size, _max_chunk_size);
+}
+
+void PartialArrayChunkSizer::record_chunk(size_t elements, size_t queued_before, size_t queued_after) {
+  if (elements == 0) {
+    return;
+  }
+  // Steals by other workers can outnumber the pushes, count that as none.
+  const size_t pushed = queued_after > queued_before ? queued_after - queued_before : 0;
+  // Weight of the latest chunk in the decaying average.
+  const double weight = 0.25;
+  const double density = MIN2(1.0, (double)pushed / elements);
+  _push_density += (density - _push_density) * weight;
+}
+
 #if TASKQUEUE_STATS
 PartialArrayTaskStats* PartialArraySplitter::stats() {
   return &_stats;
@@ -34,12 +34,39 @@
 
 class outputStream;
 
+// Chooses the chunk size for the next array, between a minimum and a maximum
+// size, from the number of tasks recent chunks pushed per element scanned.
+class PartialArrayChunkSizer {
+  const size_t _min_chunk_size;
+  const size_t _max_chunk_size;
+  // Decaying average of the number of tasks pushed per element scanned.
+  double _push_density;
+
+public:
+  PartialArrayChunkSizer(size_t min_chunk_size, size_t max_chunk_size);
+
+  size_t chunk_size() const;
+
+  // Reports that processing a chunk of the given number of elements changed
+  // the number of queued tasks from queued_before to queued_after.  Other
+  // workers may steal from the queue meanwhile, so the number can go down.
+  void record_chunk(size_t elements, size_t queued_before, size_t queued_after);
+};
+
 // Helper class for splitting the processing of a large objArray into multiple
 // tasks, to permit multiple threads to work on different pieces of the array
 // in parallel.
+//
+// The chunk size is chosen per array, between ParGCArrayScanChunk and
+// ParGCArrayScanChunkMaxScale times that, from the number of tasks recent
+// chunks pushed per element scanned.  Arrays whose elements mostly need no
+// further work, such as large caches of old objects, are scanned in larger
+// chunks to cut down on task overhead; arrays whose elements are mostly copied
+// keep small chunks for load balancing.
 class PartialArraySplitter {
   PartialArrayStateAllocator _allocator;
   PartialArrayTaskStepper _stepper;
+  PartialArrayChunkSizer _chunk_sizer;
   TASKQUEUE_STATS_ONLY(PartialArrayTaskStats _stats;)
 
 public:
@@ -98,6 +125,18 @@ class PartialArraySplitter {
   template<typename Queue>
   Claim claim(PartialArrayState* state, Queue* queue, bool stolen);
 
+  // Reports that processing a chunk of the given number of elements, either
+  // the initial chunk or a claimed one, changed the number of queued tasks
+  // from queued_before to queued_after.
+  void record_chunk(size_t elements, size_t queued_before, size_t queued_after) {
+    _chunk_sizer.record_chunk(elements, queued_before, queued_after);
+  }
+
+  // The number of tasks in queue, including its overflow stack, to report
+  // to record_chunk() from before and after processing a chunk.
+  template<typename Queue>
+  static size_t queued_tasks(Queue* queue);
+
   TASKQUEUE_STATS_ONLY(PartialArrayTaskStats* stats();)
 };
 
@@ -40,13 +40,14 @@ size_t PartialArraySplitter::start(Queue* queue,
                                    objArrayOop source,
                                    objArrayOop destination,
                                    size_t length) {
-  PartialArrayTaskStepper::Step step = _stepper.start(length);
+  const size_t chunk_size = _chunk_sizer.chunk_size();
+  PartialArrayTaskStepper::Step step = _stepper.start(length, chunk_size);
   // Push initial partial scan tasks.
   if (step._ncreate > 0) {
     TASKQUEUE_STATS_ONLY(_stats.inc_split(););
     TASKQUEUE_STATS_ONLY(_stats.inc_pushed(step._ncreate);)
     PartialArrayState* state =
-      _allocator.allocate(source, destination, step._index, length, step._ncreate);
+      _allocator.allocate(source, destination, step._index, length, chunk_size, step._ncreate);
     for (uint i = 0; i < step._ncreate; ++i) {
       queue->push(ScannerTask(state));
     }
@@ -65,6 +66,7 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
 #endif // TASKQUEUE_STATS
 
   // Claim a chunk and get number of additional tasks to enqueue.
+  const size_t chunk_size = state->chunk_size();
   PartialArrayTaskStepper::Step step = _stepper.next(state);
   // Push additional tasks.
   if (step._ncreate > 0) {
@@ -77,7 +79,12 @@ PartialArraySplitter::claim(PartialArrayState* state, Queue* queue, bool stolen)
   }
   // Release state, decrementing refcount, now that we're done with it.
   _allocator.release(state);
-  return Claim{step._index, step._index + _stepper.chunk_size()};
+  return Claim{step._index, step._index + chunk_size};
+}
+
+template<typename Queue>
+size_t PartialArraySplitter::queued_tasks(Queue* queue) {
+  return queue->size() + queue->overflow_stack()->size();
 }
 
 #endif // SHARE_GC_SHARED_PARTIALARRAYSPLITTER_INLINE_HPP
@@ -67,7 +67,11 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
                             size_t page_size, WorkerThreads* pretouch_workers) {
   // Page-align the chunk size, so if start_address is also page-aligned (as
   // is common) then there won't be any pages shared by multiple chunks.
-  size_t chunk_size = align_down_bounded(PretouchTask::chunk_size(), page_size);
+  // With large pages, align to the large page size even if the caller touches
+  // at a smaller granularity, so that workers do not fault in the same large
+  // page concurrently.
+  const size_t alignment = UseLargePages ? MAX2(page_size, os::large_page_size()) : page_size;
+  size_t chunk_size = align_down_bounded(PretouchTask::chunk_size(), alignment);
   PretouchTask task(task_name, start_address, end_address, page_size, chunk_size);
   size_t total_bytes = pointer_delta(end_address, start_address, sizeof(char));
 
@@ -39,7 +39,10 @@
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/nonJavaThread.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -371,11 +374,128 @@ size_t ReferenceProcessor::process_discovered_list_work(DiscoveredList&    refs_
   return iter.removed();
 }
 
+// Hands out the FinalReferences of the keep-alive phase to the workers during
+// multi-threaded processing with ParallelRefProcSplitFinalLists. Workers
+// first claim whole discovered lists. A worker walking a list splits off the
+// second half of the rest of it as soon as another worker runs out of lists,
+// so that a few long lists do not keep the other workers from entering the
+// closure of the reachable set. Workers without a list park on the monitor
+// until a part is split off or the last busy worker is done.
+//
+// Per-list cost estimates from earlier collections would not help here: the
+// lists are rebuilt by discovery in every GC and their lengths are already
+// known, while the cost of a referent's followers only shows once the list is
+// walked.
+class RefProcKeepAliveWorkQueue : public StackObj {
+  // Shortest list part that is split off; also how often a walking worker
+  // checks for waiting ones.
+  static const size_t MinSplitLength = 64;
+
+  DiscoveredList* const _segments;
+  const uint            _capacity;
+  Monitor               _monitor;
+  // The counts are guarded by _monitor; _waiting is also read without it.
+  uint                  _num_segments;
+  uint                  _busy;         // Workers walking a claimed segment.
+  volatile uint         _waiting;      // Workers waiting for a segment.
+
+public:
+  RefProcKeepAliveWorkQueue(uint capacity) :
+    _segments(capacity > 0 ? NEW_C_HEAP_ARRAY(DiscoveredList, capacity, mtGC) : nullptr),
+    _capacity(capacity),
+    _monitor(Mutex::nosafepoint, "RefProcKeepAliveWorkQueue_lock"),
+    _num_segments(0),
+    _busy(0),
+    _waiting(0) { }
+
+  ~RefProcKeepAliveWorkQueue() {
+    FREE_C_HEAP_ARRAY(DiscoveredList, _segments);
+  }
+
+  // Moves refs_list into the queue. Only called before the workers start.
+  void add(DiscoveredList& refs_list) {
+    assert(_num_segments < _capacity, "must be");
+    if (!refs_list.is_empty()) {
+      _segments[_num_segments++] = refs_list;
+      refs_list.clear();
+    }
+  }
+
+  // Claims the next segment, parking until one is split off while other
+  // workers are still walking theirs. Returns false once all references
+  // have been handed out and processed. Every successful claim must be
+  // followed by a call to release().
+  bool claim(DiscoveredList& segment) {
+    MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+    bool waiting = false;
+    while (_num_segments == 0 && _busy > 0) {
+      if (!waiting) {
+        Atomic::inc(&_waiting);
+        waiting = true;
+      }
+      ml.wait();
+    }
+    if (waiting) {
+      Atomic::dec(&_waiting);
+    }
+    if (_num_segments == 0) {
+      return false;
+    }
+    segment = _segments[--_num_segments];
+    _busy++;
+    return true;
+  }
+
+  void release() {
+    MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+    assert(_busy > 0, "must be");
+    if (--_busy == 0 && _waiting > 0) {
+      // Nobody is left to split off more work.
+      ml.notify_all();
+    }
+  }
+
+  // Called by the worker walking refs_list before it processes current, with
+  // processed references of refs_list already done. Splits off half of the
+  // remaining references if any worker is waiting for them.
+  void maybe_split(DiscoveredList& refs_list, oop current, size_t processed) {
+    if ((processed % MinSplitLength) != 0 || Atomic::load(&_waiting) == 0) {
+      return;
+    }
+    size_t const remaining = refs_list.length() - processed;
+    if (remaining < 2 * MinSplitLength) {
+      return;
+    }
+    size_t const kept = remaining / 2;
+    oop last = current;
+    for (size_t i = 1; i < kept; i++) {
+      last = java_lang_ref_Reference::discovered(last);
+    }
+    oop const rest = java_lang_ref_Reference::discovered(last);
+    assert(rest != last, "list shorter than its length");
+
+    MonitorLocker ml(&_monitor, Mutex::_no_safepoint_check_flag);
+    if (_num_segments < _capacity) {
+      // Terminate the kept part with a self-loop; the rest keeps its links.
+      java_lang_ref_Reference::set_discovered_raw(last, last);
+      DiscoveredList& segment = _segments[_num_segments++];
+      segment.set_head(rest);
+      segment.set_length(remaining - kept);
+      refs_list.set_length(processed + kept);
+      ml.notify();
+    }
+  }
+};
+
 size_t ReferenceProcessor::process_final_keep_alive_work(DiscoveredList& refs_list,
                                                          OopClosure*     keep_alive,
-                                                         EnqueueDiscoveredFieldClosure* enqueue) {
+                                                         EnqueueDiscoveredFieldClosure* enqueue,
+                                                         RefProcKeepAliveWorkQueue* work_queue) {
   DiscoveredListIterator iter(refs_list, keep_alive, nullptr, enqueue);
   while (iter.has_next()) {
+    if (work_queue != nullptr) {
+      work_queue->maybe_split(refs_list, iter.obj(), iter.processed());
+    }
     iter.load_ptrs(DEBUG_ONLY(false /* allow_null_referent */));
     // keep the referent and followers around
     iter.make_referent_alive();
@@ -509,11 +629,15 @@ class RefProcSoftWeakFinalPhaseTask: public RefProcTask {
 };
 
 class RefProcKeepAliveFinalPhaseTask: public RefProcTask {
+  RefProcKeepAliveWorkQueue* _work_queue;
+
 public:
   RefProcKeepAliveFinalPhaseTask(ReferenceProcessor& ref_processor,
-                                 ReferenceProcessorPhaseTimes* phase_times)
+                                 ReferenceProcessorPhaseTimes* phase_times,
+                                 RefProcKeepAliveWorkQueue* work_queue)
     : RefProcTask(ref_processor,
-                  phase_times) {}
+                  phase_times),
+      _work_queue(work_queue) {}
 
   void rp_work(uint worker_id,
                BoolObjectClosure* is_alive,
@@ -521,7 +645,15 @@ class RefProcKeepAliveFinalPhaseTask: public RefProcTask {
                EnqueueDiscoveredFieldClosure* enqueue,
                VoidClosure* complete_gc) override {
     RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::KeepAliveFinalRefsSubPhase, _phase_times, tracker_id(worker_id));
-    _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id], keep_alive, enqueue);
+    if (_work_queue == nullptr) {
+      _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id], keep_alive, enqueue);
+    } else {
+      DiscoveredList segment;
+      while (_work_queue->claim(segment)) {
+        _ref_processor.process_final_keep_alive_work(segment, keep_alive, enqueue, _work_queue);
+        _work_queue->release();
+      }
+    }
     // Close the reachable set
     complete_gc->do_void();
   }
@@ -767,13 +899,21 @@ void ReferenceProcessor::process_final_keep_alive(RefProcProxyTask& proxy_task,
 
   RefProcMTDegreeAdjuster a(this, KeepAliveFinalRefsPhase, num_final_refs);
 
-  if (processing_is_mt()) {
+  // Workers may instead claim lists and split them among each other while
+  // processing, so that a list does not need to be walked beforehand.
+  bool const share_lists = processing_is_mt() && ParallelRefProcSplitFinalLists;
+  RefProcKeepAliveWorkQueue work_queue(share_lists ? _max_num_queues + 4 * num_queues() : 0);
+  if (share_lists) {
+    for (uint i = 0; i < _max_num_queues; i++) {
+      work_queue.add(_discoveredFinalRefs[i]);
+    }
+  } else if (processing_is_mt()) {
     RefProcBalanceQueuesTimeTracker tt(KeepAliveFinalRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredFinalRefs);
   }
 
   // Traverse referents of final references and keep them and followers alive.
-  RefProcKeepAliveFinalPhaseTask phase_task(*this, &phase_times);
+  RefProcKeepAliveFinalPhaseTask phase_task(*this, &phase_times, share_lists ? &work_queue : nullptr);
   run_task(phase_task, proxy_task, true);
 
   verify_total_count_zero(_discoveredFinalRefs, "FinalReference");
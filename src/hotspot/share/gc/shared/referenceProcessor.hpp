@@ -35,6 +35,7 @@
 class GCTimer;
 class ReferencePolicy;
 class ReferenceProcessorPhaseTimes;
+class RefProcKeepAliveWorkQueue;
 class RefProcTask;
 class RefProcProxyTask;
 
@@ -281,10 +282,12 @@ class ReferenceProcessor : public ReferenceDiscoverer {
                                       bool               do_enqueue_and_clear);
 
   // Keep alive followers of referents for FinalReferences. Must only be called for
-  // those.
+  // those. If work_queue is given, the rest of refs_list may be split off and
+  // handed to workers waiting on it.
   size_t process_final_keep_alive_work(DiscoveredList& refs_list,
                                        OopClosure* keep_alive,
-                                       EnqueueDiscoveredFieldClosure* enqueue);
+                                       EnqueueDiscoveredFieldClosure* enqueue,
+                                       RefProcKeepAliveWorkQueue* work_queue = nullptr);
 
 
   void setup_policy(bool always_clear) {
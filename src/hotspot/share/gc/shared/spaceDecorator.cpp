@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "utilities/copy.hpp"
 
@@ -31,7 +32,11 @@
 // Simply mangle the MemRegion mr.
 void SpaceMangler::mangle_region(MemRegion mr) {
   assert(ZapUnusedHeapArea, "Mangling should not be in use");
-  Copy::fill_to_words(mr.start(), mr.word_size(), badHeapWord);
+  if (UseNonTemporalGCFill) {
+    Copy::fill_to_words_nontemporal(mr.start(), mr.word_size(), badHeapWord);
+  } else {
+    Copy::fill_to_words(mr.start(), mr.word_size(), badHeapWord);
+  }
 }
 
 #endif // ASSERT
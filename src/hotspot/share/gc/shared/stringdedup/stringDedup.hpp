@@ -41,7 +41,8 @@
 //
 // The second part, processing the deduplication requests, is a concurrent
 // phase.  This phase is executed by the deduplication thread, which takes
-// candidates from the set of requests and tries to deduplicate them.
+// candidates from the set of requests and tries to deduplicate them.  With
+// StringDeduplicationThreads > 1, helper threads share that work.
 //
 // A deduplication table is used to keep track of unique byte arrays used by
 // String objects.  When deduplicating, a lookup is made in this table to
@@ -93,7 +94,7 @@
 // but before weak reference processing, the GC should flush or delete all
 // of its Requests objects.
 //
-// The deduplication thread is a daemon JavaThread.  No thread visitor is
+// The deduplication threads are daemon JavaThreads.  No thread visitor is
 // needed, as it is handled via the normal JavaThread visiting mechanism.
 // Similarly, there is no need for a stop() function.
 //
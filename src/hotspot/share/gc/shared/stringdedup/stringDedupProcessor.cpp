@@ -61,7 +61,22 @@ void StringDedup::Processor::initialize_storage() {
   _storage_for_processing = new StorageUse(_storages[1]);
 }
 
-StringDedup::Processor::Processor() : _thread(nullptr) {}
+StringDedup::Processor::Processor() :
+  _thread(nullptr),
+  _num_helpers(StringDeduplicationThreads - 1),
+  _helpers(nullptr),
+  _par_state(nullptr),
+  _round(0),
+  _helpers_running(0),
+  _helpers_stat()
+{
+  if (_num_helpers > 0) {
+    _helpers = NEW_C_HEAP_ARRAY(JavaThread* volatile, _num_helpers, mtGC);
+    for (uint i = 0; i < _num_helpers; ++i) {
+      _helpers[i] = nullptr;
+    }
+  }
+}
 
 void StringDedup::Processor::initialize() {
   _processor = new Processor();
@@ -103,15 +118,15 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
   return StorageUse::obtain(&_storage_for_requests);
 }
 
-void StringDedup::Processor::yield() const {
-  assert(Thread::current() == _thread, "precondition");
-  ThreadBlockInVM tbivm(_thread);
+void StringDedup::Processor::yield(JavaThread* thread) {
+  assert(Thread::current() == thread, "precondition");
+  ThreadBlockInVM tbivm(thread);
 }
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
   if (Table::cleanup_start_if_needed(grow_only, force)) {
     do {
-      yield();
+      yield(_thread);
     } while (Table::cleanup_step());
     Table::cleanup_end();
   }
@@ -119,6 +134,10 @@ void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
 
 class StringDedup::Processor::ProcessRequest final : public OopClosure {
   OopStorage* _storage;
+  JavaThread* _thread;
+  Stat* _stat;
+  // Only the main thread, processing alone, may grow the table meanwhile.
+  bool _may_grow;
   size_t _release_index;
   oop* _bulk_release[OopStorage::bulk_allocate_limit];
 
@@ -133,8 +152,11 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   }
 
 public:
-  ProcessRequest(OopStorage* storage) :
+  ProcessRequest(OopStorage* storage, JavaThread* thread, Stat* stat, bool may_grow) :
     _storage(storage),
+    _thread(thread),
+    _stat(stat),
+    _may_grow(may_grow),
     _release_index(0),
     _bulk_release()
   {}
@@ -146,20 +168,20 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   virtual void do_oop(narrowOop*) { ShouldNotReachHere(); }
 
   virtual void do_oop(oop* ref) {
-    _processor->yield();
+    yield(_thread);
     oop java_string = NativeAccess<ON_PHANTOM_OOP_REF>::oop_load(ref);
     release_ref(ref);
     // Dedup java_string, after checking for various reasons to skip it.
     if (java_string == nullptr) {
       // String became unreachable before we got a chance to process it.
-      _cur_stat.inc_skipped_dead();
+      _stat->inc_skipped_dead();
     } else if (java_lang_String::value(java_string) == nullptr) {
       // Request during String construction, before its value array has
       // been initialized.
-      _cur_stat.inc_skipped_incomplete();
+      _stat->inc_skipped_incomplete();
     } else {
-      Table::deduplicate(java_string);
-      if (Table::is_grow_needed()) {
+      Table::deduplicate(java_string, _stat);
+      if (_may_grow && Table::is_grow_needed()) {
         _cur_stat.report_process_pause();
         _processor->cleanup_table(true /* grow_only */, false /* force */);
         _cur_stat.report_process_resume();
@@ -168,14 +190,84 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
   }
 };
 
-void StringDedup::Processor::process_requests() const {
+void StringDedup::Processor::process_requests() {
   _cur_stat.report_process_start();
-  OopStorage::ParState<true, false> par_state{_storage_for_processing->storage(), 1};
-  ProcessRequest processor{_storage_for_processing->storage()};
-  par_state.oops_do(&processor);
+  OopStorage* storage = _storage_for_processing->storage();
+  ParState par_state{storage, _num_helpers + 1};
+  start_helpers(&par_state);
+  Stat stat{};
+  {
+    ProcessRequest processor{storage, _thread, &stat, _num_helpers == 0};
+    par_state.oops_do(&processor);
+  }
+  // A table that needs to grow is handled by the cleanup after processing.
+  wait_for_helpers(&stat);
+  _cur_stat.add(&stat);
   _cur_stat.report_process_end();
 }
 
+void StringDedup::Processor::start_helpers(ParState* par_state) {
+  if (_num_helpers == 0) return;
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  _par_state = par_state;
+  _helpers_running = _num_helpers;
+  ++_round;
+  ml.notify_all();
+}
+
+void StringDedup::Processor::wait_for_helpers(Stat* stat) {
+  if (_num_helpers == 0) return;
+  ThreadBlockInVM tbivm(_thread);
+  MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+  while (_helpers_running > 0) {
+    ml.wait();
+  }
+  _par_state = nullptr;
+  stat->add(&_helpers_stat);
+  _helpers_stat = Stat{};
+}
+
+void StringDedup::Processor::run_helper(JavaThread* thread, uint helper_index) {
+  assert(thread == Thread::current(), "precondition");
+  assert(helper_index < _num_helpers, "invalid helper index %u", helper_index);
+  Atomic::release_store(&_helpers[helper_index], thread);
+  log_debug(stringdedup)("Starting string deduplication helper thread %u", helper_index);
+  uint last_round = 0;
+  while (true) {
+    ParState* par_state;
+    {
+      ThreadBlockInVM tbivm(thread);
+      MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+      while (_round == last_round) {
+        ml.wait();
+      }
+      last_round = _round;
+      par_state = _par_state;
+    }
+    Stat stat{};
+    {
+      ProcessRequest processor{_storage_for_processing->storage(), thread, &stat, false /* may_grow */};
+      par_state->oops_do(&processor);
+    }
+    MonitorLocker ml(StringDedup_lock, Mutex::_no_safepoint_check_flag);
+    _helpers_stat.add(&stat);
+    if (--_helpers_running == 0) {
+      ml.notify_all();
+    }
+  }
+}
+
+void StringDedup::Processor::update_cpu_time_counter() const {
+  ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::conc_dedup);
+  tttc.do_thread(_thread);
+  for (uint i = 0; i < _num_helpers; ++i) {
+    JavaThread* helper = Atomic::load_acquire(&_helpers[i]);
+    if (helper != nullptr) {
+      tttc.do_thread(helper);
+    }
+  }
+}
+
 void StringDedup::Processor::run(JavaThread* thread) {
   assert(thread == Thread::current(), "precondition");
   _thread = thread;
@@ -190,8 +282,7 @@ void StringDedup::Processor::run(JavaThread* thread) {
     _cur_stat.report_active_end();
     log_statistics();
     if (UsePerfData && os::is_thread_cpu_time_supported()) {
-      ThreadTotalCPUTimeClosure tttc(CPUTimeGroups::CPUTimeType::conc_dedup);
-      tttc.do_thread(thread);
+      update_cpu_time_counter();
     }
   }
 }
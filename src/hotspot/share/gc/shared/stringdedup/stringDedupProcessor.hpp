@@ -25,12 +25,13 @@
 #ifndef SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
 #define SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
 
+#include "gc/shared/oopStorage.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/stringdedup/stringDedupStat.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/macros.hpp"
 
 class JavaThread;
-class OopStorage;
 
 // This class performs string deduplication.  There is only one instance of
 // this class.  It processes deduplication requests.  It also manages the
@@ -41,18 +42,34 @@ class OopStorage;
 // requests is performed in incremental chunks.  The Table provides
 // incremental operations for resizing and for removing dead entries, so
 // safepoint checks can be performed between steps in those operations.
+//
+// With StringDeduplicationThreads > 1, helper threads join the processing of
+// each batch of requests, claiming blocks of the request storage in parallel.
+// The main thread still does all waiting for requests and all table resizing
+// and cleanup, once the helpers are done with the batch.
 class StringDedup::Processor : public CHeapObj<mtGC> {
   Processor();
   ~Processor() = default;
 
   NONCOPYABLE(Processor);
 
+  using ParState = OopStorage::ParState<true /* concurrent */, false /* is_const */>;
+
   static OopStorage* _storages[2];
   static StorageUse* volatile _storage_for_requests;
   static StorageUse* _storage_for_processing;
 
   JavaThread* _thread;
 
+  // Helper thread state.  The round counter, the number of helpers still
+  // running and their merged statistics are guarded by StringDedup_lock.
+  const uint _num_helpers;
+  JavaThread* volatile* _helpers;
+  ParState* _par_state;
+  uint _round;
+  uint _helpers_running;
+  Stat _helpers_stat;
+
   // Wait until there are requests to be processed.  The storage for requests
   // and storage for processing are swapped; the former requests storage
   // becomes the current processing storage, and vice versa.
@@ -60,11 +77,14 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   void wait_for_requests() const;
 
   // Yield if requested.
-  void yield() const;
+  static void yield(JavaThread* thread);
 
   class ProcessRequest;
-  void process_requests() const;
+  void process_requests();
+  void start_helpers(ParState* par_state);
+  void wait_for_helpers(Stat* stat);
   void cleanup_table(bool grow_only, bool force) const;
+  void update_cpu_time_counter() const;
 
   void log_statistics();
 
@@ -77,6 +97,11 @@ class StringDedup::Processor : public CHeapObj<mtGC> {
   // Use thread as the deduplication thread.
   // precondition: thread == Thread::current()
   void run(JavaThread* thread);
+
+  // Use thread as the helper with the given index, in [0, number of
+  // StringDeduplicationThreads - 1).
+  // precondition: thread == Thread::current()
+  void run_helper(JavaThread* thread, uint helper_index);
 };
 
 #endif // SHARE_GC_SHARED_STRINGDEDUP_STRINGDEDUPPROCESSOR_HPP
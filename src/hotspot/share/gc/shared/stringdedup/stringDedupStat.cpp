@@ -29,6 +29,7 @@
 
 StringDedup::Stat::Stat() :
   _inspected(0),
+  _inspected_bytes(0),
   _known(0),
   _known_shared(0),
   _new(0),
@@ -56,6 +57,7 @@ StringDedup::Stat::Stat() :
 
 void StringDedup::Stat::add(const Stat* const stat) {
   _inspected           += stat->_inspected;
+  _inspected_bytes     += stat->_inspected_bytes;
   _known               += stat->_known;
   _known_shared        += stat->_known_shared;
   _new                 += stat->_new;
@@ -218,7 +220,8 @@ void StringDedup::Stat::log_statistics(bool total) const {
   double replaced_percent            = percent_of(_replaced, _new);
   double deleted_percent             = percent_of(_deleted, _new);
   log_times(total ? "Total" : "Last");
-  log_debug(stringdedup)("    Inspected:    %12zu", _inspected);
+  log_debug(stringdedup)("    Inspected:    %12zu" STRDEDUP_BYTES_FORMAT,
+                         _inspected, STRDEDUP_BYTES_PARAM(_inspected_bytes));
   log_debug(stringdedup)("      Known:      %12zu(%5.1f%%)", _known, known_percent);
   log_debug(stringdedup)("      Shared:     %12zu(%5.1f%%)", _known_shared, known_shared_percent);
   log_debug(stringdedup)("      New:        %12zu(%5.1f%%)" STRDEDUP_BYTES_FORMAT,
@@ -229,4 +232,12 @@ void StringDedup::Stat::log_statistics(bool total) const {
                          _deduped, deduped_percent, STRDEDUP_BYTES_PARAM(_deduped_bytes), deduped_bytes_percent);
   log_debug(stringdedup)("    Skipped: %zu (dead), %zu (incomplete), %zu (shared)",
                          _skipped_dead, _skipped_incomplete, _skipped_shared);
+  double process_seconds = _process_elapsed.seconds();
+  if (process_seconds > 0.0) {
+    // Requests handled per second of processing, including skipped ones.
+    size_t handled = _inspected + _skipped_dead + _skipped_incomplete;
+    log_debug(stringdedup)("    Throughput: %.0f strings/s, " STRDEDUP_BYTES_FORMAT_NS "/s",
+                           handled / process_seconds,
+                           STRDEDUP_BYTES_PARAM((size_t)(_inspected_bytes / process_seconds)));
+  }
 }
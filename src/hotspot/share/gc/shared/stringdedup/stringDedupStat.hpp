@@ -37,6 +37,7 @@ class StringDedup::Stat {
 private:
   // Counters
   size_t _inspected;
+  size_t _inspected_bytes;
   size_t _known;
   size_t _known_shared;
   size_t _new;
@@ -75,9 +76,10 @@ class StringDedup::Stat {
 public:
   Stat();
 
-  // Track number of strings looked up.
-  void inc_inspected() {
+  // Track number of strings looked up and the size of their values.
+  void inc_inspected(size_t bytes) {
     _inspected++;
+    _inspected_bytes += bytes;
   }
 
   // Track number of requests skipped because string died.
@@ -35,6 +35,7 @@
 #include "gc/shared/stringdedup/stringDedupStat.hpp"
 #include "gc/shared/stringdedup/stringDedupTable.hpp"
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "memory/resourceArea.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
@@ -42,7 +43,9 @@
 #include "oops/oopsHierarchy.hpp"
 #include "oops/typeArrayOop.inline.hpp"
 #include "oops/weakHandle.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/growableArray.hpp"
@@ -412,6 +415,42 @@ bool StringDedup::Table::Cleaner::step() {
   return true;
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// StringDedup::Table::StripeLocker
+//
+// Locks the stripe containing a bucket while several threads deduplicate.
+// A stripe is every stripe_count'th bucket, which spreads consecutive hash
+// codes over different locks.  The lock is only held while searching and
+// updating the bucket, never while taking StringDedupIntern_lock.
+
+static const size_t stripe_count = 64;
+
+struct StringDedupStripeLock {
+  volatile int _lock;
+  DEFINE_PAD_MINUS_SIZE(0, DEFAULT_PADDING_SIZE, sizeof(volatile int));
+};
+
+static StringDedupStripeLock _stripe_locks[stripe_count];
+
+class StringDedup::Table::StripeLocker : public StackObj {
+  volatile int* const _lock;
+
+public:
+  explicit StripeLocker(size_t bucket_index) :
+    _lock(Table::_concurrent ? &_stripe_locks[bucket_index % stripe_count]._lock : nullptr)
+  {
+    if (_lock != nullptr) {
+      Thread::SpinAcquire(_lock, "StringDedupTableStripe");
+    }
+  }
+
+  ~StripeLocker() {
+    if (_lock != nullptr) {
+      Thread::SpinRelease(_lock);
+    }
+  }
+};
+
 //////////////////////////////////////////////////////////////////////////////
 // StringDedup::Table
 
@@ -424,6 +463,7 @@ StringDedup::Table::CleanupState* StringDedup::Table::_cleanup_state = nullptr;
 bool StringDedup::Table::_need_bucket_shrinking = false;
 volatile size_t StringDedup::Table::_dead_count = 0;
 volatile StringDedup::Table::DeadState StringDedup::Table::_dead_state = DeadState::good;
+bool StringDedup::Table::_concurrent = false;
 
 void StringDedup::Table::initialize_storage() {
   assert(_table_storage == nullptr, "storage already created");
@@ -436,6 +476,7 @@ void StringDedup::Table::initialize() {
   _number_of_buckets = num_buckets;
   _grow_threshold = Config::grow_threshold(num_buckets);
   _table_storage->register_num_dead_callback(num_dead_callback);
+  _concurrent = StringDeduplicationThreads > 1;
 }
 
 StringDedup::Table::Bucket*
@@ -472,7 +513,7 @@ size_t StringDedup::Table::hash_to_index(uint hash_code) {
 
 void StringDedup::Table::add(TableValue tv, uint hash_code) {
   _buckets[hash_to_index(hash_code)].add(hash_code, tv);
-  ++_number_of_entries;
+  Atomic::inc(&_number_of_entries);
 }
 
 bool StringDedup::Table::is_dead_count_good_acquire() {
@@ -482,7 +523,7 @@ bool StringDedup::Table::is_dead_count_good_acquire() {
 // Should be consistent with cleanup_start_if_needed.
 bool StringDedup::Table::is_grow_needed() {
   return is_dead_count_good_acquire() &&
-         ((_number_of_entries - Atomic::load(&_dead_count)) > _grow_threshold);
+         ((Atomic::load(&_number_of_entries) - Atomic::load(&_dead_count)) > _grow_threshold);
 }
 
 // Should be consistent with cleanup_start_if_needed.
@@ -501,9 +542,9 @@ StringDedup::Table::find(typeArrayOop obj, uint hash_code) {
   return _buckets[hash_to_index(hash_code)].find(obj, hash_code);
 }
 
-void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
+void StringDedup::Table::install(typeArrayOop obj, uint hash_code, Stat* stat) {
   add(TableValue(_table_storage, obj), hash_code);
-  _cur_stat.inc_new(obj->size() * HeapWordSize);
+  stat->inc_new(obj->size() * HeapWordSize);
 }
 
 #if INCLUDE_CDS_JAVA_HEAP
@@ -514,7 +555,7 @@ void StringDedup::Table::install(typeArrayOop obj, uint hash_code) {
 // of the string we're deduplicating.  GC requests can provide us with
 // access to a String that is incompletely constructed; the value could be
 // set before the coder.
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   typeArrayOop value = java_lang_String::value(java_string);
   assert(value != nullptr, "precondition");
   assert(TypeArrayKlass::cast(value->klass())->element_type() == T_BYTE, "precondition");
@@ -534,7 +575,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
     // table key, so not actually a match to value.
     if ((found != nullptr) &&
         !java_lang_String::is_latin1(found) &&
-        try_deduplicate_found_shared(java_string, found)) {
+        try_deduplicate_found_shared(java_string, found, stat)) {
       return true;
     }
     // That didn't work.  Try as compact latin1.
@@ -547,7 +588,7 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   ResourceMark rm(Thread::current());
   jchar* chars = NEW_RESOURCE_ARRAY_RETURN_NULL(jchar, length);
   if (chars == nullptr) {
-    _cur_stat.inc_skipped_shared();
+    stat->inc_skipped_shared();
     return true;
   }
   for (int i = 0; i < length; ++i) {
@@ -556,11 +597,11 @@ bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
   oop found = StringTable::lookup_shared(chars, length);
   if (found == nullptr) return false;
   assert(java_lang_String::is_latin1(found), "invariant");
-  return try_deduplicate_found_shared(java_string, found);
+  return try_deduplicate_found_shared(java_string, found, stat);
 }
 
-bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found) {
-  _cur_stat.inc_known_shared();
+bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat) {
+  stat->inc_known_shared();
   typeArrayOop found_value = java_lang_String::value(found);
   if (found_value == java_lang_String::value(java_string)) {
     // String's value already matches what's in the table.
@@ -571,7 +612,7 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
     // shared string.  But if they have different coders but happen to have
     // the same sequence of bytes in their value arrays, then java_string
     // could have been interned and marked deduplication-forbidden.
-    _cur_stat.inc_deduped(found_value->size() * HeapWordSize);
+    stat->inc_deduped(found_value->size() * HeapWordSize);
     return true;
   } else {
     // Must be a mismatch between java_string and found string encodings,
@@ -585,13 +626,13 @@ bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found
 
 #else // if !INCLUDE_CDS_JAVA_HEAP
 
-bool StringDedup::Table::try_deduplicate_shared(oop java_string) {
+bool StringDedup::Table::try_deduplicate_shared(oop java_string, Stat* stat) {
   ShouldNotReachHere();         // Call is guarded.
   return false;
 }
 
 // Undefined because unreferenced.
-// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found);
+// bool StringDedup::Table::try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
 
 #endif // INCLUDE_CDS_JAVA_HEAP
 
@@ -607,36 +648,44 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
   }
 }
 
-void StringDedup::Table::deduplicate(oop java_string) {
+void StringDedup::Table::deduplicate(oop java_string, Stat* stat) {
   assert(java_lang_String::is_instance(java_string), "precondition");
-  _cur_stat.inc_inspected();
+  typeArrayOop value = java_lang_String::value(java_string);
+  stat->inc_inspected(value->length());
   if ((StringTable::shared_entry_count() > 0) &&
-      try_deduplicate_shared(java_string)) {
+      try_deduplicate_shared(java_string, stat)) {
     return;                     // Done if deduplicated against shared StringTable.
   }
-  typeArrayOop value = java_lang_String::value(java_string);
+  // Hashing, the expensive part for long strings, is done outside the lock.
   uint hash_code = compute_hash(value);
-  TableValue tv = find(value, hash_code);
-  if (tv.is_empty()) {
-    // Not in table.  Create a new table entry.
-    install(value, hash_code);
-  } else {
-    _cur_stat.inc_known();
-    typeArrayOop found = cast_from_oop<typeArrayOop>(tv.resolve());
-    assert(found != nullptr, "invariant");
-    // Deduplicate if value array differs from what's in the table.
-    if (found != value) {
-      if (deduplicate_if_permitted(java_string, found)) {
-        _cur_stat.inc_deduped(found->size() * HeapWordSize);
-      } else {
-        // If string marked deduplication_forbidden then we can't update its
-        // value.  Instead, replace the array in the table with the new one,
-        // as java_string is probably in the StringTable.  That makes it a
-        // good target for future deduplications as it is probably intended
-        // to live for some time.
-        tv.replace(value);
-        _cur_stat.inc_replaced();
-      }
+  size_t index = hash_to_index(hash_code);
+  TableValue tv;
+  typeArrayOop found;
+  {
+    StripeLocker sl(index);
+    tv = find(value, hash_code);
+    if (tv.is_empty()) {
+      // Not in table.  Create a new table entry.
+      install(value, hash_code, stat);
+      return;
+    }
+    found = cast_from_oop<typeArrayOop>(tv.resolve());
+  }
+  stat->inc_known();
+  assert(found != nullptr, "invariant");
+  // Deduplicate if value array differs from what's in the table.
+  if (found != value) {
+    if (deduplicate_if_permitted(java_string, found)) {
+      stat->inc_deduped(found->size() * HeapWordSize);
+    } else {
+      // If string marked deduplication_forbidden then we can't update its
+      // value.  Instead, replace the array in the table with the new one,
+      // as java_string is probably in the StringTable.  That makes it a
+      // good target for future deduplications as it is probably intended
+      // to live for some time.
+      StripeLocker sl(index);
+      tv.replace(value);
+      stat->inc_replaced();
     }
   }
 }
@@ -46,8 +46,12 @@ class OopStorage;
 // controlling the growth or shrinkage of the hashtable.
 //
 // Operations on the table are not thread-safe.  Only the deduplication
-// thread calls most of the operations on the table.  The only exception is
-// the GC dead object count notification and the management of its state.
+// thread calls most of the operations on the table.  The exceptions are
+// the GC dead object count notification and the management of its state,
+// and deduplicate(), which several deduplication threads may call at the
+// same time if StringDeduplicationThreads > 1.  Buckets are then guarded by
+// striped locks.  Resizing and cleanup only happen while no deduplication
+// is in progress, and so never need them.
 //
 // The table supports resizing and removal of entries for byte arrays that
 // have become unreferenced.  These operations are performed by the
@@ -65,6 +69,7 @@ class StringDedup::Table : AllStatic {
   class CleanupState;
   class Resizer;
   class Cleaner;
+  class StripeLocker;
   enum class DeadState;
 
   // Values in the table are weak references to jbyte[] Java objects.  The
@@ -89,15 +94,17 @@ class StringDedup::Table : AllStatic {
   // read by the dedup thread without holding the lock lock.
   static volatile size_t _dead_count;
   static volatile DeadState _dead_state;
+  // True if buckets need locking, because deduplication is concurrent.
+  static bool _concurrent;
 
   static uint compute_hash(typeArrayOop obj);
   static size_t hash_to_index(uint hash_code);
   static void add(TableValue tv, uint hash_code);
   static TableValue find(typeArrayOop obj, uint hash_code);
-  static void install(typeArrayOop obj, uint hash_code);
+  static void install(typeArrayOop obj, uint hash_code, Stat* stat);
   static bool deduplicate_if_permitted(oop java_string, typeArrayOop value);
-  static bool try_deduplicate_shared(oop java_string);
-  static bool try_deduplicate_found_shared(oop java_string, oop found);
+  static bool try_deduplicate_shared(oop java_string, Stat* stat);
+  static bool try_deduplicate_found_shared(oop java_string, oop found, Stat* stat);
   static Bucket* make_buckets(size_t number_of_buckets, size_t reserve = 0);
   static void free_buckets(Bucket* buckets, size_t number_of_buckets);
 
@@ -114,8 +121,9 @@ class StringDedup::Table : AllStatic {
 
   // Deduplicate java_string.  If the table already contains the string's
   // data array, replace the string's data array with the one in the table.
-  // Otherwise, add the string's data array to the table.
-  static void deduplicate(oop java_string);
+  // Otherwise, add the string's data array to the table.  Counters are
+  // updated in stat, which must not be shared with other threads.
+  static void deduplicate(oop java_string, Stat* stat);
 
   // Returns true if table needs to grow.
   static bool is_grow_needed();
@@ -26,24 +26,40 @@
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "gc/shared/stringdedup/stringDedupProcessor.hpp"
 #include "gc/shared/stringdedup/stringDedupThread.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/handles.hpp"
 #include "runtime/os.hpp"
 #include "utilities/exceptions.hpp"
 
-StringDedupThread::StringDedupThread() : JavaThread(thread_entry) {}
+StringDedupThread::StringDedupThread(uint worker_id) :
+  JavaThread(thread_entry),
+  _worker_id(worker_id)
+{}
 
 void StringDedupThread::initialize() {
   EXCEPTION_MARK;
 
-  const char* name = "StringDedupThread";
-  Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
-  StringDedupThread* thread = new StringDedupThread();
-  JavaThread::vm_exit_on_osthread_failure(thread);
-  JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  for (uint i = 0; i < StringDeduplicationThreads; ++i) {
+    char name[64];
+    if (i == 0) {
+      os::snprintf_checked(name, sizeof(name), "StringDedupThread");
+    } else {
+      os::snprintf_checked(name, sizeof(name), "StringDedupThread#%u", i);
+    }
+    Handle thread_oop = JavaThread::create_system_thread_object(name, CHECK);
+    StringDedupThread* thread = new StringDedupThread(i);
+    JavaThread::vm_exit_on_osthread_failure(thread);
+    JavaThread::start_internal_daemon(THREAD, thread, thread_oop, NormPriority);
+  }
 }
 
 void StringDedupThread::thread_entry(JavaThread* thread, TRAPS) {
-  StringDedup::_processor->run(thread);
+  uint worker_id = static_cast<StringDedupThread*>(thread)->_worker_id;
+  if (worker_id == 0) {
+    StringDedup::_processor->run(thread);
+  } else {
+    StringDedup::_processor->run_helper(thread, worker_id - 1);
+  }
 }
 
 bool StringDedupThread::is_hidden_from_external_view() const {
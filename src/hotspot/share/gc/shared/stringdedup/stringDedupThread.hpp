@@ -30,9 +30,10 @@
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
 
-// Thread class for string deduplication.  There is only one instance of this
-// class.  This class provides thread management.  It uses the Processor
-// to perform most of the work.
+// Thread class for string deduplication.  There is one instance of this
+// class per StringDeduplicationThreads; the first is the main deduplication
+// thread, the others are helpers.  This class provides thread management.
+// It uses the Processor to perform most of the work.
 //
 // Unlike most of the classes in the stringdedup implementation, this class is
 // not an inner class of StringDedup.  This is because we need a simple public
@@ -40,7 +41,10 @@
 class StringDedupThread : public JavaThread {
   friend class VMStructs;
 
-  StringDedupThread();
+  // 0 for the main thread, helper index + 1 for helpers.
+  const uint _worker_id;
+
+  StringDedupThread(uint worker_id);
   ~StringDedupThread() = default;
 
   NONCOPYABLE(StringDedupThread);
@@ -47,6 +47,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_batch,      // number of tasks moved in addition by batched steals
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -68,6 +69,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_batch(uint moved) { _stats[steal_batch] += moved; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -369,6 +371,12 @@ class GenericTaskQueue: public TaskQueueSuper<N, MT> {
   // recently pushed).
   PopResult pop_global(E& t);
 
+  // Moves up to max elements from the global end of this queue to the local
+  // end of dest, one pop_global() at a time, stopping at the first that does
+  // not succeed. Must be called by the owner of dest, which must have room
+  // for max more elements. Returns the number of elements moved.
+  uint pop_global_batch(GenericTaskQueue* dest, uint max);
+
   // Delete any resource associated with the queue.
   ~GenericTaskQueue();
 
@@ -469,7 +477,11 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
   // as for the last pop_global() operation.
-  PopResult steal_best_of_2(uint queue_num, E& t);
+  PopResult steal_best_of_2(uint queue_num, E& t, uint& victim);
+
+  // After a successful steal from victim, moves more of its tasks to the
+  // queue of queue_num, see TaskQueueStealBatch.
+  void steal_batch(uint queue_num, uint victim);
 
 public:
   GenericTaskQueueSet(uint n);
@@ -485,6 +497,12 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<MT> {
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
 
+  // Try to steal a task from one of the given queues (all != queue_num), e.g. the
+  // queues of workers running on the same NUMA node. Each candidate is tried
+  // once, starting at a random one. Returns if stealing succeeds, and sets "t"
+  // to the stolen task.
+  bool steal_from(uint queue_num, const uint* candidates, uint num_candidates, E& t);
+
   DEBUG_ONLY(virtual void assert_empty() const;)
 
   virtual uint tasks() const;
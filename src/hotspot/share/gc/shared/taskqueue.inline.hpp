@@ -27,6 +27,7 @@
 
 #include "gc/shared/taskqueue.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
@@ -292,6 +293,19 @@ typename GenericTaskQueue<E, MT, N>::PopResult GenericTaskQueue<E, MT, N>::pop_g
   return resAge == oldAge ? PopResult::Success : PopResult::Contended;
 }
 
+template<class E, MemTag MT, unsigned int N>
+uint GenericTaskQueue<E, MT, N>::pop_global_batch(GenericTaskQueue* dest, uint max) {
+  uint moved = 0;
+  E t;
+  while (moved < max && pop_global(t) == PopResult::Success) {
+    bool pushed = dest->GenericTaskQueue::push(t);
+    assert(pushed, "destination queue must have room");
+    moved++;
+  }
+  TASKQUEUE_STATS_ONLY(dest->stats.record_steal_batch(moved);)
+  return moved;
+}
+
 inline int randomParkAndMiller(int *seed0) {
   const int a =      16807;
   const int m = 2147483647;
@@ -317,7 +331,7 @@ int GenericTaskQueue<E, MT, N>::next_random_queue_id() {
 }
 
 template<class T, MemTag MT>
-typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal_best_of_2(uint queue_num, E& t) {
+typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal_best_of_2(uint queue_num, E& t, uint& victim) {
   T* const local_queue = queue(queue_num);
   if (_n > 2) {
     uint k1 = queue_num;
@@ -353,6 +367,7 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
     }
 
     if (suc == PopResult::Success) {
+      victim = sel_k;
       local_queue->set_last_stolen_queue_id(sel_k);
     } else {
       local_queue->invalidate_last_stolen_queue_id();
@@ -364,6 +379,7 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
     uint k = (queue_num + 1) % 2;
     PopResult res = queue(k)->pop_global(t);
     TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    victim = k;
     return res;
   } else {
     assert(_n == 1, "can't be zero.");
@@ -372,14 +388,34 @@ typename GenericTaskQueueSet<T, MT>::PopResult GenericTaskQueueSet<T, MT>::steal
   }
 }
 
+// Taking more than one task per steal cuts down on steal attempts and
+// termination spins when a few queues hold most of the work, e.g. with deep
+// object graphs. The tasks are taken one pop_global() at a time, since the
+// owner of the victim may pop concurrently, and only half of the remaining
+// tasks are taken so that the victim keeps enough to work on.
+template<class T, MemTag MT>
+void GenericTaskQueueSet<T, MT>::steal_batch(uint queue_num, uint victim) {
+  if (TaskQueueStealBatch == 0) {
+    return;
+  }
+  T* const local_queue = queue(queue_num);
+  const uint room = local_queue->max_elems() - local_queue->size();
+  const uint max = MIN3(queue(victim)->size() / 2, TaskQueueStealBatch, room);
+  if (max > 0) {
+    queue(victim)->pop_global_batch(local_queue, max);
+  }
+}
+
 template<class T, MemTag MT>
 bool GenericTaskQueueSet<T, MT>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
-    PopResult sr = steal_best_of_2(queue_num, t);
+    uint victim = queue_num;
+    PopResult sr = steal_best_of_2(queue_num, t, victim);
     if (sr == PopResult::Success) {
+      steal_batch(queue_num, victim);
       return true;
     } else if (sr == PopResult::Contended) {
       TASKQUEUE_STATS_ONLY(
@@ -394,6 +430,30 @@ bool GenericTaskQueueSet<T, MT>::steal(uint queue_num, E& t) {
   return false;
 }
 
+template<class T, MemTag MT>
+bool GenericTaskQueueSet<T, MT>::steal_from(uint queue_num, const uint* candidates, uint num_candidates, E& t) {
+  if (num_candidates == 0) {
+    return false;
+  }
+  T* const local_queue = queue(queue_num);
+  uint const start = (uint)local_queue->next_random_queue_id() % num_candidates;
+  for (uint i = 0; i < num_candidates; i++) {
+    uint const k = candidates[(start + i) % num_candidates];
+    assert(k != queue_num && k < _n, "invalid candidate queue %u", k);
+    if (queue(k)->size() == 0) {
+      continue;
+    }
+    PopResult res = queue(k)->pop_global(t);
+    TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res == PopResult::Success) {
+      local_queue->set_last_stolen_queue_id(k);
+      steal_batch(queue_num, k);
+      return true;
+    }
+  }
+  return false;
+}
+
 template<class E, MemTag MT, unsigned int N>
 template<class Fn>
 inline void GenericTaskQueue<E, MT, N>::iterate(Fn fn) {
@@ -109,6 +109,14 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+
+    // The thread did not allocate in a tlab since the last GC. Let its share
+    // of eden decay, so that a mostly idle thread does not keep getting the
+    // large tlabs it needed once; the fraction quickly recovers if the
+    // thread starts allocating again.
+    if (TLABShrinkIdleThreads && used > 0.5 * capacity) {
+      _allocation_fraction.sample(0.0f);
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -66,6 +66,11 @@
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, TLABShrinkIdleThreads, false, EXPERIMENTAL,                 \
+          "Count a thread that did not refill its TLAB since the last GC "  \
+          "as having allocated nothing, so that the TLAB size of idle "     \
+          "threads decays over the following GCs")                          \
+                                                                            \
   /* At GC all TLABs are retired, and each thread's active  */              \
   /* TLAB is assumed to be half full on average. The        */              \
   /* remaining space is waste, proportional to TLAB size.   */              \
@@ -31,6 +31,8 @@
 #include "runtime/os.hpp"
 #include "runtime/vm_version.hpp"
 
+#include <math.h>
+
 uint WorkerPolicy::_parallel_worker_threads = 0;
 bool WorkerPolicy::_parallel_worker_threads_initialized = false;
 
@@ -175,3 +177,54 @@ uint WorkerPolicy::calc_active_conc_workers(uintx total_workers,
     return no_of_gc_threads;
   }
 }
+
+const double WorkerEfficiency::TargetEfficiency = 0.75;
+
+WorkerEfficiency::WorkerEfficiency(const char* phase, uint max_workers) :
+  _phase(phase),
+  _max_workers(max_workers),
+  _active_workers(0),
+  _busy_secs(NEW_C_HEAP_ARRAY(double, max_workers, mtGC)),
+  _parallelism(AdaptiveSizePolicyWeight) {}
+
+WorkerEfficiency::~WorkerEfficiency() {
+  FREE_C_HEAP_ARRAY(double, _busy_secs);
+}
+
+uint WorkerEfficiency::calc_active_workers(uint policy_workers) {
+  if (!UseAdaptiveGCWorkersPerPhase || _parallelism.count() == 0) {
+    return policy_workers;
+  }
+
+  // A phase that kept all its workers busy gets more of them next time.
+  uint new_active_workers = (uint)ceil(_parallelism.average() / TargetEfficiency);
+  new_active_workers = clamp(new_active_workers, 1u, _max_workers);
+  if (new_active_workers != policy_workers) {
+    log_debug(gc, task)("%s: using %u instead of %u workers (parallelism: %.2f)",
+                        _phase, new_active_workers, policy_workers, _parallelism.average());
+  }
+  return new_active_workers;
+}
+
+void WorkerEfficiency::start(uint active_workers) {
+  assert(active_workers > 0 && active_workers <= _max_workers, "sanity");
+  _active_workers = active_workers;
+  for (uint i = 0; i < active_workers; i++) {
+    _busy_secs[i] = 0.0;
+  }
+}
+
+void WorkerEfficiency::end(double wall_secs) {
+  if (wall_secs <= 0.0) {
+    return;
+  }
+  double busy_secs = 0.0;
+  for (uint i = 0; i < _active_workers; i++) {
+    busy_secs += _busy_secs[i];
+  }
+  double parallelism = MIN2(busy_secs / wall_secs, (double)_active_workers);
+  _parallelism.sample((float)parallelism);
+  log_debug(gc, task)("%s: efficiency %.2f with %u workers (parallelism: %.2f, average: %.2f)",
+                      _phase, parallelism / _active_workers, _active_workers,
+                      parallelism, _parallelism.average());
+}
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_SHARED_WORKERPOLICY_HPP
 #define SHARE_GC_SHARED_WORKERPOLICY_HPP
 
+#include "gc/shared/gcUtil.hpp"
 #include "memory/allStatic.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -74,4 +75,36 @@ class WorkerPolicy : public AllStatic {
 
 };
 
+// Measures the parallel efficiency of a GC phase, i.e. the time its workers
+// were busy divided by the number of workers times the wall time of the
+// phase. With UseAdaptiveGCWorkersPerPhase, the number of workers for the
+// next run of the phase is derived from the parallelism (busy time divided
+// by wall time) actually achieved, so phases with little work stop paying
+// for waking up and terminating idle workers.
+class WorkerEfficiency : public CHeapObj<mtGC> {
+  // Aim for workers to be busy at least this fraction of the phase.
+  static const double TargetEfficiency;
+
+  const char* const       _phase;
+  const uint              _max_workers;
+  uint                    _active_workers;
+  double* const           _busy_secs;
+  AdaptiveWeightedAverage _parallelism;
+
+public:
+  WorkerEfficiency(const char* phase, uint max_workers);
+  ~WorkerEfficiency();
+
+  // Returns the number of workers to use for the next run of the phase,
+  // given the number chosen by WorkerPolicy.
+  uint calc_active_workers(uint policy_workers);
+
+  void start(uint active_workers);
+  void record_busy_time(uint worker_id, double busy_secs) {
+    assert(worker_id < _active_workers, "sanity");
+    _busy_secs[worker_id] = busy_secs;
+  }
+  void end(double wall_secs);
+};
+
 #endif // SHARE_GC_SHARED_WORKERPOLICY_HPP
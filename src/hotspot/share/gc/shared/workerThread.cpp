@@ -26,6 +26,7 @@
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
+#include "memory/arena.hpp"
 #include "memory/iterator.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/init.hpp"
@@ -190,14 +191,26 @@ void WorkerThreads::run_task(WorkerTask* task, uint num_workers) {
 THREAD_LOCAL uint WorkerThread::_worker_id = UINT_MAX;
 
 WorkerThread::WorkerThread(const char* name_prefix, uint name_suffix, WorkerTaskDispatcher* dispatcher) :
-    _dispatcher(dispatcher) {
+    _dispatcher(dispatcher),
+    _chunk_cache(GCWorkerChunkCacheSize > 0 ? new ChunkCache() : nullptr) {
   set_name("%s#%u", name_prefix, name_suffix);
 }
 
+WorkerThread::~WorkerThread() {
+  // Chunks freed from here on go back to the global pool.
+  ChunkCache* cache = _chunk_cache;
+  _chunk_cache = nullptr;
+  delete cache;
+}
+
 void WorkerThread::run() {
   os::set_priority(this, NearMaxPriority);
 
   while (true) {
     _dispatcher->worker_run_task();
+    if (_chunk_cache != nullptr) {
+      // Going idle until the next task: drop back to the high watermark.
+      _chunk_cache->trim(GCWorkerChunkCacheSize);
+    }
   }
 }
@@ -32,6 +32,7 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+class ChunkCache;
 class ThreadClosure;
 class WorkerTaskDispatcher;
 class WorkerThread;
@@ -131,12 +132,23 @@ class WorkerThread : public NamedThread {
 
   WorkerTaskDispatcher* const _dispatcher;
 
+  // Arena chunks freed by this worker, kept for its next task.
+  ChunkCache* _chunk_cache;
+
   static void set_worker_id(uint worker_id) { _worker_id = worker_id; }
 
 public:
   static uint worker_id() { return _worker_id; }
 
+  static WorkerThread* cast(Thread* t) {
+    assert(t->is_Worker_thread(), "incorrect cast to WorkerThread");
+    return static_cast<WorkerThread*>(t);
+  }
+
   WorkerThread(const char* name_prefix, uint which, WorkerTaskDispatcher* dispatcher);
+  ~WorkerThread();
+
+  ChunkCache* chunk_cache() const { return _chunk_cache; }
 
   bool is_Worker_thread() const override { return true; }
   const char* type_name() const override { return "WorkerThread"; }
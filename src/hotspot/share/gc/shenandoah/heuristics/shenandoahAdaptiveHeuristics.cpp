@@ -60,12 +60,26 @@ const double ShenandoahAdaptiveHeuristics::HIGHEST_EXPECTED_AVAILABLE_AT_END = 0
 const double ShenandoahAdaptiveHeuristics::MINIMUM_CONFIDENCE = 0.319; // 25%
 const double ShenandoahAdaptiveHeuristics::MAXIMUM_CONFIDENCE = 3.291; // 99.9%
 
+// A runway of 1.0 means the headroom would be depleted just as an average
+// cycle completes. The buckets resolve runways from 0 to 4 cycle times.
+const double ShenandoahAdaptiveHeuristics::RUNWAY_BUCKET_WIDTH = 0.25;
+const double ShenandoahAdaptiveHeuristics::RUNWAY_BUCKET_HISTORY = 32.0;
+
 ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics(ShenandoahSpaceInfo* space_info) :
   ShenandoahHeuristics(space_info),
   _margin_of_error_sd(ShenandoahAdaptiveInitialConfidence),
   _spike_threshold_sd(ShenandoahAdaptiveInitialSpikeThreshold),
   _last_trigger(OTHER),
-  _available(Moving_Average_Samples, ShenandoahAdaptiveDecayFactor) { }
+  _available(Moving_Average_Samples, ShenandoahAdaptiveDecayFactor),
+  _last_runway(DBL_MAX),
+  _cycle_runway_bucket(RUNWAY_BUCKETS - 1),
+  _cycle_outcome_pending(false),
+  _degenerated_pause(Moving_Average_Samples, ShenandoahAdaptiveDecayFactor) {
+  for (uint i = 0; i < RUNWAY_BUCKETS; i++) {
+    _runway_cycles[i] = 0.0;
+    _runway_degenerated[i] = 0.0;
+  }
+}
 
 ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {}
 
@@ -130,10 +144,13 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
 void ShenandoahAdaptiveHeuristics::record_cycle_start() {
   ShenandoahHeuristics::record_cycle_start();
   _allocation_rate.allocation_counter_reset();
+  _cycle_runway_bucket = runway_bucket(_last_runway);
+  _cycle_outcome_pending = true;
 }
 
 void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
   ShenandoahHeuristics::record_success_concurrent();
+  record_cycle_outcome(false);
 
   size_t available = _space_info->available();
 
@@ -186,6 +203,7 @@ void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
 
 void ShenandoahAdaptiveHeuristics::record_success_degenerated() {
   ShenandoahHeuristics::record_success_degenerated();
+  record_cycle_outcome(true);
   // Adjust both trigger's parameters in the case of a degenerated GC because
   // either of them should have triggered earlier to avoid this case.
   adjust_margin_of_error(DEGENERATE_PENALTY_SD);
@@ -194,12 +212,53 @@ void ShenandoahAdaptiveHeuristics::record_success_degenerated() {
 
 void ShenandoahAdaptiveHeuristics::record_success_full() {
   ShenandoahHeuristics::record_success_full();
+  record_cycle_outcome(true);
   // Adjust both trigger's parameters in the case of a full GC because
   // either of them should have triggered earlier to avoid this case.
   adjust_margin_of_error(FULL_PENALTY_SD);
   adjust_spike_threshold(FULL_PENALTY_SD);
 }
 
+void ShenandoahAdaptiveHeuristics::record_degenerated_pause(double duration_sec) {
+  _degenerated_pause.add(duration_sec);
+}
+
+uint ShenandoahAdaptiveHeuristics::runway_bucket(double runway) {
+  if (runway >= RUNWAY_BUCKETS * RUNWAY_BUCKET_WIDTH) {
+    return RUNWAY_BUCKETS - 1;
+  }
+  return (uint)(runway / RUNWAY_BUCKET_WIDTH);
+}
+
+void ShenandoahAdaptiveHeuristics::record_cycle_outcome(bool degenerated) {
+  // A degenerated cycle that was not preceded by a concurrent cycle (e.g. an
+  // allocation failure while idle) is attributed to the current runway.
+  uint bucket = _cycle_outcome_pending ? _cycle_runway_bucket : runway_bucket(_last_runway);
+  _cycle_outcome_pending = false;
+
+  if (_runway_cycles[bucket] >= RUNWAY_BUCKET_HISTORY) {
+    _runway_cycles[bucket] /= 2;
+    _runway_degenerated[bucket] /= 2;
+  }
+  _runway_cycles[bucket] += 1.0;
+  if (degenerated) {
+    _runway_degenerated[bucket] += 1.0;
+  }
+}
+
+double ShenandoahAdaptiveHeuristics::degenerate_risk(uint bucket) const {
+  // Starting with less runway is never safer than starting with more, so the
+  // risk for a bucket is at least that observed for any longer runway. This
+  // also gives sparsely populated short-runway buckets a sensible estimate.
+  // The extra cycle in the denominator keeps a single degenerated cycle from
+  // reading as certainty.
+  double risk = 0.0;
+  for (uint i = bucket; i < RUNWAY_BUCKETS; i++) {
+    risk = MAX2(risk, _runway_degenerated[i] / (_runway_cycles[i] + 1.0));
+  }
+  return risk;
+}
+
 static double saturate(double value, double min, double max) {
   return MAX2(MIN2(value, max), min);
 }
@@ -280,6 +339,13 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
 
   log_debug(gc)("average GC time: %.2f ms, allocation rate: %.0f %s/s",
           avg_cycle_time * 1000, byte_size_in_proper_unit(avg_alloc_rate), proper_unit_for_byte_size(avg_alloc_rate));
+
+  // The runway uses the instantaneous rate when it is above average, so that
+  // a rising allocation rate shortens the runway before the average catches up.
+  double depletion_rate = MAX2(avg_alloc_rate, rate);
+  double cycle_depletion = avg_cycle_time * depletion_rate;
+  _last_runway = (cycle_depletion > 0) ? (allocation_headroom / cycle_depletion) : DBL_MAX;
+
   if (avg_cycle_time * avg_alloc_rate > allocation_headroom) {
     log_trigger("Average GC time (%.2f ms) is above the time for average allocation rate (%.0f %sB/s)"
                  " to deplete free headroom (" SIZE_FORMAT "%s) (margin of error = %.2f)",
@@ -307,6 +373,17 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
     return true;
   }
 
+  if (ShenandoahDegeneratedCostBudget > 0 && _degenerated_pause.num() > 0) {
+    double risk = degenerate_risk(runway_bucket(_last_runway));
+    double expected_cost_ms = risk * _degenerated_pause.davg() * 1000;
+    if (expected_cost_ms > ShenandoahDegeneratedCostBudget) {
+      log_trigger("Expected degenerated GC cost (%.2f ms, risk = %.3f) exceeds budget (%zu ms) at runway %.2f",
+                   expected_cost_ms, risk, ShenandoahDegeneratedCostBudget, _last_runway);
+      _last_trigger = DEGENERATE_RISK;
+      return true;
+    }
+  }
+
   return ShenandoahHeuristics::should_start_gc();
 }
 
@@ -318,6 +395,8 @@ void ShenandoahAdaptiveHeuristics::adjust_last_trigger_parameters(double amount)
     case SPIKE:
       adjust_spike_threshold(amount);
       break;
+    case DEGENERATE_RISK:
+      // The risk estimate learns from cycle outcomes on its own.
     case OTHER:
       // nothing to adjust here.
       break;
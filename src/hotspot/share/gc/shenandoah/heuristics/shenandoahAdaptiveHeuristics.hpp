@@ -57,7 +57,9 @@ class ShenandoahAllocationRate : public CHeapObj<mtGC> {
  * time of the application. It attempts to start a cycle with enough time
  * to complete before the available memory is exhausted. It errors on the
  * side of starting cycles early to avoid allocation failures (degenerated
- * cycles).
+ * cycles). With ShenandoahDegeneratedCostBudget, it also learns how likely
+ * a cycle is to degenerate given the runway left when it starts, and starts
+ * a cycle once the expected cost of degenerating exceeds the budget.
  *
  * This heuristic limits the number of regions for evacuation such that the
  * evacuation reserve is respected. This helps it avoid allocation failures
@@ -77,6 +79,7 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
   void record_success_concurrent();
   void record_success_degenerated();
   void record_success_full();
+  void record_degenerated_pause(double duration_sec);
 
   virtual bool should_start_gc();
 
@@ -97,6 +100,16 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
   const static double LOWEST_EXPECTED_AVAILABLE_AT_END;
   const static double HIGHEST_EXPECTED_AVAILABLE_AT_END;
 
+  // Cycle outcomes are bucketed by runway, the ratio of the time it would
+  // take mutators to deplete the allocation headroom to the average cycle
+  // time. Runways beyond the last bucket share the last bucket.
+  const static uint   RUNWAY_BUCKETS = 16;
+  const static double RUNWAY_BUCKET_WIDTH;
+
+  // Once a bucket has seen this many cycles, its history is halved so that
+  // the estimate follows changes in application behavior.
+  const static double RUNWAY_BUCKET_HISTORY;
+
   friend class ShenandoahAllocationRate;
 
   // Used to record the last trigger that signaled to start a GC.
@@ -104,13 +117,17 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
   // error for the average cycle time and allocation rate or the allocation
   // spike detection threshold.
   enum Trigger {
-    SPIKE, RATE, OTHER
+    SPIKE, RATE, DEGENERATE_RISK, OTHER
   };
 
   void adjust_last_trigger_parameters(double amount);
   void adjust_margin_of_error(double amount);
   void adjust_spike_threshold(double amount);
 
+  static uint runway_bucket(double runway);
+  void record_cycle_outcome(bool degenerated);
+  double degenerate_risk(uint bucket) const;
+
 protected:
   ShenandoahAllocationRate _allocation_rate;
 
@@ -140,6 +157,21 @@ class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
   // source of feedback to adjust trigger parameters.
   TruncatedSeq _available;
 
+  // Number of cycles started with a runway in each bucket, and how many of
+  // those ended up degenerated or full. Together they estimate the risk of
+  // a degenerated cycle when starting a cycle at a given runway.
+  double _runway_cycles[RUNWAY_BUCKETS];
+  double _runway_degenerated[RUNWAY_BUCKETS];
+
+  // The runway computed by the most recent call to should_start_gc, and the
+  // bucket it fell into when the current cycle started.
+  double _last_runway;
+  uint   _cycle_runway_bucket;
+  bool   _cycle_outcome_pending;
+
+  // Duration of recent degenerated pauses, in seconds.
+  TruncatedSeq _degenerated_pause;
+
   // A conservative minimum threshold of free space that we'll try to maintain when possible.
   // For example, we might trigger a concurrent gc if we are likely to drop below
   // this threshold, or we might consider this when dynamically resizing generations
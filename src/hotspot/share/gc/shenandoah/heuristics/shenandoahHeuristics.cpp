@@ -258,6 +258,10 @@ void ShenandoahHeuristics::record_success_full() {
   adjust_penalty(Full_Penalty);
 }
 
+void ShenandoahHeuristics::record_degenerated_pause(double duration_sec) {
+  // Do nothing.
+}
+
 void ShenandoahHeuristics::record_allocation_failure_gc() {
   // Do nothing.
 }
@@ -193,6 +193,9 @@ class ShenandoahHeuristics : public CHeapObj<mtGC> {
 
   virtual void record_success_full();
 
+  // Duration of the degenerated pause, including any upgrade to full GC.
+  virtual void record_degenerated_pause(double duration_sec);
+
   virtual void record_allocation_failure_gc();
 
   virtual void record_requested_gc();
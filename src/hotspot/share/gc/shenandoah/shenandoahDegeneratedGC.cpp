@@ -43,6 +43,7 @@
 #include "gc/shenandoah/shenandoahYoungGeneration.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
 #include "gc/shenandoah/shenandoahVMOperations.hpp"
+#include "runtime/os.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/events.hpp"
 
@@ -54,7 +55,9 @@ ShenandoahDegenGC::ShenandoahDegenGC(ShenandoahDegenPoint degen_point, Shenandoa
 }
 
 bool ShenandoahDegenGC::collect(GCCause::Cause cause) {
+  double pause_start = os::elapsedTime();
   vmop_degenerated();
+  _generation->heuristics()->record_degenerated_pause(os::elapsedTime() - pause_start);
   ShenandoahHeap* heap = ShenandoahHeap::heap();
   if (heap->mode()->is_generational()) {
     bool is_bootstrap_gc = heap->old_generation()->is_bootstrapping();
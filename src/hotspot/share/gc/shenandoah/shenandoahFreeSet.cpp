@@ -35,6 +35,7 @@
 #include "gc/shenandoah/shenandoahYoungGeneration.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.inline.hpp"
+#include "gc/shenandoah/shenandoahUtils.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/orderAccess.hpp"
@@ -1331,53 +1332,119 @@ void ShenandoahFreeSet::clear_internal() {
   _partitions.set_bias_from_left_to_right(ShenandoahFreeSetPartitionId::OldCollector, false);
 }
 
-void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regions, size_t &old_cset_regions,
-                                                         size_t &first_old_region, size_t &last_old_region,
-                                                         size_t &old_region_count) {
-  clear_internal();
+class ShenandoahFreeSet::RegionCapacityTally {
+public:
+  size_t young_cset_regions;
+  size_t old_cset_regions;
+  size_t first_old_region;
+  size_t last_old_region;
+  size_t old_region_count;
+
+  size_t mutator_leftmost;
+  size_t mutator_rightmost;
+  size_t mutator_leftmost_empty;
+  size_t mutator_rightmost_empty;
+  size_t mutator_regions;
+  size_t mutator_used;
+
+  size_t old_collector_leftmost;
+  size_t old_collector_rightmost;
+  size_t old_collector_leftmost_empty;
+  size_t old_collector_rightmost_empty;
+  size_t old_collector_regions;
+  size_t old_collector_used;
+
+  RegionCapacityTally() : RegionCapacityTally(0, 0) {}
+
+  RegionCapacityTally(size_t num_regions, size_t max_regions) :
+    young_cset_regions(0), old_cset_regions(0),
+    first_old_region(num_regions), last_old_region(0), old_region_count(0),
+    mutator_leftmost(max_regions), mutator_rightmost(0),
+    mutator_leftmost_empty(max_regions), mutator_rightmost_empty(0),
+    mutator_regions(0), mutator_used(0),
+    old_collector_leftmost(max_regions), old_collector_rightmost(0),
+    old_collector_leftmost_empty(max_regions), old_collector_rightmost_empty(0),
+    old_collector_regions(0), old_collector_used(0) {}
+
+  void merge(const RegionCapacityTally& other) {
+    young_cset_regions += other.young_cset_regions;
+    old_cset_regions += other.old_cset_regions;
+    first_old_region = MIN2(first_old_region, other.first_old_region);
+    last_old_region = MAX2(last_old_region, other.last_old_region);
+    old_region_count += other.old_region_count;
+
+    mutator_leftmost = MIN2(mutator_leftmost, other.mutator_leftmost);
+    mutator_rightmost = MAX2(mutator_rightmost, other.mutator_rightmost);
+    mutator_leftmost_empty = MIN2(mutator_leftmost_empty, other.mutator_leftmost_empty);
+    mutator_rightmost_empty = MAX2(mutator_rightmost_empty, other.mutator_rightmost_empty);
+    mutator_regions += other.mutator_regions;
+    mutator_used += other.mutator_used;
+
+    old_collector_leftmost = MIN2(old_collector_leftmost, other.old_collector_leftmost);
+    old_collector_rightmost = MAX2(old_collector_rightmost, other.old_collector_rightmost);
+    old_collector_leftmost_empty = MIN2(old_collector_leftmost_empty, other.old_collector_leftmost_empty);
+    old_collector_rightmost_empty = MAX2(old_collector_rightmost_empty, other.old_collector_rightmost_empty);
+    old_collector_regions += other.old_collector_regions;
+    old_collector_used += other.old_collector_used;
+  }
+};
 
-  first_old_region = _heap->num_regions();
-  last_old_region = 0;
-  old_region_count = 0;
-  old_cset_regions = 0;
-  young_cset_regions = 0;
+// Scans the regions in parallel, each worker claiming strides of regions and tallying them into its
+// own RegionCapacityTally.  Strides are a multiple of the bits in a bitmap word, so that no two workers
+// ever update the same word of the partition membership bitmaps.
+class ShenandoahFindRegionsWithAllocCapacityTask : public WorkerTask {
+private:
+  ShenandoahFreeSet* const _free_set;
+  ShenandoahFreeSet::RegionCapacityTally* const _tallies;
+  const size_t _num_regions;
+  const size_t _stride;
 
-  size_t region_size_bytes = _partitions.region_size_bytes();
-  size_t max_regions = _partitions.max_regions();
+  shenandoah_padding(0);
+  volatile size_t _index;
+  shenandoah_padding(1);
 
-  size_t mutator_leftmost = max_regions;
-  size_t mutator_rightmost = 0;
-  size_t mutator_leftmost_empty = max_regions;
-  size_t mutator_rightmost_empty = 0;
-  size_t mutator_regions = 0;
-  size_t mutator_used = 0;
+public:
+  ShenandoahFindRegionsWithAllocCapacityTask(ShenandoahFreeSet* free_set, ShenandoahFreeSet::RegionCapacityTally* tallies,
+                                             size_t num_regions, size_t stride) :
+    WorkerTask("Shenandoah Find Regions With Alloc Capacity"),
+    _free_set(free_set), _tallies(tallies), _num_regions(num_regions), _stride(stride), _index(0) {
+    assert(is_aligned(stride, BitsPerWord), "Stride must not split bitmap words");
+  }
+
+  void work(uint worker_id) {
+    ShenandoahParallelWorkerSession worker_session(worker_id);
+    ShenandoahFreeSet::RegionCapacityTally& tally = _tallies[worker_id];
+    while (Atomic::load(&_index) < _num_regions) {
+      const size_t start = Atomic::fetch_then_add(&_index, _stride, memory_order_relaxed);
+      if (start >= _num_regions) {
+        break;
+      }
+      _free_set->tally_regions_with_alloc_capacity(start, MIN2(start + _stride, _num_regions), tally);
+    }
+  }
+};
 
-  size_t old_collector_leftmost = max_regions;
-  size_t old_collector_rightmost = 0;
-  size_t old_collector_leftmost_empty = max_regions;
-  size_t old_collector_rightmost_empty = 0;
-  size_t old_collector_regions = 0;
-  size_t old_collector_used = 0;
+void ShenandoahFreeSet::tally_regions_with_alloc_capacity(size_t start_idx, size_t end_idx, RegionCapacityTally& tally) {
+  size_t region_size_bytes = _partitions.region_size_bytes();
 
-  size_t num_regions = _heap->num_regions();
-  for (size_t idx = 0; idx < num_regions; idx++) {
+  for (size_t idx = start_idx; idx < end_idx; idx++) {
     ShenandoahHeapRegion* region = _heap->get_region(idx);
     if (region->is_trash()) {
       // Trashed regions represent regions that had been in the collection partition but have not yet been "cleaned up".
       // The cset regions are not "trashed" until we have finished update refs.
       if (region->is_old()) {
-        old_cset_regions++;
+        tally.old_cset_regions++;
       } else {
         assert(region->is_young(), "Trashed region should be old or young");
-        young_cset_regions++;
+        tally.young_cset_regions++;
       }
     } else if (region->is_old()) {
       // count both humongous and regular regions, but don't count trash (cset) regions.
-      old_region_count++;
-      if (first_old_region > idx) {
-        first_old_region = idx;
+      tally.old_region_count++;
+      if (tally.first_old_region > idx) {
+        tally.first_old_region = idx;
       }
-      last_old_region = idx;
+      tally.last_old_region = idx;
     }
     if (region->is_alloc_allowed() || region->is_trash()) {
       assert(!region->is_cset(), "Shouldn't be adding cset regions to the free set");
@@ -1388,45 +1455,97 @@ void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regi
         if (region->is_trash() || !region->is_old()) {
           // Both young and old collected regions (trashed) are placed into the Mutator set
           _partitions.raw_assign_membership(idx, ShenandoahFreeSetPartitionId::Mutator);
-          if (idx < mutator_leftmost) {
-            mutator_leftmost = idx;
+          if (idx < tally.mutator_leftmost) {
+            tally.mutator_leftmost = idx;
           }
-          if (idx > mutator_rightmost) {
-            mutator_rightmost = idx;
+          if (idx > tally.mutator_rightmost) {
+            tally.mutator_rightmost = idx;
           }
           if (ac == region_size_bytes) {
-            if (idx < mutator_leftmost_empty) {
-              mutator_leftmost_empty = idx;
+            if (idx < tally.mutator_leftmost_empty) {
+              tally.mutator_leftmost_empty = idx;
             }
-            if (idx > mutator_rightmost_empty) {
-              mutator_rightmost_empty = idx;
+            if (idx > tally.mutator_rightmost_empty) {
+              tally.mutator_rightmost_empty = idx;
             }
           }
-          mutator_regions++;
-          mutator_used += (region_size_bytes - ac);
+          tally.mutator_regions++;
+          tally.mutator_used += (region_size_bytes - ac);
         } else {
           // !region->is_trash() && region is_old()
           _partitions.raw_assign_membership(idx, ShenandoahFreeSetPartitionId::OldCollector);
-          if (idx < old_collector_leftmost) {
-            old_collector_leftmost = idx;
+          if (idx < tally.old_collector_leftmost) {
+            tally.old_collector_leftmost = idx;
           }
-          if (idx > old_collector_rightmost) {
-            old_collector_rightmost = idx;
+          if (idx > tally.old_collector_rightmost) {
+            tally.old_collector_rightmost = idx;
           }
           if (ac == region_size_bytes) {
-            if (idx < old_collector_leftmost_empty) {
-              old_collector_leftmost_empty = idx;
+            if (idx < tally.old_collector_leftmost_empty) {
+              tally.old_collector_leftmost_empty = idx;
             }
-            if (idx > old_collector_rightmost_empty) {
-              old_collector_rightmost_empty = idx;
+            if (idx > tally.old_collector_rightmost_empty) {
+              tally.old_collector_rightmost_empty = idx;
             }
           }
-          old_collector_regions++;
-          old_collector_used += (region_size_bytes - ac);
+          tally.old_collector_regions++;
+          tally.old_collector_used += (region_size_bytes - ac);
         }
       }
     }
   }
+}
+
+void ShenandoahFreeSet::find_regions_with_alloc_capacity(size_t &young_cset_regions, size_t &old_cset_regions,
+                                                         size_t &first_old_region, size_t &last_old_region,
+                                                         size_t &old_region_count) {
+  clear_internal();
+
+  size_t max_regions = _partitions.max_regions();
+  size_t num_regions = _heap->num_regions();
+  RegionCapacityTally tally(num_regions, max_regions);
+
+  // The scan runs with the heap lock held, blocking mutator allocations.  Spread it over the workers
+  // when the heap has enough regions for this to pay off.  The threshold matches the one used by
+  // ShenandoahHeap::parallel_heap_region_iterate().
+  constexpr size_t parallel_threshold = 4096;
+  const uint nworkers = _heap->workers()->active_workers();
+  if (num_regions > parallel_threshold && nworkers > 1) {
+    const size_t stride = align_up((num_regions + nworkers - 1) / nworkers, (size_t) BitsPerWord);
+    RegionCapacityTally* tallies = NEW_C_HEAP_ARRAY(RegionCapacityTally, nworkers, mtGC);
+    for (uint i = 0; i < nworkers; i++) {
+      ::new (&tallies[i]) RegionCapacityTally(num_regions, max_regions);
+    }
+    ShenandoahFindRegionsWithAllocCapacityTask task(this, tallies, num_regions, stride);
+    _heap->workers()->run_task(&task);
+    for (uint i = 0; i < nworkers; i++) {
+      tally.merge(tallies[i]);
+    }
+    FREE_C_HEAP_ARRAY(RegionCapacityTally, tallies);
+  } else {
+    tally_regions_with_alloc_capacity(0, num_regions, tally);
+  }
+
+  young_cset_regions = tally.young_cset_regions;
+  old_cset_regions = tally.old_cset_regions;
+  first_old_region = tally.first_old_region;
+  last_old_region = tally.last_old_region;
+  old_region_count = tally.old_region_count;
+
+  size_t mutator_leftmost = tally.mutator_leftmost;
+  size_t mutator_rightmost = tally.mutator_rightmost;
+  size_t mutator_leftmost_empty = tally.mutator_leftmost_empty;
+  size_t mutator_rightmost_empty = tally.mutator_rightmost_empty;
+  size_t mutator_regions = tally.mutator_regions;
+  size_t mutator_used = tally.mutator_used;
+
+  size_t old_collector_leftmost = tally.old_collector_leftmost;
+  size_t old_collector_rightmost = tally.old_collector_rightmost;
+  size_t old_collector_leftmost_empty = tally.old_collector_leftmost_empty;
+  size_t old_collector_rightmost_empty = tally.old_collector_rightmost_empty;
+  size_t old_collector_regions = tally.old_collector_regions;
+  size_t old_collector_used = tally.old_collector_used;
+
   log_debug(gc, free)("  At end of prep_to_rebuild, mutator_leftmost: " SIZE_FORMAT
                       ", mutator_rightmost: " SIZE_FORMAT
                       ", mutator_leftmost_empty: " SIZE_FORMAT
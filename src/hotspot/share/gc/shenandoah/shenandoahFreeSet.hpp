@@ -299,6 +299,15 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   // from right-to-left or left-to-right, we reset the value of this counter to _InitialAllocBiasWeight.
   ssize_t _alloc_bias_weight;
 
+  // Tallies what find_regions_with_alloc_capacity() learns about a range of regions, so that the regions can be
+  // scanned in parallel and the per-range results merged afterwards.
+  class RegionCapacityTally;
+  friend class ShenandoahFindRegionsWithAllocCapacityTask;
+
+  // Assign the regions in [start_idx, end_idx) that have allocation capacity to the Mutator or OldCollector
+  // partition, and accumulate the bounds and counts find_regions_with_alloc_capacity() needs into tally.
+  void tally_regions_with_alloc_capacity(size_t start_idx, size_t end_idx, RegionCapacityTally& tally);
+
   const ssize_t INITIAL_ALLOC_BIAS_WEIGHT = 256;
 
   // Increases used memory for the partition if the allocation is successful. `in_new_region` will be set
@@ -355,6 +355,36 @@ void ShenandoahHeapRegion::make_uncommitted() {
   }
 }
 
+// Uncommits this and the following count - 1 regions, which must all be empty and committed,
+// using a single uncommit for their heap memory.
+void ShenandoahHeapRegion::make_uncommitted(size_t count) {
+  shenandoah_assert_heaplocked();
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  assert(index() + count <= heap->num_regions(), "Regions should be in heap");
+
+  for (size_t i = index(); i < index() + count; i++) {
+    ShenandoahHeapRegion* r = heap->get_region(i);
+    if (r->state() != _empty_committed) {
+      r->report_illegal_transition("uncommiting");
+    }
+  }
+
+  if (!heap->is_heap_region_special() && !os::uncommit_memory((char *) bottom(), count * RegionSizeBytes)) {
+    report_java_out_of_memory("Unable to uncommit regions");
+  }
+
+  // Bitmap slices are shared by neighboring regions: uncommit them region by region,
+  // the slice goes away with the last committed region in it.
+  for (size_t i = index(); i < index() + count; i++) {
+    ShenandoahHeapRegion* r = heap->get_region(i);
+    if (!heap->uncommit_bitmap_slice(r)) {
+      report_java_out_of_memory("Unable to uncommit bitmaps for region");
+    }
+    r->set_state(_empty_uncommitted);
+  }
+  heap->decrease_committed(count * ShenandoahHeapRegion::region_size_bytes());
+}
+
 void ShenandoahHeapRegion::make_committed_bypass() {
   shenandoah_assert_heaplocked();
   assert (ShenandoahHeap::heap()->is_full_gc_in_progress(), "only for full GC");
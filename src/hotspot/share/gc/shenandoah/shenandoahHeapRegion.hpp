@@ -187,6 +187,7 @@ class ShenandoahHeapRegion {
   void make_trash_immediate();
   void make_empty();
   void make_uncommitted();
+  void make_uncommitted(size_t count);
   void make_committed_bypass();
 
   // Primitive state predicates
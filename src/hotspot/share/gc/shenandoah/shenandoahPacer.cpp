@@ -197,7 +197,11 @@ bool ShenandoahPacer::claim_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
   intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+  return claim_budget<FORCE>(tax);
+}
 
+template<bool FORCE>
+bool ShenandoahPacer::claim_budget(intptr_t tax) {
   intptr_t cur = 0;
   intptr_t new_val = 0;
   do {
@@ -214,6 +218,30 @@ bool ShenandoahPacer::claim_for_alloc(size_t words) {
 template bool ShenandoahPacer::claim_for_alloc<true>(size_t words);
 template bool ShenandoahPacer::claim_for_alloc<false>(size_t words);
 
+bool ShenandoahPacer::claim_for_alloc_from_thread_budget(Thread* thread, size_t words) {
+  assert(ShenandoahPacingThreadBudget > 0, "Only be here when thread budgets are enabled");
+
+  intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+
+  // Budgets left over from a previous epoch were claimed at another
+  // tax rate and against another phase: drop them.
+  intptr_t epoch = Atomic::load(&_epoch);
+  intptr_t budget = ShenandoahThreadLocalData::paced_budget(thread, epoch);
+
+  if (budget < tax) {
+    // Refill the thread budget from the shared budget. Claim no more than
+    // that at once, so that threads allocating in bursts can not starve others.
+    intptr_t refill = tax + (intptr_t)ShenandoahPacingThreadBudget;
+    if (!claim_budget<false>(refill)) {
+      return false;
+    }
+    budget += refill;
+  }
+
+  ShenandoahThreadLocalData::set_paced_budget(thread, epoch, budget - tax);
+  return true;
+}
+
 void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
@@ -233,6 +261,13 @@ intptr_t ShenandoahPacer::epoch() {
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  JavaThread* current = JavaThread::current();
+
+  // Fastest path: allocate against the budget this thread claimed before
+  if (ShenandoahPacingThreadBudget > 0 && claim_for_alloc_from_thread_budget(current, words)) {
+    return;
+  }
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc<false>(words);
   if (claimed) {
@@ -246,7 +281,6 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Thread which is not an active Java thread should also not block.
   // This can happen during VM init when main thread is still not an
   // active Java thread.
-  JavaThread* current = JavaThread::current();
   if (current->is_attaching_via_jni() ||
       !current->is_active_Java_thread()) {
     claim_for_alloc<true>(words);
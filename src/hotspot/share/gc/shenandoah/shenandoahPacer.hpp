@@ -110,6 +110,8 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   template<bool FORCE>
   bool claim_for_alloc(size_t words);
 
+  bool claim_for_alloc_from_thread_budget(Thread* thread, size_t words);
+
   void pace_for_alloc(size_t words);
   void unpace_for_alloc(intptr_t epoch, size_t words);
 
@@ -125,6 +127,9 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   inline void report_progress_internal(size_t words);
 
   inline void add_budget(size_t words);
+
+  template<bool FORCE>
+  bool claim_budget(intptr_t tax);
   void restart_with(size_t non_taxable_bytes, double tax_rate);
 
   size_t update_and_get_progress_history();
@@ -37,6 +37,7 @@
 #include "gc/shenandoah/shenandoahScanRemembered.hpp"
 #include "gc/shenandoah/mode/shenandoahMode.hpp"
 #include "logging/log.hpp"
+#include "runtime/prefetch.inline.hpp"
 
 // Process all objects starting within count clusters beginning with first_cluster and for which the start address is
 // less than end_of_range.  For any non-array object whose header lies on a dirty card, scan the entire object,
@@ -231,9 +232,18 @@ void ShenandoahScanRemembered::process_clusters(size_t first_cluster, size_t cou
           // we need to remember the last object ptr we scanned, in case we need to
           // complete a partial suffix scan after mr, see below
           last_p = p;
+          const size_t size = obj->size();
+          // Dirty cards are typically sparse, and the objects on them are
+          // cold. Start fetching the header of the next object, which we
+          // need to read next, while we scan this one.
+          HeapWord* const next = p + size;
+          if (next < right) {
+            Prefetch::read(next, oopDesc::mark_offset_in_bytes());
+          }
           // apply the closure to the oops in the portion of
           // the object within mr.
-          p += obj->oop_iterate_size(cl, mr);
+          obj->oop_iterate(cl, mr);
+          p = next;
           NOT_PRODUCT(i++);
         } else {
           // forget the last object pointer we remembered
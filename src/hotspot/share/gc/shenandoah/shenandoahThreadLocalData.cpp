@@ -39,6 +39,8 @@ ShenandoahThreadLocalData::ShenandoahThreadLocalData() :
   _gclab(nullptr),
   _gclab_size(0),
   _paced_time(0),
+  _paced_budget(0),
+  _paced_budget_epoch(0),
   _plab(nullptr),
   _plab_desired_size(0),
   _plab_actual_size(0),
@@ -56,6 +56,10 @@ class ShenandoahThreadLocalData {
 
   double _paced_time;
 
+  // Pacing budget claimed from the pacer in advance, and the pacer epoch it was claimed in
+  intptr_t _paced_budget;
+  intptr_t _paced_budget_epoch;
+
   // Thread-local allocation buffer only used in generational mode.
   // Used both by mutator threads and by GC worker threads
   // for evacuations within the old generation and
@@ -235,6 +239,17 @@ class ShenandoahThreadLocalData {
     data(thread)->_paced_time = 0;
   }
 
+  static intptr_t paced_budget(Thread* thread, intptr_t epoch) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    return d->_paced_budget_epoch == epoch ? d->_paced_budget : 0;
+  }
+
+  static void set_paced_budget(Thread* thread, intptr_t epoch, intptr_t budget) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    d->_paced_budget = budget;
+    d->_paced_budget_epoch = epoch;
+  }
+
   // Evacuation OOM handling
   static bool is_oom_during_evac(Thread* thread) {
     return data(thread)->_oom_during_evac;
@@ -48,22 +48,28 @@ void ShenandoahUncommitThread::run_service() {
   // Having an interval 10x lower than the delay would mean we hit the
   // shrinking with lag of less than 1/10-th of true delay.
   // ShenandoahUncommitDelay is in millis, but shrink_period is in seconds.
-  const int64_t poll_interval = int64_t(ShenandoahUncommitDelay) / 10;
+  int64_t poll_interval = int64_t(ShenandoahUncommitDelay) / 10;
+  if (ShenandoahUncommitMemoryPressure > 0) {
+    // Memory pressure builds up much faster than the uncommit delay, check for it at least every second.
+    poll_interval = MIN2<int64_t>(poll_interval, 1000);
+  }
   const double shrink_period = double(ShenandoahUncommitDelay) / 1000;
   bool timed_out = false;
   while (!should_terminate()) {
     bool soft_max_changed = _soft_max_changed.try_unset();
     bool explicit_gc_requested = _explicit_gc_requested.try_unset();
+    bool memory_pressure = timed_out && is_under_memory_pressure();
 
     if (soft_max_changed || explicit_gc_requested || timed_out) {
       double current = os::elapsedTime();
       size_t shrink_until = soft_max_changed ? _heap->soft_max_capacity() : _heap->min_capacity();
-      double shrink_before = (soft_max_changed || explicit_gc_requested) ?
+      double shrink_before = (soft_max_changed || explicit_gc_requested || memory_pressure) ?
               current :
               current - shrink_period;
 
       // Explicit GC tries to uncommit everything down to min capacity.
       // Soft max change tries to uncommit everything down to target capacity.
+      // Memory pressure tries to uncommit everything down to min capacity.
       // Periodic uncommit tries to uncommit suitable regions down to min capacity.
       if (should_uncommit(shrink_before, shrink_until)) {
         uncommit(shrink_before, shrink_until);
@@ -78,6 +84,23 @@ void ShenandoahUncommitThread::run_service() {
   }
 }
 
+bool ShenandoahUncommitThread::is_under_memory_pressure() const {
+  if (ShenandoahUncommitMemoryPressure == 0) {
+    return false;
+  }
+
+  // Both are container aware, so this also covers running close to the container memory limit.
+  const julong physical = os::physical_memory();
+  const julong available = os::available_memory();
+  if (available >= physical / 100 * ShenandoahUncommitMemoryPressure) {
+    return false;
+  }
+
+  log_debug(gc)("Uncommit for memory pressure, available memory: " PROPERFMT " of " PROPERFMT,
+                PROPERFMTARGS((size_t)available), PROPERFMTARGS((size_t)physical));
+  return true;
+}
+
 bool ShenandoahUncommitThread::should_uncommit(double shrink_before, size_t shrink_until) const {
   // Only start uncommit if the GC is idle, is not trying to run and there is work to do.
   return _heap->is_idle() && is_uncommit_allowed() && has_work(shrink_before, shrink_until);
@@ -141,8 +164,14 @@ void ShenandoahUncommitThread::uncommit(double shrink_before, size_t shrink_unti
   // the end of it. It is more efficient to uncommit from the end, so that applications
   // could enjoy the near committed regions. GC allocations are much less frequent,
   // and therefore can accept the committing costs.
+  //
+  // Contiguous runs of regions are uncommitted in batches, with one uncommit call each.
+  // Batches are bounded to keep the time the heap lock is held short.
+  constexpr size_t max_batch = 32;
+  const size_t region_size_bytes = ShenandoahHeapRegion::region_size_bytes();
   size_t count = 0;
-  for (size_t i = _heap->num_regions(); i > 0; i--) {
+  size_t i = _heap->num_regions();
+  while (i > 0) {
     if (!is_uncommit_allowed()) {
       break;
     }
@@ -151,14 +180,30 @@ void ShenandoahUncommitThread::uncommit(double shrink_before, size_t shrink_unti
     if (r->is_empty_committed() && (r->empty_time() < shrink_before)) {
       SuspendibleThreadSetJoiner sts_joiner;
       ShenandoahHeapLocker locker(_heap->lock());
-      if (r->is_empty_committed()) {
-        if (_heap->committed() < shrink_until + ShenandoahHeapRegion::region_size_bytes()) {
+      const size_t committed = _heap->committed();
+      if (committed < shrink_until + region_size_bytes) {
+        break;
+      }
+
+      const size_t limit = MIN3((committed - shrink_until) / region_size_bytes, max_batch, i);
+      size_t batch = 0;
+      while (batch < limit) {
+        ShenandoahHeapRegion* next = _heap->get_region(i - 1 - batch);
+        if (!next->is_empty_committed() || (next->empty_time() >= shrink_before)) {
           break;
         }
+        batch++;
+      }
 
-        r->make_uncommitted();
-        count++;
+      if (batch > 0) {
+        _heap->get_region(i - batch)->make_uncommitted(batch);
+        count += batch;
+        i -= batch;
+      } else {
+        i--;
       }
+    } else {
+      i--;
     }
     SpinPause(); // allow allocators to take the lock
   }
@@ -66,6 +66,9 @@ class ShenandoahUncommitThread : public ConcurrentGCThread {
   // True if the control thread has allowed this thread to uncommit regions
   bool is_uncommit_allowed() const;
 
+  // True if ShenandoahUncommitMemoryPressure is set and the available memory is below it
+  bool is_under_memory_pressure() const;
+
 public:
   explicit ShenandoahUncommitThread(ShenandoahHeap* heap);
 
@@ -251,6 +251,14 @@
           "Larger values give more weight to recent values.")               \
           range(0,1.0)                                                      \
                                                                             \
+  product(uintx, ShenandoahDegeneratedCostBudget, 0, EXPERIMENTAL,          \
+          "Adaptive heuristic starts a cycle when the estimated risk of "   \
+          "a degenerated cycle, multiplied by the average degenerated "     \
+          "pause, exceeds this many milliseconds. The risk is learned "     \
+          "from the outcome of previous cycles, as a function of the "      \
+          "free headroom when the cycle started. Setting this to 0 "        \
+          "disables the feature.")                                          \
+                                                                            \
   product(uintx, ShenandoahGuaranteedGCInterval, 5*60*1000, EXPERIMENTAL,   \
           "Many heuristics would guarantee a concurrent GC cycle at "       \
           "least with this interval. This is useful when large idle "       \
@@ -287,6 +295,13 @@
           "milliseconds. Setting this delay to 0 effectively uncommits "    \
           "regions almost immediately after they become unused.")           \
                                                                             \
+  product(uintx, ShenandoahUncommitMemoryPressure, 0, EXPERIMENTAL,         \
+          "Uncommit empty regions without waiting for the uncommit delay "  \
+          "when the memory available to the process drops below this "      \
+          "percentage of physical memory. Both are container limits when "  \
+          "running in a container. Zero disables this.")                    \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, ShenandoahRegionSampling, false, EXPERIMENTAL,              \
           "Provide heap region sampling data via jvmstat.")                 \
                                                                             \
@@ -440,6 +455,14 @@
           "the beginning of it.")                                           \
           range(1.0, 100.0)                                                 \
                                                                             \
+  product(uintx, ShenandoahPacingThreadBudget, 0, EXPERIMENTAL,             \
+          "Claim pacing budget from the shared budget in batches of this "  \
+          "many words, and pace allocations against the thread-local "      \
+          "remainder. Reduces contention on the shared budget when many "   \
+          "threads allocate. Thread budgets are dropped when pacing is "    \
+          "restarted for the next phase. Zero claims from the shared "      \
+          "budget on every allocation.")                                    \
+                                                                            \
   product(uintx, ShenandoahCriticalFreeThreshold, 1, EXPERIMENTAL,          \
           "How much of the heap needs to be free after recovery cycles, "   \
           "either Degenerated or Full GC to be claimed successful. If this "\
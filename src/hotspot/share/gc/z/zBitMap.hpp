@@ -30,6 +30,12 @@ class ZMovableBitMap : public CHeapBitMap {
 public:
   ZMovableBitMap();
   ZMovableBitMap(ZMovableBitMap&& bitmap);
+
+  // Set the bits at the ascending indices given by index_at(0 .. count - 1).
+  // Bits in the same word are set with a single atomic update, which is
+  // skipped if they are all set already.
+  template <typename Function /* idx_t(size_t i) */>
+  void par_set_bits(size_t count, Function index_at);
 };
 
 class ZBitMap : public CHeapBitMap {
@@ -39,6 +39,32 @@ inline ZMovableBitMap::ZMovableBitMap(ZMovableBitMap&& bitmap)
   bitmap.update(nullptr, 0);
 }
 
+template <typename Function>
+inline void ZMovableBitMap::par_set_bits(size_t count, Function index_at) {
+  size_t i = 0;
+  while (i < count) {
+    const idx_t first = index_at(i);
+    verify_index(first);
+
+    // Collect all bits that fall into the same word
+    const idx_t word = to_words_align_down(first);
+    bm_word_t bits = bit_mask(first);
+    for (i++; i < count; i++) {
+      const idx_t index = index_at(i);
+      assert(index >= first, "Indices must be sorted");
+      if (to_words_align_down(index) != word) {
+        break;
+      }
+      bits |= bit_mask(index);
+    }
+
+    volatile bm_word_t* const addr = map() + word;
+    if ((Atomic::load(addr) & bits) != bits) {
+      Atomic::fetch_then_or(addr, bits, memory_order_relaxed);
+    }
+  }
+}
+
 inline ZBitMap::ZBitMap(idx_t size_in_bits)
   : CHeapBitMap(size_in_bits, mtGC, false /* clear */) {}
 
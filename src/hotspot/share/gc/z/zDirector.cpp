@@ -32,6 +32,7 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
 
 #include <limits>
 
@@ -39,6 +40,13 @@ ZDirector* ZDirector::_director;
 
 constexpr double one_in_1000 = 3.290527;
 
+// Time without allocation stalls after which boosted or surplus GC workers
+// may be given back in the middle of a GC cycle.
+constexpr double stall_free_time_before_shrinking = 1.0; // seconds
+
+// Last time an allocation stall was observed. Only accessed by the director thread.
+static double last_alloc_stall_time = 0.0;
+
 struct ZWorkerResizeStats {
   bool   _is_active;
   double _serial_gc_time_passed;
@@ -50,6 +58,7 @@ struct ZDirectorHeapStats {
   size_t _soft_max_heap_size;
   size_t _used;
   uint   _total_collections;
+  double _time_since_last_alloc_stall;
 };
 
 struct ZDirectorGenerationGeneralStats {
@@ -707,7 +716,8 @@ static ZWorkerCounts select_worker_threads(const ZDirectorStats& stats, uint you
   if (ZHeap::heap()->is_alloc_stalling()) {
     // Boost GC threads when stalling
     return {ZYoungGCThreads, ZOldGCThreads};
-  } else if (active_young_workers + active_old_workers > ConcGCThreads) {
+  } else if (active_young_workers + active_old_workers > ConcGCThreads &&
+             stats._heap._time_since_last_alloc_stall < stall_free_time_before_shrinking) {
     // Threads are boosted, due to stalling recently; retain that boosting
     return {active_young_workers, active_old_workers};
   }
@@ -738,6 +748,63 @@ static ZWorkerCounts select_worker_threads(const ZDirectorStats& stats, uint you
   return {young_workers, old_workers};
 }
 
+static void shrink_gc(const ZDirectorStats& stats) {
+  if (stats._heap._time_since_last_alloc_stall < stall_free_time_before_shrinking) {
+    // Mutators stalled recently, keep the current workers
+    return;
+  }
+
+  const ZWorkerResizeStats young_resize_stats = stats._young_stats._resize;
+  const ZWorkerResizeStats old_resize_stats = stats._old_stats._resize;
+
+  // Take the progress of the running cycle into account, so that workers
+  // are only given back if the remaining work still finishes in time.
+  const ZDriverRequest request = rule_minor_allocation_rate_dynamic(stats,
+                                                                    young_resize_stats._serial_gc_time_passed,
+                                                                    young_resize_stats._parallel_gc_time_passed,
+                                                                    false /* conservative_alloc_rate */,
+                                                                    ZHeap::heap()->max_capacity() /* capacity */);
+  if (request.cause() != GCCause::_no_gc) {
+    // Close to needing more workers, don't shrink
+    return;
+  }
+
+  const uint young_current_workers = young_resize_stats._nworkers_current;
+  const uint old_current_workers = old_resize_stats._nworkers_current;
+  const uint needed_young_workers = request.young_nworkers();
+
+  if (needed_young_workers >= young_current_workers &&
+      young_current_workers + old_current_workers <= ConcGCThreads) {
+    // No surplus
+    return;
+  }
+
+  // Give back half of the surplus at a time, to avoid oscillating
+  // between shrinking and growing within the same cycle.
+  const uint young_surplus = young_current_workers - MIN2(needed_young_workers, young_current_workers);
+  const uint desired_young_workers = young_current_workers - (young_surplus / 2);
+
+  const bool minor_during_old = old_resize_stats._is_active;
+  ZWorkerSelectionType type = minor_during_old ? ZWorkerSelectionType::minor_during_old
+                                               : ZWorkerSelectionType::normal;
+
+  const ZWorkerCounts selection = select_worker_threads(stats, desired_young_workers, type);
+
+  log_debug(gc, director)("Shrink GC Workers, TimeSinceLastStall: %.3fs, NeededYoungWorkers: %u, "
+                          "YoungWorkers: %u -> %u, OldWorkers: %u -> %u",
+                          stats._heap._time_since_last_alloc_stall, needed_young_workers,
+                          young_current_workers, MIN2(selection._young_workers, young_current_workers),
+                          old_current_workers, MIN2(selection._old_workers, old_current_workers));
+
+  // Only ever decrease here, growing is handled by adjust_gc
+  if (old_resize_stats._is_active && selection._old_workers < old_current_workers) {
+    ZGeneration::old()->workers()->request_resize_workers(selection._old_workers);
+  }
+  if (selection._young_workers < young_current_workers) {
+    ZGeneration::young()->workers()->request_resize_workers(selection._young_workers);
+  }
+}
+
 static void adjust_gc(const ZDirectorStats& stats) {
   if (!UseDynamicNumberOfGCThreads) {
     return;
@@ -761,7 +828,8 @@ static void adjust_gc(const ZDirectorStats& stats) {
                                                                               young_resize_stats._serial_gc_time_passed,
                                                                               young_resize_stats._parallel_gc_time_passed);
   if (request.cause() == GCCause::_no_gc) {
-    // No urgency
+    // No urgency, see if workers can be given back
+    shrink_gc(stats);
     return;
   }
 
@@ -876,10 +944,15 @@ bool ZDirector::wait_for_tick() {
 static ZDirectorHeapStats sample_heap_stats() {
   const ZHeap* const heap = ZHeap::heap();
   const ZCollectedHeap* const collected_heap = ZCollectedHeap::heap();
+  const double now = os::elapsedTime();
+  if (heap->is_alloc_stalling()) {
+    last_alloc_stall_time = now;
+  }
   return {
     heap->soft_max_capacity(),
     heap->used(),
-    collected_heap->total_collections()
+    collected_heap->total_collections(),
+    now - last_alloc_stall_time
   };
 }
 
@@ -61,6 +61,7 @@ class ZForwarding {
   ZPage* const           _page;
   ZPageAge               _from_age;
   ZPageAge               _to_age;
+  const uint32_t         _numa_id;
   volatile bool          _claimed;
   mutable ZConditionLock _ref_lock;
   volatile int32_t       _ref_count;
@@ -103,6 +104,7 @@ class ZForwarding {
   ZPageType type() const;
   ZPageAge from_age() const;
   ZPageAge to_age() const;
+  uint32_t numa_id() const;
   zoffset start() const;
   zoffset_end end() const;
   size_t size() const;
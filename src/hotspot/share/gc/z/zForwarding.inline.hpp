@@ -26,6 +26,7 @@
 
 #include "gc/z/zForwarding.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zAttachedArray.inline.hpp"
 #include "gc/z/zForwardingAllocator.inline.hpp"
@@ -63,6 +64,7 @@ inline ZForwarding::ZForwarding(ZPage* page, ZPageAge to_age, size_t nentries)
     _page(page),
     _from_age(page->age()),
     _to_age(to_age),
+    _numa_id(ZLocalityAwareRelocation ? page->numa_id() : 0),
     _claimed(false),
     _ref_lock(),
     _ref_count(1),
@@ -86,6 +88,10 @@ inline ZPageAge ZForwarding::to_age() const {
   return _to_age;
 }
 
+inline uint32_t ZForwarding::numa_id() const {
+  return _numa_id;
+}
+
 inline zoffset ZForwarding::start() const {
   return _virtual.start();
 }
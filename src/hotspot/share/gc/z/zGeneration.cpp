@@ -245,6 +245,7 @@ void ZGeneration::select_relocation_set(ZGenerationId generation, bool promote_a
   // which consumes the tenuring threshold.
   if (generation == ZGenerationId::young) {
     ZGeneration::young()->select_tenuring_threshold(selector.stats(), promote_all);
+    ZGeneration::young()->report_age_census(selector.stats());
   }
 
   // Install relocation set
@@ -967,6 +968,10 @@ ZGenerationTracer* ZGenerationYoung::jfr_tracer() {
   return &_jfr_tracer;
 }
 
+void ZGenerationYoung::report_age_census(const ZRelocationSetSelectorStats& stats) {
+  _jfr_tracer.report_age_census(stats);
+}
+
 ZGenerationOld::ZGenerationOld(ZPageTable* page_table, ZPageAllocator* page_allocator)
   : ZGeneration(ZGenerationId::old, page_table, page_allocator),
     _reference_processor(&_workers),
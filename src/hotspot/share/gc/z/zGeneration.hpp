@@ -256,6 +256,7 @@ class ZGenerationYoung : public ZGeneration {
 
   // Serviceability
   ZGenerationTracer* jfr_tracer();
+  void report_age_census(const ZRelocationSetSelectorStats& stats);
 
   // Verification
   bool is_remembered(volatile zpointer* p) const;
@@ -98,4 +98,8 @@ const size_t      ZMarkProactiveFlushMax        = 10;
 // Try complete mark timeout
 const uint64_t    ZMarkCompleteTimeout          = 200; // us
 
+// Number of independently resized nmethod table shards
+const size_t      ZNMethodTableShardsShift      = 4;
+const size_t      ZNMethodTableShards           = (size_t)1 << ZNMethodTableShardsShift;
+
 #endif // SHARE_GC_Z_ZGLOBALS_HPP
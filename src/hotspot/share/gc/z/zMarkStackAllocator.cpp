@@ -36,7 +36,8 @@ ZMarkStackSpace::ZMarkStackSpace()
   : _expand_lock(),
     _start(0),
     _top(0),
-    _end(0) {
+    _end(0),
+    _high_watermark(0) {
   assert(ZMarkStackSpaceLimit >= ZMarkStackSpaceExpandSize, "ZMarkStackSpaceLimit too small");
 
   // Reserve address space
@@ -92,10 +93,10 @@ size_t ZMarkStackSpace::expand_space() {
   return expand_size;
 }
 
-size_t ZMarkStackSpace::shrink_space() {
-  // Shrink to what is currently used
+size_t ZMarkStackSpace::shrink_space(size_t retain) {
+  // Shrink to what should be retained
   const size_t old_size = size();
-  const size_t new_size = align_up(used(), ZMarkStackSpaceExpandSize);
+  const size_t new_size = align_up(retain, ZMarkStackSpaceExpandSize);
   const size_t shrink_size = old_size - new_size;
 
   if (shrink_size > 0) {
@@ -110,6 +111,23 @@ size_t ZMarkStackSpace::shrink_space() {
   return shrink_size;
 }
 
+void ZMarkStackSpace::disclaim_space(size_t used) {
+  // Keep the retained space committed, so that it can be reused without
+  // expanding, but give back the pages that were not used in this cycle.
+  // They will be faulted in again if a later cycle needs them.
+  const uintptr_t disclaim_start = _start + align_up(used, os::vm_page_size());
+  if (disclaim_start >= _end) {
+    // Nothing to disclaim
+    return;
+  }
+
+  const size_t disclaim_size = _end - disclaim_start;
+
+  log_debug(gc, marking)("Disclaiming mark stack space: " SIZE_FORMAT "M", disclaim_size / M);
+
+  os::disclaim_memory((char*)disclaim_start, disclaim_size);
+}
+
 uintptr_t ZMarkStackSpace::alloc_space(size_t size) {
   uintptr_t top = Atomic::load(&_top);
 
@@ -164,8 +182,19 @@ uintptr_t ZMarkStackSpace::alloc(size_t size) {
 }
 
 void ZMarkStackSpace::free() {
-  _end -= shrink_space();
+  const size_t used = this->used();
+
+  // Let the high watermark decay towards what was used in this cycle, so
+  // that a single cycle with an unusually large mark fan-out doesn't keep
+  // its mark stack space committed forever.
+  _high_watermark = MAX2(used, _high_watermark / 2);
+
+  _end -= shrink_space(_high_watermark);
+  disclaim_space(used);
   _top = _start;
+
+  log_debug(gc, marking)("Mark stack space: " SIZE_FORMAT "M used, " SIZE_FORMAT "M high watermark, " SIZE_FORMAT "M committed",
+                         used / M, _high_watermark / M, size() / M);
 }
 
 ZMarkStackAllocator::ZMarkStackAllocator()
@@ -36,11 +36,13 @@ class ZMarkStackSpace {
   volatile uintptr_t _top;
   volatile uintptr_t _end;
   volatile bool      _recently_expanded;
+  size_t             _high_watermark;
 
   size_t used() const;
 
   size_t expand_space();
-  size_t shrink_space();
+  size_t shrink_space(size_t retain);
+  void disclaim_space(size_t used);
 
   uintptr_t alloc_space(size_t size);
   uintptr_t expand_and_alloc_space(size_t size);
@@ -43,14 +43,21 @@
 #include "utilities/debug.hpp"
 #include "utilities/powerOfTwo.hpp"
 
-ZNMethodTableEntry* ZNMethodTable::_table = nullptr;
-size_t ZNMethodTable::_size = 0;
-size_t ZNMethodTable::_nregistered = 0;
-size_t ZNMethodTable::_nunregistered = 0;
+ZNMethodTableEntry* ZNMethodTable::_tables[ZNMethodTableShards] = {};
+size_t ZNMethodTable::_sizes[ZNMethodTableShards] = {};
+size_t ZNMethodTable::_nregistered[ZNMethodTableShards] = {};
+size_t ZNMethodTable::_nunregistered[ZNMethodTableShards] = {};
 ZNMethodTableIteration ZNMethodTable::_iteration;
 ZNMethodTableIteration ZNMethodTable::_iteration_secondary;
 ZSafeDelete<ZNMethodTableEntry[]> ZNMethodTable::_safe_delete(false /* locked */);
 
+size_t ZNMethodTable::shard_index(const nmethod* nm) {
+  // Use the upper bits of the hash to select the shard, the lower
+  // bits are used to select the first index within the shard
+  const uint32_t hash = ZHash::address_to_uint32((uintptr_t)nm);
+  return hash >> (32 - ZNMethodTableShardsShift);
+}
+
 size_t ZNMethodTable::first_index(const nmethod* nm, size_t size) {
   assert(is_power_of_2(size), "Invalid size");
   const size_t mask = size - 1;
@@ -104,64 +111,72 @@ void ZNMethodTable::unregister_entry(ZNMethodTableEntry* table, size_t size, nme
   }
 }
 
-void ZNMethodTable::rebuild(size_t new_size) {
+void ZNMethodTable::rebuild(size_t shard, size_t new_size) {
   assert(CodeCache_lock->owned_by_self(), "Lock must be held");
 
   assert(is_power_of_2(new_size), "Invalid size");
 
-  log_debug(gc, nmethod)("Rebuilding NMethod Table: "
+  const size_t size = _sizes[shard];
+  const size_t nregistered = _nregistered[shard];
+  const size_t nunregistered = _nunregistered[shard];
+
+  log_debug(gc, nmethod)("Rebuilding NMethod Table Shard " SIZE_FORMAT ": "
                          SIZE_FORMAT "->" SIZE_FORMAT " entries, "
                          SIZE_FORMAT "(%.0f%%->%.0f%%) registered, "
                          SIZE_FORMAT "(%.0f%%->%.0f%%) unregistered",
-                         _size, new_size,
-                         _nregistered, percent_of(_nregistered, _size), percent_of(_nregistered, new_size),
-                         _nunregistered, percent_of(_nunregistered, _size), 0.0);
+                         shard, size, new_size,
+                         nregistered, percent_of(nregistered, size), percent_of(nregistered, new_size),
+                         nunregistered, percent_of(nunregistered, size), 0.0);
 
   // Allocate new table
+  ZNMethodTableEntry* const old_table = _tables[shard];
   ZNMethodTableEntry* const new_table = new ZNMethodTableEntry[new_size];
 
   // Transfer all registered entries
-  for (size_t i = 0; i < _size; i++) {
-    const ZNMethodTableEntry entry = _table[i];
+  for (size_t i = 0; i < size; i++) {
+    const ZNMethodTableEntry entry = old_table[i];
     if (entry.registered()) {
       register_entry(new_table, new_size, entry.method());
     }
   }
 
   // Free old table
-  _safe_delete.schedule_delete(_table);
+  _safe_delete.schedule_delete(old_table);
 
   // Install new table
-  _table = new_table;
-  _size = new_size;
-  _nunregistered = 0;
+  _tables[shard] = new_table;
+  _sizes[shard] = new_size;
+  _nunregistered[shard] = 0;
 }
 
-void ZNMethodTable::rebuild_if_needed() {
+void ZNMethodTable::rebuild_if_needed(size_t shard) {
   // The hash table uses linear probing. To avoid wasting memory while
   // at the same time maintaining good hash collision behavior we want
   // to keep the table occupancy between 30% and 70%. The table always
   // grows/shrinks by doubling/halving its size. Pruning of unregistered
   // entries is done by rebuilding the table with or without resizing it.
-  const size_t min_size = 1024;
-  const size_t shrink_threshold = (size_t)(_size * 0.30);
-  const size_t prune_threshold = (size_t)(_size * 0.65);
-  const size_t grow_threshold = (size_t)(_size * 0.70);
-
-  if (_size == 0) {
+  const size_t min_size = 1024 / ZNMethodTableShards;
+  const size_t size = _sizes[shard];
+  const size_t nregistered = _nregistered[shard];
+  const size_t nunregistered = _nunregistered[shard];
+  const size_t shrink_threshold = (size_t)(size * 0.30);
+  const size_t prune_threshold = (size_t)(size * 0.65);
+  const size_t grow_threshold = (size_t)(size * 0.70);
+
+  if (size == 0) {
     // Initialize table
-    rebuild(min_size);
-  } else if (_nregistered < shrink_threshold && _size > min_size) {
+    rebuild(shard, min_size);
+  } else if (nregistered < shrink_threshold && size > min_size) {
     // Shrink table
-    rebuild(_size / 2);
-  } else if (_nregistered + _nunregistered > grow_threshold) {
+    rebuild(shard, size / 2);
+  } else if (nregistered + nunregistered > grow_threshold) {
     // Prune or grow table
-    if (_nregistered < prune_threshold) {
+    if (nregistered < prune_threshold) {
       // Prune table
-      rebuild(_size);
+      rebuild(shard, size);
     } else {
       // Grow table
-      rebuild(_size * 2);
+      rebuild(shard, size * 2);
     }
   }
 }
@@ -173,25 +188,35 @@ ZNMethodTableIteration* ZNMethodTable::iteration(bool secondary) {
 }
 
 size_t ZNMethodTable::registered_nmethods() {
-  return _nregistered;
+  size_t sum = 0;
+  for (size_t i = 0; i < ZNMethodTableShards; i++) {
+    sum += _nregistered[i];
+  }
+  return sum;
 }
 
 size_t ZNMethodTable::unregistered_nmethods() {
-  return _nunregistered;
+  size_t sum = 0;
+  for (size_t i = 0; i < ZNMethodTableShards; i++) {
+    sum += _nunregistered[i];
+  }
+  return sum;
 }
 
 void ZNMethodTable::register_nmethod(nmethod* nm) {
   assert(CodeCache_lock->owned_by_self(), "Lock must be held");
 
-  // Grow/Shrink/Prune table if needed
-  rebuild_if_needed();
+  const size_t shard = shard_index(nm);
+
+  // Grow/Shrink/Prune shard if needed
+  rebuild_if_needed(shard);
 
   // Insert new entry
-  if (register_entry(_table, _size, nm)) {
+  if (register_entry(_tables[shard], _sizes[shard], nm)) {
     // New entry registered. When register_entry() instead returns
     // false the nmethod was already in the table so we do not want
     // to increase number of registered entries in that case.
-    _nregistered++;
+    _nregistered[shard]++;
   }
 }
 
@@ -206,10 +231,12 @@ void ZNMethodTable::wait_until_iteration_done() {
 void ZNMethodTable::unregister_nmethod(nmethod* nm) {
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
 
+  const size_t shard = shard_index(nm);
+
   // Remove entry
-  unregister_entry(_table, _size, nm);
-  _nunregistered++;
-  _nregistered--;
+  unregister_entry(_tables[shard], _sizes[shard], nm);
+  _nunregistered[shard]++;
+  _nregistered[shard]--;
 }
 
 void ZNMethodTable::nmethods_do_begin(bool secondary) {
@@ -219,7 +246,7 @@ void ZNMethodTable::nmethods_do_begin(bool secondary) {
   _safe_delete.enable_deferred_delete();
 
   // Prepare iteration
-  iteration(secondary)->nmethods_do_begin(_table, _size);
+  iteration(secondary)->nmethods_do_begin(_tables, _sizes);
 }
 
 void ZNMethodTable::nmethods_do_end(bool secondary) {
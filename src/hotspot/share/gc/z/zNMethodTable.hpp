@@ -33,12 +33,17 @@ class NMethodClosure;
 class ZNMethodTableEntry;
 class ZWorkers;
 
+// The table is split into shards, selected by the upper bits of the nmethod
+// hash. Each shard is an open addressing hash table of its own, which is
+// grown, shrunk and pruned independently of the other shards. This keeps
+// the time spent rebuilding a table while holding the CodeCache_lock short,
+// even when a very large number of nmethods are registered.
 class ZNMethodTable : public AllStatic {
 private:
-  static ZNMethodTableEntry*               _table;
-  static size_t                            _size;
-  static size_t                            _nregistered;
-  static size_t                            _nunregistered;
+  static ZNMethodTableEntry*               _tables[ZNMethodTableShards];
+  static size_t                            _sizes[ZNMethodTableShards];
+  static size_t                            _nregistered[ZNMethodTableShards];
+  static size_t                            _nunregistered[ZNMethodTableShards];
   static ZNMethodTableIteration            _iteration;
   static ZNMethodTableIteration            _iteration_secondary;
   static ZSafeDelete<ZNMethodTableEntry[]> _safe_delete;
@@ -46,14 +51,15 @@ class ZNMethodTable : public AllStatic {
   static ZNMethodTableEntry* create(size_t size);
   static void destroy(ZNMethodTableEntry* table);
 
+  static size_t shard_index(const nmethod* nm);
   static size_t first_index(const nmethod* nm, size_t size);
   static size_t next_index(size_t prev_index, size_t size);
 
   static bool register_entry(ZNMethodTableEntry* table, size_t size, nmethod* nm);
   static void unregister_entry(ZNMethodTableEntry* table, size_t size, nmethod* nm);
 
-  static void rebuild(size_t new_size);
-  static void rebuild_if_needed();
+  static void rebuild(size_t shard, size_t new_size);
+  static void rebuild_if_needed(size_t shard);
 
   static ZNMethodTableIteration* iteration(bool secondary);
 
@@ -29,35 +29,53 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+// Each partition is currently sized to span two cache lines. This number
+// is just a guess, but seems to work well.
+static const size_t partition_size = (ZCacheLineSize * 2) / sizeof(ZNMethodTableEntry);
+
 ZNMethodTableIteration::ZNMethodTableIteration()
-  : _table(nullptr),
+  : _tables(),
+    _sizes(),
     _size(0),
+    _in_progress(false),
     _claimed(0) {}
 
 bool ZNMethodTableIteration::in_progress() const {
-  return _table != nullptr;
+  return _in_progress;
 }
 
-void ZNMethodTableIteration::nmethods_do_begin(ZNMethodTableEntry* table, size_t size) {
+void ZNMethodTableIteration::nmethods_do_begin(ZNMethodTableEntry* const* tables, const size_t* sizes) {
   assert(!in_progress(), "precondition");
 
-  _table = table;
-  _size = size;
+  _size = 0;
+  for (size_t i = 0; i < ZNMethodTableShards; i++) {
+    // Shard sizes are multiples of the partition size, so that
+    // partitions never span two shards
+    assert(sizes[i] % partition_size == 0, "Invalid shard size");
+    _tables[i] = tables[i];
+    _sizes[i] = sizes[i];
+    _size += sizes[i];
+  }
+
   _claimed = 0;
+  _in_progress = true;
 }
 
 void ZNMethodTableIteration::nmethods_do_end() {
   assert(_claimed >= _size, "Failed to claim all table entries");
 
   // Finish iteration
-  _table = nullptr;
+  _in_progress = false;
 }
 
 void ZNMethodTableIteration::nmethods_do(NMethodClosure* cl) {
+  size_t shard = 0;
+  size_t shard_start = 0;
+
   for (;;) {
-    // Claim table partition. Each partition is currently sized to span
-    // two cache lines. This number is just a guess, but seems to work well.
-    const size_t partition_size = (ZCacheLineSize * 2) / sizeof(ZNMethodTableEntry);
+    // Claim partition. The shards are claimed as one contiguous range,
+    // so workers that finish early continue with partitions of the
+    // following shards.
     const size_t partition_start = MIN2(Atomic::fetch_then_add(&_claimed, partition_size), _size);
     const size_t partition_end = MIN2(partition_start + partition_size, _size);
     if (partition_start == partition_end) {
@@ -65,9 +83,16 @@ void ZNMethodTableIteration::nmethods_do(NMethodClosure* cl) {
       break;
     }
 
+    // Find shard. Claimed partitions are increasing, so we never need to look back.
+    while (partition_start >= shard_start + _sizes[shard]) {
+      shard_start += _sizes[shard];
+      shard++;
+    }
+
     // Process table partition
+    const ZNMethodTableEntry* const table = _tables[shard];
     for (size_t i = partition_start; i < partition_end; i++) {
-      const ZNMethodTableEntry entry = _table[i];
+      const ZNMethodTableEntry entry = table[i - shard_start];
       if (entry.registered()) {
         cl->do_nmethod(entry.method());
       }
@@ -31,8 +31,10 @@ class ZNMethodTableEntry;
 
 class ZNMethodTableIteration {
 private:
-  ZNMethodTableEntry*            _table;
+  ZNMethodTableEntry*            _tables[ZNMethodTableShards];
+  size_t                         _sizes[ZNMethodTableShards];
   size_t                         _size;
+  bool                           _in_progress;
   ZCACHE_ALIGNED volatile size_t _claimed;
 
 public:
@@ -40,7 +42,7 @@ class ZNMethodTableIteration {
 
   bool in_progress() const;
 
-  void nmethods_do_begin(ZNMethodTableEntry* table, size_t size);
+  void nmethods_do_begin(ZNMethodTableEntry* const* tables, const size_t* sizes);
   void nmethods_do_end();
   void nmethods_do(NMethodClosure* cl);
 };
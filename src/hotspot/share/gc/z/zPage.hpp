@@ -108,6 +108,7 @@ class ZPage : public CHeapObj<mtGC> {
   uint32_t seqnum() const;
   bool is_allocating() const;
   bool is_relocatable() const;
+  bool is_allocated_in_previous_cycle() const;
 
   uint64_t last_used() const;
   void set_last_used();
@@ -150,6 +151,10 @@ class ZPage : public CHeapObj<mtGC> {
 
   void remember(volatile zpointer* p);
 
+  // Remember the fields at the ascending addresses given by field_at(0 .. count - 1)
+  template <typename Function /* volatile zpointer*(size_t i) */>
+  void remember(size_t count, Function field_at);
+
   // In-place relocation support
   void clear_remset_bit_non_par_current(uintptr_t l_offset);
   void clear_remset_range_non_par_current(uintptr_t l_offset, size_t size);
@@ -202,6 +202,10 @@ inline bool ZPage::is_relocatable() const {
   return _seqnum < generation()->seqnum();
 }
 
+inline bool ZPage::is_allocated_in_previous_cycle() const {
+  return _seqnum + 1 == generation()->seqnum();
+}
+
 inline uint64_t ZPage::last_used() const {
   return _last_used;
 }
@@ -361,6 +365,14 @@ inline void ZPage::remember(volatile zpointer* p) {
   _remembered_set.set_current(l_offset);
 }
 
+template <typename Function>
+inline void ZPage::remember(size_t count, Function field_at) {
+  _remembered_set.set_current(count, [&](size_t i) {
+    const zaddress addr = to_zaddress((uintptr_t)field_at(i));
+    return local_offset(addr);
+  });
+}
+
 inline void ZPage::clear_remset_bit_non_par_current(uintptr_t l_offset) {
   _remembered_set.unset_non_par_current(l_offset);
 }
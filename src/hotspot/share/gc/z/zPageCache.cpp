@@ -237,12 +237,7 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
   }
 }
 
-void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
-  // Prefer flushing large, then medium and last small pages
-  flush_list(cl, &_large, to);
-  flush_list(cl, &_medium, to);
-  flush_per_numa_lists(cl, &_small, to);
-
+void ZPageCache::flush_overflushed(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   if (cl->_flushed > cl->_requested) {
     // Overflushed, re-insert part of last page into the cache
     const size_t overflushed = cl->_flushed - cl->_requested;
@@ -252,6 +247,47 @@ void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
   }
 }
 
+void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
+  // Prefer flushing large, then medium and last small pages
+  flush_list(cl, &_large, to);
+  flush_list(cl, &_medium, to);
+  flush_per_numa_lists(cl, &_small, to);
+
+  flush_overflushed(cl, to);
+}
+
+ZList<ZPage>* ZPageCache::coldest_list() {
+  // Pages are inserted first when freed, so the last page of each list is
+  // the least recently used one. Among equally cold pages, prefer large,
+  // then medium and last small pages.
+  ZList<ZPage>* coldest = nullptr;
+  uint64_t coldest_last_used = UINT64_MAX;
+
+  auto consider = [&](ZList<ZPage>* list) {
+    const ZPage* const page = list->last();
+    if (page != nullptr && page->last_used() < coldest_last_used) {
+      coldest = list;
+      coldest_last_used = page->last_used();
+    }
+  };
+
+  consider(&_large);
+  consider(&_medium);
+  for (uint32_t numa_id = 0; numa_id < ZNUMA::count(); numa_id++) {
+    consider(_small.addr(numa_id));
+  }
+
+  return coldest;
+}
+
+void ZPageCache::flush_coldest(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
+  // Flush the least recently used pages first, regardless of their type,
+  // so that recently used pages of all sizes stay mapped
+  for (ZList<ZPage>* list; (list = coldest_list()) != nullptr && flush_list_inner(cl, list, to);) {}
+
+  flush_overflushed(cl, to);
+}
+
 class ZPageCacheFlushForAllocationClosure : public ZPageCacheFlushClosure {
 public:
   ZPageCacheFlushForAllocationClosure(size_t requested)
@@ -323,7 +359,7 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
   }
 
   ZPageCacheFlushForUncommitClosure cl(requested, now, timeout);
-  flush(&cl, to);
+  flush_coldest(&cl, to);
 
   return cl._flushed;
 }
@@ -49,8 +49,12 @@ class ZPageCache {
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
+  void flush_overflushed(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
   void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
 
+  ZList<ZPage>* coldest_list();
+  void flush_coldest(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
+
 public:
   ZPageCache();
 
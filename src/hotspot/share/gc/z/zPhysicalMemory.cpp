@@ -385,3 +385,7 @@ void ZPhysicalMemoryManager::unmap(zoffset offset, size_t size) const {
 
   _backing.unmap(addr, size);
 }
+
+void ZPhysicalMemoryManager::threads_do(ThreadClosure* tc) const {
+  _backing.threads_do(tc);
+}
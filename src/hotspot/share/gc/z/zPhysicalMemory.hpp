@@ -30,6 +30,8 @@
 #include "memory/allocation.hpp"
 #include OS_HEADER(gc/z/zPhysicalMemoryBacking)
 
+class ThreadClosure;
+
 class ZPhysicalMemorySegment : public CHeapObj<mtGC> {
 private:
   zoffset     _start;
@@ -100,6 +102,8 @@ class ZPhysicalMemoryManager {
 
   void map(zoffset offset, const ZPhysicalMemory& pmem) const;
   void unmap(zoffset offset, size_t size) const;
+
+  void threads_do(ThreadClosure* tc) const;
 };
 
 #endif // SHARE_GC_Z_ZPHYSICALMEMORY_HPP
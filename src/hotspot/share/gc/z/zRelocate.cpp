@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -129,6 +130,19 @@ void ZRelocateQueue::leave() {
   }
 }
 
+void ZRelocateQueue::leave_all() {
+  ZLocker<ZConditionLock> locker(&_lock);
+
+  assert(_nsynchronized == 0, "Invalid state");
+
+  log_debug(gc, reloc)("Leaving all workers: %u", _nworkers);
+
+  _nworkers = 0;
+
+  // Wake up anyone waiting for the workers to synchronize
+  _lock.notify_all();
+}
+
 void ZRelocateQueue::add_and_wait(ZForwarding* forwarding) {
   ZStatTimer timer(ZCriticalPhaseRelocationStall);
   ZLocker<ZConditionLock> locker(&_lock);
@@ -1047,16 +1061,18 @@ class ZRelocateStoreBufferInstallBasePointersTask : public ZTask {
 
 class ZRelocateTask : public ZRestartableTask {
 private:
-  ZRelocationSetParallelIterator _iter;
-  ZGeneration* const             _generation;
-  ZRelocateQueue* const          _queue;
-  ZRelocateSmallAllocator        _small_allocator;
-  ZRelocateMediumAllocator       _medium_allocator;
+  ZRelocationSetParallelIterator  _iter;
+  ZRelocationSetNUMALocalIterator _numa_local_iter;
+  ZGeneration* const              _generation;
+  ZRelocateQueue* const           _queue;
+  ZRelocateSmallAllocator         _small_allocator;
+  ZRelocateMediumAllocator        _medium_allocator;
 
 public:
   ZRelocateTask(ZRelocationSet* relocation_set, ZRelocateQueue* queue)
     : ZRestartableTask("ZRelocateTask"),
       _iter(relocation_set),
+      _numa_local_iter(relocation_set),
       _generation(relocation_set->generation()),
       _queue(queue),
       _small_allocator(_generation),
@@ -1097,10 +1113,13 @@ class ZRelocateTask : public ZRestartableTask {
       }
     };
 
+    const uint32_t numa_id = ZNUMA::id();
+
     const auto do_forwarding_one_from_iter = [&]() {
       ZForwarding* forwarding;
 
-      if (_iter.next(&forwarding)) {
+      // Prefer pages on our own NUMA node, then help out with the rest
+      if (_numa_local_iter.next(numa_id, &forwarding) || _iter.next(&forwarding)) {
         claim_and_do_forwarding(forwarding);
         return true;
       }
@@ -1202,12 +1221,19 @@ void ZRelocate::relocate(ZRelocationSet* relocation_set) {
     workers()->run(&buffer_task);
   }
 
-  {
+  if (relocation_set->is_empty()) {
+    // Nothing was selected for relocation, typically because all garbage
+    // was found on empty pages, which have already been freed. Don't wake
+    // up the workers just to find that there is nothing to do.
+    _generation->stat_relocation()->at_relocate_end(0 /* small_in_place_count */, 0 /* medium_in_place_count */);
+    _queue.leave_all();
+    _queue.deactivate();
+  } else {
     ZRelocateTask relocate_task(relocation_set, &_queue);
     workers()->run(&relocate_task);
   }
 
-  if (relocation_set->generation()->is_young()) {
+  if (relocation_set->generation()->is_young() && relocation_set->flip_promoted_pages()->is_nonempty()) {
     ZRelocateAddRemsetForFlipPromoted task(relocation_set->flip_promoted_pages());
     workers()->run(&task);
   }
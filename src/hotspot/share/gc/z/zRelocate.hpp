@@ -61,6 +61,7 @@ class ZRelocateQueue {
   void join(uint nworkers);
   void resize_workers(uint nworkers);
   void leave();
+  void leave_all();
 
   void add_and_wait(ZForwarding* forwarding);
 
@@ -27,6 +27,7 @@
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zForwardingAllocator.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAllocator.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -154,6 +155,10 @@ ZGeneration* ZRelocationSet::generation() const {
   return _generation;
 }
 
+bool ZRelocationSet::is_empty() const {
+  return _nforwardings == 0;
+}
+
 ZArray<ZPage*>* ZRelocationSet::flip_promoted_pages() {
   return &_flip_promoted_pages;
 }
@@ -192,6 +197,46 @@ void ZRelocationSet::reset(ZPageAllocator* page_allocator) {
   destroy_and_clear(page_allocator, &_flip_promoted_pages);
 }
 
+ZRelocationSetNUMALocalIterator::ZRelocationSetNUMALocalIterator(ZRelocationSet* relocation_set)
+  : _forwardings(relocation_set->_forwardings),
+    _nforwardings(relocation_set->_nforwardings),
+    _next(nullptr) {
+  if (ZLocalityAwareRelocation && ZNUMA::is_enabled()) {
+    // Keep the cursors of different nodes on separate cache lines
+    const size_t length = ZNUMA::count() * NextStride;
+    _next = NEW_C_HEAP_ARRAY(volatile size_t, length, mtGC);
+    for (size_t i = 0; i < length; i++) {
+      _next[i] = 0;
+    }
+  }
+}
+
+ZRelocationSetNUMALocalIterator::~ZRelocationSetNUMALocalIterator() {
+  FREE_C_HEAP_ARRAY(volatile size_t, _next);
+}
+
+bool ZRelocationSetNUMALocalIterator::next(uint32_t numa_id, ZForwarding** forwarding) {
+  if (_next == nullptr) {
+    // Disabled
+    return false;
+  }
+
+  volatile size_t* const next = _next + (numa_id * NextStride);
+
+  for (;;) {
+    const size_t index = Atomic::fetch_then_add(next, (size_t)1, memory_order_relaxed);
+    if (index >= _nforwardings) {
+      return false;
+    }
+
+    ZForwarding* const candidate = _forwardings[index];
+    if (candidate->numa_id() == numa_id) {
+      *forwarding = candidate;
+      return true;
+    }
+  }
+}
+
 void ZRelocationSet::register_flip_promoted(const ZArray<ZPage*>& pages) {
   ZLocker<ZLock> locker(&_promotion_lock);
   for (ZPage* const page : pages) {
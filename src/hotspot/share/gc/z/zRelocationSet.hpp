@@ -26,6 +26,7 @@
 
 #include "gc/z/zArray.hpp"
 #include "gc/z/zForwardingAllocator.hpp"
+#include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.hpp"
 
 class ZForwarding;
@@ -37,6 +38,7 @@ class ZWorkers;
 
 class ZRelocationSet {
   template <bool> friend class ZRelocationSetIteratorImpl;
+  friend class ZRelocationSetNUMALocalIterator;
 
 private:
   ZGeneration*         _generation;
@@ -55,6 +57,7 @@ class ZRelocationSet {
   void install(const ZRelocationSetSelector* selector);
   void reset(ZPageAllocator* page_allocator);
   ZGeneration* generation() const;
+  bool is_empty() const;
   ZArray<ZPage*>* flip_promoted_pages();
 
   void register_flip_promoted(const ZArray<ZPage*>& pages);
@@ -70,4 +73,22 @@ class ZRelocationSetIteratorImpl : public ZArrayIteratorImpl<ZForwarding*, Paral
 using ZRelocationSetIterator = ZRelocationSetIteratorImpl<false /* Parallel */>;
 using ZRelocationSetParallelIterator = ZRelocationSetIteratorImpl<true /* Parallel */>;
 
+// Parallel iterator that only returns forwardings of pages on a given NUMA
+// node. Each node has its own cursor, so every forwarding is returned at most
+// once per node. Callers claim the forwardings to avoid relocating a page twice.
+class ZRelocationSetNUMALocalIterator : public StackObj {
+private:
+  ZForwarding** const _forwardings;
+  const size_t        _nforwardings;
+  volatile size_t*    _next;
+
+  static const size_t NextStride = ZCacheLineSize / sizeof(size_t);
+
+public:
+  ZRelocationSetNUMALocalIterator(ZRelocationSet* relocation_set);
+  ~ZRelocationSetNUMALocalIterator();
+
+  bool next(uint32_t numa_id, ZForwarding** forwarding);
+};
+
 #endif // SHARE_GC_Z_ZRELOCATIONSET_HPP
@@ -91,6 +91,7 @@ class ZRelocationSetSelectorGroup {
 
   bool is_disabled();
   bool is_selectable();
+  bool is_growing_old_page(const ZPage* page, size_t garbage) const;
   void semi_sort();
   void select_inner();
 
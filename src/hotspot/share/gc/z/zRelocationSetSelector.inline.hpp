@@ -26,6 +26,7 @@
 
 #include "gc/z/zRelocationSetSelector.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zArray.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 
@@ -69,13 +70,24 @@ inline const ZRelocationSetSelectorGroupStats& ZRelocationSetSelectorStats::larg
   return _large[static_cast<uint>(age)];
 }
 
+inline bool ZRelocationSetSelectorGroup::is_growing_old_page(const ZPage* page, size_t garbage) const {
+  // Old pages allocated after the previous old collection started have been
+  // receiving promoted objects up until this collection started. When such
+  // a page is almost full, relocating it mostly copies objects that were
+  // just promoted and are likely to stay live, so leave it for a later cycle.
+  return ZLocalityAwareRelocation &&
+         page->is_old() &&
+         page->is_allocated_in_previous_cycle() &&
+         garbage <= _page_fragmentation_limit * 2;
+}
+
 inline void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
   const size_t size = page->size();
   const size_t live = page->live_bytes();
   const size_t garbage = size - live;
 
   // Pre-filter out pages that are guaranteed to not be selected
-  if (!page->is_large() && garbage > _page_fragmentation_limit) {
+  if (!page->is_large() && garbage > _page_fragmentation_limit && !is_growing_old_page(page, garbage)) {
     _live_pages.append(page);
   } else if (page->is_young()) {
     _not_selected_pages.append(page);
@@ -119,6 +119,8 @@ class ZRememberedSet {
   bool at_current(uintptr_t offset) const;
   bool at_previous(uintptr_t offset) const;
   bool set_current(uintptr_t offset);
+  template <typename Function /* uintptr_t(size_t i) */>
+  void set_current(size_t count, Function offset_at);
   void unset_non_par_current(uintptr_t offset);
   void unset_range_non_par_current(uintptr_t offset, size_t size);
 
@@ -26,11 +26,14 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 #include "gc/z/zStoreBarrierBuffer.inline.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/vmError.hpp"
 
 ByteSize ZStoreBarrierEntry::p_offset() {
@@ -268,6 +271,39 @@ void ZStoreBarrierBuffer::on_error(outputStream* st) {
   }
 }
 
+static int compare_fields(volatile zpointer* a, volatile zpointer* b) {
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+void ZStoreBarrierBuffer::remember_fields() {
+  // Sort the fields, so that fields on the same page, and fields sharing
+  // a remembered set bitmap word, end up next to each other. Duplicates
+  // are then folded into the same bitmap update.
+  volatile zpointer* fields[BufferLength];
+  size_t count = 0;
+  for (size_t i = current(); i < BufferLength; ++i) {
+    fields[count++] = _buffer[i]._p;
+  }
+  QuickSort::sort(fields, count, compare_fields);
+
+  // Only need remset entries for old objects, so look up the page
+  // and its age once for all fields on the same page
+  for (size_t i = 0; i < count;) {
+    ZPage* const page = ZHeap::heap()->page(fields[i]);
+    size_t end = i + 1;
+    while (end < count && page->is_in(to_zaddress((uintptr_t)fields[end]))) {
+      end++;
+    }
+
+    if (page->is_old()) {
+      volatile zpointer** const page_fields = fields + i;
+      page->remember(end - i, [&](size_t j) { return page_fields[j]; });
+    }
+
+    i = end;
+  }
+}
+
 void ZStoreBarrierBuffer::flush() {
   if (!ZBufferStoreBarriers) {
     return;
@@ -279,9 +315,13 @@ void ZStoreBarrierBuffer::flush() {
   for (size_t i = current(); i < BufferLength; ++i) {
     const ZStoreBarrierEntry& entry = _buffer[i];
     const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+    if (!is_null(addr)) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
   }
 
+  remember_fields();
+
   clear();
 }
 
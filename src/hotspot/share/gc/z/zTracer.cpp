@@ -22,10 +22,13 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/ageTableTracer.hpp"
 #include "gc/shared/gcId.hpp"
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zGlobals.hpp"
+#include "gc/z/zPageAge.hpp"
 #include "gc/z/zPageType.hpp"
+#include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTracer.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -108,6 +111,20 @@ void ZYoungTracer::report_end(const Ticks& timestamp) {
   e.commit();
 }
 
+void ZYoungTracer::report_age_census(const ZRelocationSetSelectorStats& stats) {
+  if (!AgeTableTracer::is_tenuring_distribution_event_enabled()) {
+    return;
+  }
+
+  // Report the live bytes of each young age, as found by marking.
+  // This is the population that is about to survive this collection.
+  for (uint i = 0; i < ZPageAgeMax; ++i) {
+    const ZPageAge age = static_cast<ZPageAge>(i);
+    const size_t live = stats.small(age).live() + stats.medium(age).live() + stats.large(age).live();
+    AgeTableTracer::send_tenuring_distribution_event(i, live);
+  }
+}
+
 void ZOldTracer::report_end(const Ticks& timestamp) {
   NoSafepointVerifier nsv;
 
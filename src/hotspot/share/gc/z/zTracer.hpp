@@ -27,6 +27,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/z/zGenerationId.hpp"
 
+class ZRelocationSetSelectorStats;
 class ZStatCounter;
 class ZStatPhase;
 class ZStatSampler;
@@ -72,6 +73,7 @@ class ZGenerationTracer {
 class ZYoungTracer : public ZGenerationTracer {
 public:
   void report_end(const Ticks& timestamp) override;
+  void report_age_census(const ZRelocationSetSelectorStats& stats);
 };
 
 class ZOldTracer : public ZGenerationTracer {
@@ -83,6 +83,11 @@
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
                                                                             \
+  product(bool, ZLocalityAwareRelocation, false, EXPERIMENTAL,              \
+          "Skip almost full old pages that received promoted objects "      \
+          "since the previous old collection, and let relocation "          \
+          "workers prefer pages on their own NUMA node")                    \
+                                                                            \
   product(bool, ZStressRelocateInPlace, false, DIAGNOSTIC,                  \
           "Always relocate pages in-place")                                 \
                                                                             \
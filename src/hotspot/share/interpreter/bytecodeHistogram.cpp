@@ -145,6 +145,28 @@ void BytecodeHistogram::print(float cutoff) {
 
 // Implementation of BytecodePairHistogram
 
+// A pair can only be merged into a single template if control always falls
+// through from the first bytecode into the second one.
+static bool is_fusable_pair(int c1, int c2) {
+  if (!Bytecodes::is_defined(c1) || !Bytecodes::is_defined(c2)) return false;
+  Bytecodes::Code code = Bytecodes::java_code(Bytecodes::cast(c1));
+  if (Bytecodes::_ifeq <= code && code <= Bytecodes::_lookupswitch) return false; // branches, jsr/ret, switches
+  if (Bytecodes::is_return(code) || Bytecodes::is_invoke(code)) return false;
+  switch (code) {
+    case Bytecodes::_athrow:
+    case Bytecodes::_wide:
+    case Bytecodes::_ifnull:
+    case Bytecodes::_ifnonnull:
+    case Bytecodes::_goto_w:
+    case Bytecodes::_jsr_w:
+      return false;
+    default:
+      return true;
+  }
+}
+
+static const int number_of_fusion_candidates = 10;
+
 int BytecodePairHistogram::_index;
 int BytecodePairHistogram::_counters[BytecodePairHistogram::number_of_pairs];
 
@@ -184,6 +206,25 @@ void BytecodePairHistogram::print(float cutoff) {
   float rel_sum = (float)abs_sum * 100.0F / (float)tot;
   tty->print_cr("%10d   %6.3f%%    (cutoff = %.3f%%)", abs_sum, rel_sum, cutoff);
   tty->cr();
+
+  // Pairs that are still dispatched separately are what a super-instruction
+  // would save; pairs already fused by RewriteFrequentPairs show up under
+  // their fast bytecode instead.
+  tty->print_cr("Super-instruction candidates (dispatches saved if fused):");
+  tty->cr();
+  int printed = 0;
+  i = profile->length();
+  while (i-- > 0 && printed < number_of_fusion_candidates) {
+    HistoEntry* e = profile->at(i);
+    int c1 = e->index() % number_of_codes;
+    int c2 = e->index() / number_of_codes;
+    if (e->count() > 0 && is_fusable_pair(c1, c2)) {
+      float rel = (float)e->count() * 100.0F / (float)tot;
+      tty->print_cr("%10d   %6.3f%%    %02x %02x    %-19s %s", e->count(), rel, c1, c2, name_for(c1), name_for(c2));
+      printed++;
+    }
+  }
+  tty->cr();
 }
 
 #endif
@@ -41,6 +41,7 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/constantPool.inline.hpp"
 #include "oops/cpCache.inline.hpp"
 #include "oops/instanceKlass.inline.hpp"
@@ -1509,6 +1510,28 @@ Method* LinkResolver::linktime_resolve_interface_method(const LinkInfo& link_inf
 }
 
 // throws runtime exceptions
+// Link-time itable initialization already performed the selection search
+// below for every interface method with an itable index, and stored the
+// result if it was a public, concrete method. Returns null if the receiver's
+// itable cannot answer the query.
+static Method* select_from_itable(Klass* recv_klass, const methodHandle& resolved_method) {
+  if (!resolved_method->has_itable_index() || !recv_klass->is_instance_klass()) {
+    return nullptr;
+  }
+  InstanceKlass* recv_ik = InstanceKlass::cast(recv_klass);
+  if (!recv_ik->is_linked()) {
+    return nullptr;
+  }
+  bool implements_interface;
+  Method* m = recv_ik->method_at_itable_or_null(resolved_method->method_holder(),
+                                                resolved_method->itable_index(),
+                                                implements_interface);
+  if (m == Universe::throw_illegal_access_error()) {
+    return nullptr;
+  }
+  return m;
+}
+
 void LinkResolver::runtime_resolve_interface_method(CallInfo& result,
                                                     const methodHandle& resolved_method,
                                                     Klass* resolved_klass,
@@ -1545,10 +1568,15 @@ void LinkResolver::runtime_resolve_interface_method(CallInfo& result,
     // This search must match the linktime preparation search for itable initialization
     // to correctly enforce loader constraints for interface method inheritance.
     // Private methods are skipped as the resolved method was not private.
-    Method* method = lookup_instance_method_in_klasses(recv_klass,
-                                                       resolved_method->name(),
-                                                       resolved_method->signature(),
-                                                       Klass::PrivateLookupMode::skip);
+    // Use the itable entry when there is one, so that repeated resolution of
+    // megamorphic call sites does not redo the name and signature search.
+    Method* method = select_from_itable(recv_klass, resolved_method);
+    if (method == nullptr) {
+      method = lookup_instance_method_in_klasses(recv_klass,
+                                                 resolved_method->name(),
+                                                 resolved_method->signature(),
+                                                 Klass::PrivateLookupMode::skip);
+    }
     selected_method = methodHandle(THREAD, method);
 
     if (selected_method.is_null() && !check_null_and_abstract) {
@@ -437,6 +437,8 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
+volatile size_t OopMapCache::_total_misses = 0;
+volatile size_t OopMapCache::_total_evictions = 0;
 
 OopMapCache::OopMapCache() {
   for(int i = 0; i < size; i++) _array[i] = nullptr;
@@ -517,6 +519,7 @@ void OopMapCache::lookup(const methodHandle& method,
   // Entry is not in hashtable.
   // Compute entry
 
+  Atomic::inc(&_total_misses, memory_order_relaxed);
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
   tmp->initialize();
   tmp->fill(method, bci);
@@ -543,6 +546,7 @@ void OopMapCache::lookup(const methodHandle& method,
   }
 
   log_debug(interpreter, oopmap)("*** collision in oopmap cache - flushing item ***");
+  Atomic::inc(&_total_evictions, memory_order_relaxed);
 
   // No empty slot (uncommon case). Use (some approximation of a) LRU algorithm
   // where the first entry in the collision array is replaced with the new one.
@@ -590,6 +594,12 @@ void OopMapCache::try_trigger_cleanup() {
     Service_lock->notify_all();
     Service_lock->unlock();
   }
+  log_statistics();
+}
+
+void OopMapCache::log_statistics() {
+  log_info(interpreter, oopmap)("OopMapCache: %zu misses, %zu evictions",
+                                Atomic::load(&_total_misses), Atomic::load(&_total_evictions));
 }
 
 void OopMapCache::cleanup() {
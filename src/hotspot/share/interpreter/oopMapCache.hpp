@@ -150,6 +150,8 @@ class InterpreterOopMap: ResourceObj {
 
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
+ static volatile size_t _total_misses;      // lookups that ran GenerateOopMap
+ static volatile size_t _total_evictions;   // entries replaced on collision
  private:
   static constexpr int size = 32;        // Use fixed size for now
   static constexpr int probe_depth = 3;  // probe depth in case of collisions
@@ -186,6 +188,9 @@ class OopMapCache : public CHeapObj<mtClass> {
 
   // Clean up the old entries
   static void cleanup();
+
+  // Log miss and eviction counts to interpreter+oopmap
+  static void log_statistics();
 };
 
 #endif // SHARE_INTERPRETER_OOPMAPCACHE_HPP
@@ -37,7 +37,7 @@
 #include "oops/oop.inline.hpp"
 #include "utilities/align.hpp"
 
-BFSClosure::BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits) :
+BFSClosure::BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits, size_t samples_to_find) :
   _edge_queue(edge_queue),
   _edge_store(edge_store),
   _mark_bits(mark_bits),
@@ -46,6 +46,8 @@ BFSClosure::BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet*
   _next_frontier_idx(0),
   _prev_frontier_idx(0),
   _dfs_fallback_idx(0),
+  _samples_to_find(samples_to_find),
+  _samples_found(0),
   _use_dfs(false) {
 }
 
@@ -122,9 +124,15 @@ void BFSClosure::closure_impl(UnifiedOopRef reference, const oop pointee) {
      return;
   }
 
+  // Once every sample has a chain there is nothing left to discover,
+  // so avoid walking the rest of the heap.
+  if (all_samples_found()) {
+    return;
+  }
+
   if (_use_dfs) {
     assert(_current_parent != nullptr, "invariant");
-    DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, _current_parent);
+    DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, _current_parent, &_samples_found);
     return;
   }
 
@@ -151,16 +159,17 @@ void BFSClosure::add_chain(UnifiedOopRef reference, const oop pointee) {
   assert(pointee->mark().is_marked(), "invariant");
   Edge leak_edge(_current_parent, reference);
   _edge_store->put_chain(&leak_edge, _current_parent == nullptr ? 1 : _current_frontier_level + 2);
+  ++_samples_found;
 }
 
 void BFSClosure::dfs_fallback() {
   assert(_edge_queue->is_full(), "invariant");
   _use_dfs = true;
   _dfs_fallback_idx = _edge_queue->bottom();
-  while (!_edge_queue->is_empty()) {
+  while (!_edge_queue->is_empty() && !all_samples_found()) {
     const Edge* edge = _edge_queue->remove();
     if (edge->pointee() != nullptr) {
-      DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, edge);
+      DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, edge, &_samples_found);
     }
   }
 }
@@ -184,6 +193,10 @@ void BFSClosure::step_frontier() const {
 }
 
 bool BFSClosure::is_complete() const {
+  if (all_samples_found()) {
+    log_trace(jfr, system)("BFS front: %zu found all %zu samples", _current_frontier_level, _samples_to_find);
+    return true;
+  }
   if (_edge_queue->bottom() < _next_frontier_idx) {
     return false;
   }
@@ -44,12 +44,15 @@ class BFSClosure : public BasicOopIterateClosure {
   mutable size_t _next_frontier_idx;
   mutable size_t _prev_frontier_idx;
   size_t _dfs_fallback_idx;
+  const size_t _samples_to_find;
+  size_t _samples_found;
   bool _use_dfs;
 
   void log_completed_frontier() const;
   void log_dfs_fallback() const;
 
   bool is_complete() const;
+  bool all_samples_found() const { return _samples_found >= _samples_to_find; }
   void step_frontier() const;
 
   void closure_impl(UnifiedOopRef reference, const oop pointee);
@@ -65,7 +68,7 @@ class BFSClosure : public BasicOopIterateClosure {
  public:
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS_EXCEPT_REFERENT; }
 
-  BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits);
+  BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, JFRBitSet* mark_bits, size_t samples_to_find);
   void process();
   void do_root(UnifiedOopRef ref);
 
@@ -41,13 +41,15 @@ UnifiedOopRef DFSClosure::_reference_stack[max_dfs_depth];
 
 void DFSClosure::find_leaks_from_edge(EdgeStore* edge_store,
                                       JFRBitSet* mark_bits,
-                                      const Edge* start_edge) {
+                                      const Edge* start_edge,
+                                      size_t* chains_found) {
   assert(edge_store != nullptr, "invariant");
   assert(mark_bits != nullptr," invariant");
   assert(start_edge != nullptr, "invariant");
+  assert(chains_found != nullptr, "invariant");
 
   // Depth-first search, starting from a BFS edge
-  DFSClosure dfs(edge_store, mark_bits, start_edge);
+  DFSClosure dfs(edge_store, mark_bits, start_edge, chains_found);
   start_edge->pointee()->oop_iterate(&dfs);
 }
 
@@ -57,7 +59,7 @@ void DFSClosure::find_leaks_from_root_set(EdgeStore* edge_store,
   assert(mark_bits != nullptr, "invariant");
 
   // Mark root set, to avoid going sideways
-  DFSClosure dfs(edge_store, mark_bits, nullptr);
+  DFSClosure dfs(edge_store, mark_bits, nullptr, nullptr);
   dfs._max_depth = 1;
   RootSetClosure<DFSClosure> rs(&dfs);
   rs.process();
@@ -68,8 +70,8 @@ void DFSClosure::find_leaks_from_root_set(EdgeStore* edge_store,
   rs.process();
 }
 
-DFSClosure::DFSClosure(EdgeStore* edge_store, JFRBitSet* mark_bits, const Edge* start_edge)
-  :_edge_store(edge_store), _mark_bits(mark_bits), _start_edge(start_edge),
+DFSClosure::DFSClosure(EdgeStore* edge_store, JFRBitSet* mark_bits, const Edge* start_edge, size_t* chains_found)
+  :_edge_store(edge_store), _mark_bits(mark_bits), _start_edge(start_edge), _chains_found(chains_found),
   _max_depth(max_dfs_depth), _depth(0), _ignore_root_set(false) {
 }
 
@@ -129,6 +131,9 @@ void DFSClosure::add_chain() {
     chain[idx - 1] = Edge(nullptr, chain[idx - 1].reference());
   }
   _edge_store->put_chain(chain, idx + (_start_edge != nullptr ? _start_edge->distance_to_root() : 0));
+  if (_chains_found != nullptr) {
+    ++*_chains_found;
+  }
 }
 
 void DFSClosure::do_oop(oop* ref) {
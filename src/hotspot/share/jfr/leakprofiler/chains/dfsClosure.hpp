@@ -43,11 +43,12 @@ class DFSClosure : public BasicOopIterateClosure {
   EdgeStore* _edge_store;
   JFRBitSet* _mark_bits;
   const Edge*_start_edge;
+  size_t* _chains_found;  // shared with the BFS this search falls back from, if any
   size_t _max_depth;
   size_t _depth;
   bool _ignore_root_set;
 
-  DFSClosure(EdgeStore* edge_store, JFRBitSet* mark_bits, const Edge* start_edge);
+  DFSClosure(EdgeStore* edge_store, JFRBitSet* mark_bits, const Edge* start_edge, size_t* chains_found);
 
   void add_chain();
   void closure_impl(UnifiedOopRef reference, const oop pointee);
@@ -55,7 +56,8 @@ class DFSClosure : public BasicOopIterateClosure {
  public:
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS_EXCEPT_REFERENT; }
 
-  static void find_leaks_from_edge(EdgeStore* edge_store, JFRBitSet* mark_bits, const Edge* start_edge);
+  // Adds the number of chains found to *chains_found.
+  static void find_leaks_from_edge(EdgeStore* edge_store, JFRBitSet* mark_bits, const Edge* start_edge, size_t* chains_found);
   static void find_leaks_from_root_set(EdgeStore* edge_store, JFRBitSet* mark_bits);
   void do_root(UnifiedOopRef ref);
 
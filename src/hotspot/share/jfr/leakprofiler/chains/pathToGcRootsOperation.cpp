@@ -101,7 +101,8 @@ void PathToGcRootsOperation::doit() {
   // Save the original markWord for the potential leak objects,
   // to be restored on function exit
   ObjectSampleMarker marker;
-  if (ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all) == 0) {
+  const int samples_to_find = ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all);
+  if (samples_to_find == 0) {
     // no valid samples to process
     return;
   }
@@ -109,7 +110,7 @@ void PathToGcRootsOperation::doit() {
   // Necessary condition for attempting a root set iteration
   Universe::heap()->ensure_parsability(false);
 
-  BFSClosure bfs(&edge_queue, _edge_store, &mark_bits);
+  BFSClosure bfs(&edge_queue, _edge_store, &mark_bits, (size_t)samples_to_find);
   RootSetClosure<BFSClosure> roots(&bfs);
 
   GranularTimer::start(_cutoff_ticks, 1000000);
@@ -41,6 +41,8 @@ struct CompilerQueueEntry {
   GET_COMPILER_THREAD_COUNT get_compiler_thread_count;
   uint64_t added;
   uint64_t removed;
+  uint64_t dropped;
+  jlong select_nanos;
 };
 
 // If current counters are less than previous, we assume the interface has been reset
@@ -55,8 +57,8 @@ static uint64_t rate_per_second(uint64_t current, uint64_t old, const JfrTickspa
 
 void JfrCompilerQueueUtilization::send_events() {
   static CompilerQueueEntry compilerQueueEntries[num_compiler_queues] = {
-    {CompileBroker::c1_compile_queue(), c1_compiler_queue_id, &CompileBroker::get_c1_thread_count, 0, 0},
-    {CompileBroker::c2_compile_queue(), c2_compiler_queue_id, &CompileBroker::get_c2_thread_count, 0, 0}};
+    {CompileBroker::c1_compile_queue(), c1_compiler_queue_id, &CompileBroker::get_c1_thread_count, 0, 0, 0, 0},
+    {CompileBroker::c2_compile_queue(), c2_compiler_queue_id, &CompileBroker::get_c2_thread_count, 0, 0, 0, 0}};
 
   const JfrTicks cur_time = JfrTicks::now();
   static JfrTicks last_sample_instant;
@@ -66,6 +68,8 @@ void JfrCompilerQueueUtilization::send_events() {
     if (entry->compilerQueue != nullptr) {
       const uint64_t current_added = entry->compilerQueue->get_total_added();
       const uint64_t current_removed = entry->compilerQueue->get_total_removed();
+      const uint64_t current_dropped = entry->compilerQueue->get_total_dropped();
+      const jlong current_select_nanos = entry->compilerQueue->get_total_select_nanos();
       const uint64_t addedRate = rate_per_second(current_added, entry->added, interval);
       const uint64_t removedRate = rate_per_second(current_removed, entry->removed, interval);
 
@@ -79,11 +83,16 @@ void JfrCompilerQueueUtilization::send_events() {
       event.set_removedCount(current_removed - entry->removed);
       event.set_totalAddedCount(current_added);
       event.set_totalRemovedCount(current_removed);
+      event.set_droppedCount(current_dropped - entry->dropped);
+      event.set_totalDroppedCount(current_dropped);
+      event.set_selectionTime(current_select_nanos - entry->select_nanos);
       event.set_compilerThreadCount(entry->get_compiler_thread_count());
       event.commit();
 
       entry->added = current_added;
       entry->removed = current_removed;
+      entry->dropped = current_dropped;
+      entry->select_nanos = current_select_nanos;
     }
 
     last_sample_instant = cur_time;
@@ -25,11 +25,15 @@
 #include "precompiled.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/periodic/jfrNativeMemoryEvent.hpp"
+#include "jfr/recorder/repository/jfrRepository.hpp"
 #include "nmt/memTracker.hpp"
 #include "nmt/nmtUsage.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ticks.hpp"
 
+NMTUsagePair JfrNativeMemoryEvent::_last_sent[mt_number_of_tags];
+jlong JfrNativeMemoryEvent::_last_sent_chunk_start = 0;
+
 static NMTUsage* get_usage(const Ticks& timestamp) {
   static Ticks last_timestamp;
   static NMTUsage* usage = nullptr;
@@ -88,3 +92,48 @@ void JfrNativeMemoryEvent::send_type_events(const Ticks& timestamp) {
     send_type_event(timestamp, mem_tag, usage->reserved(mem_tag), usage->committed(mem_tag));
   }
 }
+
+// NMTUsage only reads the per-tag summary counters, so this is cheap enough to
+// run at short periods; events are only written for tags that actually changed.
+// The first request in each chunk reports every tag, with the deltas relative
+// to zero, so that each chunk is self-contained.
+void JfrNativeMemoryEvent::send_type_delta_events(const Ticks& timestamp) {
+  if (!MemTracker::enabled()) {
+    return;
+  }
+
+  NMTUsage* usage = get_usage(timestamp);
+
+  const jlong chunk_start = JfrRepository::current_chunk_start_nanos();
+  const bool full = chunk_start != _last_sent_chunk_start;
+  if (full) {
+    for (int index = 0; index < mt_number_of_tags; index ++) {
+      _last_sent[index].reserved = 0;
+      _last_sent[index].committed = 0;
+    }
+    _last_sent_chunk_start = chunk_start;
+  }
+
+  for (int index = 0; index < mt_number_of_tags; index ++) {
+    MemTag mem_tag = NMTUtil::index_to_tag(index);
+    if (mem_tag == mtNone) {
+      continue;
+    }
+    const size_t reserved = usage->reserved(mem_tag);
+    const size_t committed = usage->committed(mem_tag);
+    NMTUsagePair* const last = &_last_sent[index];
+    if (!full && reserved == last->reserved && committed == last->committed) {
+      continue;
+    }
+    EventNativeMemoryUsageDelta event(UNTIMED);
+    event.set_starttime(timestamp);
+    event.set_type(index);
+    event.set_reserved(reserved);
+    event.set_committed(committed);
+    event.set_reservedDelta((s8)reserved - (s8)last->reserved);
+    event.set_committedDelta((s8)committed - (s8)last->committed);
+    event.commit();
+    last->reserved = reserved;
+    last->committed = committed;
+  }
+}
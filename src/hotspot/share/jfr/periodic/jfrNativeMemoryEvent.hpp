@@ -35,10 +35,17 @@
 // so no more synchronization is needed.
 class JfrNativeMemoryEvent : public AllStatic {
 private:
+  // Usage per tag as of the last NativeMemoryUsageDelta events
+  static NMTUsagePair _last_sent[mt_number_of_tags];
+  // Start of the chunk that _last_sent belongs to
+  static jlong _last_sent_chunk_start;
+
   static void send_type_event(const Ticks& starttime, MemTag mem_tag, size_t reserved, size_t committed);
  public:
   static void send_total_event(const Ticks& timestamp);
   static void send_type_events(const Ticks& timestamp);
+  // Like send_type_events, but only for tags whose usage changed since the last call.
+  static void send_type_delta_events(const Ticks& timestamp);
 };
 
 #endif //SHARE_JFR_PERIODIC_JFRNATIVEMEMORYEVENT_HPP
@@ -44,6 +44,8 @@
 #include "jfr/periodic/jfrThreadDumpEvent.hpp"
 #include "jfr/periodic/jfrNativeMemoryEvent.hpp"
 #include "jfr/periodic/jfrNetworkUtilization.hpp"
+#include "jfr/periodic/sampling/jfrExecutionProfile.hpp"
+#include "jfr/support/jfrNativeAllocationSample.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/utilities/jfrThreadIterator.hpp"
 #include "jfr/utilities/jfrTime.hpp"
@@ -407,10 +409,24 @@ TRACE_REQUEST_FUNC(ObjectCount) {
   VMThread::execute(&op);
 }
 
+TRACE_REQUEST_FUNC(AggregatedExecutionProfile) {
+  JfrExecutionProfile::send_events(JfrPeriodicEventSet::type() == BEGIN_CHUNK);
+}
+
+TRACE_REQUEST_FUNC(NativeAllocationSample) {
+  JfrNativeAllocationSample::send_events();
+}
+
 TRACE_REQUEST_FUNC(G1HeapRegionInformation) {
   G1GC_ONLY(G1HeapRegionEventSender::send_events());
 }
 
+// The first request in each chunk reports the full region table, whatever the
+// period, so the table at any point is the last event seen per region index.
+TRACE_REQUEST_FUNC(G1HeapRegionInformationDelta) {
+  G1GC_ONLY(G1HeapRegionEventSender::send_delta_events());
+}
+
 // Java Mission Control (JMC) uses (Java) Long.MIN_VALUE to describe that a
 // long value is undefined.
 static jlong jmc_undefined_long = min_jlong;
@@ -737,6 +753,10 @@ TRACE_REQUEST_FUNC(NativeMemoryUsage) {
   JfrNativeMemoryEvent::send_type_events(timestamp());
 }
 
+TRACE_REQUEST_FUNC(NativeMemoryUsageDelta) {
+  JfrNativeMemoryEvent::send_type_delta_events(timestamp());
+}
+
 TRACE_REQUEST_FUNC(NativeMemoryUsageTotal) {
   JfrNativeMemoryEvent::send_total_event(timestamp());
 }
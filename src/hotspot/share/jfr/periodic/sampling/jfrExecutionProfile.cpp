@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/periodic/sampling/jfrExecutionProfile.hpp"
+#include "jfr/utilities/jfrSpinlockHelper.hpp"
+#include "logging/log.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Open addressed, power of two sized, keyed by stack trace id. Id 0 marks a free slot.
+static const size_t table_size = 4096;
+static const size_t table_mask = table_size - 1;
+
+struct ProfileBucket {
+  traceid _stacktrace_id;
+  u4 _samples;
+};
+
+// The sampler adds to _table under _lock. send_events() swaps in the other,
+// cleared table under that lock and commits the events of the retired one
+// after releasing it, so that the sampler is not stalled while they are
+// written. _send_lock serializes the senders.
+static ProfileBucket _tables[2][table_size];
+static ProfileBucket* _table = _tables[0];
+static size_t _buckets = 0;
+static u8 _dropped_samples = 0;
+static volatile int _lock = 0;
+static volatile int _send_lock = 0;
+
+static void clear(ProfileBucket* table) {
+  for (size_t i = 0; i < table_size; ++i) {
+    table[i]._stacktrace_id = 0;
+    table[i]._samples = 0;
+  }
+}
+
+bool JfrExecutionProfile::is_enabled() {
+  return EventAggregatedExecutionProfile::is_enabled();
+}
+
+void JfrExecutionProfile::add(traceid stacktrace_id) {
+  assert(stacktrace_id != 0, "invariant");
+  JfrSpinlockHelper mutex(&_lock);
+  // Leave some headroom, so that probe sequences stay short.
+  const bool full = _buckets >= table_size - (table_size >> 2);
+  for (size_t idx = stacktrace_id & table_mask; ; idx = (idx + 1) & table_mask) {
+    ProfileBucket& bucket = _table[idx];
+    if (bucket._stacktrace_id == stacktrace_id) {
+      ++bucket._samples;
+      return;
+    }
+    if (bucket._stacktrace_id == 0) {
+      if (full) {
+        ++_dropped_samples;
+        return;
+      }
+      bucket._stacktrace_id = stacktrace_id;
+      bucket._samples = 1;
+      ++_buckets;
+      return;
+    }
+  }
+}
+
+void JfrExecutionProfile::send_events(bool discard) {
+  JfrSpinlockHelper send_mutex(&_send_lock);
+  ProfileBucket* retired;
+  size_t buckets;
+  u8 dropped_samples;
+  {
+    JfrSpinlockHelper mutex(&_lock);
+    retired = _table;
+    buckets = _buckets;
+    dropped_samples = _dropped_samples;
+    _table = retired == _tables[0] ? _tables[1] : _tables[0];
+    _buckets = 0;
+    _dropped_samples = 0;
+  }
+  if (!discard) {
+    for (size_t i = 0; i < table_size; ++i) {
+      const ProfileBucket& bucket = retired[i];
+      if (bucket._stacktrace_id != 0) {
+        EventAggregatedExecutionProfile event;
+        event.set_stackTrace(bucket._stacktrace_id);
+        event.set_samples(bucket._samples);
+        event.commit();
+      }
+    }
+    if (dropped_samples > 0) {
+      log_debug(jfr, system)("Execution profile: %zu stack traces, " UINT64_FORMAT " samples dropped", buckets, dropped_samples);
+    }
+  }
+  clear(retired);
+}
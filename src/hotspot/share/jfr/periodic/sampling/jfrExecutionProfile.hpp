@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_PERIODIC_SAMPLING_JFREXECUTIONPROFILE_HPP
+#define SHARE_JFR_PERIODIC_SAMPLING_JFREXECUTIONPROFILE_HPP
+
+#include "jfr/utilities/jfrTypes.hpp"
+#include "memory/allStatic.hpp"
+
+// Aggregates Java execution samples into per stack trace counts, reported by the
+// periodic jdk.AggregatedExecutionProfile event as one event per stack trace.
+// The table is bounded, samples for new stack traces are dropped when it is full.
+class JfrExecutionProfile : AllStatic {
+ public:
+  static bool is_enabled();
+  static void add(traceid stacktrace_id);
+  // Stack trace ids are only valid in the chunk they were recorded in, so at the
+  // beginning of a chunk the aggregated counts are discarded instead of reported.
+  static void send_events(bool discard);
+};
+
+#endif // SHARE_JFR_PERIODIC_SAMPLING_JFREXECUTIONPROFILE_HPP
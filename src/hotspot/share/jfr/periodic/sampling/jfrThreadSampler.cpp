@@ -27,6 +27,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/periodic/sampling/jfrCallTrace.hpp"
+#include "jfr/periodic/sampling/jfrExecutionProfile.hpp"
 #include "jfr/periodic/sampling/jfrThreadSampler.hpp"
 #include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdLoadBarrier.inline.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
@@ -277,6 +278,9 @@ bool JfrThreadSampleClosure::sample_thread_in_java(JavaThread* thread, JfrStackF
   traceid id = JfrStackTraceRepository::add(sampler.stacktrace());
   assert(id != 0, "Stacktrace id should not be 0");
   event->set_stackTrace(id);
+  if (JfrExecutionProfile::is_enabled()) {
+    JfrExecutionProfile::add(id);
+  }
   return true;
 }
 
@@ -398,6 +402,15 @@ bool JfrThreadSampleClosure::do_sample_thread(JavaThread* thread, JfrStackFrame*
     return false;
   }
 
+  // Most threads of a large application are blocked or waiting. A racy look at the
+  // thread state filters them out before we pay for the trace flag handshake (and
+  // a system-wide memory barrier with UseSystemMemoryBarrier). A thread that has
+  // just entered the sampled state is missed this time around; the state is checked
+  // again under the trace flag below.
+  if (JAVA_SAMPLE == type ? !thread_state_in_java(thread) : !thread_state_in_native(thread)) {
+    return false;
+  }
+
   bool ret = false;
   thread->set_trace_flag();  // Provides StoreLoad, needed to keep read of thread state from floating up.
   if (UseSystemMemoryBarrier) {
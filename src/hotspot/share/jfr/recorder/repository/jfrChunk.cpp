@@ -96,6 +96,10 @@ void JfrChunk::mark_final() {
   _final = true;
 }
 
+bool JfrChunk::is_final() const {
+  return _final;
+}
+
 u2 JfrChunk::flags() const {
   // chunk capabilities, CompressedIntegers etc
   u2 flags = 0;
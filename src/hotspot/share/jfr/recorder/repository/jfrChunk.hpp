@@ -59,6 +59,7 @@ class JfrChunk : public JfrCHeapObj {
   u2 flags() const;
 
   void mark_final();
+  bool is_final() const;
 
   void update_start_ticks();
   void update_start_nanos();
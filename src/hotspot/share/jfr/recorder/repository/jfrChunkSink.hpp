@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSINK_HPP
+#define SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSINK_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Platform dependent access to -XX:FlightRecorderChunkSink. Where the platform
+// allows, the sink is opened and written without blocking, so that the
+// recorder thread does not hang on a named pipe without a reader or with a
+// stalled one.
+class JfrChunkSink : AllStatic {
+ public:
+  enum WriteResult { WRITTEN, SKIPPED, TRUNCATED };
+
+  // Opens path for appending. Returns -1 if the sink cannot be opened, with
+  // *no_reader set if that is because a named pipe has no reader.
+  static int open(const char* path, bool* no_reader);
+
+  // Writes data to sink_fd. If the sink does not accept data before any byte
+  // of the chunk was written (*started is false), the chunk is skipped. Once a
+  // chunk is started it must be completed, so a full pipe is waited on for up
+  // to stall_timeout_ms.
+  static WriteResult write(int sink_fd, const char* data, size_t size, bool* started, int stall_timeout_ms);
+
+  // Closes a sink, or the chunk file read for forwarding.
+  static void close(int fd);
+};
+
+#endif // SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSINK_HPP
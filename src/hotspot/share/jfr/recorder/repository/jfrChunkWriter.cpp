@@ -217,6 +217,11 @@ void JfrChunkWriter::mark_chunk_final() {
   _chunk->mark_final();
 }
 
+bool JfrChunkWriter::is_chunk_final() const {
+  assert(_chunk != nullptr, "invariant");
+  return _chunk->is_final();
+}
+
 int64_t JfrChunkWriter::flush_chunk(bool flushpoint) {
   assert(_chunk != nullptr, "invariant");
   const int64_t sz_written = write_chunk_header_checkpoint(flushpoint);
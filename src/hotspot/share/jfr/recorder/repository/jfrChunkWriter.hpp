@@ -60,6 +60,7 @@ class JfrChunkWriter : public JfrChunkWriterBase {
   bool has_metadata() const;
   void set_time_stamp();
   void mark_chunk_final();
+  bool is_chunk_final() const;
 };
 
 #endif // SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKWRITER_HPP
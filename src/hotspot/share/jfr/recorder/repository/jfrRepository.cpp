@@ -26,6 +26,8 @@
 #include "jfr/jfr.hpp"
 #include "jfr/jni/jfrJavaSupport.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
+#include "jfr/recorder/repository/jfrChunk.hpp"
+#include "jfr/recorder/repository/jfrChunkSink.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/repository/jfrEmergencyDump.hpp"
 #include "jfr/recorder/repository/jfrRepository.hpp"
@@ -35,6 +37,8 @@
 #include "runtime/javaThread.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/os.hpp"
+#include "utilities/vmError.hpp"
+#include "utilities/zipLibrary.hpp"
 
 static JfrRepository* _instance = nullptr;
 
@@ -44,6 +48,10 @@ JfrRepository& JfrRepository::instance() {
 
 static JfrChunkWriter* _chunkwriter = nullptr;
 
+// Path of the chunk file currently written, when forwarding to a chunk sink.
+// The chunk writer's own path already names the next chunk during rotation.
+static char* _open_chunk_path = nullptr;
+
 
 JfrChunkWriter& JfrRepository::chunkwriter() {
   return *_chunkwriter;
@@ -164,11 +172,223 @@ bool JfrRepository::open_chunk(bool vm_error /* false */) {
   if (vm_error) {
     _chunkwriter->set_path(JfrEmergencyDump::chunk_path(_path));
   }
-  return _chunkwriter->open();
+  if (!_chunkwriter->open()) {
+    return false;
+  }
+  if (FlightRecorderChunkSink != nullptr && _chunkwriter->_chunk->path() != nullptr) {
+    assert(_open_chunk_path == nullptr, "invariant");
+    _open_chunk_path = os::strdup(_chunkwriter->_chunk->path(), mtTracing);
+  }
+  return true;
 }
 
-size_t JfrRepository::close_chunk() {
-  return _chunkwriter->close();
+// Compresses the blocks of a forwarded chunk into self-contained gzip members,
+// so the sink output decompresses with standard tools into a sequence of chunks.
+class ChunkSinkCompressor : public StackObj {
+  const int _level;
+  size_t _out_size;
+  size_t _tmp_size;
+  char* _out;
+  char* _tmp;
+
+ public:
+  ChunkSinkCompressor(size_t block_size, int level) :
+    _level(level), _out_size(0), _tmp_size(0), _out(nullptr), _tmp(nullptr) {
+    if (_level == 0) {
+      return;
+    }
+    const char* msg = ZipLibrary::init_params(block_size, &_out_size, &_tmp_size, _level);
+    if (msg != nullptr) {
+      log_info(jfr)("Chunk sink compression unavailable: %s", msg);
+      return;
+    }
+    _out = (char*)os::malloc(_out_size, mtTracing);
+    _tmp = _tmp_size > 0 ? (char*)os::malloc(_tmp_size, mtTracing) : nullptr;
+  }
+
+  ~ChunkSinkCompressor() {
+    os::free(_tmp);
+    os::free(_out);
+  }
+
+  bool is_enabled() const { return _out != nullptr && (_tmp_size == 0 || _tmp != nullptr); }
+
+  // Returns the compressed size, or 0 on failure.
+  size_t compress(char* in, size_t in_size, char** out) {
+    const char* msg = nullptr;
+    const size_t size = ZipLibrary::compress(in, in_size, _out, _out_size, _tmp, _tmp_size, _level, nullptr, &msg);
+    if (msg != nullptr) {
+      log_info(jfr)("Unable to compress chunk block: %s", msg);
+      return 0;
+    }
+    *out = _out;
+    return size;
+  }
+};
+
+// Forwarding state for the whole session. Whether chunks are compressed is
+// decided before the first one is written, so the sink never mixes raw
+// chunks and gzip members. After a chunk was only partly written, the sink
+// stream is no longer parseable and forwarding stops.
+enum ChunkSinkMode { SINK_UNDECIDED, SINK_RAW, SINK_COMPRESSED, SINK_DISABLED };
+static ChunkSinkMode _sink_mode = SINK_UNDECIDED;
+
+// How long a chunk that is partly written to a full pipe waits for the reader.
+static const int sink_stall_timeout_ms = 5000;
+
+static JfrChunkSink::WriteResult write_to_sink(int sink_fd, const char* data, size_t size, bool* started) {
+  return JfrChunkSink::write(sink_fd, data, size, started, sink_stall_timeout_ms);
+}
+
+// Opens -XX:FlightRecorderChunkSink for appending. Returns -1 if there is no
+// reader on a named pipe, or the sink cannot be opened.
+static int open_sink() {
+  bool no_reader = false;
+  const int sink_fd = JfrChunkSink::open(FlightRecorderChunkSink, &no_reader);
+  if (sink_fd == -1) {
+    if (no_reader) {
+      log_debug(jfr, system)("No reader on chunk sink %s, chunk skipped", FlightRecorderChunkSink);
+    } else {
+      log_info(jfr)("Unable to open chunk sink %s, chunk skipped", FlightRecorderChunkSink);
+    }
+  }
+  return sink_fd;
+}
+
+// Reads the chunk at chunk_fd and compresses it into a sequence of gzip
+// members. Returns nullptr if any block fails, so that nothing of the chunk
+// is written.
+static char* compress_chunk(int chunk_fd, char* block, size_t block_size, size_t* compressed_size) {
+  ChunkSinkCompressor compressor(block_size, (int)FlightRecorderChunkSinkCompression);
+  if (!compressor.is_enabled()) {
+    return nullptr;
+  }
+  char* result = nullptr;
+  size_t capacity = 0;
+  size_t size = 0;
+  int64_t offset = 0;
+  while (true) {
+    const ssize_t read_result = os::read_at(chunk_fd, block, (int)block_size, offset);
+    if (read_result < 0) {
+      os::free(result);
+      return nullptr;
+    }
+    if (read_result == 0) {
+      break;
+    }
+    char* data = nullptr;
+    const size_t data_size = compressor.compress(block, (size_t)read_result, &data);
+    if (data_size == 0) {
+      os::free(result);
+      return nullptr;
+    }
+    if (size + data_size > capacity) {
+      capacity = MAX2(2 * capacity, size + data_size);
+      char* const grown = (char*)os::realloc(result, capacity, mtTracing);
+      if (grown == nullptr) {
+        os::free(result);
+        return nullptr;
+      }
+      result = grown;
+    }
+    memcpy(result + size, data, data_size);
+    size += data_size;
+    offset += read_result;
+  }
+  *compressed_size = size;
+  return result;
+}
+
+static void forward_chunk_data(const char* chunk_path, int chunk_fd, char* block, size_t block_size) {
+  char* compressed = nullptr;
+  size_t compressed_size = 0;
+  if (_sink_mode == SINK_COMPRESSED) {
+    compressed = compress_chunk(chunk_fd, block, block_size, &compressed_size);
+    if (compressed == nullptr) {
+      log_info(jfr)("Unable to compress chunk %s, chunk skipped", chunk_path);
+      return;
+    }
+  }
+  const int sink_fd = open_sink();
+  if (sink_fd != -1) {
+    JfrChunkSink::WriteResult result = JfrChunkSink::WRITTEN;
+    bool started = false;
+    int64_t forwarded = 0;
+    if (compressed != nullptr) {
+      result = write_to_sink(sink_fd, compressed, compressed_size, &started);
+    } else {
+      while (result == JfrChunkSink::WRITTEN) {
+        const ssize_t read_result = os::read_at(chunk_fd, block, (int)block_size, forwarded);
+        if (read_result <= 0) {
+          if (read_result < 0) {
+            result = started ? JfrChunkSink::TRUNCATED : JfrChunkSink::SKIPPED;
+          }
+          break;
+        }
+        result = write_to_sink(sink_fd, block, (size_t)read_result, &started);
+        forwarded += read_result;
+      }
+    }
+    JfrChunkSink::close(sink_fd);
+    if (result == JfrChunkSink::WRITTEN) {
+      log_debug(jfr, system)("Forwarded chunk %s to %s as " SIZE_FORMAT " bytes", chunk_path, FlightRecorderChunkSink,
+                             compressed != nullptr ? compressed_size : (size_t)forwarded);
+    } else if (result == JfrChunkSink::SKIPPED) {
+      log_info(jfr)("Chunk sink %s is not accepting data, chunk %s skipped", FlightRecorderChunkSink, chunk_path);
+    } else {
+      log_warning(jfr)("Chunk %s was only partly written to %s, forwarding disabled", chunk_path, FlightRecorderChunkSink);
+      _sink_mode = SINK_DISABLED;
+    }
+  }
+  os::free(compressed);
+}
+
+// Append a completed chunk to -XX:FlightRecorderChunkSink. Where the platform
+// allows, the sink is opened and written without blocking, so the recorder
+// thread does not hang on a named pipe without a reader or with a stalled
+// one: such chunks are skipped and remain in the repository. A regular file sink grows without bound; it
+// is up to the consumer to rotate or truncate it.
+static void forward_chunk(const char* chunk_path) {
+  static const size_t block_size = 1 * M;
+  if (_sink_mode == SINK_DISABLED) {
+    return;
+  }
+  if (_sink_mode == SINK_UNDECIDED) {
+    _sink_mode = SINK_RAW;
+    if (FlightRecorderChunkSinkCompression > 0) {
+      ChunkSinkCompressor probe(block_size, (int)FlightRecorderChunkSinkCompression);
+      if (probe.is_enabled()) {
+        _sink_mode = SINK_COMPRESSED;
+      } else {
+        log_info(jfr)("Chunk sink %s receives uncompressed chunks", FlightRecorderChunkSink);
+      }
+    }
+  }
+
+  const int chunk_fd = os::open(chunk_path, O_RDONLY, 0);
+  char* const block = (char*)os::malloc(block_size, mtTracing);
+  if (chunk_fd != -1 && block != nullptr) {
+    forward_chunk_data(chunk_path, chunk_fd, block, block_size);
+  }
+  os::free(block);
+  if (chunk_fd != -1) {
+    JfrChunkSink::close(chunk_fd);
+  }
+}
+
+size_t JfrRepository::close_chunk(bool vm_shutdown /* false */) {
+  const size_t size = _chunkwriter->close();
+  if (_open_chunk_path != nullptr) {
+    // The final chunk at VM exit or on a crash stays in the repository, so
+    // that shutdown never waits on the sink. The recorder passes vm_shutdown
+    // once the chunk has been marked final by the shutdown hook or on a crash.
+    if (!vm_shutdown && !VMError::is_error_reported()) {
+      forward_chunk(_open_chunk_path);
+    }
+    os::free(_open_chunk_path);
+    _open_chunk_path = nullptr;
+  }
+  return size;
 }
 
 void JfrRepository::flush(JavaThread* jt) {
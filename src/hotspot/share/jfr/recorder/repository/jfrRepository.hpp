@@ -55,7 +55,7 @@ class JfrRepository : public JfrCHeapObj {
   bool set_path(const char* path);
   void set_chunk_path(const char* path);
   bool open_chunk(bool vm_error = false);
-  size_t close_chunk();
+  size_t close_chunk(bool vm_shutdown = false);
   size_t flush_chunk();
   void on_vm_error();
 
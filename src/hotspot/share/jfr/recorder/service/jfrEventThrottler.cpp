@@ -27,6 +27,7 @@
 #include "jfr/recorder/service/jfrEventThrottler.hpp"
 #include "jfr/utilities/jfrSpinlockHelper.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 
 constexpr static const JfrSamplerParams _disabled_params = {
                                                              0, // sample points per window
@@ -35,7 +36,17 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = nullptr;
+// Throttlers are indexed by event id. The ones for jdk.ObjectAllocationSample and
+// jdk.NativeAllocationSample are created eagerly; throttlers for other event
+// types with a throttle setting are created on first configuration and live
+// until the recorder is destroyed.
+static JfrEventThrottler* _throttlers[LAST_EVENT_ID + 1] = { nullptr };
+static volatile int _throttlers_lock = 0;
+
+// jdk.NativeAllocationSample is sampled inside os::malloc and is never left
+// unthrottled. This rate applies until a recording configures one, and when
+// a recording turns the throttle off.
+constexpr static const int64_t native_allocation_sample_default_rate = 100; // per second
 
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
@@ -43,35 +54,74 @@ JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   _sample_size(0),
   _period_ms(0),
   _sample_size_ewma(0),
+  _total_population(0),
+  _total_samples(0),
+  _ms_since_statistics(0),
   _event_id(event_id),
   _disabled(false),
   _update(false) {}
 
 bool JfrEventThrottler::create() {
-  assert(_throttler == nullptr, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != nullptr && _throttler->initialize();
+  const JfrEventId eager[] = { JfrObjectAllocationSampleEvent, JfrNativeAllocationSampleEvent };
+  for (JfrEventId event_id : eager) {
+    assert(_throttlers[event_id] == nullptr, "invariant");
+    JfrEventThrottler* const throttler = new JfrEventThrottler(event_id);
+    if (throttler == nullptr || !throttler->initialize()) {
+      delete throttler;
+      return false;
+    }
+    Atomic::release_store(&_throttlers[event_id], throttler);
+  }
+  _throttlers[JfrNativeAllocationSampleEvent]->configure(native_allocation_sample_default_rate, MILLIUNITS);
+  return true;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = nullptr;
+  for (size_t i = FIRST_EVENT_ID; i <= LAST_EVENT_ID; ++i) {
+    JfrEventThrottler* const throttler = _throttlers[i];
+    if (throttler != nullptr) {
+      throttler->log_statistics();
+      _throttlers[i] = nullptr;
+      delete throttler;
+    }
+  }
+}
+
+inline bool is_valid(JfrEventId event_id) {
+  return (unsigned)event_id >= FIRST_EVENT_ID && (unsigned)event_id <= LAST_EVENT_ID;
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
+// Lock-free lookup, called for every throttled event before any stack trace is captured.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : nullptr;
+  assert(is_valid(event_id), "invariant");
+  return Atomic::load_acquire(&_throttlers[event_id]);
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if (!is_valid(event_id)) {
     return;
   }
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  if (event_id == JfrNativeAllocationSampleEvent && sample_size < 0) {
+    sample_size = native_allocation_sample_default_rate;
+    period_ms = MILLIUNITS;
+  }
+  JfrEventThrottler* throttler = for_event(event_id);
+  if (throttler == nullptr) {
+    JfrSpinlockHelper mutex(&_throttlers_lock);
+    throttler = _throttlers[event_id];
+    if (throttler == nullptr) {
+      throttler = new JfrEventThrottler(event_id);
+      if (throttler == nullptr || !throttler->initialize()) {
+        log_warning(jfr, system, throttle)("Unable to create throttler for event type %u", (unsigned)event_id);
+        delete throttler;
+        return;
+      }
+      throttler->configure(sample_size, period_ms);
+      Atomic::release_store(&_throttlers[event_id], throttler);
+      return;
+    }
+  }
+  throttler->configure(sample_size, period_ms);
 }
 
 /*
@@ -94,7 +144,7 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == nullptr) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -236,25 +286,29 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Excerpt:
  *
- * "jdk.ObjectAllocationSample: avg.sample size: 19.8377, window set point: 20 ..."
+ * "Event type 123: avg.sample size: 19.8377, window set point: 20 ..."
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
  *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
+ * The event name is not known to the VM, so the event type id is logged instead.
+ * The id of jdk.ObjectAllocationSample is JfrObjectAllocationSampleEvent.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(JfrEventId event_id, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != nullptr, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(static_cast<double>(expired->sample_size()), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("Event type %u: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      (unsigned)event_id, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : static_cast<double>(expired->sample_size()) / static_cast<double>(expired->population_size()),
       expired->params().window_duration_ms);
   }
 }
 
+// The totals are logged on jfr+system+throttle=info after at least this much
+// expired window time, and at shutdown.
+constexpr static const int64_t statistics_log_interval_ms = MINUTE;
+
 /*
  * This is the feedback control loop.
  *
@@ -268,9 +322,23 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != nullptr, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  // Totals are accumulated here, under the rotation lock, to keep the accept path free of shared counters.
+  _total_population += expired->population_size();
+  _total_samples += expired->sample_size();
+  _ms_since_statistics += static_cast<int64_t>(expired->params().window_duration_ms);
+  if (_ms_since_statistics >= statistics_log_interval_ms) {
+    log_statistics();
+    _ms_since_statistics = 0;
+  }
+  log(_event_id, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
   return _disabled ? _disabled_params : _last_params;
 }
+
+void JfrEventThrottler::log_statistics() const {
+  log_info(jfr, system, throttle)("Event type %u: accepted " UINT64_FORMAT " of " UINT64_FORMAT " events (%.2f%%) in expired windows",
+                                  (unsigned)_event_id, _total_samples, _total_population,
+                                  _total_population == 0 ? 100.0 : 100.0 * static_cast<double>(_total_samples) / static_cast<double>(_total_population));
+}
@@ -36,6 +36,9 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
   int64_t _sample_size;
   int64_t _period_ms;
   double _sample_size_ewma;
+  uint64_t _total_population;
+  uint64_t _total_samples;
+  int64_t _ms_since_statistics;
   JfrEventId _event_id;
   bool _disabled;
   bool _update;
@@ -44,6 +47,7 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
   static void destroy();
   JfrEventThrottler(JfrEventId event_id);
   void configure(int64_t event_sample_size, int64_t period_ms);
+  void log_statistics() const;
 
   const JfrSamplerParams& update_params(const JfrSamplerWindow* expired);
   const JfrSamplerParams& next_window_params(const JfrSamplerWindow* expired);
@@ -520,7 +520,7 @@ void JfrRecorderService::vm_error_rotation() {
     JfrDeprecationManager::write_edges(_chunkwriter, thread, true);
     invoke_flush();
     _chunkwriter.set_time_stamp();
-    _repository.close_chunk();
+    _repository.close_chunk(true /* vm_shutdown */);
     assert(!_chunkwriter.is_valid(), "invariant");
     _repository.on_vm_error();
   }
@@ -618,7 +618,8 @@ void JfrRecorderService::post_safepoint_write() {
   }
   // serialize the metadata descriptor event and close out the chunk
   write_metadata(_chunkwriter);
-  _repository.close_chunk();
+  // The shutdown hook marks the last chunk final before it stops the recordings.
+  _repository.close_chunk(_chunkwriter.is_chunk_final() /* vm_shutdown */);
 }
 
 static JfrBuffer* thread_local_buffer(Thread* t) {
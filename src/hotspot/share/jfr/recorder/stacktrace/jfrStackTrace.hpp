@@ -81,6 +81,7 @@ class JfrStackTrace : public JfrCHeapObj {
   mutable bool _written;
 
   const JfrStackTrace* next() const { return _next; }
+  void set_next(const JfrStackTrace* next) { _next = next; }
 
   bool should_write() const { return !_written; }
   void write(JfrChunkWriter& cw) const;
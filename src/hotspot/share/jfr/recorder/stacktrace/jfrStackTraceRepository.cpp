@@ -202,13 +202,23 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   assert(stacktrace._nr_of_frames > 0, "invariant");
   const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
+  JfrStackTrace* prev = nullptr;
+  JfrStackTrace* table_entry = _table[index];
 
   while (table_entry != nullptr) {
     if (table_entry->equals(stacktrace)) {
+      // Events tend to repeat the same few traces. Move a hit to the front of its
+      // bucket so that the next lookup for it is short. Not done for the leak
+      // profiler instance, whose buckets are searched without holding the lock.
+      if (prev != nullptr && this != _leak_profiler_instance) {
+        prev->set_next(table_entry->next());
+        table_entry->set_next(_table[index]);
+        _table[index] = table_entry;
+      }
       return table_entry->id();
     }
-    table_entry = table_entry->next();
+    prev = table_entry;
+    table_entry = const_cast<JfrStackTrace*>(table_entry->next());
   }
 
   if (!stacktrace.have_lineno()) {
@@ -45,7 +45,7 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   friend class StackTraceRepository;
 
  private:
-  static const u4 TABLE_SIZE = 2053;
+  static const u4 TABLE_SIZE = 8191;
   JfrStackTrace* _table[TABLE_SIZE];
   u4 _last_entries;
   u4 _entries;
@@ -44,6 +44,7 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
 
 typedef JfrStorage::BufferPtr BufferPtr;
@@ -92,6 +93,7 @@ JfrStorage::~JfrStorage() {
 }
 
 static const size_t thread_local_cache_count = 8;
+static const size_t thread_local_cache_count_max = 64;
 // start to discard data when the only this number of free buffers are left
 static const size_t in_memory_discard_threshold_delta = 2;
 
@@ -118,8 +120,14 @@ bool JfrStorage::initialize() {
     return false;
   }
   assert(_global_mspace->live_list_is_nonempty(), "invariant");
+  // On many-core hosts more threads concurrently hold and recycle thread local buffers.
+  // Let the free list retain up to one buffer per processor, so that released buffers are
+  // reused instead of being freed and re-allocated, but only preallocate the base count.
+  const size_t thread_local_cache_limit = clamp<size_t>(os::active_processor_count(),
+                                                        thread_local_cache_count,
+                                                        thread_local_cache_count_max);
   _thread_local_mspace = create_mspace<JfrThreadLocalMspace>(thread_buffer_size,
-                                                             thread_local_cache_count, // cache count limit
+                                                             thread_local_cache_limit, // cache count limit
                                                              thread_local_cache_count, // cache preallocate count
                                                              true,  // preallocate_to_free_list
                                                              this);
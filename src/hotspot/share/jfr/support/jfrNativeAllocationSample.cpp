@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/recorder/service/jfrEventThrottler.hpp"
+#include "jfr/support/jfrNativeAllocationSample.hpp"
+#include "jfr/support/jfrThreadId.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "jfr/utilities/jfrSpinlockHelper.hpp"
+#include "jfr/utilities/jfrThreadIterator.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/javaThread.hpp"
+
+bool JfrNativeAllocationSampleBuffer::add(const JfrNativeAllocationSampleData& sample) {
+  uint count = Atomic::load(&_count);
+  while (count < capacity) {
+    _samples[count] = sample;
+    const uint prev = Atomic::cmpxchg(&_count, count, count + 1);
+    if (prev == count) {
+      return true;
+    }
+    // Drained in between, retry at the start of the now empty buffer.
+    assert(prev == 0, "only a drain changes the count of another thread");
+    count = prev;
+  }
+  return false;
+}
+
+uint JfrNativeAllocationSampleBuffer::drain(JfrNativeAllocationSampleData* samples) {
+  uint count = Atomic::load_acquire(&_count);
+  while (count > 0) {
+    for (uint i = 0; i < count; i++) {
+      samples[i] = _samples[i];
+    }
+    const uint prev = Atomic::cmpxchg(&_count, count, 0u);
+    if (prev == count) {
+      break;
+    }
+    // The owner appended in between, the slots already copied are unchanged.
+    assert(prev > count, "invariant");
+    count = prev;
+  }
+  return count;
+}
+
+void JfrNativeAllocationSample::record(size_t size, MemTag mem_tag) {
+  if (!EventNativeAllocationSample::is_enabled() || mem_tag == mtTracing) {
+    return;
+  }
+  Thread* const thread = Thread::current_or_null();
+  if (thread == nullptr || !thread->is_Java_thread()) {
+    return;
+  }
+  JfrNativeAllocationSampleBuffer* const buffer = thread->jfr_thread_local()->native_allocation_samples();
+  if (buffer->_in_record) {
+    return;
+  }
+  buffer->_in_record = true;
+  buffer->_unsampled_bytes += size;
+  // A full buffer drops the sample, its bytes weigh into the next one instead.
+  if (Atomic::load(&buffer->_count) < JfrNativeAllocationSampleBuffer::capacity) {
+    const JfrTicks now = JfrTicks::now();
+    if (JfrEventThrottler::accept(JfrNativeAllocationSampleEvent, now.value())) {
+      const JfrNativeAllocationSampleData sample = { now, size, buffer->_unsampled_bytes, mem_tag };
+      if (buffer->add(sample)) {
+        buffer->_unsampled_bytes = 0;
+      }
+    }
+  }
+  buffer->_in_record = false;
+}
+
+// Serializes drains, the periodic events can be requested by different threads.
+static volatile int _send_events_lock = 0;
+
+void JfrNativeAllocationSample::send_events() {
+  JfrSpinlockHelper lock(&_send_events_lock);
+  Thread* const periodic_thread = Thread::current();
+  const traceid periodic_thread_id = JfrThreadLocal::thread_id(periodic_thread);
+  JfrNativeAllocationSampleData samples[JfrNativeAllocationSampleBuffer::capacity];
+  JfrJavaThreadIterator iter;
+  while (iter.has_next()) {
+    JavaThread* const jt = iter.next();
+    assert(jt != nullptr, "invariant");
+    const uint count = jt->jfr_thread_local()->native_allocation_samples()->drain(samples);
+    if (count == 0) {
+      continue;
+    }
+    // Commit reads the thread id from this thread's trace data, so put it there temporarily
+    JfrThreadLocal::impersonate(periodic_thread, jt != periodic_thread ? JFR_JVM_THREAD_ID(jt) : periodic_thread_id);
+    for (uint i = 0; i < count; i++) {
+      const JfrNativeAllocationSampleData& sample = samples[i];
+      // Untimed, since the sample was already throttled when it was taken.
+      EventNativeAllocationSample event(UNTIMED);
+      event.set_starttime(sample._ticks);
+      event.set_type(NMTUtil::tag_to_index(sample._mem_tag));
+      event.set_allocationSize(sample._size);
+      event.set_weight(sample._weight);
+      event.commit();
+    }
+  }
+  JfrThreadLocal::stop_impersonating(periodic_thread);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
+#define SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
+
+#include "jfr/utilities/jfrTime.hpp"
+#include "memory/allStatic.hpp"
+#include "nmt/memTag.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// A native allocation sampled by os::malloc.
+struct JfrNativeAllocationSampleData {
+  JfrTicks _ticks;
+  size_t _size;
+  size_t _weight;
+  MemTag _mem_tag;
+};
+
+// The samples taken by one thread and not yet committed. The owner thread
+// appends and the periodic task drains, both by a CAS on _count. The owner
+// only writes the slot at the current count, so a drain can copy the slots
+// below it without racing with the owner.
+class JfrNativeAllocationSampleBuffer {
+  friend class JfrNativeAllocationSample;
+ public:
+  static const uint capacity = 16;
+ private:
+  JfrNativeAllocationSampleData _samples[capacity];
+  volatile uint _count;
+  // Bytes allocated by the owner since its last sample, reported as the
+  // weight of the next one. Only accessed by the owner.
+  size_t _unsampled_bytes;
+  // Guards against sampling allocations made while recording a sample.
+  bool _in_record;
+
+ public:
+  JfrNativeAllocationSampleBuffer() : _count(0), _unsampled_bytes(0), _in_record(false) {}
+
+  // Owner thread only. Returns false if the buffer is full.
+  bool add(const JfrNativeAllocationSampleData& sample);
+  // Removes all samples, copying them to samples, which must have room for
+  // capacity entries. Returns the number of samples copied.
+  uint drain(JfrNativeAllocationSampleData* samples);
+};
+
+// Feeds the throttled jdk.NativeAllocationSample event from os::malloc.
+// A malloc site may hold locks, be in a critical region or be in the middle
+// of a state change, so os::malloc only records the sample in the thread's
+// buffer. The events are committed from the periodic task.
+class JfrNativeAllocationSample : AllStatic {
+ public:
+  static void record(size_t size, MemTag mem_tag);
+  static void send_events();
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
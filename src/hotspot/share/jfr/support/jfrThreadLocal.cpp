@@ -66,6 +66,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _stack_trace_hash(0),
   _parent_trace_id(0),
   _last_allocated_bytes(0),
+  _native_allocation_samples(),
   _user_time(0),
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
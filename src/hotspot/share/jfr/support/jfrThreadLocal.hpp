@@ -25,6 +25,7 @@
 #ifndef SHARE_JFR_SUPPORT_JFRTHREADLOCAL_HPP
 #define SHARE_JFR_SUPPORT_JFRTHREADLOCAL_HPP
 
+#include "jfr/support/jfrNativeAllocationSample.hpp"
 #include "jfr/utilities/jfrBlob.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
 
@@ -59,6 +60,7 @@ class JfrThreadLocal {
   traceid _stack_trace_hash;
   traceid _parent_trace_id;
   int64_t _last_allocated_bytes;
+  JfrNativeAllocationSampleBuffer _native_allocation_samples;
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
@@ -163,6 +165,10 @@ class JfrThreadLocal {
     set_last_allocated_bytes(0);
   }
 
+  JfrNativeAllocationSampleBuffer* native_allocation_samples() {
+    return &_native_allocation_samples;
+  }
+
   // Contextually defined thread id that is volatile,
   // a function of Java carrier thread mounts / unmounts.
   static traceid thread_id(const Thread* t);
@@ -81,8 +81,13 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The writer only waits while no data is available, so only the first message
+  // after a swap needs to wake it. Later ones are picked up by the same swap
+  // and do not pay for a notify while holding the lock.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
@@ -88,6 +88,7 @@ void LogConfiguration::post_initialize() {
   }
 
   LogDiagnosticCommand::registerCommand();
+  LogTagSet::initialize_rate_limit();
   Log(logging) log;
   if (log.is_info()) {
     log.info("Log configuration fully initialized.");
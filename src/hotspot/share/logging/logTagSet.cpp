@@ -32,6 +32,10 @@
 #include "logging/logTagSet.hpp"
 #include "logging/logTagSetDescriptions.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "runtime/task.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
 
@@ -41,7 +45,7 @@ size_t      LogTagSet::_ntagsets  = 0;
 // This constructor is called only during static initialization.
 // See the declaration in logTagSet.hpp for more information.
 LogTagSet::LogTagSet(PrefixWriter prefix_writer, LogTagType t0, LogTagType t1, LogTagType t2, LogTagType t3, LogTagType t4)
-    : _next(_list), _write_prefix(prefix_writer) {
+    : _next(_list), _write_prefix(prefix_writer), _rate_window(0), _rate_count(0), _rate_suppressed(0), _rate_suppressed_level(LogLevel::Off) {
   _tag[0] = t0;
   _tag[1] = t1;
   _tag[2] = t2;
@@ -118,12 +122,76 @@ void LogTagSet::write(LogLevelType level, const char* fmt, ...) {
 
 const size_t vwrite_buffer_size = 512;
 
+// Messages are counted in one second windows. Whoever moves the tag set into
+// a new window, the first message in it or the periodic task below, resets
+// the count and reports how many messages were dropped in the earlier ones.
+int64_t LogTagSet::current_rate_window() {
+  return os::javaTimeNanos() / NANOSECS_PER_SEC;
+}
+
+void LogTagSet::advance_rate_window(int64_t window) {
+  const int64_t current = Atomic::load(&_rate_window);
+  if (window != current && Atomic::cmpxchg(&_rate_window, current, window) == current) {
+    Atomic::store(&_rate_count, 0u);
+    const size_t suppressed = Atomic::xchg(&_rate_suppressed, (size_t)0);
+    if (suppressed > 0) {
+      char buf[64];
+      os::snprintf_checked(buf, sizeof(buf), "Suppressed %zu messages (LogRateLimit)", suppressed);
+      log(static_cast<LogLevelType>(Atomic::load(&_rate_suppressed_level)), buf);
+    }
+  }
+}
+
+bool LogTagSet::is_rate_limited(LogLevelType level, int64_t window) {
+  advance_rate_window(window);
+  if (Atomic::add(&_rate_count, 1u) > LogRateLimit) {
+    Atomic::store(&_rate_suppressed_level, static_cast<uint>(level));
+    Atomic::inc(&_rate_suppressed);
+    return true;
+  }
+  return false;
+}
+
+void LogTagSet::report_rate_limited() {
+  const int64_t window = current_rate_window();
+  for (LogTagSet* ts = first(); ts != nullptr; ts = ts->next()) {
+    if (Atomic::load(&ts->_rate_suppressed) > 0) {
+      ts->advance_rate_window(window);
+    }
+  }
+}
+
+// Reports drops of windows that have ended, when no further message on the
+// tag set does so.
+class LogRateLimitTask : public PeriodicTask {
+ public:
+  LogRateLimitTask() : PeriodicTask(MILLIUNITS) {}
+  void task() override { LogTagSet::report_rate_limited(); }
+};
+
+void LogTagSet::initialize_rate_limit() {
+  if (LogRateLimit > 0) {
+    (new LogRateLimitTask())->enroll();
+  }
+}
+
 void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   assert(level >= LogLevel::First && level <= LogLevel::Last, "Log level:%d is incorrect", level);
+  // Reject before any formatting.
+  if (LogRateLimit > 0 && is_rate_limited(level, current_rate_window())) {
+    return;
+  }
   char buf[vwrite_buffer_size];
   va_list saved_args;           // For re-format on buf overflow.
   va_copy(saved_args, args);
   size_t prefix_len = _write_prefix(buf, sizeof(buf));
+  if (prefix_len == 0 && strchr(fmt, '%') == nullptr) {
+    // Nothing to format, the format string is the message.
+    // Decorations are already resolved lazily by the outputs.
+    log(level, fmt);
+    va_end(saved_args);
+    return;
+  }
   // Check that string fits in buffer; resize buffer if necessary
   int ret;
   if (prefix_len < vwrite_buffer_size) {
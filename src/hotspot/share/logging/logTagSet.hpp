@@ -53,6 +53,16 @@ class LogTagSet {
   typedef size_t (*PrefixWriter)(char* buf, size_t size);
   PrefixWriter _write_prefix;
 
+  // Rate limiting state, see LogRateLimit.
+  volatile int64_t _rate_window;
+  volatile uint _rate_count;
+  volatile size_t _rate_suppressed;
+  volatile uint _rate_suppressed_level;  // LogLevelType of the last dropped message
+
+  static int64_t current_rate_window();
+  void advance_rate_window(int64_t window);
+  bool is_rate_limited(LogLevelType level, int64_t window);
+
   // Keep constructor private to prevent incorrect instantiations of this class.
   // Only LogTagSetMappings can create/contain instances of this class.
   // The constructor links all tagsets together in a global list of tagsets.
@@ -64,6 +74,14 @@ class LogTagSet {
   friend class LogTagSetMapping;
 
  public:
+  // Starts the periodic task that reports drops under LogRateLimit.
+  static void initialize_rate_limit();
+  // Reports, for each tag set, the messages dropped in rate limiting
+  // windows that have ended.
+  static void report_rate_limited();
+
+  class TestSupport;            // For unit tests
+
   static void describe_tagsets(outputStream* out);
   static void list_all_tagsets(outputStream* out);
 
@@ -25,6 +25,8 @@
 
 #include "precompiled.hpp"
 #include "compiler/compilationMemoryStatistic.hpp"
+#include "compiler/compilerThread.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/arena.hpp"
@@ -144,10 +146,16 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
 
   assert(is_aligned(length, ARENA_AMALLOC_ALIGNMENT), "chunk payload length misaligned: "
          SIZE_FORMAT ".", length);
+  Chunk* chunk = nullptr;
+  ChunkCache* cache = ChunkCache::current();
+  if (cache != nullptr) {
+    // Reuse a chunk the current thread has freed before
+    length = ChunkCache::cached_length(length);
+    chunk = cache->take(length);
+  }
   // Try to reuse a freed chunk from the pool
   ChunkPool* pool = ChunkPool::get_pool_for_size(length);
-  Chunk* chunk = nullptr;
-  if (pool != nullptr) {
+  if (chunk == nullptr && pool != nullptr) {
     Chunk* c = pool->take_from_pool();
     if (c != nullptr) {
       assert(c->length() == length, "wrong length?");
@@ -170,6 +178,11 @@ Chunk* ChunkPool::allocate_chunk(size_t length, AllocFailType alloc_failmode) {
 }
 
 void ChunkPool::deallocate_chunk(Chunk* c) {
+  ChunkCache* cache = ChunkCache::current();
+  if (cache != nullptr) {
+    cache->put(c);
+    return;
+  }
   // If this is a standard-sized chunk, return it to its pool; otherwise free it.
   ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
   if (pool != nullptr) {
@@ -182,6 +195,110 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
 
 ChunkPool ChunkPool::_pools[] = { Chunk::size, Chunk::medium_size, Chunk::init_size, Chunk::tiny_size };
 
+ChunkCache::ChunkCache() : _large(nullptr), _cached_bytes(0) {
+  for (int i = 0; i < _num_standard; i++) {
+    _standard[i] = nullptr;
+  }
+}
+
+ChunkCache::~ChunkCache() {
+  trim(0);
+}
+
+ChunkCache* ChunkCache::current() {
+  Thread* t = Thread::current_or_null();
+  if (t == nullptr) {
+    return nullptr;
+  }
+  if (t->is_Compiler_thread()) {
+    return CompilerThread::cast(t)->chunk_cache();
+  }
+  if (t->is_Worker_thread()) {
+    return WorkerThread::cast(t)->chunk_cache();
+  }
+  return nullptr;
+}
+
+int ChunkCache::standard_index(size_t length) {
+  switch (length) {
+    case Chunk::tiny_size:   return 0;
+    case Chunk::init_size:   return 1;
+    case Chunk::medium_size: return 2;
+    case Chunk::size:        return 3;
+    default:                 return -1;
+  }
+}
+
+size_t ChunkCache::cached_length(size_t length) {
+  if (length <= Chunk::size) {
+    return length;
+  }
+  // Round the allocation up to an eighth of the next power of two, so that
+  // requests of similar size map to the same length, wasting at most 25%.
+  const size_t overhead = Chunk::aligned_overhead_size();
+  const size_t granule = round_up_power_of_2(length + overhead) / 8;
+  return align_up(length + overhead, granule) - overhead;
+}
+
+Chunk* ChunkCache::take(size_t length) {
+  Chunk** prev = list_for(length);
+  for (Chunk* c = *prev; c != nullptr; prev = c->next_addr(), c = c->next()) {
+    if (c->length() == length) {
+      *prev = c->next();
+      _cached_bytes -= length;
+      return c;
+    }
+  }
+  return nullptr;
+}
+
+void ChunkCache::put(Chunk* c) {
+  Chunk** list = list_for(c->length());
+  c->set_next(*list);
+  *list = c;
+  _cached_bytes += c->length();
+}
+
+void ChunkCache::trim(size_t limit) {
+  size_t kept = 0;
+  Chunk* to_free = nullptr;
+  auto trim_list = [&](Chunk** list, bool disclaim) {
+    Chunk** prev = list;
+    for (Chunk* c = *list; c != nullptr; c = *prev) {
+      if (kept + c->length() <= limit) {
+        kept += c->length();
+        if (disclaim) {
+          char* start = align_up(c->bottom(), os::vm_page_size());
+          char* end = align_down(c->top(), os::vm_page_size());
+          if (start < end) {
+            os::disclaim_memory_lazily(start, pointer_delta(end, start, 1));
+          }
+        }
+        prev = c->next_addr();
+      } else {
+        *prev = c->next();
+        c->set_next(to_free);
+        to_free = c;
+      }
+    }
+  };
+  // Standard chunks are small and needed by every compilation, keep them first.
+  for (int i = _num_standard - 1; i >= 0; i--) {
+    trim_list(&_standard[i], false);
+  }
+  trim_list(&_large, true);
+  _cached_bytes = kept;
+
+  if (to_free != nullptr) {
+    ThreadCritical tc;  // Free chunks under TC lock so that NMT adjustment is stable.
+    while (to_free != nullptr) {
+      Chunk* next = to_free->next();
+      os::free(to_free);
+      to_free = next;
+    }
+  }
+}
+
 class ChunkPoolCleaner : public PeriodicTask {
   static const int cleaning_interval = 5000; // cleaning interval in ms
 
@@ -234,7 +351,7 @@ Arena::Arena(MemTag mem_tag, Tag tag, size_t init_size) :
   _hwm = _chunk->bottom();      // Save the cached hwm, max
   _max = _chunk->top();
   MemTracker::record_new_arena(mem_tag);
-  set_size_in_bytes(init_size);
+  set_size_in_bytes(_chunk->length());
 }
 
 Arena::~Arena() {
@@ -305,7 +422,7 @@ void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   }
   _hwm  = _chunk->bottom();     // Save the cached hwm, max
   _max =  _chunk->top();
-  set_size_in_bytes(size_in_bytes() + len);
+  set_size_in_bytes(size_in_bytes() + _chunk->length());
   void* result = _hwm;
   _hwm += x;
   return result;
@@ -76,6 +76,7 @@ class Chunk {
 
   size_t length() const         { return _len;  }
   Chunk* next() const           { return _next;  }
+  Chunk** next_addr()           { return &_next; }
   void set_next(Chunk* n)       { _next = n;  }
   // Boundaries of data area (possibly unused)
   char* bottom() const          { return ((char*) this) + aligned_overhead_size();  }
@@ -83,6 +84,47 @@ class Chunk {
   bool contains(char* p) const  { return bottom() <= p && p <= top(); }
 };
 
+// Cache of freed chunks, owned by a single compiler or GC worker thread. Compilations
+// and GC tasks build and tear down arenas; keeping the chunks for the next compilation
+// or task avoids the global ChunkPool lock and malloc/free churn. Non-standard sized
+// chunks are handed out in rounded lengths so that they can be reused for similar
+// requests. When its thread goes idle the cache is trimmed back to a high watermark, and
+// the payload of the large chunks it keeps is disclaimed lazily: the pages stay
+// reusable, but the OS may reclaim them under memory pressure.
+class ChunkCache : public CHeapObj<mtChunk> {
+  static constexpr int _num_standard = 4;
+  Chunk* _standard[_num_standard];  // one list per standard chunk size
+  Chunk* _large;                    // all other chunks
+  size_t _cached_bytes;
+
+  static int standard_index(size_t length);
+  Chunk** list_for(size_t length) {
+    int i = standard_index(length);
+    return i >= 0 ? &_standard[i] : &_large;
+  }
+
+ public:
+  ChunkCache();
+  ~ChunkCache();
+  NONCOPYABLE(ChunkCache);
+
+  // The cache of the current thread, or null.
+  static ChunkCache* current();
+
+  // Payload length of the chunk handed out for a request of the given length.
+  static size_t cached_length(size_t length);
+
+  // Returns a cached chunk of exactly this length, or null.
+  Chunk* take(size_t length);
+  void put(Chunk* c);
+
+  // Free cached chunks beyond the given number of bytes, and lazily disclaim the
+  // payload of the large chunks that are kept.
+  void trim(size_t limit);
+
+  size_t cached_bytes() const { return _cached_bytes; }
+};
+
 #define DO_ARENA_TAG(FN) \
   FN(other, Others, Other arenas) \
   FN(ra, RA, Resource areas) \
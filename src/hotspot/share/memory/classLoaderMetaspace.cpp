@@ -68,7 +68,9 @@ ClassLoaderMetaspace::ClassLoaderMetaspace(Mutex* lock, Metaspace::MetaspaceType
   _lock(lock),
   _space_type(space_type),
   _non_class_space_arena(nullptr),
-  _class_space_arena(nullptr)
+  _class_space_arena(nullptr),
+  _num_allocs(0),
+  _num_contended_allocs(0)
 {
   // Initialize non-class Arena
   _non_class_space_arena = new MetaspaceArena(
@@ -101,7 +103,14 @@ ClassLoaderMetaspace::~ClassLoaderMetaspace() {
 // Allocate word_size words from Metaspace.
 MetaWord* ClassLoaderMetaspace::allocate(size_t word_size, Metaspace::MetadataType mdType) {
   word_size = align_up(word_size, Metaspace::min_allocation_word_size);
+  // Sample whether the arena lock is held on entry, so that we can tell how
+  // often concurrent class loading threads of the same loader serialize on it.
+  const bool contended = lock()->is_locked();
   MutexLocker fcl(lock(), Mutex::_no_safepoint_check_flag);
+  _num_allocs++;
+  if (contended) {
+    _num_contended_allocs++;
+  }
   MetaBlock result, wastage;
   const bool is_class = have_class_space_arena() && mdType == Metaspace::ClassType;
   if (is_class) {
@@ -180,6 +189,8 @@ void ClassLoaderMetaspace::add_to_statistics(metaspace::ClmsStats* out) const {
   if (class_space_arena() != nullptr) {
     class_space_arena()->add_to_statistics(&out->_arena_stats_class);
   }
+  out->_num_allocs += _num_allocs;
+  out->_num_contended_allocs += _num_contended_allocs;
 }
 
 #ifdef ASSERT
@@ -74,6 +74,11 @@ class ClassLoaderMetaspace : public CHeapObj<mtClass> {
   //  (null if -XX:-UseCompressedClassPointers).
   metaspace::MetaspaceArena* _class_space_arena;
 
+  // Number of allocations, and how many of them found the lock already
+  // held by another thread. Both are only modified under _lock.
+  uint64_t _num_allocs;
+  uint64_t _num_contended_allocs;
+
   Mutex* lock() const                             { return _lock; }
   metaspace::MetaspaceArena* non_class_space_arena() const   { return _non_class_space_arena; }
   metaspace::MetaspaceArena* class_space_arena() const       { return _class_space_arena; }
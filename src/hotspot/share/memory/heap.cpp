@@ -26,6 +26,7 @@
 #include "memory/heap.hpp"
 #include "memory/memoryReserver.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
@@ -191,6 +192,11 @@ static size_t align_to_page_size(size_t size) {
 
 
 void CodeHeap::on_code_mapping(char* base, size_t size) {
+  if (UseNUMA && CodeCacheNUMAInterleave) {
+    // Spread instruction fetches over all nodes instead of the one that
+    // happens to touch the pages first.
+    os::numa_make_global(base, size);
+  }
 #ifdef LINUX
   extern void linux_wrap_code(char* base, size_t size);
   linux_wrap_code(base, size);
@@ -349,7 +355,11 @@ void CodeHeap::deallocate_tail(void* p, size_t used_size) {
   guarantee(used_number_of_segments <= actual_number_of_segments, "Must be!");
 
   HeapBlock* f = split_block(b, used_number_of_segments);
+  bool at_top = ends_at_next_segment(f);
   add_to_freelist(f);
+  if (at_top) {
+    release_free_tail();
+  }
   NOT_PRODUCT(verify());
 }
 
@@ -364,7 +374,11 @@ void CodeHeap::deallocate(void* p) {
             "The block to be deallocated " PTR_FORMAT " is not within the heap "
             "starting with "  PTR_FORMAT " and ending with " PTR_FORMAT,
             p2i(b), p2i(_memory.low_boundary()), p2i(_memory.high()));
+  bool at_top = ends_at_next_segment(b);
   add_to_freelist(b);
+  if (at_top) {
+    release_free_tail();
+  }
   NOT_PRODUCT(verify());
 }
 
@@ -643,6 +657,40 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
   _last_insert_point = prev;
 }
 
+// Give the last free block back to the unallocated tail of the heap if it
+// ends at _next_segment. Without this, freeing the topmost blocks only grows
+// the freelist, while the contiguous space at the end of the heap, which
+// large allocations depend on, never grows back.
+void CodeHeap::release_free_tail() {
+  FreeBlock* prev = nullptr;
+  FreeBlock* last = _freelist;
+  if (last == nullptr) {
+    return;
+  }
+  while (last->link() != nullptr) {
+    prev = last;
+    last = last->link();
+  }
+  size_t beg = segment_for(last);
+  if (beg + last->length() != _next_segment) {
+    return;
+  }
+
+  if (prev == nullptr) {
+    _freelist = nullptr;
+  } else {
+    prev->set_link(nullptr);
+  }
+  if (_last_insert_point != nullptr && _last_insert_point >= last) {
+    _last_insert_point = nullptr;
+  }
+  _freelist_length--;
+  _freelist_segments -= last->length();
+  // Contents have already been invalidated by add_to_freelist().
+  mark_segmap_as_free(beg, _next_segment);
+  _next_segment = beg;
+}
+
 /**
  * Search freelist for an entry on the list with the best fit.
  * @return null, if no one was found
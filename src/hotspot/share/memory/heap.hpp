@@ -140,6 +140,8 @@ class CodeHeap : public CHeapObj<mtCode> {
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock* b);
+  void release_free_tail();
+  bool ends_at_next_segment(HeapBlock* b) const  { return segment_for(b) + b->length() == _next_segment; }
   HeapBlock* search_freelist(size_t length);
 
   // Iteration helpers
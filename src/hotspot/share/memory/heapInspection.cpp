@@ -34,6 +34,7 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "nmt/memTracker.hpp"
+#include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
@@ -96,24 +97,25 @@ const char* KlassInfoEntry::name() const {
   return name;
 }
 
-void KlassInfoEntry::print_on(outputStream* st) const {
+void KlassInfoEntry::print_on(outputStream* st, bool print_referenced) const {
   ResourceMark rm;
 
   // simplify the formatting (ILP32 vs LP64) - always cast the numbers to 64-bit
+  st->print(INT64_FORMAT_W(13) "  " UINT64_FORMAT_W(13) "  ",
+            (int64_t)_instance_count,
+            (uint64_t)_instance_words * HeapWordSize);
+  if (print_referenced) {
+    st->print(UINT64_FORMAT_W(13) "  ", (uint64_t)_referenced_words * HeapWordSize);
+  }
   ModuleEntry* module = _klass->module();
   if (module->is_named()) {
-    st->print_cr(INT64_FORMAT_W(13) "  " UINT64_FORMAT_W(13) "  %s (%s%s%s)",
-                 (int64_t)_instance_count,
-                 (uint64_t)_instance_words * HeapWordSize,
+    st->print_cr("%s (%s%s%s)",
                  name(),
                  module->name()->as_C_string(),
                  module->version() != nullptr ? "@" : "",
                  module->version() != nullptr ? module->version()->as_C_string() : "");
   } else {
-    st->print_cr(INT64_FORMAT_W(13) "  " UINT64_FORMAT_W(13) "  %s",
-                 (int64_t)_instance_count,
-                 (uint64_t)_instance_words * HeapWordSize,
-                 name());
+    st->print_cr("%s", name());
   }
 }
 
@@ -168,7 +170,7 @@ class KlassInfoTable::AllClassesFinder : public LockedClassesDo {
 };
 
 
-KlassInfoTable::KlassInfoTable(bool add_all_classes) {
+KlassInfoTable::KlassInfoTable(bool add_all_classes, bool record_referenced) : _record_referenced(record_referenced) {
   _size_of_instances_in_words = 0;
   _ref = (uintptr_t) Universe::boolArrayKlass();
   _buckets =
@@ -210,6 +212,28 @@ KlassInfoEntry* KlassInfoTable::lookup(Klass* k) {
   return e;
 }
 
+// Sums up the sizes of the objects directly referenced by an object. This is a
+// one level approximation of what an instance keeps alive, objects referenced
+// from several places are counted for each of them.
+class ReferencedSizeClosure : public BasicOopIterateClosure {
+  size_t _words;
+
+  template <typename T>
+  void do_oop_work(T* p) {
+    const oop o = HeapAccess<AS_NO_KEEPALIVE>::oop_load(p);
+    if (o != nullptr) {
+      _words += o->size();
+    }
+  }
+
+ public:
+  ReferencedSizeClosure() : _words(0) {}
+  virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS_EXCEPT_REFERENT; }
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+  size_t words() const { return _words; }
+};
+
 // Return false if the entry could not be recorded on account
 // of running out of space required to create a new entry.
 bool KlassInfoTable::record_instance(const oop obj) {
@@ -218,6 +242,11 @@ bool KlassInfoTable::record_instance(const oop obj) {
   // elt may be null if it's a new klass for which we
   // could not allocate space for a new entry in the hashtable.
   if (elt != nullptr) {
+    if (_record_referenced) {
+      ReferencedSizeClosure rsc;
+      obj->oop_iterate(&rsc);
+      elt->set_referenced_words(elt->referenced_words() + rsc.words());
+    }
     elt->set_count(elt->count() + 1);
     elt->set_words(elt->words() + obj->size());
     _size_of_instances_in_words += obj->size();
@@ -248,6 +277,7 @@ bool KlassInfoTable::merge_entry(const KlassInfoEntry* cie) {
   if (elt != nullptr) {
     elt->set_count(elt->count() + cie->count());
     elt->set_words(elt->words() + cie->words());
+    elt->set_referenced_words(elt->referenced_words() + cie->referenced_words());
     _size_of_instances_in_words += cie->words();
     return true;
   }
@@ -300,7 +330,7 @@ void KlassInfoHisto::print_elements(outputStream* st) const {
   uint64_t totalw = 0;
   for(int i=0; i < elements()->length(); i++) {
     st->print("%4d: ", i+1);
-    elements()->at(i)->print_on(st);
+    elements()->at(i)->print_on(st, _cit->records_referenced());
     total += elements()->at(i)->count();
     totalw += elements()->at(i)->words();
   }
@@ -493,8 +523,13 @@ void KlassHierarchy::print_class(outputStream* st, KlassInfoEntry* cie, bool pri
 }
 
 void KlassInfoHisto::print_histo_on(outputStream* st) {
-  st->print_cr(" num     #instances         #bytes  class name (module)");
-  st->print_cr("-------------------------------------------------------");
+  if (_cit->records_referenced()) {
+    st->print_cr(" num     #instances         #bytes    #referenced  class name (module)");
+    st->print_cr("----------------------------------------------------------------------");
+  } else {
+    st->print_cr(" num     #instances         #bytes  class name (module)");
+    st->print_cr("-------------------------------------------------------");
+  }
   print_elements(st);
 }
 
@@ -544,7 +579,7 @@ void ParHeapInspectTask::work(uint worker_id) {
     return;
   }
 
-  KlassInfoTable cit(false);
+  KlassInfoTable cit(false, _shared_cit->records_referenced());
   if (cit.allocation_failed()) {
     // fail to allocate memory, stop parallel mode
     Atomic::store(&_success, false);
@@ -584,10 +619,10 @@ uintx HeapInspection::populate_table(KlassInfoTable* cit, BoolObjectClosure *fil
   return ric.missed_count();
 }
 
-void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers) {
+void HeapInspection::heap_inspection(outputStream* st, WorkerThreads* workers, bool print_referenced) {
   ResourceMark rm;
 
-  KlassInfoTable cit(false);
+  KlassInfoTable cit(false, print_referenced);
   if (!cit.allocation_failed()) {
     // populate table with object allocation info
     uintx missed_count = populate_table(&cit, nullptr, workers);
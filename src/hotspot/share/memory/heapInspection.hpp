@@ -56,13 +56,14 @@ class KlassInfoEntry: public CHeapObj<mtInternal> {
   Klass*          _klass;
   uint64_t        _instance_count;
   size_t          _instance_words;
+  size_t          _referenced_words; // Size of the objects directly referenced by the instances.
   int64_t         _index;
   bool            _do_print; // True if we should print this class when printing the class hierarchy.
   GrowableArray<KlassInfoEntry*>* _subclasses;
 
  public:
   KlassInfoEntry(Klass* k, KlassInfoEntry* next) :
-    _next(next), _klass(k), _instance_count(0), _instance_words(0), _index(-1),
+    _next(next), _klass(k), _instance_count(0), _instance_words(0), _referenced_words(0), _index(-1),
     _do_print(false), _subclasses(nullptr)
   {}
   ~KlassInfoEntry();
@@ -73,6 +74,8 @@ class KlassInfoEntry: public CHeapObj<mtInternal> {
   void set_count(uint64_t ct)    { _instance_count = ct; }
   size_t words()  const          { return _instance_words; }
   void set_words(size_t wds)     { _instance_words = wds; }
+  size_t referenced_words() const { return _referenced_words; }
+  void set_referenced_words(size_t wds) { _referenced_words = wds; }
   void set_index(int64_t index)  { _index = index; }
   int64_t index()    const       { return _index; }
   GrowableArray<KlassInfoEntry*>* subclasses() const { return _subclasses; }
@@ -80,7 +83,7 @@ class KlassInfoEntry: public CHeapObj<mtInternal> {
   void set_do_print(bool do_print) { _do_print = do_print; }
   bool do_print() const      { return _do_print; }
   int compare(KlassInfoEntry* e1, KlassInfoEntry* e2);
-  void print_on(outputStream* st) const;
+  void print_on(outputStream* st, bool print_referenced = false) const;
   const char* name() const;
 };
 
@@ -106,6 +109,8 @@ class KlassInfoTable: public StackObj {
  private:
   static const int _num_buckets = 20011;
   size_t _size_of_instances_in_words;
+  // Also sum up the sizes of the objects referenced from each instance.
+  const bool _record_referenced;
 
   // An aligned reference address (typically the least
   // address in the metaspace) used for hashing klasses.
@@ -118,9 +123,10 @@ class KlassInfoTable: public StackObj {
   class AllClassesFinder;
 
  public:
-  KlassInfoTable(bool add_all_classes);
+  KlassInfoTable(bool add_all_classes, bool record_referenced = false);
   ~KlassInfoTable();
   bool record_instance(const oop obj);
+  bool records_referenced() const { return _record_referenced; }
   void iterate(KlassInfoClosure* cic);
   bool allocation_failed() { return _buckets == nullptr; }
   size_t size_of_instances_in_words() const;
@@ -199,7 +205,7 @@ class KlassInfoClosure;
 
 class HeapInspection : public StackObj {
  public:
-  void heap_inspection(outputStream* st, WorkerThreads* workers) NOT_SERVICES_RETURN;
+  void heap_inspection(outputStream* st, WorkerThreads* workers, bool print_referenced = false) NOT_SERVICES_RETURN;
   uintx populate_table(KlassInfoTable* cit, BoolObjectClosure* filter, WorkerThreads* workers) NOT_SERVICES_RETURN_(0);
   static void find_instances_at_safepoint(Klass* k, GrowableArray<oop>* result) NOT_SERVICES_RETURN;
 };
@@ -26,6 +26,7 @@
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "memory/memoryReserver.hpp"
+#include "nmt/memTracker.hpp"
 #include "oops/compressedOops.hpp"
 #include "oops/markWord.hpp"
 #include "runtime/globals_extension.hpp"
@@ -452,6 +453,24 @@ ReservedSpace HeapReserver::Instance::try_reserve_range(char *highest_start,
     }
   }
 
+  // The evenly spaced attach points above are few, and in a randomized address
+  // space they are easily all taken. Before we give up on this encoding mode,
+  // let the os layer probe the range more densely. This only works for plain
+  // mappings; file-backed and explicit large page heaps cannot be moved.
+  if (_fd == -1 && !use_explicit_large_pages(page_size)) {
+    char* const min = MAX2(lowest_start, aligned_heap_base_min_address);
+    char* const max = MIN2(highest_start + size, upper_bound);
+    if (min < max) {
+      char* const base = os::attempt_reserve_memory_between(min, max, size, attach_point_alignment, false /* randomize */);
+      if (base != nullptr) {
+        MemTracker::record_virtual_memory_tag(base, mtJavaHeap);
+        log_debug(gc, heap, coops)("Reserved heap at " PTR_FORMAT " after probing [" PTR_FORMAT "-" PTR_FORMAT ")",
+                                   p2i(base), p2i(min), p2i(max));
+        return ReservedSpace(base, size, alignment, os::vm_page_size(), false /* exec */, false /* special */);
+      }
+    }
+  }
+
   // Failed
   return {};
 }
@@ -357,6 +357,18 @@ void ChunkManager::purge() {
   const size_t reserved_after = _vslist->reserved_words();
   const size_t committed_after = _vslist->committed_words();
 
+  // Free chunks smaller than a commit granule share their granule with chunks
+  //  still in use, so their memory cannot be returned. Report how much that is,
+  //  since it is what remains of the committed-but-unused metaspace.
+  size_t stranded_words = 0;
+  int stranded_chunks = 0;
+  for (chunklevel_t l = max_level + 1; l <= chunklevel::HIGHEST_CHUNK_LEVEL; l++) {
+    for (Metachunk* c = _chunks.first_at_level(l); c != nullptr && c->committed_words() > 0; c = c->next()) {
+      stranded_words += c->committed_words();
+      stranded_chunks++;
+    }
+  }
+
   // Print a nice report.
   if (reserved_after == reserved_before && committed_after == committed_before) {
     UL(info, "nothing reclaimed.");
@@ -373,6 +385,15 @@ void ChunkManager::purge() {
       ls.cr();
     }
   }
+  if (stranded_chunks > 0) {
+    LogTarget(Info, metaspace) lt;
+    if (lt.is_enabled()) {
+      LogStream ls(lt);
+      ls.print(LOGFMT ": %d free chunks below commit granule size stay committed: ", LOGFMT_ARGS, stranded_chunks);
+      print_scaled_words(&ls, stranded_words);
+      ls.cr();
+    }
+  }
   SOMETIMES(_vslist->verify_locked();)
   SOMETIMES(verify_locked();)
 }
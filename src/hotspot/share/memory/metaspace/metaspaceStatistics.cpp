@@ -227,6 +227,13 @@ void ClmsStats::print_on(outputStream* st, size_t scale, bool detailed) const {
       st->cr();
     }
   }
+  if (detailed && _num_allocs > 0) {
+    st->cr_indent();
+    st->print("Allocations: " UINT64_FORMAT ", contended: " UINT64_FORMAT " (%.1f%%)",
+              _num_allocs, _num_contended_allocs,
+              percent_of(_num_contended_allocs, _num_allocs));
+    st->cr();
+  }
   st->cr();
 }
 
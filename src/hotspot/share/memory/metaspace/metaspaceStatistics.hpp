@@ -147,11 +147,18 @@ struct ClmsStats {
   ArenaStats _arena_stats_nonclass;
   ArenaStats _arena_stats_class;
 
-  ClmsStats() : _arena_stats_nonclass(), _arena_stats_class() {}
+  // Allocations, and allocations which had to wait for the arena lock.
+  uint64_t _num_allocs;
+  uint64_t _num_contended_allocs;
+
+  ClmsStats() : _arena_stats_nonclass(), _arena_stats_class(),
+    _num_allocs(0), _num_contended_allocs(0) {}
 
   void add(const ClmsStats& other) {
     _arena_stats_nonclass.add(other._arena_stats_nonclass);
     _arena_stats_class.add(other._arena_stats_class);
+    _num_allocs += other._num_allocs;
+    _num_contended_allocs += other._num_contended_allocs;
   }
 
   void print_on(outputStream* st, size_t scale, bool detailed) const;
@@ -51,6 +51,9 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/ostream.hpp"
+#ifdef LINUX
+#include "os_linux.hpp"
+#endif
 
 namespace metaspace {
 
@@ -114,6 +117,12 @@ bool VirtualSpaceNode::commit_range(MetaWord* p, size_t word_size) {
     vm_exit_out_of_memory(word_size * BytesPerWord, OOM_MMAP_ERROR, "Failed to commit metaspace.");
   }
 
+#ifdef LINUX
+  if (THPMetaspaceMitigation) {
+    os::Linux::madvise_no_transparent_huge_pages(p, word_size * BytesPerWord);
+  }
+#endif
+
   if (AlwaysPreTouch) {
     os::pretouch_memory(p, p + word_size);
   }
@@ -91,7 +91,7 @@ bool MallocSiteTable::walk(MallocSiteWalker* walker) {
   for (int index = 0; index < table_size; index ++) {
     head = _table[index];
     while (head != nullptr) {
-      if (!walker->do_malloc_site(head->peek())) {
+      if (!walker->do_malloc_site(head->snapshot())) {
         return false;
       }
       head = (MallocSiteHashtableEntry*)head->next();
@@ -111,7 +111,7 @@ bool MallocSiteTable::walk(MallocSiteWalker* walker) {
  *    2. Overflow hash bucket.
  *  Under any of above circumstances, caller should handle the situation.
  */
-MallocSite* MallocSiteTable::lookup_or_add(const NativeCallStack& key, uint32_t* marker, MemTag mem_tag) {
+MallocSiteHashtableEntry* MallocSiteTable::lookup_or_add(const NativeCallStack& key, uint32_t* marker, MemTag mem_tag) {
   assert(mem_tag != mtNone, "Should have a real memory tag");
   const unsigned int hash = key.calculate_hash();
   const unsigned int index = hash_to_index(hash);
@@ -126,7 +126,7 @@ MallocSite* MallocSiteTable::lookup_or_add(const NativeCallStack& key, uint32_t*
     // swap in the head
     if (Atomic::replace_if_null(&_table[index], entry)) {
       *marker = build_marker(index, 0);
-      return entry->data();
+      return entry;
     }
 
     delete entry;
@@ -136,10 +136,10 @@ MallocSite* MallocSiteTable::lookup_or_add(const NativeCallStack& key, uint32_t*
   MallocSiteHashtableEntry* head = _table[index];
   while (head != nullptr && pos_idx < MAX_BUCKET_LENGTH) {
     if (head->hash() == hash) {
-      MallocSite* site = head->data();
+      const MallocSite* site = head->peek();
       if (site->mem_tag() == mem_tag && site->equals(key)) {
         *marker = build_marker(index, pos_idx);
-        return head->data();
+        return head;
       }
     }
 
@@ -150,7 +150,7 @@ MallocSite* MallocSiteTable::lookup_or_add(const NativeCallStack& key, uint32_t*
       if (head->atomic_insert(entry)) {
         pos_idx ++;
         *marker = build_marker(index, pos_idx);
-        return entry->data();
+        return entry;
       }
       // contended, other thread won
       delete entry;
@@ -162,7 +162,7 @@ MallocSite* MallocSiteTable::lookup_or_add(const NativeCallStack& key, uint32_t*
 }
 
 // Access malloc site
-MallocSite* MallocSiteTable::malloc_site(uint32_t marker) {
+MallocSiteHashtableEntry* MallocSiteTable::malloc_site(uint32_t marker) {
   uint16_t bucket_idx = bucket_idx_from_marker(marker);
   assert(bucket_idx < table_size, "Invalid bucket index");
   const uint16_t pos_idx = pos_idx_from_marker(marker);
@@ -171,7 +171,7 @@ MallocSite* MallocSiteTable::malloc_site(uint32_t marker) {
        index < pos_idx && head != nullptr;
        index++, head = (MallocSiteHashtableEntry*)head->next()) {}
   assert(head != nullptr, "Invalid position index");
-  return head->data();
+  return head;
 }
 
 // Allocates MallocSiteHashtableEntry object. Special call stack
@@ -249,3 +249,27 @@ void MallocSiteTable::print_tuning_statistics(outputStream* st) {
 bool MallocSiteHashtableEntry::atomic_insert(MallocSiteHashtableEntry* entry) {
   return Atomic::replace_if_null(&_next, entry);
 }
+
+size_t MallocSiteHashtableEntry::size() const {
+  size_t sum = 0;
+  for (int i = 0; i < stripes; i++) {
+    sum += Atomic::load(&_stripes[i]._size);
+  }
+  return sum;
+}
+
+size_t MallocSiteHashtableEntry::count() const {
+  size_t sum = 0;
+  for (int i = 0; i < stripes; i++) {
+    sum += Atomic::load(&_stripes[i]._count);
+  }
+  return sum;
+}
+
+const MallocSite* MallocSiteHashtableEntry::snapshot() {
+  // The stripes are read one after the other, so a concurrent allocation
+  // moving between stripes could be seen half. That is no worse than the
+  // unsynchronized reads of a single counter.
+  _malloc_site.set_size_and_count(size(), count());
+  return &_malloc_site;
+}
@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/nativeCallStack.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 // MallocSite represents a code path that eventually calls
 // os::malloc() to allocate memory
@@ -44,6 +45,10 @@ class MallocSite : public AllocationSite {
   void allocate(size_t size)      { _c.allocate(size);   }
   void deallocate(size_t size)    { _c.deallocate(size); }
 
+  // Used by the site table, which keeps its counters in stripes.
+  void set_size_and_count(size_t size, size_t count) { _c.set_size_and_count(size, count); }
+  void update_peak(size_t size, size_t count)        { _c.update_peak(size, count); }
+
   // Memory allocated from this code path
   size_t size()  const { return _c.size(); }
   // Peak memory ever allocated from this code path
@@ -57,9 +62,41 @@ class MallocSite : public AllocationSite {
 // Malloc site hashtable entry
 class MallocSiteHashtableEntry : public CHeapObj<mtNMT> {
  private:
+  // The counters are striped, so threads allocating from the same hot code
+  // path don't all update the same cache line. Allocations and deallocations
+  // are accounted to the stripe of the current thread, so a single stripe
+  // might get negative. Only the sum over all stripes is meaningful.
+  static const int stripes = 4;
+  STATIC_ASSERT(is_power_of_2(stripes));
+
+  struct Stripe {
+    volatile size_t _count;
+    volatile size_t _size;
+    // The highest size this stripe has seen, used to update the peak.
+    volatile ssize_t _high;
+    // Keeps the counters of the next stripe out of our cache line.
+    char _pad[DEFAULT_CACHE_LINE_SIZE];
+
+    Stripe() : _count(0), _size(0), _high(0) {}
+  };
+
+  // The call stack and memory tag. Its counters are only brought up to date
+  // from the stripes when the site is walked.
   MallocSite                         _malloc_site;
   const unsigned int                 _hash;
   MallocSiteHashtableEntry* volatile _next;
+  Stripe                             _stripes[stripes];
+
+  static inline int current_stripe() {
+    // An address on the current stack tells threads apart much cheaper
+    // than asking for the thread id. Threads might occasionally switch
+    // stripes, which is fine.
+    uintptr_t sp = (uintptr_t)&sp;
+    uintptr_t h = sp >> 16;
+    h ^= h >> 4;
+    h ^= h >> 8;
+    return (int)(h & (stripes - 1));
+  }
 
  public:
 
@@ -79,17 +116,43 @@ class MallocSiteHashtableEntry : public CHeapObj<mtNMT> {
 
   unsigned int hash() const { return _hash; }
 
+  // The call stack and memory tag. Note that the counters are not current,
+  // use snapshot() for that.
   inline const MallocSite* peek() const { return &_malloc_site; }
-  inline MallocSite* data()             { return &_malloc_site; }
+
+  // Brings the counters of the site up to date and returns it.
+  const MallocSite* snapshot();
 
   // Allocation/deallocation on this allocation site
-  inline void allocate(size_t size)   { _malloc_site.allocate(size);   }
-  inline void deallocate(size_t size) { _malloc_site.deallocate(size); }
-  // Memory counters
-  inline size_t size() const  { return _malloc_site.size();  }
-  inline size_t count() const { return _malloc_site.count(); }
+  inline void allocate(size_t size);
+  inline void deallocate(size_t size);
+  // Memory counters summed up over all stripes
+  size_t size() const;
+  size_t count() const;
 };
 
+inline void MallocSiteHashtableEntry::allocate(size_t size) {
+  Stripe* stripe = &_stripes[current_stripe()];
+  Atomic::add(&stripe->_count, size_t(1), memory_order_relaxed);
+  if (size > 0) {
+    ssize_t sum = (ssize_t)Atomic::add(&stripe->_size, size, memory_order_relaxed);
+    // Only a new high of this stripe can be a new peak of the site, which
+    // is rare once the site reached its steady state.
+    if (sum > Atomic::load(&stripe->_high)) {
+      Atomic::store(&stripe->_high, sum);
+      _malloc_site.update_peak(this->size(), count());
+    }
+  }
+}
+
+inline void MallocSiteHashtableEntry::deallocate(size_t size) {
+  Stripe* stripe = &_stripes[current_stripe()];
+  Atomic::sub(&stripe->_count, size_t(1), memory_order_relaxed);
+  if (size > 0) {
+    Atomic::sub(&stripe->_size, size, memory_order_relaxed);
+  }
+}
+
 // The walker walks every entry on MallocSiteTable
 class MallocSiteWalker : public StackObj {
  public:
@@ -132,9 +195,9 @@ class MallocSiteTable : AllStatic {
   // Access and copy a call stack from this table. Shared lock should be
   // acquired before access the entry.
   static inline bool access_stack(NativeCallStack& stack, const MallocHeader& header) {
-    MallocSite* site = malloc_site(header.mst_marker());
+    MallocSiteHashtableEntry* site = malloc_site(header.mst_marker());
     if (site != nullptr) {
-      stack = *site->call_stack();
+      stack = *site->peek()->call_stack();
       return true;
     }
     return false;
@@ -148,7 +211,7 @@ class MallocSiteTable : AllStatic {
   //  2. overflow hash bucket
   static inline bool allocation_at(const NativeCallStack& stack, size_t size,
       uint32_t* marker, MemTag mem_tag) {
-    MallocSite* site = lookup_or_add(stack, marker, mem_tag);
+    MallocSiteHashtableEntry* site = lookup_or_add(stack, marker, mem_tag);
     if (site != nullptr) site->allocate(size);
     return site != nullptr;
   }
@@ -156,7 +219,7 @@ class MallocSiteTable : AllStatic {
   // Record memory deallocation. marker indicates where the allocation
   // information was recorded.
   static inline bool deallocation_at(size_t size, uint32_t marker) {
-    MallocSite* site = malloc_site(marker);
+    MallocSiteHashtableEntry* site = malloc_site(marker);
     if (site != nullptr) {
       site->deallocate(size);
       return true;
@@ -172,8 +235,8 @@ class MallocSiteTable : AllStatic {
  private:
   static MallocSiteHashtableEntry* new_entry(const NativeCallStack& key, MemTag mem_tag);
 
-  static MallocSite* lookup_or_add(const NativeCallStack& key, uint32_t* marker, MemTag mem_tag);
-  static MallocSite* malloc_site(uint32_t marker);
+  static MallocSiteHashtableEntry* lookup_or_add(const NativeCallStack& key, uint32_t* marker, MemTag mem_tag);
+  static MallocSiteHashtableEntry* malloc_site(uint32_t marker);
   static bool walk(MallocSiteWalker* walker);
 
   static inline unsigned int hash_to_index(unsigned int hash) {
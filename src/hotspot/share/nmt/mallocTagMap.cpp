@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2024 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "nmt/mallocTagMap.hpp"
+#include "nmt/mallocTracker.hpp"
+#include "nmt/nmtCommon.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+MallocTagMap::Stripe MallocTagMap::_stripes[MallocTagMap::stripe_count];
+
+class MallocTagMapLocker : public StackObj {
+  volatile int* const _lock;
+ public:
+  MallocTagMapLocker(volatile int* lock) : _lock(lock) {
+    Thread::SpinAcquire(_lock, "MallocTagMap");
+  }
+  ~MallocTagMapLocker() {
+    Thread::SpinRelease(_lock);
+  }
+};
+
+uintptr_t* MallocTagMap::allocate_table(size_t capacity) {
+  const size_t bytes = capacity * sizeof(uintptr_t);
+  ALLOW_C_FUNCTION(::calloc, uintptr_t* const table = (uintptr_t*)::calloc(capacity, sizeof(uintptr_t));)
+  if (table != nullptr) {
+    MallocMemorySummary::record_malloc(bytes, mtNMT);
+  }
+  return table;
+}
+
+bool MallocTagMap::initialize() {
+#ifdef _LP64
+  if (_stripes[0]._table != nullptr) {
+    return true;
+  }
+
+  // Check that the allocator can tell us block sizes and that its addresses fit.
+  ALLOW_C_FUNCTION(::malloc, void* const probe = ::malloc(1);)
+  if (probe == nullptr) {
+    return false;
+  }
+  const bool usable = os::malloc_usable_size(probe) >= 1 && can_hold(probe);
+  ALLOW_C_FUNCTION(::free, ::free(probe);)
+  if (!usable) {
+    return false;
+  }
+
+  for (int i = 0; i < stripe_count; i++) {
+    Stripe* const s = _stripes + i;
+    s->_lock = 0;
+    s->_table = allocate_table(initial_capacity);
+    if (s->_table == nullptr) {
+      return false;
+    }
+    s->_capacity = initial_capacity;
+    s->_used = 0;
+  }
+  return true;
+#else
+  // No room for the tag next to a 32-bit address.
+  return false;
+#endif
+}
+
+// Called with the stripe lock held. The old table stays in use if the new one
+// cannot be allocated; only a completely full table is fatal.
+void MallocTagMap::grow(Stripe* s) {
+  const size_t new_capacity = s->_capacity * 2;
+  uintptr_t* const new_table = allocate_table(new_capacity);
+  if (new_table == nullptr) {
+    if (s->_used + 1 >= s->_capacity) {
+      vm_exit_out_of_memory(new_capacity * sizeof(uintptr_t), OOM_MALLOC_ERROR, "NMT malloc tag map");
+    }
+    return;
+  }
+  for (size_t i = 0; i < s->_capacity; i++) {
+    const uintptr_t e = s->_table[i];
+    if (e != 0) {
+      size_t slot = home_slot(hash(e & address_mask), new_capacity);
+      while (new_table[slot] != 0) {
+        slot = (slot + 1) & (new_capacity - 1);
+      }
+      new_table[slot] = e;
+    }
+  }
+  ALLOW_C_FUNCTION(::free, ::free(s->_table);)
+  MallocMemorySummary::record_free(s->_capacity * sizeof(uintptr_t), mtNMT);
+  s->_table = new_table;
+  s->_capacity = new_capacity;
+}
+
+void MallocTagMap::add(const void* p, MemTag mem_tag) {
+  const uintptr_t addr = p2i(p);
+  guarantee(can_hold(p), "malloc returned unexpected address " PTR_FORMAT, addr);
+  const uint64_t h = hash(addr);
+  Stripe* const s = stripe_for(h);
+  MallocTagMapLocker ml(&s->_lock);
+  if ((s->_used + 1) * 8 > s->_capacity * 7) {
+    grow(s);
+  }
+  const size_t mask = s->_capacity - 1;
+  size_t slot = home_slot(h, s->_capacity);
+  while (s->_table[slot] != 0) {
+    assert((s->_table[slot] & address_mask) != addr, "block " PTR_FORMAT " already in map", addr);
+    slot = (slot + 1) & mask;
+  }
+  s->_table[slot] = addr | ((uintptr_t)NMTUtil::tag_to_index(mem_tag) << tag_shift);
+  s->_used++;
+}
+
+MemTag MallocTagMap::remove(const void* p) {
+  const uintptr_t addr = p2i(p);
+  const uint64_t h = hash(addr);
+  Stripe* const s = stripe_for(h);
+  MallocTagMapLocker ml(&s->_lock);
+  const size_t mask = s->_capacity - 1;
+  size_t slot = home_slot(h, s->_capacity);
+  while ((s->_table[slot] & address_mask) != addr) {
+    guarantee(s->_table[slot] != 0, "block " PTR_FORMAT " not allocated by os::malloc", addr);
+    slot = (slot + 1) & mask;
+  }
+  const MemTag mem_tag = NMTUtil::index_to_tag((int)(s->_table[slot] >> tag_shift));
+
+  // Backward shift deletion: move up following entries whose home slot does
+  // not lie cyclically within (hole, current], so that no probe sequence breaks.
+  size_t hole = slot;
+  size_t cur = slot;
+  for (;;) {
+    cur = (cur + 1) & mask;
+    const uintptr_t e = s->_table[cur];
+    if (e == 0) {
+      break;
+    }
+    const size_t home = home_slot(hash(e & address_mask), s->_capacity);
+    const bool stays = (hole <= cur) ? (hole < home && home <= cur)
+                                     : (hole < home || home <= cur);
+    if (!stays) {
+      s->_table[hole] = e;
+      hole = cur;
+    }
+  }
+  s->_table[hole] = 0;
+  s->_used--;
+  return mem_tag;
+}
+
+bool MallocTagMap::lookup(const void* p, MemTag* mem_tag) {
+  const uintptr_t addr = p2i(p);
+  if (addr == 0 || !can_hold(p)) {
+    return false;
+  }
+  const uint64_t h = hash(addr);
+  Stripe* const s = stripe_for(h);
+  if (s->_table == nullptr) {
+    return false;
+  }
+  MallocTagMapLocker ml(&s->_lock);
+  const size_t mask = s->_capacity - 1;
+  for (size_t slot = home_slot(h, s->_capacity); s->_table[slot] != 0; slot = (slot + 1) & mask) {
+    if ((s->_table[slot] & address_mask) == addr) {
+      *mem_tag = NMTUtil::index_to_tag((int)(s->_table[slot] >> tag_shift));
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_NMT_MALLOCTAGMAP_HPP
+#define SHARE_NMT_MALLOCTAGMAP_HPP
+
+#include "memory/allStatic.hpp"
+#include "nmt/memTag.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+/*
+ * Side table for header-less malloc tracking (-XX:-NMTMallocHeaders).
+ *
+ * In summary mode, NMT only needs size and memory tag of a block to deaccount it on free.
+ * Instead of prefixing each block with a MallocHeader, the size is taken from the C-heap
+ * allocator (os::malloc_usable_size) and the tag is kept here, keyed by block address.
+ *
+ * The map is split into stripes to keep contention low. Each stripe is an open-addressing
+ * hash table with linear probing, guarded by a spin lock. An entry is a single word holding
+ * the block address in the lower 56 bits and the memory tag in the upper 8 bits, so a live
+ * block costs about 8 bytes divided by the load factor (at most 7/8).
+ *
+ * Tables are allocated with raw ::calloc, since os::malloc would recurse into NMT, and are
+ * accounted to mtNMT.
+ */
+class MallocTagMap : AllStatic {
+  static const int    stripe_bits = 6;
+  static const int    stripe_count = 1 << stripe_bits;
+  static const size_t initial_capacity = 256;
+
+  struct Stripe {
+    volatile int _lock;
+    uintptr_t*   _table;
+    size_t       _capacity;  // power of 2
+    size_t       _used;
+  };
+
+  static Stripe _stripes[stripe_count];
+
+  static const int       tag_shift = 56;
+  static const uintptr_t address_mask = (((uintptr_t)1) << tag_shift) - 1;
+
+  static inline uint64_t hash(uintptr_t addr) {
+    // malloc blocks are at least 8-byte aligned, mix the remaining bits.
+    return (uint64_t)(addr >> 3) * CONST64(0x9E3779B97F4A7C15);
+  }
+  static inline Stripe* stripe_for(uint64_t h) {
+    return _stripes + (h >> (64 - stripe_bits));
+  }
+  static inline size_t home_slot(uint64_t h, size_t capacity) {
+    return (size_t)(h >> 20) & (capacity - 1);
+  }
+
+  static uintptr_t* allocate_table(size_t capacity);
+  static void grow(Stripe* s);
+
+ public:
+  // Returns false if the platform cannot support header-less tracking.
+  static bool initialize();
+
+  // Returns true if addresses returned by malloc(3) can be stored in the map.
+  static inline bool can_hold(const void* p) {
+    return (p2i(p) & ~address_mask) == 0;
+  }
+
+  static void add(const void* p, MemTag mem_tag);
+
+  // Removes p from the map and returns its tag.
+  static MemTag remove(const void* p);
+
+  // Looks up p without removing it; returns false if p is not a live block.
+  static bool lookup(const void* p, MemTag* mem_tag);
+};
+
+#endif // SHARE_NMT_MALLOCTAGMAP_HPP
@@ -32,6 +32,7 @@
 #include "nmt/mallocHeader.inline.hpp"
 #include "nmt/mallocLimit.hpp"
 #include "nmt/mallocSiteTable.hpp"
+#include "nmt/mallocTagMap.hpp"
 #include "nmt/mallocTracker.hpp"
 #include "nmt/memTracker.hpp"
 #include "runtime/arguments.hpp"
@@ -46,6 +47,7 @@
 #include "utilities/globalDefinitions.hpp"
 
 MallocMemorySnapshot MallocMemorySummary::_snapshot;
+bool MallocTracker::_use_headers = true;
 
 void MemoryCounter::update_peak(size_t size, size_t cnt) {
   size_t peak_sz = peak_size();
@@ -161,8 +163,19 @@ bool MallocTracker::initialize(NMT_TrackingLevel level) {
   }
 
   if (level == NMT_detail) {
+    if (!NMTMallocHeaders) {
+      log_warning(nmt)("NMTMallocHeaders is ignored, detail tracking needs malloc headers.");
+    }
     return MallocSiteTable::initialize();
   }
+
+  if (level == NMT_summary && !NMTMallocHeaders) {
+    if (MallocTagMap::initialize()) {
+      _use_headers = false;
+    } else {
+      log_warning(nmt)("NMTMallocHeaders is ignored, not supported on this platform.");
+    }
+  }
   return true;
 }
 
@@ -173,6 +186,12 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MemTag mem_ta
   assert(MemTracker::enabled(), "precondition");
   assert(malloc_base != nullptr, "precondition");
 
+  if (!_use_headers) {
+    MallocTagMap::add(malloc_base, mem_tag);
+    MallocMemorySummary::record_malloc(os::malloc_usable_size(malloc_base), mem_tag);
+    return malloc_base;
+  }
+
   MallocMemorySummary::record_malloc(size, mem_tag);
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
@@ -203,6 +222,12 @@ void* MallocTracker::record_free_block(void* memblock) {
   assert(MemTracker::enabled(), "Sanity");
   assert(memblock != nullptr, "precondition");
 
+  if (!_use_headers) {
+    const MemTag mem_tag = MallocTagMap::remove(memblock);
+    MallocMemorySummary::record_free(os::malloc_usable_size(memblock), mem_tag);
+    return memblock;
+  }
+
   MallocHeader* header = MallocHeader::resolve_checked(memblock);
 
   deaccount(header->free_info());
@@ -227,6 +252,12 @@ void MallocTracker::deaccount(MallocHeader::FreeInfo free_info) {
 bool MallocTracker::print_pointer_information(const void* p, outputStream* st) {
   assert(MemTracker::enabled(), "NMT not enabled");
 
+  if (!_use_headers) {
+    // No headers to search for. The tag map is lock protected, so we don't
+    // query it here, where we may be crashing while holding its lock.
+    return false;
+  }
+
 #if !INCLUDE_ASAN
 
   address addr = (address)p;
@@ -50,11 +50,13 @@ class MemoryCounter {
   // peak size was reached, not the absolute highest peak count.
   volatile size_t _peak_count;
   volatile size_t _peak_size;
-  void update_peak(size_t size, size_t cnt);
 
  public:
   MemoryCounter() : _count(0), _size(0), _peak_count(0), _peak_size(0) {}
 
+  // Raises the peak to the given size (and the count at that time) if larger.
+  void update_peak(size_t size, size_t cnt);
+
   inline void set_size_and_count(size_t size, size_t count) {
     _size = size;
     _count = count;
@@ -165,9 +167,9 @@ class MallocMemorySnapshot {
     return &_malloc[index];
   }
 
-  inline size_t malloc_overhead() const {
-    return _all_mallocs.count() * MallocHeader::malloc_overhead();
-  }
+  // The memory used by malloc headers. Without headers, the tag map is
+  // accounted to mtNMT instead.
+  inline size_t malloc_overhead() const;
 
   // Total malloc invocation count
   size_t total_count() const {
@@ -263,13 +265,20 @@ class MallocMemorySummary : AllStatic {
 
 // Main class called from MemTracker to track malloc activities
 class MallocTracker : AllStatic {
+  // False if summary tracking keeps size and tag outside the block (-XX:-NMTMallocHeaders)
+  static bool _use_headers;
+
  public:
   // Initialize malloc tracker for specific tracking level
   static bool initialize(NMT_TrackingLevel level);
 
+  static inline bool use_headers() { return _use_headers; }
+
   // The overhead that is incurred by switching on NMT (we need, per malloc allocation,
   // space for header and 16-bit footer)
-  static inline size_t overhead_per_malloc() { return MallocHeader::malloc_overhead(); }
+  static inline size_t overhead_per_malloc() {
+    return _use_headers ? MallocHeader::malloc_overhead() : 0;
+  }
 
   // Parameter name convention:
   // memblock :   the beginning address for user data
@@ -278,6 +287,9 @@ class MallocTracker : AllStatic {
   // The relationship:
   // memblock = (char*)malloc_base + sizeof(nmt header)
   //
+  // Without headers, memblock == malloc_base and blocks are accounted with
+  // their usable size as reported by the C-heap allocator.
+  //
 
   // Record  malloc on specified memory block
   static void* record_malloc(void* malloc_base, size_t size, MemTag mem_tag,
@@ -322,4 +334,8 @@ class MallocTracker : AllStatic {
   }
 };
 
+inline size_t MallocMemorySnapshot::malloc_overhead() const {
+  return _all_mallocs.count() * MallocTracker::overhead_per_malloc();
+}
+
 #endif // SHARE_NMT_MALLOCTRACKER_HPP
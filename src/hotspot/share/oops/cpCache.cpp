@@ -518,6 +518,16 @@ void ConstantPoolCache::remove_resolved_indy_entries_if_non_deterministic() {
       rei->remove_unshareable_info();
     }
     if (resolved) {
+      bool unsupported_bsm = !archived && !AOTConstantPoolResolver::is_supported_indy_bootstrap(src_cp, cp_index);
+      if (unsupported_bsm && log_is_enabled(Debug, cds, resolve)) {
+        ResourceMark rm;
+        int bsm = cp->bootstrap_method_ref_index_at(cp_index);
+        int bsm_ref = cp->method_handle_index_at(bsm);
+        log_debug(cds, resolve)("Cannot archive indy CP entry [%3d] in %s: unsupported bootstrap method %s.%s",
+                                cp_index, cp->pool_holder()->external_name(),
+                                cp->klass_name_at(cp->uncached_klass_ref_index_at(bsm_ref))->as_C_string(),
+                                cp->uncached_name_ref_at(bsm_ref)->as_C_string());
+      }
       LogStreamHandle(Trace, cds, resolve) log;
       if (log.is_enabled()) {
         ResourceMark rm;
@@ -532,7 +542,7 @@ void ConstantPoolCache::remove_resolved_indy_entries_if_non_deterministic() {
         log.print(" %s %s.%s:%s", (archived ? "=>" : "  "), bsm_klass->as_C_string(),
                   bsm_name->as_C_string(), bsm_signature->as_C_string());
       }
-      ArchiveBuilder::alloc_stats()->record_indy_cp_entry(archived, resolved && !archived);
+      ArchiveBuilder::alloc_stats()->record_indy_cp_entry(archived, resolved && !archived, unsupported_bsm);
     }
   }
 }
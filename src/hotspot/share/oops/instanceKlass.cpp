@@ -38,6 +38,7 @@
 #include "classfile/moduleEntry.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/systemDictionaryShared.hpp"
+#include "classfile/verificationCache.hpp"
 #include "classfile/verifier.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -2910,6 +2911,11 @@ void InstanceKlass::release_C_heap_structures(bool release_sub_metadata) {
   // Clean up C heap
   Klass::release_C_heap_structures();
 
+  // A later class may be allocated at the same address.
+  if (VerificationCache::is_enabled()) {
+    VerificationCache::forget(this);
+  }
+
   // Deallocate and call destructors for MDO mutexes
   if (release_sub_metadata) {
     methods_do(method_release_C_heap_structures);
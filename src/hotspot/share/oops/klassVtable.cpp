@@ -1442,30 +1442,40 @@ class InterfaceVisiterClosure : public StackObj {
   virtual void doit(InstanceKlass* intf, int method_count) = 0;
 };
 
-// Visit all interfaces with at least one itable method
+static int itable_method_count(InstanceKlass* intf) {
+  int method_count = 0;
+  Array<Method*>* methods = intf->methods();
+  for (int i = methods->length(); --i >= 0; ) {
+    if (interface_method_needs_itable_index(methods->at(i))) {
+      method_count++;
+    }
+  }
+  return method_count;
+}
+
+// Visit all interfaces with at least one itable method, then the method-less
+// ones that are only needed for receiver type checks. Itable stubs scan the
+// offset table linearly, so putting the interfaces that calls can select
+// methods from first shortens the scan for classes with many marker or
+// aggregating super-interfaces.
 static void visit_all_interfaces(Array<InstanceKlass*>* transitive_intf, InterfaceVisiterClosure *blk) {
   // Handle array argument
   for(int i = 0; i < transitive_intf->length(); i++) {
     InstanceKlass* intf = transitive_intf->at(i);
     assert(intf->is_interface(), "sanity check");
-
-    // Find no. of itable methods
-    int method_count = 0;
-    // method_count = klassItable::method_count_for_interface(intf);
-    Array<Method*>* methods = intf->methods();
-    if (methods->length() > 0) {
-      for (int i = methods->length(); --i >= 0; ) {
-        if (interface_method_needs_itable_index(methods->at(i))) {
-          method_count++;
-        }
-      }
+    int method_count = itable_method_count(intf);
+    if (method_count > 0) {
+      blk->doit(intf, method_count);
     }
+  }
 
-    // Visit all interfaces which either have any methods or can participate in receiver type check.
-    // We do not bother to count methods in transitive interfaces, although that would allow us to skip
-    // this step in the rare case of a zero-method interface extending another zero-method interface.
-    if (method_count > 0 || intf->transitive_interfaces()->length() > 0) {
-      blk->doit(intf, method_count);
+  // Visit all interfaces which can participate in receiver type check.
+  // We do not bother to count methods in transitive interfaces, although that would allow us to skip
+  // this step in the rare case of a zero-method interface extending another zero-method interface.
+  for(int i = 0; i < transitive_intf->length(); i++) {
+    InstanceKlass* intf = transitive_intf->at(i);
+    if (intf->transitive_interfaces()->length() > 0 && itable_method_count(intf) == 0) {
+      blk->doit(intf, 0);
     }
   }
 }
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/archiveBuilder.hpp"
 #include "cds/cdsConfig.hpp"
 #include "cds/cppVtables.hpp"
 #include "cds/metaspaceShared.hpp"
@@ -405,6 +406,15 @@ void Method::metaspace_pointers_do(MetaspaceClosure* it) {
 // entries now in order allow them to be write protected later.
 
 void Method::remove_unshareable_info() {
+  if (ArchiveHotMethodHints) {
+    // The MethodCounters of the buffered copy have already been cleared,
+    // so look at the method that was used during the dump.
+    Method* src = ArchiveBuilder::current()->get_source_addr(this);
+    if (src->highest_comp_level() == CompLevel_full_optimization ||
+        src->highest_osr_comp_level() == CompLevel_full_optimization) {
+      set_was_hot_at_dump_time();
+    }
+  }
   unlink_method();
   JFR_ONLY(REMOVE_METHOD_ID(this);)
 }
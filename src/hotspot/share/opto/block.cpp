@@ -1773,6 +1773,16 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
   }
 }
 
+bool PhaseBlockLayout::is_cold_trace(Trace* tr) {
+  assert(!tr->first_block()->is_connector(), "connector traces are placed separately");
+  for (Block* b = tr->first_block(); b != nullptr; b = tr->next(b)) {
+    if (!_cfg.is_uncommon(b)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Order the sequence of the traces in some desirable way
 void PhaseBlockLayout::reorder_traces(int count) {
   Trace** new_traces = NEW_RESOURCE_ARRAY(Trace*, count);
@@ -1794,6 +1804,37 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  // Frequency alone leaves uncommon traps and slow paths with a non-trivial
+  // profile interleaved with the hot code. Move the cold traces behind all
+  // hot ones, keeping their relative order, so that the hot part of the
+  // method is contiguous in the code cache. Connector traces still go last,
+  // PhaseCFG::fixup_flow() expects all connector blocks at the end.
+  if (BlockLayoutColdAtEnd) {
+    Trace** hot_and_cold = NEW_RESOURCE_ARRAY(Trace*, new_count);
+    int next = 0;
+    hot_and_cold[next++] = new_traces[0];
+    for (int i = 1; i < new_count; i++) {
+      Trace* tr = new_traces[i];
+      if (!tr->first_block()->is_connector() && !is_cold_trace(tr)) {
+        hot_and_cold[next++] = tr;
+      }
+    }
+    for (int i = 1; i < new_count; i++) {
+      Trace* tr = new_traces[i];
+      if (!tr->first_block()->is_connector() && is_cold_trace(tr)) {
+        hot_and_cold[next++] = tr;
+      }
+    }
+    for (int i = 1; i < new_count; i++) {
+      Trace* tr = new_traces[i];
+      if (tr->first_block()->is_connector()) {
+        hot_and_cold[next++] = tr;
+      }
+    }
+    assert(next == new_count, "all traces placed");
+    new_traces = hot_and_cold;
+  }
+
   // Collect all blocks from existing Traces
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
@@ -905,6 +905,9 @@ class PhaseBlockLayout : public Phase {
   Trace * trace(Block *b) {
     return traces[uf->Find_compress(b->_pre_order)];
   }
+
+  // True if every block of the trace is predicted to be uncommon.
+  bool is_cold_trace(Trace* tr);
  public:
   PhaseBlockLayout(PhaseCFG &cfg);
 
@@ -219,6 +219,12 @@
   product(bool, UseVectorCmov, false,                                       \
           "Use Vectorized Cmov")                                            \
                                                                             \
+  product(bool, UseVectorIfConversion, false, DIAGNOSTIC,                   \
+          "On CPUs with vector predicate registers, convert cheap "         \
+          "diamonds in innermost counted loops into conditional moves "     \
+          "regardless of branch profile, and vectorize them with masked "   \
+          "compares and blends")                                            \
+                                                                            \
   develop(intx, UnrollLimitForProfileCheck, 1,                              \
           "Don't use profile_trip_cnt() to restrict unrolling until "       \
           "unrolling would push the number of unrolled iterations above "   \
@@ -361,6 +367,12 @@
           "loop iterations this detection spans.")                          \
           range(0, 4096)                                                    \
                                                                             \
+  product(uint, SuperWordMaxGatherStride, 0, DIAGNOSTIC,                    \
+          "Maximal distance in elements between the strided loads of a "    \
+          "vector that auto-vectorization implements with a gather. "       \
+          "0 disables strided gathers.")                                    \
+          range(0, 64)                                                      \
+                                                                            \
   product(bool, UseCMoveUnconditionally, false,                             \
           "Use CMove (scalar and vector) ignoring profitability test.")     \
                                                                             \
@@ -499,6 +511,11 @@
   product(bool, DoEscapeAnalysis, true,                                     \
           "Perform escape analysis")                                        \
                                                                             \
+  product(bool, TrapColdEscapingCalls, false, DIAGNOSTIC,                   \
+          "Replace rarely executed calls that take a newly allocated "      \
+          "object with an uncommon trap, so that the object can be "        \
+          "scalar replaced")                                                \
+                                                                            \
   product(double, EscapeAnalysisTimeout, 20. DEBUG_ONLY(+40.),              \
           "Abort EA when it reaches time limit (in sec)")                   \
           range(0, DBL_MAX)                                                 \
@@ -561,6 +578,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(bool, BlockLayoutColdAtEnd, true, DIAGNOSTIC,                     \
+          "Place traces of uncommon blocks after all other code in "        \
+          "frequency based block layout")                                   \
+                                                                            \
   product(bool, InlineReflectionGetCallerClass, true, DIAGNOSTIC,           \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
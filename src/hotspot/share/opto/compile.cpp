@@ -41,6 +41,8 @@
 #include "gc/shared/c2/barrierSetC2.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm_io.h"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/allocation.hpp"
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
@@ -78,6 +80,7 @@
 #include "opto/vector.hpp"
 #include "opto/vectornode.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -679,7 +682,8 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _java_calls(0),
                   _inner_loops(0),
                   _interpreter_frame_size(0),
-                  _output(nullptr)
+                  _output(nullptr),
+                  _phase_ticks(nullptr)
 #ifndef PRODUCT
                   , _in_dump_cnt(0)
 #endif
@@ -690,6 +694,11 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
   TraceTime t1("Total compilation time", &_t_totalCompilation, CITime, CITimeVerbose);
   TraceTime t2(nullptr, &_t_methodCompilation, CITime, false);
 
+  if (log_is_enabled(Debug, jit, phases)) {
+    _phase_ticks = NEW_ARENA_ARRAY(comp_arena(), jlong, max_phase_timers);
+    memset(_phase_ticks, 0, max_phase_timers * sizeof(jlong));
+  }
+
 #if defined(SUPPORT_ASSEMBLY) || defined(SUPPORT_ABSTRACT_ASSEMBLY)
   bool print_opto_assembly = directive->PrintOptoAssemblyOption;
   // We can always print a disassembly, either abstract (hex dump) or
@@ -883,6 +892,59 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
 
   // Now generate code
   Code_Gen();
+
+  log_phase_times();
+}
+
+// Phases that are not nested in another phase.
+static bool is_top_level_phase(Phase::PhaseTraceId id) {
+  switch (id) {
+    case Phase::_t_parser:
+    case Phase::_t_optimizer:
+    case Phase::_t_matcher:
+    case Phase::_t_scheduler:
+    case Phase::_t_registerAllocation:
+    case Phase::_t_blockOrdering:
+    case Phase::_t_peephole:
+    case Phase::_t_postalloc_expand:
+    case Phase::_t_output:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void Compile::print_phase_times(outputStream* st, bool nested) const {
+  st->print("C2 %d ", _compile_id);
+  method()->print_short_name(st);
+  st->print(" (%d bytes, %u nodes):", method()->code_size(), unique());
+  for (int i = 0; i < max_phase_timers; i++) {
+    PhaseTraceId id = (PhaseTraceId)i;
+    const char* name = get_phase_trace_id_text(id);
+    if (_phase_ticks[i] == 0 || name[0] == '\0' || (!nested && !is_top_level_phase(id))) {
+      continue;
+    }
+    st->print(" %s=%.3fms", name, TimeHelper::counter_to_millis(_phase_ticks[i]));
+  }
+  st->cr();
+}
+
+// -Xlog:jit+phases=debug prints the time of the main phases of each successful
+// compilation, trace adds the nested ones, e.g. the steps of register allocation.
+void Compile::log_phase_times() {
+  if (_phase_ticks == nullptr || failing()) {
+    return;
+  }
+  ResourceMark rm;
+  LogTarget(Trace, jit, phases) lt_nested;
+  if (lt_nested.is_enabled()) {
+    LogStream ls(lt_nested);
+    print_phase_times(&ls, true);
+  } else {
+    LogTarget(Debug, jit, phases) lt;
+    LogStream ls(lt);
+    print_phase_times(&ls, false);
+  }
 }
 
 //------------------------------Compile----------------------------------------
@@ -948,6 +1010,7 @@ Compile::Compile( ciEnv* ci_env,
     _inner_loops(0),
     _interpreter_frame_size(0),
     _output(nullptr),
+    _phase_ticks(nullptr),
 #ifndef PRODUCT
     _in_dump_cnt(0),
 #endif
@@ -4321,9 +4384,14 @@ Compile::TracePhase::TracePhase(const char* name, PhaseTraceId id)
   : TraceTime(name, &Phase::timers[id], CITime, CITimeVerbose),
     _compile(Compile::current()),
     _log(nullptr),
-    _dolog(CITimeVerbose)
+    _dolog(CITimeVerbose),
+    _id(id),
+    _start_ticks(0)
 {
   assert(_compile != nullptr, "sanity check");
+  if (_compile->_phase_ticks != nullptr) {
+    _start_ticks = os::elapsed_counter();
+  }
   if (_dolog) {
     _log = _compile->log();
   }
@@ -4344,6 +4412,9 @@ Compile::TracePhase::~TracePhase() {
     }
     return; // timing code, not stressing bailouts.
   }
+  if (_start_ticks != 0) {
+    _compile->_phase_ticks[_id] += os::elapsed_counter() - _start_ticks;
+  }
 #ifdef ASSERT
   if (PrintIdealNodeCount) {
     tty->print_cr("phase name='%s' nodes='%d' live='%d' live_graph_walk='%d'",
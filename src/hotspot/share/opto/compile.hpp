@@ -240,6 +240,8 @@ class Compile : public Phase {
     Compile*    _compile;
     CompileLog* _log;
     bool _dolog;
+    PhaseTraceId _id;
+    jlong _start_ticks;              // 0 unless the phase times of this compilation are logged
    public:
     TracePhase(PhaseTraceId phaseTraceId);
     TracePhase(const char* name, PhaseTraceId phaseTraceId);
@@ -566,6 +568,9 @@ class Compile : public Phase {
   int                   _interpreter_frame_size;
 
   PhaseOutput*          _output;
+  jlong*                _phase_ticks;           // Time spent per PhaseTraceId, null unless logged
+
+  void print_phase_times(outputStream* st, bool nested) const;
 
  public:
   // Accessors
@@ -1222,6 +1227,7 @@ class Compile : public Phase {
   void Init(bool aliasing);                      // Prepare for a single compilation
   void Optimize();                               // Given a graph, optimize it
   void Code_Gen();                               // Generate code from a graph
+  void log_phase_times();                        // Print where the time of this compilation went
 
   // Management of the AliasType table.
   void grow_alias_types();
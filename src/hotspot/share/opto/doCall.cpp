@@ -505,6 +505,39 @@ static bool check_call_consistency(JVMState* jvms, CallGenerator* cg) {
 }
 #endif // ASSERT
 
+//------------------------------is_cold_escaping_call--------------------------
+// True if the out-of-line call at the current bci takes a freshly allocated
+// object and, according to the profile, is executed less than once every
+// 10000 invocations of the method.
+bool Parse::is_cold_escaping_call(CallGenerator* cg) {
+  if (!TrapColdEscapingCalls || !UseInterpreter ||
+      !C->do_escape_analysis() || !EliminateAllocations) {
+    return false;
+  }
+  if (cg->is_inline() || cg->is_late_inline() || cg->is_trap() ||
+      cg->method()->is_object_initializer() ||
+      cg->method()->is_method_handle_intrinsic()) {
+    return false;
+  }
+  int site_count = method()->call_profile_at_bci(bci()).count();
+  int invocations = method()->interpreter_invocation_count();
+  if (site_count < 0 || invocations <= 0 ||
+      (float)site_count >= invocations * PROB_UNLIKELY_MAG(4)) {
+    return false;
+  }
+  if (too_many_traps(Deoptimization::Reason_unreached)) {
+    return false;
+  }
+  // Arguments are still on the stack, use the signature of the call site.
+  int nargs = method()->get_method_at_bci(bci())->arg_size();
+  for (int i = 0; i < nargs; i++) {
+    if (AllocateNode::Ideal_allocation(argument(i)) != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //------------------------------do_call----------------------------------------
 // Handle your basic call.  Inline if we can & want to, else just setup call.
 void Parse::do_call() {
@@ -640,6 +673,14 @@ void Parse::do_call() {
   // It decides whether inlining is desirable or not.
   CallGenerator* cg = C->call_generator(callee, vtable_index, call_does_dispatch, jvms, try_inline, prof_factor(), speculative_receiver_type);
 
+  // An allocation passed to a call that is almost never executed escapes only
+  // on that path. Trapping there instead lets escape analysis scalar replace
+  // it; the object is materialized by deoptimization when the call is reached.
+  if (is_cold_escaping_call(cg)) {
+    cg = CallGenerator::for_uncommon_trap(cg->method(), Deoptimization::Reason_unreached,
+                                          Deoptimization::Action_reinterpret);
+  }
+
   // NOTE:  Don't use orig_callee and callee after this point!  Use cg->method() instead.
   orig_callee = callee = nullptr;
 
@@ -281,6 +281,14 @@ void PhaseIdealLoop::get_opaque_template_assertion_predicate_nodes(ParsePredicat
 //------------------------------Invariance-----------------------------------
 // Helper class for loop_predication_impl to compute invariance on the fly and
 // clone invariants.
+//
+// Checks are processed from the loop head down, and map_ctrl() marks the
+// projection of a hoisted invariant check as invariant. Data nodes pinned on
+// that projection become invariant as well, which is what hoists the row
+// accesses of multi-dimensional arrays: for a[i][j] in a loop over j, the
+// range check of i against a.length is hoisted first, after which the row
+// load a[i], its null check and the LoadRange of the row are invariant and the
+// range check of j is turned into a Range Check Predicate on row.length.
 class Invariance : public StackObj {
   VectorSet _visited, _invariant;
   Node_Stack _stack;
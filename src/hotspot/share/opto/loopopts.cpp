@@ -715,12 +715,18 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Check profitability
   int cost = 0;
   int phis = 0;
+  // Whether all phis could be vectorized as blends, see below.
+  bool vectorizable = VectorNode::vectorize_cmove() && UseSuperWord &&
+                      r_loop->_child == nullptr && r_loop->_head->is_CountedLoop();
   for (DUIterator_Fast imax, i = region->fast_outs(imax); i < imax; i++) {
     Node *out = region->fast_out(i);
     if (!out->is_Phi()) continue; // Ignore other control edges, etc
     phis++;
     PhiNode* phi = out->as_Phi();
     BasicType bt = phi->type()->basic_type();
+    if (!is_java_primitive(bt)) {
+      vectorizable = false;
+    }
     switch (bt) {
     case T_DOUBLE:
     case T_FLOAT:
@@ -801,6 +807,22 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Avoid duplicated float compare.
   if (phis > 1 && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) return nullptr;
 
+  // A cheap diamond in an innermost counted loop may be worth converting even
+  // if its branch is well predicted, when SuperWord can then vectorize the
+  // loop with a masked compare and a blend per CMove. If the loop is not
+  // vectorized after all, the scalar CMoves stay and can be slower than the
+  // predicted branch, so this is only done with -XX:+UseVectorIfConversion.
+  if (vectorizable && used_inside_loop && cost < ConditionalMoveLimit) {
+    for (DUIterator_Fast imax, i = region->fast_outs(imax); i < imax && vectorizable; i++) {
+      Node* out = region->fast_out(i);
+      if (out->is_Phi()) {
+        vectorizable = VectorNode::is_vectorizable_cmove(cmp_op, out->as_Phi()->type()->basic_type());
+      }
+    }
+  } else {
+    vectorizable = false;
+  }
+
   float infrequent_prob = PROB_UNLIKELY_MAG(3);
   // Ignore cost and blocks frequency if CMOVE can be moved outside the loop.
   if (used_inside_loop) {
@@ -817,6 +839,8 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // we are going to predict accurately all the time.
   if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
     //keep going
+  } else if (vectorizable) {
+    //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
     return nullptr;
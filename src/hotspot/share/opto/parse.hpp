@@ -521,6 +521,7 @@ class Parse : public GraphKit {
 
   // Helper function to setup Ideal Call nodes
   void do_call();
+  bool is_cold_escaping_call(CallGenerator* cg);
 
   // Helper function to uncommon-trap or bailout for non-compilable call-sites
   bool can_not_compile_call_site(ciMethod *dest_method, ciInstanceKlass *klass);
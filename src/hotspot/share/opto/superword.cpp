@@ -560,6 +560,7 @@ void SuperWord::create_adjacent_memop_pairs_in_one_group(const GrowableArray<con
 
   MemNode* first = vpointers.at(group_start)->mem();
   int element_size = data_size(first);
+  bool found_any = false;
 
   // For each ref in group: find others that can be paired:
   for (int i = group_start; i < group_end; i++) {
@@ -601,9 +602,63 @@ void SuperWord::create_adjacent_memop_pairs_in_one_group(const GrowableArray<con
 
       if (!found) {
         _pairset.add_pair(mem1, mem2);
+        found_any = true;
       }
     }
   }
+
+  if (!found_any) {
+    create_strided_load_pairs_in_one_group(vpointers, group_start, group_end);
+  }
+}
+
+// A group without adjacent memops may still consist of loads at a constant distance,
+// e.g. a[2*i] after unrolling. Pair them up, so that they can be vectorized with a
+// gather: lane k of the vector is loaded from the address of the first load plus
+// k times the distance.
+void SuperWord::create_strided_load_pairs_in_one_group(const GrowableArray<const VPointer*>& vpointers, const int group_start, const int group_end) {
+  if (group_end - group_start < 2) { return; }
+
+  MemNode* first = vpointers.at(group_start)->mem();
+  if (!first->is_Load() || is_subword_type(velt_basic_type(first))) { return; }
+
+  int element_size = data_size(first);
+  int distance = vpointers.at(group_start + 1)->offset_in_bytes() - vpointers.at(group_start)->offset_in_bytes();
+  if (distance % element_size != 0) { return; }
+  int stride = distance / element_size;
+  if (stride < 2 || stride > (int)SuperWordMaxGatherStride) { return; }
+
+  // All loads must be at the same distance, so that every pack has a single stride.
+  for (int i = group_start + 1; i < group_end; i++) {
+    if (vpointers.at(i)->offset_in_bytes() - vpointers.at(i - 1)->offset_in_bytes() != distance) { return; }
+  }
+
+  for (int i = group_start; i + 1 < group_end; i++) {
+    const VPointer* p1 = vpointers.at(i);
+    const VPointer* p2 = vpointers.at(i + 1);
+    MemNode* mem1 = p1->mem();
+    MemNode* mem2 = p2->mem();
+
+    // Only allow nodes from same origin idx to be packed (see CompileCommand Option Vectorize)
+    if (_do_vector_loop && !same_origin_idx(mem1, mem2)) { continue; }
+
+    // The gather node does not carry a control dependency.
+    if (!mem1->depends_only_on_test() || !mem2->depends_only_on_test()) { continue; }
+
+    if (!can_pack_into_pair(mem1, mem2, stride)) { continue; }
+
+#ifndef PRODUCT
+    if (is_trace_superword_adjacent_memops()) {
+      tty->print_cr(" strided pair (stride %d):", stride);
+      tty->print("  ");
+      p1->print();
+      tty->print("  ");
+      p2->print();
+    }
+#endif
+
+    _pairset.add_pair(mem1, mem2);
+  }
 }
 
 void VLoopMemorySlices::find_memory_slices() {
@@ -681,7 +736,7 @@ void VLoopMemorySlices::get_slice_in_reverse_order(PhiNode* head, MemNode* tail,
 }
 
 // Check if two nodes can be packed into a pair.
-bool SuperWord::can_pack_into_pair(Node* s1, Node* s2) {
+bool SuperWord::can_pack_into_pair(Node* s1, Node* s2, int stride) {
 
   // Do not use superword for non-primitives
   BasicType bt1 = velt_basic_type(s1);
@@ -697,7 +752,7 @@ bool SuperWord::can_pack_into_pair(Node* s1, Node* s2) {
   if (isomorphic(s1, s2) && !is_populate_index(s1, s2)) {
     if ((independent(s1, s2) && have_similar_inputs(s1, s2)) || reduction(s1, s2)) {
       if (!_pairset.is_left(s1) && !_pairset.is_right(s2)) {
-        if (!s1->is_Mem() || are_adjacent_refs(s1, s2)) {
+        if (!s1->is_Mem() || are_adjacent_refs(s1, s2, stride)) {
           return true;
         }
       }
@@ -707,8 +762,8 @@ bool SuperWord::can_pack_into_pair(Node* s1, Node* s2) {
 }
 
 //------------------------------are_adjacent_refs---------------------------
-// Is s1 immediately before s2 in memory?
-bool SuperWord::are_adjacent_refs(Node* s1, Node* s2) const {
+// Is s2 stride elements after s1 in memory?
+bool SuperWord::are_adjacent_refs(Node* s1, Node* s2, int stride) const {
   if (!s1->is_Mem() || !s2->is_Mem()) return false;
   if (!in_bb(s1)    || !in_bb(s2))    return false;
 
@@ -729,7 +784,7 @@ bool SuperWord::are_adjacent_refs(Node* s1, Node* s2) const {
   const VPointer& p2 = vpointer(s2->as_Mem());
   if (p1.base() != p2.base() || !p1.comparable(p2)) return false;
   int diff = p2.offset_in_bytes() - p1.offset_in_bytes();
-  return diff == data_size(s1);
+  return diff == stride * data_size(s1);
 }
 
 //------------------------------isomorphic---------------------------
@@ -1476,6 +1531,11 @@ void SuperWord::filter_packs_for_alignment() {
       return true; // accept all non memops
     }
 
+    // Gathers do not access contiguous memory, and need no alignment.
+    if (is_gather_pack(pack)) {
+      return true;
+    }
+
     mem_ops_count++;
     const AlignmentSolution* s = pack_alignment_solution(pack);
     const AlignmentSolution* intersect = current->filter(s);
@@ -1575,9 +1635,14 @@ bool SuperWord::implemented(const Node_List* pack, const uint size) const {
       // integer subword types with superword vectorization.
       // See JDK-8294816 for miscompilation issues with shorts.
       return false;
+    } else if (is_gather_pack(pack)) {
+      retValue = VectorNode::is_strided_gather_supported(size, velt_basic_type(p0));
     } else if (p0->is_Cmp()) {
       // Cmp -> Bool -> Cmove
-      retValue = UseVectorCmov;
+      retValue = VectorNode::vectorize_cmove();
+      if (opc == Op_CmpU || opc == Op_CmpUL) {
+        retValue = retValue && Matcher::supports_vector_comparison_unsigned(size, velt_basic_type(p0));
+      }
     } else if (VectorNode::is_scalar_op_that_returns_int_but_vector_op_returns_long(opc)) {
       // Requires extra vector long -> int conversion.
       retValue = VectorNode::implemented(opc, size, T_LONG) &&
@@ -1686,6 +1751,12 @@ VTransformBoolTest PackSet::get_bool_test(const Node_List* bool_pack) const {
       mask = bol->_test.negate();
       is_negated = true;
     }
+  } else if (cmp0->Opcode() == Op_CmpU || cmp0->Opcode() == Op_CmpUL) {
+    // VectorMaskCmp compares signed lanes unless the predicate carries the
+    // unsigned_compare bit. Equality does not depend on signedness.
+    if (mask != BoolTest::eq && mask != BoolTest::ne) {
+      mask = (BoolTest::mask)(mask | BoolTest::unsigned_compare);
+    }
   }
 
   return VTransformBoolTest(mask, is_negated);
@@ -1720,6 +1791,11 @@ bool SuperWord::profitable(const Node_List* p) const {
       return false;
     }
   }
+  if (is_gather_pack(p) && p->size() < 4) {
+    // A gather executes roughly one load per lane, plus the setup of the
+    // index vector. It only pays off if it feeds wide enough vector work.
+    return false;
+  }
   if (VectorNode::is_shift(p0)) {
     // For now, return false if shift count is vector or not scalar promotion
     // case (different shift counts) because it is not supported yet.
@@ -1784,6 +1860,10 @@ bool SuperWord::profitable(const Node_List* p) const {
     if (cmp == nullptr || get_pack(cmp) == nullptr) {
       return false;
     }
+    // The mask produced by the compare must have lanes of the blended size.
+    if (type2aelembytes(velt_basic_type(cmp)) != type2aelembytes(velt_basic_type(p0))) {
+      return false;
+    }
   }
   return true;
 }
@@ -2616,7 +2696,10 @@ void VTransform::determine_mem_ref_and_aw_for_main_loop_alignment() {
     MemNode* p0 = vtn->nodes().at(0)->isa_Mem();
     if (p0 == nullptr) { continue; }
 
-    int vw = p0->memory_size() * vtn->nodes().length();
+    // A gather only reads single elements. Prefer any contiguous memop as reference.
+    VTransformLoadVectorNode* load = vtn->isa_LoadVector();
+    bool is_gather = load != nullptr && load->is_gather();
+    int vw = p0->memory_size() * (is_gather ? 1 : vtn->nodes().length());
     if (vw > max_aw) {
       max_aw = vw;
       mem_ref = p0;
@@ -568,11 +568,12 @@ class SuperWord : public ResourceObj {
   void create_adjacent_memop_pairs_in_all_groups(const GrowableArray<const VPointer*>& vpointers);
   static int find_group_end(const GrowableArray<const VPointer*>& vpointers, int group_start);
   void create_adjacent_memop_pairs_in_one_group(const GrowableArray<const VPointer*>& vpointers, const int group_start, int group_end);
+  void create_strided_load_pairs_in_one_group(const GrowableArray<const VPointer*>& vpointers, const int group_start, int group_end);
 
   // Various methods to check if we can pack two nodes.
-  bool can_pack_into_pair(Node* s1, Node* s2);
-  // Is s1 immediately before s2 in memory?
-  bool are_adjacent_refs(Node* s1, Node* s2) const;
+  bool can_pack_into_pair(Node* s1, Node* s2, int stride = 1);
+  // Is s2 stride elements after s1 in memory? By default: is s1 immediately before s2?
+  bool are_adjacent_refs(Node* s1, Node* s2, int stride = 1) const;
   // Are s1 and s2 similar?
   bool isomorphic(Node* s1, Node* s2);
   // Do we have pattern n1 = (iv + c) and n2 = (iv + c + 1)?
@@ -604,6 +605,11 @@ class SuperWord : public ResourceObj {
 
   DEBUG_ONLY(void verify_packs() const;)
 
+  // Is the pack made of strided loads, to be vectorized with a gather?
+  bool is_gather_pack(const Node_List* pack) const {
+    return pack->at(0)->is_Load() && _vloop_analyzer.vpointers().stride_in_elements(pack) > 1;
+  }
+
   // Can code be generated for the pack, restricted to size nodes?
   bool implemented(const Node_List* pack, const uint size) const;
   // Find the maximal implemented size smaller or equal to the packs size
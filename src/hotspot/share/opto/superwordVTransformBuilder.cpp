@@ -139,7 +139,8 @@ VTransformVectorNode* SuperWordVTransformBuilder::make_vector_vtnode_for_pack(co
   VTransformVectorNode* vtn = nullptr;
 
   if (p0->is_Load()) {
-    vtn = new (_vtransform.arena()) VTransformLoadVectorNode(_vtransform, pack_size);
+    int stride = _vloop_analyzer.vpointers().stride_in_elements(pack);
+    vtn = new (_vtransform.arena()) VTransformLoadVectorNode(_vtransform, pack_size, stride);
   } else if (p0->is_Store()) {
     vtn = new (_vtransform.arena()) VTransformStoreVectorNode(_vtransform, pack_size);
   } else if (p0->is_Bool()) {
@@ -217,6 +217,14 @@ const VPointer& VLoopVPointers::vpointer(const MemNode* mem) const {
   return _vpointers[pointers_idx];
 }
 
+int VLoopVPointers::stride_in_elements(const Node_List* pack) const {
+  const VPointer& p0 = vpointer(pack->at(0)->as_Mem());
+  const VPointer& p1 = vpointer(pack->at(1)->as_Mem());
+  int distance = p1.offset_in_bytes() - p0.offset_in_bytes();
+  assert(distance > 0 && distance % p0.memory_size() == 0, "lanes must be ordered by offset");
+  return distance / p0.memory_size();
+}
+
 #ifndef PRODUCT
 void VLoopVPointers::print() const {
   tty->print_cr("\nVLoopVPointers::print:");
@@ -495,6 +495,9 @@ class VLoopVPointers : public StackObj {
 
   void compute_vpointers();
   const VPointer& vpointer(const MemNode* mem) const;
+  // Distance in elements between the lanes of a memop pack: 1 if the memops are
+  // adjacent, larger for strided loads that are vectorized with a gather.
+  int stride_in_elements(const Node_List* pack) const;
   NOT_PRODUCT( void print() const; )
 
 private:
@@ -81,6 +81,10 @@ int VectorNode::opcode(int sopc, BasicType bt) {
     return (bt == T_DOUBLE ? Op_FmaVD : 0);
   case Op_FmaF:
     return (bt == T_FLOAT ? Op_FmaVF : 0);
+  case Op_CMoveI:
+    return (bt == T_INT ? Op_VectorBlend : 0);
+  case Op_CMoveL:
+    return (bt == T_LONG ? Op_VectorBlend : 0);
   case Op_CMoveF:
     return (bt == T_FLOAT ? Op_VectorBlend : 0);
   case Op_CMoveD:
@@ -491,6 +495,16 @@ bool VectorNode::is_populate_index_supported(BasicType bt) {
   return Matcher::match_rule_supported_vector(Op_PopulateIndex, vlen, bt);
 }
 
+// The index vector [0, s, 2s, ...] is computed as PopulateIndex(0, 1) * Replicate(s).
+// Subword gathers take their indices from memory and are not used here.
+bool VectorNode::is_strided_gather_supported(uint vlen, BasicType bt) {
+  return !is_subword_type(bt) &&
+         Matcher::match_rule_supported_vector(Op_LoadVectorGather, vlen, bt) &&
+         Matcher::match_rule_supported_vector(Op_PopulateIndex, vlen, T_INT) &&
+         Matcher::match_rule_supported_vector(Op_Replicate, vlen, T_INT) &&
+         Matcher::match_rule_supported_vector(Op_MulVI, vlen, T_INT);
+}
+
 bool VectorNode::is_shift_opcode(int opc) {
   switch (opc) {
   case Op_LShiftI:
@@ -555,6 +569,43 @@ bool VectorNode::is_minmax_opcode(int opc) {
   return opc == Op_MinI || opc == Op_MaxI;
 }
 
+bool VectorNode::vectorize_cmove() {
+  return UseVectorCmov || (UseVectorIfConversion && Matcher::has_predicated_vectors());
+}
+
+bool VectorNode::is_vectorizable_cmove(int cmp_opc, BasicType bt) {
+  int cmove_opc;
+  switch (bt) {
+    case T_INT:    cmove_opc = Op_CMoveI; break;
+    case T_LONG:   cmove_opc = Op_CMoveL; break;
+    case T_FLOAT:  cmove_opc = Op_CMoveF; break;
+    case T_DOUBLE: cmove_opc = Op_CMoveD; break;
+    default:       return false;
+  }
+  BasicType cmp_bt;
+  switch (cmp_opc) {
+    case Op_CmpI:
+    case Op_CmpU:  cmp_bt = T_INT;    break;
+    case Op_CmpL:
+    case Op_CmpUL: cmp_bt = T_LONG;   break;
+    case Op_CmpF:  cmp_bt = T_FLOAT;  break;
+    case Op_CmpD:  cmp_bt = T_DOUBLE; break;
+    default:       return false;
+  }
+  // The mask lanes must line up with the blended lanes.
+  if (type2aelembytes(cmp_bt) != type2aelembytes(bt)) {
+    return false;
+  }
+  const uint vlen = (uint)Matcher::max_vector_size_auto_vectorization(bt);
+  if ((cmp_opc == Op_CmpU || cmp_opc == Op_CmpUL) &&
+      !Matcher::supports_vector_comparison_unsigned(vlen, cmp_bt)) {
+    return false;
+  }
+  return vlen >= 4 &&
+         implemented(cmove_opc, vlen, bt) &&
+         implemented(Op_Bool, vlen, cmp_bt);
+}
+
 bool VectorNode::is_shift(Node* n) {
   return is_shift_opcode(n->Opcode());
 }
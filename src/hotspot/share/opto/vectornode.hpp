@@ -88,6 +88,14 @@ class VectorNode : public TypeNode {
   static bool is_convert_opcode(int opc);
   static bool is_minmax_opcode(int opc);
 
+  // Whether Cmp + Bool + CMove may be vectorized into VectorMaskCmp +
+  // VectorBlend (UseVectorCmov, or UseVectorIfConversion with predicated
+  // vectors).
+  static bool vectorize_cmove();
+  // Whether a CMove of type bt, selected by a compare with opcode cmp_opc, can
+  // be vectorized at the maximal auto-vectorization size.
+  static bool is_vectorizable_cmove(int cmp_opc, BasicType bt);
+
   static bool is_vshift_cnt_opcode(int opc);
 
   static bool is_rotate_opcode(int opc);
@@ -108,6 +116,8 @@ class VectorNode : public TypeNode {
   static bool is_vector_rotate_supported(int opc, uint vlen, BasicType bt);
   static bool is_vector_integral_negate_supported(int opc, uint vlen, BasicType bt, bool use_predicate);
   static bool is_populate_index_supported(BasicType bt);
+  // Can loads at a constant distance be vectorized as a gather?
+  static bool is_strided_gather_supported(uint vlen, BasicType bt);
   // Return true if every bit in this vector is 1.
   static bool is_all_ones_vector(Node* n);
   // Return true if every bit in this vector is 0.
@@ -349,7 +349,15 @@ bool VTransformGraph::has_store_to_load_forwarding_failure(const VLoopAnalyzer&
     int iv_offset = k * iv_stride; // virtual super-unrolling
     for (int i = 0; i < _schedule.length(); i++) {
       VTransformNode* vtn = _schedule.at(i);
-      if (vtn->is_load_or_store_in_loop()) {
+      VTransformLoadVectorNode* gather = vtn->isa_LoadVector();
+      if (gather != nullptr && gather->is_gather()) {
+        // The lanes of a gather are not contiguous, add them one by one.
+        for (int l = 0; l < gather->nodes().length(); l++) {
+          const VPointer& p = vloop_analyzer.vpointers().vpointer(gather->nodes().at(l)->as_Mem());
+          memory_regions.push(VMemoryRegion(p, iv_offset, 1, schedule_order));
+        }
+        schedule_order++;
+      } else if (vtn->is_load_or_store_in_loop()) {
         const VPointer& p = vtn->vpointer(vloop_analyzer);
         if (p.valid()) {
           VTransformVectorNode* vector = vtn->isa_Vector();
@@ -584,6 +592,23 @@ VTransformApplyResult VTransformLoadVectorNode::apply(const VLoopAnalyzer& vloop
     }
   }
 
+  if (is_gather()) {
+    // Lane k is loaded from adr + k * _stride elements: indices = [0, 1, 2, ...] * [_stride, ...].
+    PhaseIdealLoop* phase = vloop_analyzer.vloop().phase();
+    const TypeVect* index_vt = TypeVect::make(T_INT, vlen);
+    VectorNode* iota = new PopulateIndexNode(phase->igvn().intcon(0), phase->igvn().intcon(1), index_vt);
+    register_new_node_from_vectorization(vloop_analyzer, iota, first);
+    VectorNode* stride = VectorNode::scalar2vector(phase->igvn().intcon(_stride), vlen, T_INT);
+    register_new_node_from_vectorization(vloop_analyzer, stride, first);
+    VectorNode* indices = VectorNode::make(Op_MulVI, iota, stride, index_vt);
+    register_new_node_from_vectorization(vloop_analyzer, indices, first);
+
+    assert(control_dependency() == LoadNode::DependsOnlyOnTest, "gathers are only formed from such loads");
+    LoadVectorNode* vn = new LoadVectorGatherNode(ctrl, mem, adr, adr_type, TypeVect::make(bt, vlen), indices);
+    register_new_node_from_vectorization_and_replace_scalar_nodes(vloop_analyzer, vn);
+    return VTransformApplyResult::make_vector(vn, vlen, vn->memory_size());
+  }
+
   LoadVectorNode* vn = LoadVectorNode::make(opc, ctrl, mem, adr, adr_type, vlen, bt,
                                             control_dependency());
   DEBUG_ONLY( if (VerifyAlignVector) { vn->set_must_verify_alignment(); } )
@@ -479,17 +479,21 @@ class VTransformReductionVectorNode : public VTransformVectorNode {
 };
 
 class VTransformLoadVectorNode : public VTransformVectorNode {
+private:
+  // Distance in elements between the lanes. Strided loads become a gather.
+  const int _stride;
 public:
   // req = 3 -> [ctrl, mem, adr]
-  VTransformLoadVectorNode(VTransform& vtransform, uint number_of_nodes) :
-    VTransformVectorNode(vtransform, 3, number_of_nodes) {}
+  VTransformLoadVectorNode(VTransform& vtransform, uint number_of_nodes, int stride = 1) :
+    VTransformVectorNode(vtransform, 3, number_of_nodes), _stride(stride) {}
+  bool is_gather() const { return _stride > 1; }
   LoadNode::ControlDependency control_dependency() const;
   virtual VTransformLoadVectorNode* isa_LoadVector() override { return this; }
   virtual bool is_load_or_store_in_loop() const override { return true; }
   virtual const VPointer& vpointer(const VLoopAnalyzer& vloop_analyzer) const override { return vloop_analyzer.vpointers().vpointer(nodes().at(0)->as_Mem()); }
   virtual VTransformApplyResult apply(const VLoopAnalyzer& vloop_analyzer,
                                       const GrowableArray<Node*>& vnode_idx_to_transformed_node) const override;
-  NOT_PRODUCT(virtual const char* name() const override { return "LoadVector"; };)
+  NOT_PRODUCT(virtual const char* name() const override { return is_gather() ? "LoadVectorGather" : "LoadVector"; };)
 };
 
 class VTransformStoreVectorNode : public VTransformVectorNode {
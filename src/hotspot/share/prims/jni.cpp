@@ -650,7 +650,11 @@ JNI_ENTRY(jobject, jni_PopLocalFrame(JNIEnv *env, jobject result))
   HOTSPOT_JNI_POPLOCALFRAME_ENTRY(env, result);
 
   //%note jni_11
-  Handle result_handle(thread, JNIHandles::resolve(result));
+  // Most callers pop with a null result; skip preserving it in that case.
+  Handle result_handle;
+  if (result != nullptr) {
+    result_handle = Handle(thread, JNIHandles::resolve(result));
+  }
   JNIHandleBlock* old_handles = thread->active_handles();
   JNIHandleBlock* new_handles = old_handles->pop_frame_link();
   if (new_handles != nullptr) {
@@ -661,7 +665,9 @@ JNI_ENTRY(jobject, jni_PopLocalFrame(JNIEnv *env, jobject result))
     thread->set_active_handles(new_handles);
     old_handles->set_pop_frame_link(nullptr);              // clear link we won't release new_handles below
     JNIHandleBlock::release_block(old_handles, thread); // may block
-    result = JNIHandles::make_local(thread, result_handle());
+    if (result != nullptr) {
+      result = JNIHandles::make_local(thread, result_handle());
+    }
   }
   HOTSPOT_JNI_POPLOCALFRAME_RETURN(result);
   return result;
@@ -3189,6 +3189,13 @@ void JvmtiSampledObjectAllocEventCollector::start() {
       return;
     }
 
+    // SampledObjectAlloc is thread filtered. If no environment enabled it for
+    // this thread, skip recording the sample; nobody would be posted to.
+    JvmtiThreadState* state = JavaThread::current()->jvmti_thread_state();
+    if (state != nullptr && !state->is_enabled(JVMTI_EVENT_SAMPLED_OBJECT_ALLOC)) {
+      return;
+    }
+
     _enable = true;
     setup_jvmti_thread_state();
     _post_callback = JvmtiExport::post_sampled_object_alloc;
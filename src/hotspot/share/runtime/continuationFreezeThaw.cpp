@@ -403,6 +403,7 @@ class FreezeBase : public StackObj {
 
 public:
   NOINLINE freeze_result freeze_slow();
+  CONT_JFR_ONLY(const char* slow_path_cause() const;)
   void freeze_fast_existing_chunk();
 
   CONT_JFR_ONLY(FreezeThawJfrInfo& jfr_info() { return _jfr_info; })
@@ -581,7 +582,20 @@ freeze_result Freeze<ConfigT>::try_freeze_fast() {
   DEBUG_ONLY(_fast_freeze_size = size_if_fast_freeze_available();)
   assert(_fast_freeze_size == 0, "");
 
-  stackChunkOop chunk = allocate_chunk(cont_size() + frame::metadata_words + _monitors_in_lockstack, _cont.argsize() + frame::metadata_words_at_top);
+  const size_t needed = cont_size() + frame::metadata_words + _monitors_in_lockstack;
+  size_t stack_size = needed;
+  stackChunkOop tail = _cont.tail();
+  if (tail != nullptr && tail->is_empty() && (size_t)tail->stack_size() < needed) {
+    // The empty tail chunk is too small and is about to be replaced. Leave room
+    // to grow, so that a continuation whose depth varies between yields soon
+    // settles on a chunk that is reused, instead of allocating on every deeper freeze.
+    const size_t grown = MIN2(MAX2(needed, (size_t)tail->stack_size() * 2), needed * 2);
+    const size_t max_size = CollectedHeap::stack_chunk_max_size();
+    if (max_size == 0 || InstanceStackChunkKlass::cast(vmClasses::StackChunk_klass())->instance_size(grown) < max_size) {
+      stack_size = grown;
+    }
+  }
+  stackChunkOop chunk = allocate_chunk(stack_size, _cont.argsize() + frame::metadata_words_at_top);
   if (freeze_fast_new_chunk(chunk)) {
     return freeze_ok;
   }
@@ -696,9 +710,10 @@ bool FreezeBase::freeze_fast_new_chunk(stackChunkOop chunk) {
   chunk->set_max_thawing_size(cont_size());
 
   // in a fresh chunk, we freeze *with* the bottom-most frame's stack arguments.
-  // They'll then be stored twice: in the chunk and in the parent chunk's top frame
-  const int chunk_start_sp = cont_size() + frame::metadata_words + _monitors_in_lockstack;
-  assert(chunk_start_sp == chunk->stack_size(), "");
+  // They'll then be stored twice: in the chunk and in the parent chunk's top frame.
+  // The chunk may have been allocated with room to spare below the frames.
+  const int chunk_start_sp = chunk->stack_size();
+  assert(chunk_start_sp >= cont_size() + frame::metadata_words + _monitors_in_lockstack, "");
 
   DEBUG_ONLY(_orig_chunk_sp = chunk->start_address() + chunk_start_sp;)
 
@@ -806,6 +821,21 @@ void FreezeBase::freeze_fast_copy(stackChunkOop chunk, int chunk_start_sp CONT_J
 #endif
 }
 
+#if CONT_JFR
+// The checks mirror the order in which the fast path is given up on.
+const char* FreezeBase::slow_path_cause() const {
+  if (!UseContinuationFastPath) {
+    return "fast path disabled";
+  } else if (!_thread->cont_fastpath()) {
+    return "interpreted or native frames";
+  } else if (_barriers) {
+    return "chunk requires GC barriers";
+  } else {
+    return "chunk allocation failed";
+  }
+}
+#endif
+
 NOINLINE freeze_result FreezeBase::freeze_slow() {
 #ifdef ASSERT
   ResourceMark rm;
@@ -818,6 +848,7 @@ NOINLINE freeze_result FreezeBase::freeze_slow() {
   EventContinuationFreezeSlow e;
   if (e.should_commit()) {
     e.set_id(cast_from_oop<u8>(_cont.continuation()));
+    e.set_cause(slow_path_cause());
     e.commit();
   }
 #endif
@@ -456,6 +456,13 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, BytecodeVerificationLocal, false, DIAGNOSTIC,               \
           "Enable the Java bytecode verifier for local classes")            \
                                                                             \
+  product(ccstr, VerificationCacheFile, nullptr, DIAGNOSTIC,                \
+          "Skip verifying classes that the builtin loaders read from the "  \
+          "class path or runtime image and that passed verification in "    \
+          "an earlier run with the same VM and class path, as recorded "    \
+          "in this file. The file must be trusted as much as the class "    \
+          "path")                                                           \
+                                                                            \
   develop(bool, VerifyStackAtCalls, false,                                  \
           "Verify that the stack pointer is unchanged after calls")         \
                                                                             \
@@ -547,6 +554,42 @@ const int ObjectAlignmentInBytes = 8;
           "When DumpVitalsAtExit is set, the file name prefix for the "     \
           "output files (default is sapmachine_vitals_<pid>).")             \
                                                                             \
+  product(ccstr, VitalsHistoryFile, NULL,                                   \
+          "If set, keep the vitals short and long term tables in a memory " \
+          "mapped file of that name, which survives abnormal termination "  \
+          "of the VM. Decode it with jcmd VM.vitals file=<name>.")          \
+                                                                            \
+  product(ccstr, VitalsMetricsFile, NULL,                                   \
+          "If set, after every regular vitals sample write the latest "     \
+          "values to this file in OpenMetrics text format, e.g. for a "     \
+          "node exporter textfile collector.")                              \
+                                                                            \
+  product(bool, VitalsBurstSampling, false,                                 \
+          "Temporarily sample vitals at a high rate when consecutive "      \
+          "samples show a sudden change, see VitalsBurst*Threshold "        \
+          "options, or when HiMemReport raises its alert level.")           \
+                                                                            \
+  product(uintx, VitalsBurstSampleInterval, 100,                            \
+          "Vitals burst sample interval in milliseconds")                   \
+          range(10, 1000)                                                   \
+                                                                            \
+  product(uintx, VitalsBurstDuration, 10,                                   \
+          "Duration of a vitals burst sampling window in seconds")          \
+          range(1, 600)                                                     \
+                                                                            \
+  product(size_t, VitalsBurstRSSGrowthThreshold, 256 * M,                   \
+          "Start burst sampling if the process RSS grew by at least this "  \
+          "many bytes since the previous sample (0 = off)")                 \
+                                                                            \
+  product(uintx, VitalsBurstThreadCountThreshold, 100,                      \
+          "Start burst sampling if the number of java threads grew by at "  \
+          "least this many since the previous sample (0 = off)")            \
+                                                                            \
+  product(uintx, VitalsBurstGCCPUThreshold, 200,                            \
+          "Start burst sampling if GC threads used at least this many "     \
+          "percent of one CPU since the previous sample (0 = off). "        \
+          "Requires UsePerfData.")                                          \
+                                                                            \
   /* SapMachine 2023-09-18: malloc trace */                                 \
   product(bool, UseMallocHooks, false,                                      \
           "Preloads the malloc hooks library needed for the malloc trace. " \
@@ -579,6 +622,12 @@ const int ObjectAlignmentInBytes = 8;
           "malloc trace if enabled at startup.")                            \
           range(1, 1000)                                                    \
                                                                             \
+  product(uintx, MallocTraceSampleInterval, 0,                              \
+          "If > 0 each thread only records about one allocation per the "   \
+          "given number of bytes allocated for the malloc trace if "        \
+          "enabled at startup. The samples are picked randomly and the "    \
+          "dump shows the estimated sizes and counts.")                     \
+                                                                            \
   product(bool, MallocTraceUseBacktrace, PPC_ONLY(false) NOT_PPC(true),     \
           "If set we use the backtrace() call to sample the stacks of "     \
           "the malloc trace if enabled at startup. Note that while this "   \
@@ -718,6 +767,14 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(bool, NMTMallocHeaders, true,                                     \
+          "Prefix each malloced block with a header holding size and "      \
+          "memory tag. If disabled, summary tracking takes the size from "  \
+          "the C-heap allocator and keeps the tag in a side table, which "  \
+          "saves memory for small blocks but loses overflow detection. "    \
+          "Ignored for NativeMemoryTracking=detail and on platforms "       \
+          "that cannot report malloc block sizes")                          \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -838,6 +895,10 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, PrintClassLoaderDataGraphAtExit, false,                     \
           "Print the class loader data graph at exit")                      \
                                                                             \
+  product(bool, CountDictionaryLookups, false, DIAGNOSTIC,                  \
+          "Count the dictionary hits and misses when resolving classes, "   \
+          "per class loader, for VM.classloader_stats")                     \
+                                                                            \
   product(bool, AllowParallelDefineClass, false,                            \
           "Allow parallel defineClass requests for class loaders "          \
           "registering as parallel capable")                                \
@@ -876,6 +937,22 @@ const int ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                                 \
           range(1024, max_jint)                                             \
                                                                             \
+  product(bool, ObjectMonitorNUMAHandoff, false, EXPERIMENTAL,              \
+          "On monitor exit, prefer waking a blocked thread that last "      \
+          "ran on the same NUMA node as the exiting thread. Requires "      \
+          "UseNUMA.")                                                       \
+                                                                            \
+  product(int, ObjectMonitorNUMAHandoffLimit, 8, EXPERIMENTAL,              \
+          "Maximum number of consecutive same-node handoffs that may "      \
+          "bypass the head of a monitor's entry list")                      \
+          range(1, max_jint)                                                \
+                                                                            \
+  product(intx, MonitorDeflationTimeBudget, 0, DIAGNOSTIC,                  \
+          "Maximum time in milliseconds spent searching for idle "          \
+          "monitors in one deflation cycle; the remainder is left for "     \
+          "later cycles (0 is off).")                                       \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, MonitorUnlinkBatch, 500, DIAGNOSTIC,                        \
           "The maximum number of monitors to unlink in one batch. ")        \
           range(1, max_jint)                                                \
@@ -959,6 +1036,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, RestrictContended, true,                                    \
           "Restrict @Contended to trusted classes")                         \
                                                                             \
+  product(ccstrlist, HotFields, "", DIAGNOSTIC,                             \
+          "Comma separated list of instance fields, as class.field, to "    \
+          "lay out first in their class, next to the object header or "     \
+          "the fields of the super class")                                  \
+                                                                            \
   product(int, DiagnoseSyncOnValueBasedClasses, 0, DIAGNOSTIC,              \
              "Detect and take action upon identifying synchronization on "  \
              "value based classes. Modes: "                                 \
@@ -1069,6 +1151,18 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseDynamicNumberOfCompilerThreads, true,                    \
           "Dynamically choose the number of parallel compiler threads")     \
                                                                             \
+  product(uint, DynamicCompilerThreadsCPUPercentage, 100,                   \
+          "Maximum number of threads per compiler started by "              \
+          "UseDynamicNumberOfCompilerThreads, as a percentage of the "      \
+          "active processor count")                                         \
+          range(1, 100)                                                     \
+                                                                            \
+  product(intx, DynamicCompilerThreadsMinQueueWait, 0,                      \
+          "Only start additional compiler threads if the last task "        \
+          "taken from the queue waited at least this many milliseconds; "   \
+          "0 disables the check")                                           \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, ReduceNumberOfCompilerThreads, true, DIAGNOSTIC,            \
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
@@ -1681,6 +1775,10 @@ const int ObjectAlignmentInBytes = 8;
           "Size of code heap with non-nmethods (in bytes)")                 \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
                                                                             \
+  product(bool, CodeCacheNUMAInterleave, false, EXPERIMENTAL,               \
+          "Interleave code cache memory across NUMA nodes when "            \
+          "UseNUMA is enabled")                                             \
+                                                                            \
   product_pd(uintx, CodeCacheExpansionSize,                                 \
           "Code cache expansion size (in bytes)")                           \
           range(32*K, max_uintx)                                            \
@@ -1965,6 +2063,10 @@ const int ObjectAlignmentInBytes = 8;
           "(will be rounded to nearest higher power of 2)")                 \
           range(minimumStringTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(bool, StringTableNodeFreeList, false, EXPERIMENTAL,               \
+          "Recycle the C-heap nodes of dead interned String table "         \
+          "entries through a free list instead of freeing them")            \
+                                                                            \
   product(uintx, SymbolTableSize, defaultSymbolTableSize, EXPERIMENTAL,     \
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
@@ -2003,6 +2105,10 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, StringDeduplicationResizeALot, false, DIAGNOSTIC,           \
           "Force more frequent table resizing")                             \
                                                                             \
+  product(uint, StringDeduplicationThreads, 1, EXPERIMENTAL,                \
+          "Number of threads processing deduplication requests")            \
+          range(1, 64)                                                      \
+                                                                            \
   product(uint64_t, StringDeduplicationHashSeed, 0, DIAGNOSTIC,             \
           "Seed for the table hashing function; 0 requests computed seed")  \
                                                                             \
@@ -2024,6 +2130,12 @@ const int ObjectAlignmentInBytes = 8;
           "Logging (-Xlog:async).")                                         \
           range(100*K, 50*M)                                                \
                                                                             \
+  product(uint, LogRateLimit, 0, DIAGNOSTIC,                                \
+          "Maximum number of messages per second logged through any one "   \
+          "tag set. Further messages in the same second are dropped and "   \
+          "counted in a summary line. 0 means no limit")                    \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, CheckIntrinsics, true, DIAGNOSTIC,                          \
              "When a class C is loaded, check that "                        \
              "(1) all intrinsics defined by the VM for class C are present "\
@@ -2085,6 +2197,17 @@ const int ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, nullptr,                    \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(ccstr, FlightRecorderChunkSink, nullptr, DIAGNOSTIC,     \
+          "Named pipe or file to which each completed Flight Recorder "     \
+          "chunk is appended, for off-box collection. Chunks are "          \
+          "skipped while a pipe has no reader or stays full. A regular "    \
+          "file grows without bound and must be rotated by the consumer"))  \
+                                                                            \
+  JFR_ONLY(product(uint, FlightRecorderChunkSinkCompression, 0, DIAGNOSTIC, \
+          "Gzip level used for FlightRecorderChunkSink. Every 1M block "    \
+          "is a separate gzip member. 0 writes chunks uncompressed.")       \
+          range(0, 9))                                                      \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
@@ -2121,6 +2244,13 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(size_t, TrimNativeHeapFreeThreshold, 0, EXPERIMENTAL,             \
+          "With TrimNativeHeapInterval, skip a periodic trim unless the "   \
+          "native heap holds at least this many bytes in free blocks, "     \
+          "or available memory is low. Trims are then also spaced "         \
+          "by their cost. 0 trims at every interval.")                      \
+          range(0, max_uintx)                                               \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
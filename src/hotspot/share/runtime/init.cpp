@@ -44,6 +44,7 @@
 #include "runtime/init.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/timerTrace.hpp"
 #include "sanitizers/leak.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_JVMCI
@@ -130,8 +131,12 @@ jint init_globals() {
   initial_stubs_init();
   // stack overflow exception blob is referenced by the interpreter
   SharedRuntime::generate_initial_stubs();
-  jint status = universe_init();  // dependent on codeCache_init and
-                                  // initial_stubs_init and metaspace_init.
+  jint status;
+  {
+    TraceTime timer("Initialize universe", TRACETIME_LOG(Info, startuptime));
+    status = universe_init();  // dependent on codeCache_init and
+                               // initial_stubs_init and metaspace_init.
+  }
   if (status != JNI_OK)
     return status;
 
@@ -497,6 +497,7 @@ JavaThread::JavaThread(MemTag mem_tag) :
   _held_monitor_count(0),
   _jni_monitor_count(0),
   _unlocked_inflated_monitor(nullptr),
+  _profile_sample_countdown(0),
 
   _preempt_alternate_return(nullptr),
   _preemption_cancelled(false),
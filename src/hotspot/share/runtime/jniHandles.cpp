@@ -52,6 +52,8 @@ OopStorage* JNIHandles::_weak_global_handles = nullptr;
 
 void jni_handles_init() {
   JNIHandles::_global_handles = OopStorageSet::create_strong("JNI Global", mtInternal);
+  // Global handles are only set on creation and cleared on destruction.
+  JNIHandles::_global_handles->enable_young_block_tracking();
   JNIHandles::_weak_global_handles = OopStorageSet::create_weak("JNI Weak", mtInternal);
 }
 
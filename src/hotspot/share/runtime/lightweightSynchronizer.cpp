@@ -662,6 +662,14 @@ void LightweightSynchronizer::enter(Handle obj, BasicLock* lock, JavaThread* cur
 
   LockStack& lock_stack = current->lock_stack();
 
+  if (lock_stack.is_full() && VM_Version::supports_recursive_lightweight_locking() &&
+      lock_stack.top() == obj()) {
+    // A recursive enter that only failed for lack of space. Make room the
+    // same way as for a new fast lock instead of inflating the innermost,
+    // most recently used, lock.
+    ensure_lock_stack_space(current);
+  }
+
   if (!lock_stack.is_full() && lock_stack.try_recursive_enter(obj())) {
     // Recursively fast locked
     return;
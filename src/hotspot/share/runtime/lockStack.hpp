@@ -95,6 +95,10 @@ class LockStack {
   // Precondition: This lock-stack must not be empty.
   inline oop bottom() const;
 
+  // Get the youngest oop from this lock-stack.
+  // Precondition: This lock-stack must not be empty.
+  inline oop top() const;
+
   // Is the lock-stack empty.
   inline bool is_empty() const;
 
@@ -82,6 +82,11 @@ inline oop LockStack::bottom() const {
   return _base[0];
 }
 
+inline oop LockStack::top() const {
+  assert(to_index(_top) > 0, "must contain an oop");
+  return _base[to_index(_top) - 1];
+}
+
 inline bool LockStack::is_empty() const {
   return to_index(_top) == 0;
 }
@@ -41,6 +41,9 @@
 #include "jfr/jfr.hpp"
 #endif
 
+// SapMachine 2019-02-20: Vitals
+#include "vitals/vitals.hpp"
+
 // List of all NonJavaThreads and safe iteration over that list.
 
 class NonJavaThread::List {
@@ -86,6 +89,8 @@ void NonJavaThread::remove_from_the_list() {
     MutexLocker ml(NonJavaThreadsList_lock, Mutex::_no_safepoint_check_flag);
     // Cleanup BarrierSet-related data before removing from list.
     BarrierSet::barrier_set()->on_thread_detach(this);
+    // SapMachine 2019-02-20: Vitals
+    sapmachine_vitals::counters::add_exited_thread_cpu_time(this);
     NonJavaThread* volatile* p = &_the_list._head;
     for (NonJavaThread* t = *p; t != nullptr; p = &t->_next, t = *p) {
       if (t == this) {
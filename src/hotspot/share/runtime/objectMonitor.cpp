@@ -49,6 +49,7 @@
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/safefetch.hpp"
@@ -259,6 +260,7 @@ ObjectMonitor::ObjectMonitor(oop object) :
   _cxq(nullptr),
   _succ(NO_OWNER),
   _SpinDuration(ObjectMonitor::Knob_SpinLimit),
+  _numa_handoffs(0),
   _contentions(0),
   _WaitSet(nullptr),
   _waiters(0),
@@ -1443,7 +1445,7 @@ void ObjectMonitor::exit(JavaThread* current, bool not_suspended) {
       // Given all that, we have to tolerate the circumstance where "w" is
       // associated with current.
       assert(w->TState == ObjectWaiter::TS_ENTER, "invariant");
-      ExitEpilog(current, w);
+      ExitEpilog(current, entry_list_successor());
       return;
     }
 
@@ -1495,12 +1497,48 @@ void ObjectMonitor::exit(JavaThread* current, bool not_suspended) {
     w = _EntryList;
     if (w != nullptr) {
       guarantee(w->TState == ObjectWaiter::TS_ENTER, "invariant");
-      ExitEpilog(current, w);
+      ExitEpilog(current, entry_list_successor());
       return;
     }
   }
 }
 
+// Select the thread to wake from the EntryList. This is normally the head.
+// With ObjectMonitorNUMAHandoff, a waiter near the front of the list that
+// blocked on the exiting thread's NUMA node is preferred, so that the monitor
+// and the data it protects stay on one node. To keep remote waiters from
+// starving, the head is taken after ObjectMonitorNUMAHandoffLimit such
+// handoffs in a row.
+ObjectWaiter* ObjectMonitor::entry_list_successor() {
+  static const int scan_limit = 8;
+  ObjectWaiter* head = _EntryList;
+  assert(head != nullptr, "invariant");
+  if (!ObjectMonitorNUMAHandoff || !UseNUMA) {
+    return head;
+  }
+
+  const int node = os::numa_get_group_id();
+  if (head->_numa_node != node && _numa_handoffs < ObjectMonitorNUMAHandoffLimit) {
+    int scanned = 0;
+    for (ObjectWaiter* p = head->_next; p != nullptr && scanned < scan_limit; p = p->_next, scanned++) {
+      if (p->_numa_node == node) {
+        assert(p->TState == ObjectWaiter::TS_ENTER, "invariant");
+        _numa_handoffs++;
+        OM_PERFDATA_OP(LocalHandoffs, inc());
+        return p;
+      }
+    }
+  }
+
+  _numa_handoffs = 0;
+  if (head->_numa_node == node) {
+    OM_PERFDATA_OP(LocalHandoffs, inc());
+  } else {
+    OM_PERFDATA_OP(RemoteHandoffs, inc());
+  }
+  return head;
+}
+
 void ObjectMonitor::ExitEpilog(JavaThread* current, ObjectWaiter* Wakee) {
   assert(has_owner(current), "invariant");
 
@@ -2348,6 +2386,7 @@ ObjectWaiter::ObjectWaiter(JavaThread* current) {
   _monitor  = nullptr;
   _notifier_tid = 0;
   _recursions = 0;
+  _numa_node = (current != nullptr && ObjectMonitorNUMAHandoff && UseNUMA) ? os::numa_get_group_id() : -1;
   TState    = TS_RUN;
   _notified = false;
   _is_wait  = false;
@@ -2443,6 +2482,8 @@ PerfCounter * ObjectMonitor::_sync_Parks                       = nullptr;
 PerfCounter * ObjectMonitor::_sync_Notifications               = nullptr;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = nullptr;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = nullptr;
+PerfCounter * ObjectMonitor::_sync_LocalHandoffs               = nullptr;
+PerfCounter * ObjectMonitor::_sync_RemoteHandoffs              = nullptr;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = nullptr;
 
 // One-shot global initialization for the sync subsystem.
@@ -2478,6 +2519,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_LocalHandoffs);
+    NEWPERFCOUNTER(_sync_RemoteHandoffs);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
@@ -51,6 +51,7 @@ class ObjectWaiter : public CHeapObj<mtThread> {
   ObjectMonitor* _monitor;
   uint64_t  _notifier_tid;
   int         _recursions;
+  int         _numa_node;     // NUMA node of the thread when it blocked, -1 if unknown
   volatile TStates TState;
   volatile bool _notified;
   bool           _is_wait;
@@ -182,6 +183,9 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
 
   volatile int _SpinDuration;
 
+  int _numa_handoffs;               // Consecutive same-node handoffs that bypassed the
+                                    // EntryList head. Only accessed by the owner.
+
   int _contentions;                 // Number of active contentions in enter(). It is used by is_busy()
                                     // along with other fields to determine if an ObjectMonitor can be
                                     // deflated. It is also used by the async deflation protocol. See
@@ -220,6 +224,8 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   static PerfCounter * _sync_Notifications;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
+  static PerfCounter * _sync_LocalHandoffs;
+  static PerfCounter * _sync_RemoteHandoffs;
   static PerfLongVariable * _sync_MonExtant;
 
   static int Knob_SpinLimit;
@@ -420,6 +426,7 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
 
   bool      TrySpin(JavaThread* current);
   bool      short_fixed_spin(JavaThread* current, int spin_count, bool adapt);
+  ObjectWaiter* entry_list_successor();
   void      ExitEpilog(JavaThread* current, ObjectWaiter* Wakee);
 
   // Deflation support
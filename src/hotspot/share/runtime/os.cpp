@@ -41,6 +41,7 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "nmt/mallocHeader.inline.hpp"
+#include "nmt/mallocTagMap.hpp"
 #include "nmt/mallocTracker.hpp"
 #include "nmt/memTracker.inline.hpp"
 #include "nmt/nmtCommon.hpp"
@@ -79,6 +80,9 @@
 #include "utilities/fastrand.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/powerOfTwo.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeAllocationSample.hpp"
+#endif
 
 #ifdef LINUX
 #include "osContainer_linux.hpp"
@@ -669,6 +673,7 @@ void* os::malloc(size_t size, MemTag mem_tag, const NativeCallStack& stack) {
     DEBUG_ONLY(::memset(inner_ptr, uninitBlockPad, size);)
   }
   DEBUG_ONLY(break_if_ptr_caught(inner_ptr);)
+  JFR_ONLY(JfrNativeAllocationSample::record(size, mem_tag);)
   return inner_ptr;
 }
 
@@ -695,7 +700,41 @@ void* os::realloc(void *memblock, size_t size, MemTag mem_tag, const NativeCallS
   // we chose the latter.
   size = MAX2((size_t)1, size);
 
-  if (MemTracker::enabled()) {
+  if (MemTracker::enabled() && !MallocTracker::use_headers()) {
+    // NMT realloc handling without malloc headers
+
+    const size_t old_size = os::malloc_usable_size(memblock);
+
+    // Observe MallocLimit
+    if ((size > old_size) && MemTracker::check_exceeds_limit(size - old_size, mem_tag)) {
+      return nullptr;
+    }
+
+    // Deaccount the old block *before* calling the real realloc(3): once it returns,
+    // another thread may get the old address from malloc and enter it into the tag map.
+    DEBUG_ONLY(MemTag old_mem_tag;)
+    assert(MallocTagMap::lookup(memblock, &old_mem_tag) && old_mem_tag == mem_tag,
+           "weird NMT type mismatch");
+    MemTracker::record_free(memblock);
+
+    // the real realloc
+    ALLOW_C_FUNCTION(::realloc, rc = ::realloc(memblock, size);)
+
+    if (rc == nullptr) {
+      // realloc(3) failed and the block still exists, account it again.
+      MemTracker::record_malloc(memblock, old_size, mem_tag, stack);
+      return nullptr;
+    }
+    MemTracker::record_malloc(rc, size, mem_tag, stack);
+
+#ifdef ASSERT
+    if (old_size < size) {
+      // We also zap the newly extended region.
+      ::memset((char*)rc + old_size, uninitBlockPad, size - old_size);
+    }
+#endif
+
+  } else if (MemTracker::enabled()) {
     // NMT realloc handling
 
     const size_t new_outer_size = size + MemTracker::overhead_per_malloc();
@@ -2325,6 +2364,10 @@ void os::disclaim_memory(char *addr, size_t bytes) {
   pd_disclaim_memory(addr, bytes);
 }
 
+void os::disclaim_memory_lazily(char *addr, size_t bytes) {
+  pd_disclaim_memory_lazily(addr, bytes);
+}
+
 void os::realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   pd_realign_memory(addr, bytes, alignment_hint);
 }
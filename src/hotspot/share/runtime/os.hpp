@@ -234,6 +234,7 @@ class os: AllStatic {
                            bool allow_exec = false);
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_disclaim_memory(char *addr, size_t bytes);
+  static void   pd_disclaim_memory_lazily(char *addr, size_t bytes);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
 
   // Returns 0 if pretouch is done via platform dependent method, or otherwise
@@ -492,6 +493,10 @@ class os: AllStatic {
   struct size_change_t { size_t before; size_t after; };
   static bool trim_native_heap(size_change_t* rss_change = nullptr);
 
+  // Bytes held in free blocks by the C-heap, i.e. what a trim could at most
+  // return to the OS. Returns SIZE_MAX if the platform cannot tell.
+  static size_t native_heap_free_bytes();
+
   // A diagnostic function to print memory mappings in the given range.
   static void print_memory_mappings(char* addr, size_t bytes, outputStream* st);
   // Prints all mappings
@@ -528,6 +533,9 @@ class os: AllStatic {
                            bool allow_exec = false, MemTag mem_tag = mtNone);
   static bool   unmap_memory(char *addr, size_t bytes);
   static void   disclaim_memory(char *addr, size_t bytes);
+  // Like disclaim_memory, but the OS only reclaims the memory when it needs it,
+  // and the contents survive until then.
+  static void   disclaim_memory_lazily(char *addr, size_t bytes);
   static void   realign_memory(char *addr, size_t bytes, size_t alignment_hint);
 
   // NUMA-specific interface
@@ -922,6 +930,10 @@ class os: AllStatic {
 
   // handles null pointers
   static void  free    (void *memblock);
+
+  // Returns the usable size of a block obtained directly from the C-heap allocator
+  // (malloc(3), not os::malloc), or 0 if the platform cannot tell.
+  static size_t malloc_usable_size(void* p);
   static char* strdup(const char *, MemTag mem_tag = mtInternal);  // Like strdup
   // Like strdup, but exit VM when strdup() returns null
   static char* strdup_check_oom(const char*, MemTag mem_tag = mtInternal);
@@ -195,7 +195,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** straggler)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -225,6 +226,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *straggler = nullptr;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -246,7 +248,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
     while (cur_tss != nullptr) {
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
-        --still_running;
+        if (--still_running == 0) {
+          // The last thread the VM thread had to wait for.
+          *straggler = cur_tss->thread();
+        }
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -365,12 +370,13 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  JavaThread* straggler = nullptr;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &straggler);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -417,7 +423,7 @@ void SafepointSynchronize::begin() {
                                    initial_running,
                                    _waiting_to_block, iterations);
 
-  SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
+  SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page, straggler);
 
   post_safepoint_begin_event(begin_event, _safepoint_id, nof_threads, _current_jni_active_count);
 }
@@ -875,6 +881,7 @@ VM_Operation::VMOp_Type SafepointTracing::_current_type;
 jlong     SafepointTracing::_max_sync_time = 0;
 jlong     SafepointTracing::_max_vmop_time = 0;
 uint64_t  SafepointTracing::_op_count[VM_Operation::VMOp_Terminating] = {0};
+uint64_t  SafepointTracing::_sync_time_histogram[SafepointTracing::sync_time_buckets] = {0};
 
 void SafepointTracing::init() {
   // Application start
@@ -943,6 +950,45 @@ void SafepointTracing::statistics_exit_log() {
   log_info(safepoint, stats)("Maximum vm operation time (except for Exit VM operation)  "
                               INT64_FORMAT " ns",
                               (int64_t)(_max_vmop_time));
+
+  log_info(safepoint, stats)("Time to safepoint histogram:");
+  for (int i = 0; i < sync_time_buckets; i++) {
+    if (_sync_time_histogram[i] != 0) {
+      if (i == sync_time_buckets - 1) {
+        log_info(safepoint, stats)("  >= " UINT64_FORMAT_W(8) " us " UINT64_FORMAT_W(10),
+                                   (uint64_t)1 << (i - 1), _sync_time_histogram[i]);
+      } else {
+        log_info(safepoint, stats)("   < " UINT64_FORMAT_W(8) " us " UINT64_FORMAT_W(10),
+                                   (uint64_t)1 << i, _sync_time_histogram[i]);
+      }
+    }
+  }
+}
+
+// Reports the last thread that reached the safepoint and where it stopped.
+// For compiled code the pc is the safepoint poll the thread took, which
+// points at the method (often a long-running loop) that delayed the safepoint.
+void SafepointTracing::straggler_log(JavaThread* straggler) {
+  LogTarget(Debug, safepoint) lt;
+  if (straggler == nullptr || !lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  LogStream ls(lt);
+  ls.print("Last thread to reach safepoint: \"%s\" after " JLONG_FORMAT " ns",
+           straggler->name(), _last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
+  address pc = straggler->has_last_Java_frame() ? straggler->frame_anchor()->last_Java_pc() : nullptr;
+  if (pc != nullptr) {
+    ls.print(", pc " INTPTR_FORMAT, p2i(pc));
+    CodeBlob* cb = CodeCache::find_blob(pc);
+    if (cb != nullptr && cb->is_nmethod()) {
+      nmethod* nm = cb->as_nmethod();
+      ls.print(" in %s (compile id %d, tier %d)", nm->method()->external_name(), nm->compile_id(), nm->comp_level());
+    } else if (cb != nullptr) {
+      ls.print(" in %s", cb->name());
+    }
+  }
+  ls.cr();
 }
 
 void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
@@ -959,11 +1005,19 @@ void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
   RuntimeService::record_safepoint_begin(_last_app_time_ns);
 }
 
-void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps) {
+void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps, JavaThread* straggler) {
   _last_safepoint_sync_time_ns = os::javaTimeNanos();
   _nof_threads = nof_threads;
   _nof_running = nof_running;
   _page_trap   = traps;
+
+  const jlong sync_us = (_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns) / (NANOUNITS / MICROUNITS);
+  int bucket = 0;
+  while (bucket < sync_time_buckets - 1 && (1LL << bucket) <= sync_us) {
+    bucket++;
+  }
+  _sync_time_histogram[bucket]++;
+  straggler_log(straggler);
   RuntimeService::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
 }
 
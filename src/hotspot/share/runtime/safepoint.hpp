@@ -102,7 +102,8 @@ class SafepointSynchronize : AllStatic {
 
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
-  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
+  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                 JavaThread** straggler);
   static void disarm_safepoint();
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
@@ -244,13 +245,18 @@ class SafepointTracing : public AllStatic {
   static jlong     _max_vmop_time;
   static uint64_t  _op_count[VM_Operation::VMOp_Terminating];
 
+  // Time-to-safepoint histogram, bucket i counts sync times below 2^i us.
+  static const int sync_time_buckets = 20;
+  static uint64_t  _sync_time_histogram[sync_time_buckets];
+
   static void statistics_log();
+  static void straggler_log(JavaThread* straggler);
 
 public:
   static void init();
 
   static void begin(VM_Operation::VMOp_Type type);
-  static void synchronized(int nof_threads, int nof_running, int traps);
+  static void synchronized(int nof_threads, int nof_running, int traps, JavaThread* straggler);
   static void end();
 
   static void statistics_exit_log();
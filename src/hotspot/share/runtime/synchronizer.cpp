@@ -285,6 +285,7 @@ void ObjectSynchronizer::initialize() {
 }
 
 MonitorList ObjectSynchronizer::_in_use_list;
+ObjectMonitor* ObjectSynchronizer::_deflation_resume_point = nullptr;
 // monitors_used_above_threshold() policy is as follows:
 //
 // The ratio of the current _in_use_list count to the ceiling is used
@@ -1642,17 +1643,40 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* locking_thread, oop
 }
 
 // Walk the in-use list and deflate (at most MonitorDeflationMax) idle
-// ObjectMonitors. Returns the number of deflated ObjectMonitors.
+// ObjectMonitors. With MonitorDeflationTimeBudget the walk also stops once
+// the budget is used up, and the next cycle resumes with the first monitor
+// not visited. Returns the number of deflated ObjectMonitors.
+//
+// The resume point stays on the in-use list: it was not deflated, and only
+// the deflation thread deflates and unlinks monitors. Monitors added since
+// are at the head, and are visited once a walk reaches the end of the list.
 //
 size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
+  // Reading the clock is cheap compared to a batch of deflate_monitor() calls,
+  // but not compared to a single one.
+  static const size_t budget_check_interval = 1024;
+  const jlong deadline_ns = MonitorDeflationTimeBudget > 0
+                          ? os::javaTimeNanos() + MonitorDeflationTimeBudget * NANOSECS_PER_MILLISEC
+                          : 0;
+  MonitorList::Iterator iter = _deflation_resume_point != nullptr
+                              ? MonitorList::Iterator(_deflation_resume_point)
+                              : _in_use_list.iterator();
+  _deflation_resume_point = nullptr;
   size_t deflated_count = 0;
+  size_t visited_count = 0;
   Thread* current = Thread::current();
 
   while (iter.has_next()) {
     if (deflated_count >= (size_t)MonitorDeflationMax) {
       break;
     }
+    if (deadline_ns != 0 && ++visited_count % budget_check_interval == 0 &&
+        os::javaTimeNanos() > deadline_ns) {
+      log_info(monitorinflation)("deflation time budget exhausted: visited_count=" SIZE_FORMAT
+                                 ", deflated_count=" SIZE_FORMAT, visited_count, deflated_count);
+      _deflation_resume_point = iter.peek();
+      break;
+    }
     ObjectMonitor* mid = iter.next();
     if (mid->deflate_monitor(current)) {
       deflated_count++;
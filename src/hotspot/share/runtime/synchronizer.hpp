@@ -64,6 +64,7 @@ class MonitorList::Iterator {
 public:
   Iterator(ObjectMonitor* head) : _current(head) {}
   bool has_next() const { return _current != nullptr; }
+  ObjectMonitor* peek() const { return _current; }
   ObjectMonitor* next();
 };
 
@@ -214,6 +215,8 @@ class ObjectSynchronizer : AllStatic {
   friend class LightweightSynchronizer;
 
   static MonitorList _in_use_list;
+  // Where the next deflation cycle resumes after a MonitorDeflationTimeBudget stop.
+  static ObjectMonitor* _deflation_resume_point;
   static volatile bool _is_async_deflation_requested;
   static volatile bool _is_final_audit;
   static jlong         _last_async_deflation_time_ns;
@@ -764,6 +764,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   }
 #endif
   if (init_compilation) {
+    TraceTime timer("Initialize compilation", TRACETIME_LOG(Info, startuptime));
     CompileBroker::compilation_init(CHECK_JNI_ERR);
   }
 #endif
@@ -1128,6 +1129,9 @@ void Threads::remove(JavaThread* p, bool is_daemon) {
 
     assert(ThreadsSMRSupport::get_java_thread_list()->includes(p), "p must be present");
 
+    // SapMachine 2019-02-20: Vitals
+    sapmachine_vitals::counters::add_exited_thread_cpu_time(p);
+
     // Maintain fast thread list
     ThreadsSMRSupport::remove_thread(p);
 
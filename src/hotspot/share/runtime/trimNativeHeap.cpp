@@ -53,6 +53,11 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   // Statistics
   uint64_t _num_trims_performed;
+  uint64_t _num_trims_skipped;
+  size_t _bytes_recovered;
+
+  // Trims are spaced so that they take at most this fraction of wall time.
+  static constexpr double max_trim_time_fraction = 0.01;
 
   bool is_suspended() const {
     assert(_lock->is_locked(), "Must be");
@@ -92,10 +97,15 @@ class NativeHeapTrimmerThread : public NamedThread {
     LogStartStopMark lssm;
 
     const double interval_secs = (double)TrimNativeHeapInterval / 1000;
+    double last_trim_secs = 0.0;
 
     while (true) {
       double tnow = now();
       double next_trim_time = tnow + interval_secs;
+      if (is_adaptive()) {
+        // Back off if trimming turns out to be expensive.
+        next_trim_time = tnow + MAX2(interval_secs, last_trim_secs / max_trim_time_fraction);
+      }
 
       unsigned times_suspended = 0;
       unsigned times_waited = 0;
@@ -128,10 +138,41 @@ class NativeHeapTrimmerThread : public NamedThread {
       log_trace(trimnative)("Times: %u suspended, %u timed, %u safepoint",
                             times_suspended, times_waited, times_safepoint);
 
-      execute_trim_and_log(tnow);
+      if (should_trim()) {
+        execute_trim_and_log(tnow);
+        if (is_adaptive()) {
+          last_trim_secs = now() - tnow;
+        }
+      }
     }
   }
 
+  // With TrimNativeHeapFreeThreshold, the trimmer skips trims that are not worth
+  // it, backs off when trims are expensive and keeps track of the bytes recovered.
+  // Without it, it trims at every interval, as before.
+  static bool is_adaptive() { return TrimNativeHeapFreeThreshold > 0; }
+
+  // Only trim if there is enough free memory in the C-heap to be worth it, or
+  // if the system (or container) runs low on memory.
+  bool should_trim() {
+    if (!is_adaptive()) {
+      return true;
+    }
+    const size_t free_bytes = os::native_heap_free_bytes();
+    if (free_bytes == SIZE_MAX || free_bytes >= TrimNativeHeapFreeThreshold) {
+      return true;
+    }
+    const julong physical = os::physical_memory();
+    if (os::available_memory() < physical / 10) {
+      log_debug(trimnative)("Low on memory, trimming anyway");
+      return true;
+    }
+    _num_trims_skipped++;
+    log_trace(trimnative)("Periodic Trim skipped: " PROPERFMT " free in native heap",
+                          PROPERFMTARGS(free_bytes));
+    return false;
+  }
+
   // Execute the native trim, log results.
   void execute_trim_and_log(double t1) {
     assert(os::can_trim_native_heap(), "Unexpected");
@@ -140,9 +181,13 @@ class NativeHeapTrimmerThread : public NamedThread {
     LogTarget(Info, trimnative) lt;
     const bool logging_enabled = lt.is_enabled();
 
-    // We only collect size change information if we are logging; save the access to procfs otherwise.
-    if (os::trim_native_heap(logging_enabled ? &sc : nullptr)) {
+    // We only collect size change information if we are logging or tracking the
+    // recovered bytes; save the access to procfs otherwise.
+    if (os::trim_native_heap((logging_enabled || is_adaptive()) ? &sc : nullptr)) {
       _num_trims_performed++;
+      if (is_adaptive() && sc.after != SIZE_MAX && sc.after < sc.before) {
+        _bytes_recovered += sc.before - sc.after;
+      }
       if (logging_enabled) {
         double t2 = now();
         if (sc.after != SIZE_MAX) {
@@ -167,7 +212,9 @@ class NativeHeapTrimmerThread : public NamedThread {
     _lock(new (std::nothrow) PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
     _suspend_count(0),
-    _num_trims_performed(0)
+    _num_trims_performed(0),
+    _num_trims_skipped(0),
+    _bytes_recovered(0)
   {
     set_name("Native Heap Trimmer");
     if (os::create_thread(this, os::vm_thread)) {
@@ -211,19 +258,28 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   void print_state(outputStream* st) const {
     int64_t num_trims = 0;
+    int64_t num_skipped = 0;
+    size_t recovered = 0;
     bool stopped = false;
     uint16_t suspenders = 0;
     {
       // Don't pull lock during error reporting
       ConditionalMutexLocker ml(_lock, !VMError::is_error_reported(), Mutex::_no_safepoint_check_flag);
       num_trims = _num_trims_performed;
+      num_skipped = _num_trims_skipped;
+      recovered = _bytes_recovered;
       stopped = _stop;
       suspenders = _suspend_count;
     }
     st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d",
                  num_trims, suspenders, stopped);
+    st->print_cr("Trims skipped: " UINT64_FORMAT ", recovered: " PROPERFMT,
+                 num_skipped, PROPERFMTARGS(recovered));
   }
 
+  uint64_t num_trims_performed() const { return _num_trims_performed; }
+  size_t bytes_recovered() const         { return _bytes_recovered; }
+
 }; // NativeHeapTrimmer
 
 static NativeHeapTrimmerThread* g_trimmer_thread = nullptr;
@@ -259,6 +315,15 @@ void NativeHeapTrimmer::resume_periodic_trim(const char* reason) {
   }
 }
 
+bool NativeHeapTrimmer::get_statistics(uint64_t* num_trims, size_t* bytes_recovered) {
+  if (g_trimmer_thread == nullptr) {
+    return false;
+  }
+  *num_trims = g_trimmer_thread->num_trims_performed();
+  *bytes_recovered = g_trimmer_thread->bytes_recovered();
+  return true;
+}
+
 void NativeHeapTrimmer::print_state(outputStream* st) {
   if (g_trimmer_thread != nullptr) {
     st->print_cr("Periodic native trim enabled (interval: %u ms)", TrimNativeHeapInterval);
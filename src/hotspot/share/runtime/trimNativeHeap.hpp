@@ -49,6 +49,11 @@ class NativeHeapTrimmer : public AllStatic {
 
   static void print_state(outputStream* st);
 
+  // Trims performed so far and the bytes they returned to the OS. The bytes are
+  // only tracked with TrimNativeHeapFreeThreshold. Returns false if periodic
+  // trimming is not running.
+  static bool get_statistics(uint64_t* num_trims, size_t* bytes_recovered);
+
   // Pause periodic trimming while in scope; when leaving scope,
   // resume periodic trimming.
   struct SuspendMark {
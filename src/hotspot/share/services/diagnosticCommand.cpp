@@ -52,9 +52,11 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -564,9 +566,13 @@ ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
        "1 means use one thread (disable parallelism). "
        "For any other value the VM will try to use the specified number of "
        "threads, but might use fewer.",
-       "INT", false, "0") {
+       "INT", false, "0"),
+  _referenced("-referenced", "Also report the total size of the objects directly referenced by "
+       "the instances of each class, an approximation of what they keep alive",
+       "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_option(&_parallel_thread_num);
+  _dcmdparser.add_dcmd_option(&_referenced);
 }
 
 void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
@@ -580,7 +586,8 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
       : num;
   VM_GC_HeapInspection heapop(output(),
                               !_all.value(), /* request full gc if false */
-                              parallel_thread_num);
+                              parallel_thread_num,
+                              _referenced.value());
   VMThread::execute(&heapop);
 }
 
@@ -589,15 +596,65 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "stop one thread at a time instead of all threads at once; "
+             "the dump is then not a single consistent snapshot and omits "
+             "java.util.concurrent locks, non-Java threads and JNI handle counts", "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
-}
+  _dcmdparser.add_dcmd_option(&_handshake);
+}
+
+// Prints one JavaThread while it is stopped in a handshake. Only that
+// thread is stopped, so the other threads keep running during the dump.
+class PrintThreadHandshakeClosure : public HandshakeClosure {
+  outputStream* _st;
+  bool _print_extended_info;
+ public:
+  PrintThreadHandshakeClosure(outputStream* st, bool print_extended_info) :
+    HandshakeClosure("PrintThread"), _st(st), _print_extended_info(print_extended_info) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = JavaThread::cast(thread);
+    ResourceMark rm;
+    jt->print_on(_st, _print_extended_info);
+    jt->print_stack_on(_st);
+    if (jt->is_vthread_mounted()) {
+      _st->print_cr("   Mounted virtual thread #" INT64_FORMAT, java_lang_Thread::thread_id(jt->vthread()));
+      jt->print_vthread_stack_on(_st);
+    }
+    _st->cr();
+  }
+};
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
-  // thread stacks and JNI global handles
-  VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
-  VMThread::execute(&op1);
+  if (_handshake.value()) {
+    char buf[32];
+    output()->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
+    output()->print_cr("Thread dump %s (%s %s), one thread at a time:",
+                       VM_Version::vm_name(),
+                       VM_Version::vm_release(),
+                       VM_Version::vm_info_string());
+    output()->cr();
+
+    PrintThreadHandshakeClosure cl(output(), _extended.value());
+    ThreadsListHandle tlh(THREAD);
+    for (uint i = 0; i < tlh.length(); i++) {
+      JavaThread* jt = tlh.thread_at(i);
+      if (jt->is_exiting()) {
+        continue;
+      }
+      if (jt == THREAD) {
+        cl.do_thread(jt);
+      } else {
+        Handshake::execute(&cl, &tlh, jt);
+      }
+    }
+  } else {
+    // thread stacks and JNI global handles
+    VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
+    VMThread::execute(&op1);
+  }
 
   // Deadlock detection
   VM_FindDeadlocks op2(output());
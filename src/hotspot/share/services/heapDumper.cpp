@@ -2133,10 +2133,17 @@ void DumpMerger::set_error(const char* msg) {
 // Merge segmented heap files via sendfile, it's more efficient than the
 // read+write combination, which would require transferring data to and from
 // user space.
+//
+// The segment is copied in bounded steps, and the blocks of each copied step
+// are released again by punching a hole into the segment file. This keeps the
+// extra disk space needed while merging to about one step, instead of a full
+// segment, on file systems that support it.
+static const jlong merge_step_size = 64 * M;
+
 void DumpMerger::merge_file(const char* path) {
   TraceTime timer("Merge segmented heap file directly", TRACETIME_LOG(Info, heapdump));
 
-  int segment_fd = os::open(path, O_RDONLY, 0);
+  int segment_fd = os::open(path, O_RDWR, 0);
   if (segment_fd == -1) {
     set_error("Can not open segmented heap file during merging");
     return;
@@ -2152,13 +2159,18 @@ void DumpMerger::merge_file(const char* path) {
   // A successful call to sendfile may write fewer bytes than requested; the
   // caller should be prepared to retry the call if there were unsent bytes.
   jlong offset = 0;
+  bool can_punch_hole = true;
   while (offset < st.st_size) {
-    int ret = os::Linux::sendfile(_writer->get_fd(), segment_fd, &offset, st.st_size);
+    const jlong step_start = offset;
+    jlong ret = os::Linux::sendfile(_writer->get_fd(), segment_fd, &offset, MIN2(merge_step_size, (jlong)st.st_size - offset));
     if (ret == -1) {
       ::close(segment_fd);
       set_error("Failed to merge segmented heap file");
       return;
     }
+    if (can_punch_hole && offset > step_start) {
+      can_punch_hole = os::Linux::punch_hole(segment_fd, step_start, offset - step_start);
+    }
   }
 
   // As sendfile variant does not call the write method of the global writer,
@@ -2416,6 +2428,18 @@ void VM_HeapDumper::doit() {
   }
 
   WorkerThreads* workers = ch->safepoint_workers();
+  if (workers == nullptr) {
+    prepare_parallel_dump(nullptr);
+    work(VMDumperId);
+    return;
+  }
+
+  // The number of active workers only reflects what the last GC asked for, with
+  // UseDynamicNumberOfGCThreads it may be much lower than what the dump can use.
+  // Segment compression is CPU bound, so activate as many workers as requested.
+  // Creating workers may fail, the dump is sized from the number actually active:
+  // DumperController waits for every dumper it was created for.
+  WithActiveWorkers with_active_workers(workers, clamp(_num_dumper_threads, 1U, workers->max_workers()));
   prepare_parallel_dump(workers);
 
   if (!is_parallel_dump()) {
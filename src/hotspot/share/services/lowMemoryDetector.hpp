@@ -150,6 +150,13 @@ class SensorInfo : public CHeapObj<mtInternal> {
   int pending_trigger_count()      { return _pending_trigger_count; }
   int pending_clear_count()        { return _pending_clear_count; }
 
+  // Unlocked pre-check for set_gauge_sensor_level: returns false if a
+  // usage above the high threshold would not request a trigger because
+  // the sensor is already on, or will be, with no clear pending.
+  bool may_trigger_on_high() const {
+    return (!_sensor_on && _pending_trigger_count == 0) || _pending_clear_count > 0;
+  }
+
   // When this method is used, the memory usage is monitored
   // as a gauge attribute.  High and low thresholds are designed
   // to provide a hysteresis mechanism to avoid repeated triggering
@@ -255,7 +262,9 @@ class LowMemoryDetector : public AllStatic {
       if (pool->is_collected_pool() && is_enabled(pool)) {
         size_t used = pool->used_in_bytes();
         size_t high = pool->usage_threshold()->high_threshold();
-        if (used > high) {
+        // Once the sensor is on, every slow-path allocation would take
+        // Notification_lock to find nothing to do; skip that case.
+        if (used > high && pool->usage_sensor()->may_trigger_on_high()) {
           detect_low_memory(pool);
         }
       }
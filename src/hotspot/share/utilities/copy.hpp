@@ -269,6 +269,18 @@ class Copy : AllStatic {
     pd_fill_to_words(to, count, value);
   }
 
+  // Fill large word-aligned ranges that will not be read back soon, bypassing
+  // the caches where the platform supports that. Only for GC region clearing
+  // and filler objects, see UseNonTemporalGCFill.
+  static void fill_to_words_nontemporal(HeapWord* to, size_t count, juint value = 0) {
+    assert_params_ok(to, HeapWordSize);
+    pd_fill_to_words_nontemporal(to, count, value);
+  }
+
+  static void zero_to_words_nontemporal(HeapWord* to, size_t count) {
+    fill_to_words_nontemporal(to, count, 0);
+  }
+
   static void fill_to_aligned_words(HeapWord* to, size_t count, juint value = 0) {
     assert_params_aligned(to);
     pd_fill_to_aligned_words(to, count, value);
@@ -34,6 +34,25 @@ ElfDecoder::~ElfDecoder() {
     delete _opened_elf_files;
     _opened_elf_files = nullptr;
   }
+
+  if (_symbol_cache != nullptr) {
+    FREE_C_HEAP_ARRAY(CachedSymbol, _symbol_cache);
+    _symbol_cache = nullptr;
+  }
+}
+
+ElfDecoder::CachedSymbol* ElfDecoder::get_cached_symbol(ElfFile* file, address addr) {
+  if (_symbol_cache == nullptr) {
+    _symbol_cache = NEW_C_HEAP_ARRAY_RETURN_NULL(CachedSymbol, CACHED_SYMBOLS, mtInternal);
+    if (_symbol_cache == nullptr) {
+      return nullptr;
+    }
+    memset(_symbol_cache, 0, sizeof(CachedSymbol) * CACHED_SYMBOLS);
+  }
+
+  uintptr_t hash = (uintptr_t)addr ^ ((uintptr_t)file >> 4);
+  hash ^= hash >> 9;
+  return &_symbol_cache[hash & (CACHED_SYMBOLS - 1)];
 }
 
 bool ElfDecoder::decode(address addr, char *buf, int buflen, int* offset, const char* filepath, bool demangle_name) {
@@ -45,12 +64,37 @@ bool ElfDecoder::decode(address addr, char *buf, int buflen, int* offset, const
     return false;
   }
 
-  if (!file->decode(addr, buf, buflen, offset)) {
+  CachedSymbol* cached = get_cached_symbol(file, addr);
+  if (cached != nullptr && cached->_file == file && cached->_addr == addr &&
+      cached->_demangled == demangle_name) {
+    strncpy(buf, cached->_name, buflen);
+    buf[buflen - 1] = '\0';
+    if (offset != nullptr) {
+      *offset = cached->_offset;
+    }
+    return true;
+  }
+
+  int off = -1;
+  if (!file->decode(addr, buf, buflen, &off)) {
     return false;
   }
   if (demangle_name && (buf[0] != '\0')) {
     demangle(buf, buf, buflen);
   }
+  if (offset != nullptr) {
+    *offset = off;
+  }
+
+  // Only cache names which were not truncated.
+  size_t len = strlen(buf);
+  if (cached != nullptr && len < (size_t)CACHED_SYMBOL_LEN && len + 1 < (size_t)buflen) {
+    cached->_file = file;
+    cached->_addr = addr;
+    cached->_offset = off;
+    cached->_demangled = demangle_name;
+    memcpy(cached->_name, buf, len + 1);
+  }
   return true;
 }
 
@@ -33,7 +33,7 @@
 class ElfDecoder : public AbstractDecoder {
 
 public:
-  ElfDecoder() : AbstractDecoder(no_error), _opened_elf_files(nullptr) {}
+  ElfDecoder() : AbstractDecoder(no_error), _opened_elf_files(nullptr), _symbol_cache(nullptr) {}
 
   virtual ~ElfDecoder();
 
@@ -46,10 +46,26 @@ class ElfDecoder : public AbstractDecoder {
   bool get_source_info(address pc, char* buf, size_t buflen, int* line, bool is_pc_after_call);
 
 private:
+  // Caches the results of decode(), so printing the same stacks again (e.g.
+  // for the malloc trace, NMT or hs_err files) doesn't search the symbol
+  // tables every time. The cache is direct mapped and allocated lazily.
+  static const int CACHED_SYMBOLS    = 512;
+  static const int CACHED_SYMBOL_LEN = 128;
+
+  struct CachedSymbol {
+    ElfFile* _file;
+    address  _addr;
+    int      _offset;
+    bool     _demangled;
+    char     _name[CACHED_SYMBOL_LEN];
+  };
+
   ElfFile*         get_elf_file(const char* filepath);
+  CachedSymbol*    get_cached_symbol(ElfFile* file, address addr);
 
 private:
   ElfFile*         _opened_elf_files;
+  CachedSymbol*    _symbol_cache;
 };
 
 #endif // !_WINDOWS && !__APPLE__
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "utilities/rotate_bits.hpp"
+#include "utilities/sha256.hpp"
+
+static const uint32_t round_constants[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+SHA256::SHA256() : _length(0), _block_used(0) {
+  _state[0] = 0x6a09e667;
+  _state[1] = 0xbb67ae85;
+  _state[2] = 0x3c6ef372;
+  _state[3] = 0xa54ff53a;
+  _state[4] = 0x510e527f;
+  _state[5] = 0x9b05688c;
+  _state[6] = 0x1f83d9ab;
+  _state[7] = 0x5be0cd19;
+}
+
+void SHA256::process_block(const u1* block) {
+  uint32_t w[64];
+  for (int i = 0; i < 16; i++) {
+    w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[4 * i + 1] << 16) |
+           ((uint32_t)block[4 * i + 2] << 8) | (uint32_t)block[4 * i + 3];
+  }
+  for (int i = 16; i < 64; i++) {
+    uint32_t s0 = rotate_right_32(w[i - 15], 7) ^ rotate_right_32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    uint32_t s1 = rotate_right_32(w[i - 2], 17) ^ rotate_right_32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+
+  uint32_t a = _state[0], b = _state[1], c = _state[2], d = _state[3];
+  uint32_t e = _state[4], f = _state[5], g = _state[6], h = _state[7];
+  for (int i = 0; i < 64; i++) {
+    uint32_t s1 = rotate_right_32(e, 6) ^ rotate_right_32(e, 11) ^ rotate_right_32(e, 25);
+    uint32_t ch = (e & f) ^ (~e & g);
+    uint32_t t1 = h + s1 + ch + round_constants[i] + w[i];
+    uint32_t s0 = rotate_right_32(a, 2) ^ rotate_right_32(a, 13) ^ rotate_right_32(a, 22);
+    uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+    uint32_t t2 = s0 + maj;
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+  _state[0] += a;
+  _state[1] += b;
+  _state[2] += c;
+  _state[3] += d;
+  _state[4] += e;
+  _state[5] += f;
+  _state[6] += g;
+  _state[7] += h;
+}
+
+void SHA256::update(const void* data, size_t length) {
+  const u1* p = (const u1*)data;
+  _length += length;
+  if (_block_used > 0) {
+    size_t n = MIN2(length, BLOCK_LENGTH - _block_used);
+    memcpy(_block + _block_used, p, n);
+    _block_used += n;
+    p += n;
+    length -= n;
+    if (_block_used < BLOCK_LENGTH) {
+      return;
+    }
+    process_block(_block);
+    _block_used = 0;
+  }
+  while (length >= BLOCK_LENGTH) {
+    process_block(p);
+    p += BLOCK_LENGTH;
+    length -= BLOCK_LENGTH;
+  }
+  memcpy(_block, p, length);
+  _block_used = length;
+}
+
+void SHA256::finish(u1 digest[DIGEST_LENGTH]) {
+  uint64_t bit_length = _length * 8;
+  // Pad with a 1 bit and zeros up to 8 bytes short of a block, then append
+  // the message length in bits.
+  _block[_block_used++] = 0x80;
+  if (_block_used > BLOCK_LENGTH - 8) {
+    memset(_block + _block_used, 0, BLOCK_LENGTH - _block_used);
+    process_block(_block);
+    _block_used = 0;
+  }
+  memset(_block + _block_used, 0, BLOCK_LENGTH - 8 - _block_used);
+  for (int i = 0; i < 8; i++) {
+    _block[BLOCK_LENGTH - 1 - i] = (u1)(bit_length >> (8 * i));
+  }
+  process_block(_block);
+
+  for (int i = 0; i < 8; i++) {
+    digest[4 * i]     = (u1)(_state[i] >> 24);
+    digest[4 * i + 1] = (u1)(_state[i] >> 16);
+    digest[4 * i + 2] = (u1)(_state[i] >> 8);
+    digest[4 * i + 3] = (u1)_state[i];
+  }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_UTILITIES_SHA256_HPP
+#define SHARE_UTILITIES_SHA256_HPP
+
+#include "utilities/globalDefinitions.hpp"
+
+// A plain software SHA-256 (FIPS 180-4), for digests of data that must not
+// be forgeable, such as fingerprints of class files kept across runs. It is
+// not meant for hashing on hot paths.
+class SHA256 {
+ public:
+  static const size_t DIGEST_LENGTH = 32;
+
+ private:
+  static const size_t BLOCK_LENGTH = 64;
+
+  uint32_t _state[8];
+  uint64_t _length;             // bytes hashed so far
+  u1       _block[BLOCK_LENGTH];
+  size_t   _block_used;
+
+  void process_block(const u1* block);
+
+ public:
+  SHA256();
+
+  void update(const void* data, size_t length);
+
+  // Writes the digest of all data passed to update() to digest. The object
+  // must not be updated afterwards.
+  void finish(u1 digest[DIGEST_LENGTH]);
+};
+
+#endif // SHARE_UTILITIES_SHA256_HPP
@@ -30,6 +30,27 @@
 #include "utilities/utf8.hpp"
 #include "runtime/os.hpp"
 
+// Word-at-a-time helpers for the ASCII prefix scans below. Loads are done
+// with memcpy so the input need not be aligned.
+static const uint64_t ascii_high_bits = UCONST64(0x8080808080808080);
+static const uint64_t ascii_low_bits  = UCONST64(0x0101010101010101);
+
+static inline uint64_t load_word(const void* p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+// True if none of the eight bytes has its high bit set.
+static inline bool is_ascii_word(uint64_t v) {
+  return (v & ascii_high_bits) == 0;
+}
+
+// True if all eight bytes are in 1..127: no high bit and no zero byte.
+static inline bool is_nonzero_ascii_word(uint64_t v) {
+  return ((v | ((v - ascii_low_bits) & ~v)) & ascii_high_bits) == 0;
+}
+
 // Assume the utf8 string is in legal form and has been
 // checked in the class file parser/format checker.
 template<typename T> char* UTF8::next(const char* str, T* value) {
@@ -112,7 +133,15 @@ int UTF8::unicode_length(const char* str, size_t len, bool& is_latin1, bool& has
   has_multibyte = false;
   is_latin1 = true;
   unsigned char prev = 0;
-  for (size_t i = 0; i < len; i++) {
+  size_t i = 0;
+  // Plain ASCII has no continuation bytes; skip it a word at a time.
+  while (i + sizeof(uint64_t) <= len && is_ascii_word(load_word(str + i))) {
+    i += sizeof(uint64_t);
+  }
+  if (i > 0) {
+    prev = str[i - 1];
+  }
+  for (; i < len; i++) {
     unsigned char c = str[i];
     if ((c & 0xC0) == 0x80) {
       // Multibyte, check if valid latin1 character.
@@ -339,7 +368,10 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 bool UTF8::is_legal_utf8(const unsigned char* buffer, size_t length,
                          bool version_leq_47) {
   size_t i = 0;
-  size_t count = length >> 2;
+  while (i + sizeof(uint64_t) <= length && is_nonzero_ascii_word(load_word(buffer + i))) {
+    i += sizeof(uint64_t);
+  }
+  size_t count = (length - i) >> 2;
   for (size_t k = 0; k < count; k++) {
     unsigned char b0 = buffer[i];
     unsigned char b1 = buffer[i+1];
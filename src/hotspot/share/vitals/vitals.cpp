@@ -30,6 +30,7 @@
 
 #include "gc/shared/collectedHeap.hpp"
 #include "classfile/classLoaderDataGraph.inline.hpp"
+#include "classfile/stringTable.hpp"
 #include "code/codeCache.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
@@ -39,11 +40,17 @@
 #include "nmt/mallocTracker.hpp"
 #include "nmt/memBaseline.hpp"
 #include "nmt/memTracker.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/cpuTimeCounters.hpp"
 #include "runtime/os.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/nonJavaThread.hpp"
+#include "runtime/orderAccess.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/thread.hpp"
 #include "runtime/threads.hpp"
+#include "runtime/threadSMR.hpp"
+#include "runtime/trimNativeHeap.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -52,7 +59,10 @@
 #include "vitals/vitals_internals.hpp"
 #include "vitals/vitalsLocker.hpp"
 
+#include <ctype.h>
+#include <fcntl.h>
 #include <locale.h>
+#include <stdio.h>
 #include <time.h>
 
 // Newer JDKS: NMT is always on and this macro does not exist
@@ -131,6 +141,7 @@ void Sample::reset() {
   }
   DEBUG_ONLY(_num = -1;)
   _timestamp = 0;
+  _millis = 0;
 }
 
 void Sample::set_value(int index, value_t v) {
@@ -138,8 +149,10 @@ void Sample::set_value(int index, value_t v) {
   _values[index] = v;
 }
 
-void Sample::set_timestamp(time_t t) {
+void Sample::set_timestamp(time_t t, int millis) {
+  assert(millis >= 0 && millis < 1000, "invalid millis: %d", millis);
   _timestamp = t;
+  _millis = millis;
 }
 
 #ifdef ASSERT
@@ -198,11 +211,18 @@ int printf_helper(outputStream* st, const char *fmt, ...) {
 #define TIMESTAMP_LEN 19
 // number of spaces after time stamp
 #define TIMESTAMP_DIVIDER_LEN 3
-static void print_timestamp(outputStream* st, time_t t) {
+// If millis is given (>= 0), print time of day with milliseconds instead of the date.
+static void print_timestamp(outputStream* st, time_t t, int millis = -1) {
   struct tm _tm;
   if (os::localtime_pd(&t, &_tm) == &_tm) {
     char buf[32];
-    ::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &_tm);
+    if (millis >= 0) {
+      char buf2[16];
+      ::strftime(buf2, sizeof(buf2), "%H:%M:%S", &_tm);
+      jio_snprintf(buf, sizeof(buf), "%s.%03d", buf2, millis);
+    } else {
+      ::strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &_tm);
+    }
     st->print("%*s", TIMESTAMP_LEN, buf);
   }
 }
@@ -600,13 +620,14 @@ int DeltaMemorySizeColumn::do_print0(outputStream* st, value_t value,
 
 // Print one sample.
 static void print_one_sample(outputStream* st, const Sample* sample,
-    const Sample* last_sample, const ColumnWidths* widths, const print_info_t* pi, int marked_index = -1, char const* mark = NULL) {
+    const Sample* last_sample, const ColumnWidths* widths, const print_info_t* pi, int marked_index = -1, char const* mark = NULL,
+    bool with_millis = false) {
 
   // Print timestamp and divider
   if (pi->csv) {
     st->print("\"");
   }
-  print_timestamp(st, sample->timestamp());
+  print_timestamp(st, sample->timestamp(), with_millis ? sample->millis() : -1);
   if (pi->csv) {
     st->print("\"");
   }
@@ -638,71 +659,101 @@ static void print_one_sample(outputStream* st, const Sample* sample,
 
 ////////////// Class SampleTable /////////////////////////
 
-// A fixed sized fifo buffer of n samples
+// A fixed sized fifo buffer of n samples.
+//
+// The table has exactly one writer, the sampler thread, which must never be blocked by
+// readers. Samples are numbered monotonically; sample <n> lives in slot <n % num_entries>.
+// Before overwriting a slot, the writer announces the number of the sample it is about
+// to write; after writing, it publishes the sample. Readers copy samples out of the
+// table and afterwards check whether the writer has reached the copied slot in the
+// meantime, in which case the copy is discarded (seqlock-style validation).
 class SampleTable : public CHeapObj<mtInternal> {
 
-  const int _num_entries;
-  int _head;      // Index of the last sample written; -1 if none have been written yet
-  bool _did_wrap;
-  Sample* _samples;
+public:
 
-#ifdef ASSERT
-  void verify() const {
-    assert(_samples != NULL, "sanity");
-    assert(_head >= 0 && _head < _num_entries, "sanity");
-  }
-#endif
+  // Fill state of the table. Kept apart from the table object since, for a table living in
+  // the history file (see -XX:VitalsHistoryFile), it is part of the file.
+  struct State {
+    volatile uint64_t announced; // Number of samples announced (= being written or written)
+    volatile uint64_t published; // Number of samples published
+  };
+
+private:
+
+  const int _num_entries;
+  State* const _state;
+  Sample* const _samples;
 
   size_t sample_offset_in_bytes(int idx) const {
-    assert(idx >= 0 && idx <= _num_entries, "invalid index: %d", idx);
+    assert(idx >= 0 && idx < _num_entries, "invalid index: %d", idx);
     return Sample::size_in_bytes() * idx;
   }
 
-public:
+  int slot_of(uint64_t n) const { return (int)(n % (uint64_t)_num_entries); }
 
-  SampleTable(int num_entries)
-    : _num_entries(num_entries),
-      _head(-1),
-      _did_wrap(false),
-      _samples(NULL)
-  {
-    _samples = (Sample*) NEW_C_HEAP_ARRAY(char, Sample::size_in_bytes() * _num_entries, mtInternal);
+  // Returns true if sample number <n>, copied before this call, is still intact.
+  bool is_intact(uint64_t n) const {
+    OrderAccess::loadload();
+    return Atomic::load(&_state->announced) <= n + _num_entries;
+  }
+
+  static size_t state_size_in_bytes() { return align_up(sizeof(State), sizeof(uint64_t)); }
+
+  static void* allocate_table_memory(int num_entries) {
+    void* p = NEW_C_HEAP_ARRAY(char, external_size_in_bytes(num_entries), mtInternal);
+    State* const state = (State*)p;
+    state->announced = state->published = 0;
 #ifdef ASSERT
-    for (int i = 0; i < _num_entries; i ++) {
-      sample_at(i)->reset();
+    for (int i = 0; i < num_entries; i ++) {
+      ((Sample*)((uint8_t*)p + state_size_in_bytes() + Sample::size_in_bytes() * i))->reset();
     }
 #endif
+    return p;
+  }
+
+public:
+
+  // Creates a table of num_entries samples. If memory is given, it must be external_size_in_bytes(num_entries)
+  // large and the table takes its content as it is; that is used for tables living in the history file.
+  // Otherwise, the table allocates its memory from C-heap.
+  SampleTable(int num_entries, void* memory = NULL)
+    : _num_entries(num_entries),
+      _state((State*)(memory != NULL ? memory : allocate_table_memory(num_entries))),
+      _samples((Sample*)((uint8_t*)_state + state_size_in_bytes()))
+  {}
+
+  static size_t external_size_in_bytes(int num_entries) {
+    return state_size_in_bytes() + Sample::size_in_bytes() * num_entries;
   }
 
-  bool is_empty() const { return _head == -1; }
+  bool is_empty() const { return Atomic::load_acquire(&_state->published) == 0; }
+  bool is_full() const  { return Atomic::load_acquire(&_state->published) >= (uint64_t)_num_entries; }
 
+  // Direct slot access. Writer only, or for readers synchronizing by other means.
   const Sample* sample_at(int index) const { return (Sample*)((uint8_t*)_samples + sample_offset_in_bytes(index)); }
   Sample* sample_at(int index) { return (Sample*)((uint8_t*)_samples + sample_offset_in_bytes(index)); }
 
+  // Writer only.
   void add_sample(const Sample* sample) {
-    // Advance head
-    _head ++;
-    if (_head == _num_entries) {
-      _did_wrap = true;
-      _head = 0;
-    }
-    // Copy sample
-    ::memcpy(sample_at(_head), sample, Sample::size_in_bytes());
-    DEBUG_ONLY(verify());
-  }
-
-  // Given a valid sample index, return the previous index or -1 if this is the oldest sample.
-  int get_previous_index(int idx) const {
-    assert(idx >= 0 && idx <= _num_entries, "index oob: %d", idx);
-    assert(_did_wrap == true || idx <= _head, "index invalid: %d", idx);
-    int prev = idx - 1;
-    if (prev == -1 && _did_wrap) {
-      prev = _num_entries - 1;
-    }
-    if (prev == _head) {
-      prev = -1;
-    }
-    return prev;
+    const uint64_t n = _state->published;
+    Atomic::release_store(&_state->announced, n + 1);
+    OrderAccess::storestore();
+    ::memcpy(sample_at(slot_of(n)), sample, Sample::size_in_bytes());
+    Atomic::release_store(&_state->published, n + 1);
+  }
+
+  // A range [lo, hi) of sample numbers; taken once by a reader so that consecutive
+  // walks (e.g. measuring and printing) see the same set of samples.
+  struct Range {
+    uint64_t lo;
+    uint64_t hi;
+  };
+
+  Range published_range() const {
+    Range r;
+    r.hi = Atomic::load_acquire(&_state->published);
+    r.lo = r.hi > (uint64_t)_num_entries ? r.hi - _num_entries : 0;
+    return r;
   }
 
   class Closure {
@@ -710,38 +761,29 @@ class SampleTable : public CHeapObj<mtInternal> {
     virtual void do_sample(const Sample* sample, const Sample* previous_sample) = 0;
   };
 
-  void call_closure_for_sample_at(Closure* closure, int idx) const {
-    const Sample* sample = sample_at(idx);
-    int idx2 = get_previous_index(idx);
-    const Sample* previous_sample = idx2 == -1 ? NULL : sample_at(idx2);
-    closure->do_sample(sample, previous_sample);
-  }
-
-  void walk_table_locked(Closure* closure, bool youngest_to_oldest = true) const {
-
-    if (_head == -1) {
-      return;
+  // Copies sample <n> - and, unless it is the oldest sample of the range, its predecessor - into the
+  // given buffers and feeds them to the closure. Samples overwritten while copying are skipped.
+  void call_closure_for_sample(Closure* closure, const Range& r, uint64_t n,
+                               Sample* buf, Sample* previous_buf) const {
+    const bool has_previous = n > r.lo;
+    ::memcpy(buf, sample_at(slot_of(n)), Sample::size_in_bytes());
+    if (has_previous) {
+      ::memcpy(previous_buf, sample_at(slot_of(n - 1)), Sample::size_in_bytes());
     }
+    if (is_intact(has_previous ? n - 1 : n)) {
+      closure->do_sample(buf, has_previous ? previous_buf : NULL);
+    }
+  }
 
-    DEBUG_ONLY(verify();)
-
-    if (youngest_to_oldest) { // youngest to oldest
-      for (int pos = _head; pos >= 0; pos--) {
-        call_closure_for_sample_at(closure, pos);
-      }
-      if (_did_wrap) {
-        for (int pos = _num_entries - 1; pos > _head; pos--) {
-          call_closure_for_sample_at(closure, pos);
-        }
-      }
-    } else { // oldest to youngest
-      if (_did_wrap) {
-        for (int pos = _head + 1; pos < _num_entries; pos ++) {
-          call_closure_for_sample_at(closure, pos);
-        }
+  void walk_table(Closure* closure, const Range& r, Sample* buf, Sample* previous_buf,
+                  bool youngest_to_oldest = true) const {
+    if (youngest_to_oldest) {
+      for (uint64_t n = r.hi; n > r.lo; n--) {
+        call_closure_for_sample(closure, r, n - 1, buf, previous_buf);
       }
-      for (int pos = 0; pos <= _head; pos ++) {
-        call_closure_for_sample_at(closure, pos);
+    } else {
+      for (uint64_t n = r.lo; n < r.hi; n++) {
+        call_closure_for_sample(closure, r, n, buf, previous_buf);
       }
     }
   }
@@ -765,40 +807,167 @@ class PrintSamplesClosure : public SampleTable::Closure {
   outputStream* const _st;
   const print_info_t* const _pi;
   const ColumnWidths* const _widths;
+  const bool _with_millis;
 
 public:
 
-  PrintSamplesClosure(outputStream* st, const print_info_t* pi, const ColumnWidths* widths) :
-    _st(st), _pi(pi), _widths(widths) {}
+  PrintSamplesClosure(outputStream* st, const print_info_t* pi, const ColumnWidths* widths, bool with_millis) :
+    _st(st), _pi(pi), _widths(widths), _with_millis(with_millis) {}
 
   void do_sample(const Sample* sample, const Sample* previous_sample) {
-    print_one_sample(_st, sample, previous_sample, _widths, _pi);
+    print_one_sample(_st, sample, previous_sample, _widths, _pi, -1, NULL, _with_millis);
+  }
+};
+
+////////////// History file //////////////////////////
+
+// With -XX:VitalsHistoryFile, the short and long term tables live in a shared file mapping.
+// That way the kernel persists them even if the process dies abnormally (e.g. if it gets
+// OOM-killed), without any syscalls on the sampling path. The file can be decoded post mortem
+// with "jcmd <pid> VM.vitals file=<name>" by a JVM of the same build and column layout.
+//
+// Layout: this header, followed by the short term table and the long term table, each consisting
+// of a SampleTable::State and the samples.
+class HistoryFileHeader {
+
+  static const int layout_version = 1;
+
+  char     _magic[8];
+  uint32_t _layout_version;
+  uint32_t _vitals_version;
+  uint32_t _num_values;
+  uint32_t _sample_size;
+  uint32_t _columns_hash;
+  uint32_t _short_term_entries;
+  uint32_t _long_term_entries;
+  uint32_t _short_term_span;  // seconds
+  uint32_t _long_term_span;   // seconds
+  int32_t  _pid;
+
+  static const char* magic() { return "VITALSHF"; }
+
+  // A fingerprint of the column layout, which depends on platform and VM options.
+  static uint32_t calc_columns_hash() {
+    uint32_t h = 0;
+    for (const Column* c = ColumnList::the_list()->first(); c != NULL; c = c->next()) {
+      const char* const strings[] = { c->category(), c->header(), c->name() };
+      for (int i = 0; i < 3; i++) {
+        for (const char* p = strings[i]; p != NULL && *p != '\0'; p++) {
+          h = 31 * h + (uint32_t)*p;
+        }
+        h = 31 * h + '/';
+      }
+    }
+    return h;
+  }
+
+  static size_t header_size_in_bytes() { return align_up(sizeof(HistoryFileHeader), sizeof(uint64_t)); }
+
+  size_t short_term_table_size_in_bytes() const { return SampleTable::external_size_in_bytes(_short_term_entries); }
+  size_t long_term_table_size_in_bytes() const  { return SampleTable::external_size_in_bytes(_long_term_entries); }
+
+public:
+
+  static size_t file_size(int short_term_entries, int long_term_entries) {
+    return header_size_in_bytes() +
+           SampleTable::external_size_in_bytes(short_term_entries) +
+           SampleTable::external_size_in_bytes(long_term_entries);
+  }
+
+  // Initialize the header of a freshly created (hence zeroed) history file.
+  void initialize(int short_term_entries, int long_term_entries) {
+    _layout_version = layout_version;
+    _vitals_version = vitals_version;
+    _num_values = (uint32_t)Sample::num_values();
+    _sample_size = (uint32_t)Sample::size_in_bytes();
+    _columns_hash = calc_columns_hash();
+    _short_term_entries = (uint32_t)short_term_entries;
+    _long_term_entries = (uint32_t)long_term_entries;
+    _short_term_span = (uint32_t)(VitalsShortTermTableHours * 3600);
+    _long_term_span = (uint32_t)(VitalsLongTermTableDays * 24 * 3600);
+    _pid = os::current_process_id();
+    // Write the magic last, so that a file is only recognized once its header is complete.
+    OrderAccess::storestore();
+    ::memcpy(_magic, magic(), sizeof(_magic));
+  }
+
+  // Check that a mapped file of the given size, written by another JVM, can be decoded by us.
+  // Returns NULL on success, a reason otherwise.
+  const char* check(size_t size) const {
+    if (size < header_size_in_bytes() || ::memcmp(_magic, magic(), sizeof(_magic)) != 0) {
+      return "not a vitals history file";
+    }
+    if (_layout_version != layout_version || _vitals_version != vitals_version ||
+        _sample_size != Sample::size_in_bytes()) {
+      return "history file was written by a different JVM version";
+    }
+    if (_num_values != (uint32_t)Sample::num_values() || _columns_hash != calc_columns_hash()) {
+      return "history file was written with a different column layout (VM options or platform differ)";
+    }
+    if (size < file_size(_short_term_entries, _long_term_entries)) {
+      return "history file is truncated";
+    }
+    return NULL;
+  }
+
+  void* short_term_table() const {
+    return (uint8_t*)this + header_size_in_bytes();
+  }
+  void* long_term_table() const {
+    return (uint8_t*)short_term_table() + short_term_table_size_in_bytes();
   }
+
+  int short_term_entries() const { return (int)_short_term_entries; }
+  int long_term_entries() const  { return (int)_long_term_entries; }
+  int short_term_span() const    { return (int)_short_term_span; }
+  int long_term_span() const     { return (int)_long_term_span; }
+  int pid() const                { return (int)_pid; }
 };
 
 // sampleTables is a combination of two tables: a short term table and a long term table.
 // It takes care to feed new samples into these tables at the appropriate intervals.
+//
+// Only the sampler thread writes to the tables, and it never takes a lock. Readers are
+// serialized among themselves via g_vitals_lock, which guards the reader copy buffers.
 class SampleTables: public CHeapObj<mtInternal> {
 
-  static int short_term_tablesize() { return (VitalsShortTermTableHours * 3600 / VitalsSampleInterval) + 1; }
-  static int long_term_tablesize()  { return (VitalsLongTermTableDays * 24 * 60 / VitalsLongTermSampleIntervalMinutes) + 1; }
-
   SampleTable _short_term_table;
   SampleTable _long_term_table;
   SampleTable _extremum_samples;
   SampleTable _last_extremum_samples;
 
+  // Only with -XX:+VitalsBurstSampling.
+  SampleTable* const _burst_table;
+
+  // Sequence counter for the extremum tables, which are updated in place: odd while
+  // the sampler thread updates them.
+  volatile uint32_t _extremum_seq;
+
   int _count;
   int _large_table_count;
 
-  static void print_table(const SampleTable* table, outputStream* st,
-                          const ColumnWidths* widths, const print_info_t* pi) {
-    if (table->is_empty()) {
-      st->print_cr("(no samples)");
-      return;
+  // Reader copy buffers, preallocated since we may print when memory is tight.
+  Sample* _read_buf;
+  Sample* _read_buf_previous;
+
+  static const int max_extremum_read_attempts = 100;
+
+  // Copy the extremum sample for the given column, and its predecessor, into the reader buffers.
+  // Returns false if we could not get a consistent copy (the sampler may have died while updating).
+  bool copy_extremum_samples(int idx) {
+    for (int attempt = 0; attempt < max_extremum_read_attempts; attempt++) {
+      const uint32_t seq = Atomic::load_acquire(&_extremum_seq);
+      if ((seq & 1) == 0) {
+        ::memcpy(_read_buf, _extremum_samples.sample_at(idx), Sample::size_in_bytes());
+        ::memcpy(_read_buf_previous, _last_extremum_samples.sample_at(idx), Sample::size_in_bytes());
+        OrderAccess::loadload();
+        if (Atomic::load(&_extremum_seq) == seq) {
+          return true;
+        }
+      }
+      os::naked_yield();
     }
-    PrintSamplesClosure prclos(st, pi, widths);
-    table->walk_table_locked(&prclos, !pi->reverse_ordering);
+    return false;
   }
 
   static void print_headers(outputStream* st, const ColumnWidths* widths, const print_info_t* pi) {
@@ -809,6 +978,19 @@ class SampleTables: public CHeapObj<mtInternal> {
     print_column_names(st, widths, pi);
   }
 
+public:
+
+  static void print_table_with_headers(const SampleTable* table, outputStream* st, const print_info_t* pi,
+                                       Sample* buf, Sample* previous_buf, bool with_millis = false) {
+    const SampleTable::Range range = table->published_range();
+    ColumnWidths widths;
+    MeasureColumnWidthsClosure mcwclos(pi, &widths);
+    table->walk_table(&mcwclos, range, buf, previous_buf);
+    print_headers(st, &widths, pi);
+    PrintSamplesClosure prclos(st, pi, &widths, with_millis);
+    table->walk_table(&prclos, range, buf, previous_buf, !pi->reverse_ordering);
+  }
+
   // Helper, print a time span given in seconds-
   static void print_time_span(outputStream* st, int secs) {
     const int mins = secs / 60;
@@ -825,19 +1007,28 @@ class SampleTables: public CHeapObj<mtInternal> {
     }
   }
 
-public:
-
-  SampleTables()
-    : _short_term_table(short_term_tablesize()),
-      _long_term_table(long_term_tablesize()),
+  static int short_term_tablesize() { return (VitalsShortTermTableHours * 3600 / VitalsSampleInterval) + 1; }
+  static int long_term_tablesize()  { return (VitalsLongTermTableDays * 24 * 60 / VitalsLongTermSampleIntervalMinutes) + 1; }
+  static int burst_tablesize()      { return (VitalsBurstDuration * 1000 / VitalsBurstSampleInterval) + 1; }
+
+  // If given, short and long term tables live in the history file.
+  SampleTables(HistoryFileHeader* history_file)
+    : _short_term_table(short_term_tablesize(),
+                        history_file != NULL ? history_file->short_term_table() : NULL),
+      _long_term_table(long_term_tablesize(),
+                       history_file != NULL ? history_file->long_term_table() : NULL),
       _extremum_samples(Sample::num_values()),
       _last_extremum_samples(Sample::num_values()),
+      _burst_table(VitalsBurstSampling ? new SampleTable(burst_tablesize()) : NULL),
+      _extremum_seq(0),
       _count(0),
-      _large_table_count(MAX2(1, (int) (VitalsLongTermSampleIntervalMinutes * 60 / VitalsSampleInterval)))
+      _large_table_count(MAX2(1, (int) (VitalsLongTermSampleIntervalMinutes * 60 / VitalsSampleInterval))),
+      _read_buf(Sample::allocate()),
+      _read_buf_previous(Sample::allocate())
   {}
 
+  // Called by the sampler thread only.
   void add_sample(const Sample* sample) {
-    AutoLock autolock(&g_vitals_lock);
     // Nothing we do in here blocks: the sample values are already taken,
     // we only modify existing data structures (no memory is allocated either).
     _short_term_table.add_sample(sample);
@@ -880,8 +1071,11 @@ class SampleTables: public CHeapObj<mtInternal> {
 
             if (should_log) {
               Sample* last_extremum_sample = _last_extremum_samples.sample_at(idx);
+              Atomic::release_store(&_extremum_seq, _extremum_seq + 1);
+              OrderAccess::storestore();
               ::memcpy(last_extremum_sample, last_sample, Sample::size_in_bytes());
               ::memcpy(extremum_sample, sample, Sample::size_in_bytes());
+              Atomic::release_store(&_extremum_seq, _extremum_seq + 1);
             }
           }
         }
@@ -892,6 +1086,12 @@ class SampleTables: public CHeapObj<mtInternal> {
     }
   }
 
+  // Called by the sampler thread only.
+  void add_burst_sample(const Sample* sample) {
+    assert(_burst_table != NULL, "burst sampling not enabled");
+    _burst_table->add_sample(sample);
+  }
+
   void print_all(outputStream* st, const print_info_t* pi, const Sample* sample_now) {
 
     { // lock start
@@ -899,7 +1099,6 @@ class SampleTables: public CHeapObj<mtInternal> {
 
       if (sample_now != NULL) {
         ColumnWidths widths;
-        MeasureColumnWidthsClosure mcwclos(pi, &widths);
         widths.update_from_sample(sample_now, NULL, pi);
         st->print_cr("Now:");
         print_headers(st, &widths, pi);
@@ -908,49 +1107,45 @@ class SampleTables: public CHeapObj<mtInternal> {
       }
 
       if (!_short_term_table.is_empty()) {
-        ColumnWidths widths;
-        MeasureColumnWidthsClosure mcwclos(pi, &widths);
-        _short_term_table.walk_table_locked(&mcwclos);
-
         if (pi->csv == false) {
           print_time_span(st, VitalsShortTermTableHours * 3600);
         }
-        print_headers(st, &widths, pi);
-        print_table(&_short_term_table, st, &widths, pi);
+        print_table_with_headers(&_short_term_table, st, pi, _read_buf, _read_buf_previous);
         st->cr();
       }
 
       if (!_long_term_table.is_empty()) {
-        ColumnWidths widths;
-        MeasureColumnWidthsClosure mcwclos(pi, &widths);
-        _long_term_table.walk_table_locked(&mcwclos);
         print_time_span(st, VitalsLongTermTableDays * 24 * 3600);
-        print_headers(st, &widths, pi);
-        print_table(&_long_term_table, st, &widths, pi);
+        print_table_with_headers(&_long_term_table, st, pi, _read_buf, _read_buf_previous);
         st->cr();
       }
 
-      if (StoreVitalsExtremas && !_extremum_samples.is_empty() && !_last_extremum_samples.is_empty()) {
+      if (_burst_table != NULL && !_burst_table->is_empty()) {
+        if (pi->csv == false) {
+          st->print_cr("Burst samples (every %zu ms for %zu seconds after a trigger):",
+                       VitalsBurstSampleInterval, VitalsBurstDuration);
+        }
+        print_table_with_headers(_burst_table, st, pi, _read_buf, _read_buf_previous, true);
+        st->cr();
+      }
+
+      // The extremum tables are only valid once they had been fully initialized, see add_sample().
+      if (StoreVitalsExtremas && _extremum_samples.is_full()) {
         st->print_cr("Samples at extremes (+ marks a maximum, - marks a minimum)");
 
         ColumnWidths widths;
-        MeasureColumnWidthsClosure mcwclos(pi, &widths);
 
         for (Column const* column = ColumnList::the_list()->first(); column != NULL; column = column->next()) {
-          if (column->extremum() != NONE) {
-            Sample* extremum_sample = _extremum_samples.sample_at(column->index());
-            Sample* last_extremum_sample = _last_extremum_samples.sample_at(column->index());
-            widths.update_from_sample(extremum_sample, last_extremum_sample, pi, 1);
+          if (column->extremum() != NONE && copy_extremum_samples(column->index())) {
+            widths.update_from_sample(_read_buf, _read_buf_previous, pi, 1);
           }
         }
 
         print_headers(st, &widths, pi); // Need more space for the mark to display.
 
         for (Column const* column = ColumnList::the_list()->first(); column != NULL; column = column->next()) {
-          if (column->extremum() != NONE) {
-            Sample* extremum_sample = _extremum_samples.sample_at(column->index());
-            Sample* last_extremum_sample = _last_extremum_samples.sample_at(column->index());
-            print_one_sample(st, extremum_sample, last_extremum_sample, &widths, pi, column->index(),
+          if (column->extremum() != NONE && copy_extremum_samples(column->index())) {
+            print_one_sample(st, _read_buf, _read_buf_previous, &widths, pi, column->index(),
                              column->extremum() == MIN ? "-" : "+");
           }
         }
@@ -962,20 +1157,127 @@ class SampleTables: public CHeapObj<mtInternal> {
   }
 };
 
+static HistoryFileHeader* create_history_file(const char* name) {
+  const int short_term_entries = SampleTables::short_term_tablesize();
+  const int long_term_entries = SampleTables::long_term_tablesize();
+  HistoryFileHeader* hdr = (HistoryFileHeader*)
+      platform_create_shared_file_mapping(name, HistoryFileHeader::file_size(short_term_entries, long_term_entries));
+  if (hdr != NULL) {
+    hdr->initialize(short_term_entries, long_term_entries);
+    log_info(vitals)("Vitals history file: %s", name);
+  }
+  return hdr;
+}
+
 static SampleTables* g_all_tables = NULL;
 
+/////////////// METRICS FILE //////////////////////
+
+// With -XX:VitalsMetricsFile, the sampler thread writes each regular sample in OpenMetrics
+// text format. Scrapers read that file instead of attaching to the VM. The file is written
+// under a temporary name and then renamed, so a reader never sees a partial file. Values
+// are the raw sample values; for delta columns that is the underlying counter. The output
+// buffer is allocated once at startup.
+
+static char* g_metrics_buffer = NULL;
+static size_t g_metrics_buffer_size = 0;
+static char* g_metrics_tmp_file_name = NULL;
+
+static void initialize_metrics_file() {
+  const size_t len = ::strlen(VitalsMetricsFile) + 5;
+  g_metrics_tmp_file_name = NEW_C_HEAP_ARRAY(char, len, mtInternal);
+  jio_snprintf(g_metrics_tmp_file_name, len, "%s.tmp", VitalsMetricsFile);
+  // Room for name, HELP line and value of every column.
+  g_metrics_buffer_size = (size_t)ColumnList::the_list()->num_columns() * 256 + 16;
+  g_metrics_buffer = NEW_C_HEAP_ARRAY(char, g_metrics_buffer_size, mtInternal);
+  log_info(vitals)("Vitals metrics file: %s", VitalsMetricsFile);
+}
+
+// Prints vitals_<category>[_<header>]_<name>, with characters not valid in a metric
+// name replaced by '_'.
+static void print_metric_name(outputStream* st, const Column* c) {
+  char buf[128];
+  if (c->header() != NULL) {
+    jio_snprintf(buf, sizeof(buf), "vitals_%s_%s_%s", c->category(), c->header(), c->name());
+  } else {
+    jio_snprintf(buf, sizeof(buf), "vitals_%s_%s", c->category(), c->name());
+  }
+  for (char* p = buf; *p != '\0'; p++) {
+    if (!isalnum((unsigned char)*p) && *p != '_') {
+      *p = '_';
+    }
+  }
+  st->print_raw(buf);
+}
+
+static void write_metrics_file(const Sample* sample) {
+  stringStream ss(g_metrics_buffer, g_metrics_buffer_size);
+  for (const Column* c = ColumnList::the_list()->first(); c != NULL; c = c->next()) {
+    const value_t v = sample->value(c->index());
+    if (v == INVALID_VALUE) {
+      continue;
+    }
+    ss.print_raw("# HELP ");
+    print_metric_name(&ss, c);
+    ss.print_cr(" %s", c->description());
+    print_metric_name(&ss, c);
+    ss.print_cr(" " UINT64_FORMAT, (uint64_t)v);
+  }
+  ss.print_cr("# EOF");
+
+  const int fd = os::open(g_metrics_tmp_file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd == -1) {
+    log_debug(vitals)("Vitals: cannot open %s (%s).", g_metrics_tmp_file_name, os::strerror(errno));
+    return;
+  }
+  const bool written = os::write(fd, ss.base(), ss.size());
+  ::close(fd);
+  if (written) {
+    // rename() does not replace an existing file on Windows.
+    WINDOWS_ONLY(remove(VitalsMetricsFile);)
+    if (rename(g_metrics_tmp_file_name, VitalsMetricsFile) == -1) {
+      log_debug(vitals)("Vitals: cannot rename %s (%s).", g_metrics_tmp_file_name, os::strerror(errno));
+    }
+  }
+}
+
 /////////////// SAMPLING //////////////////////
 
 // Samples all values, but leaves timestamp unchanged
 static void sample_values(Sample* sample, bool avoid_locking) {
-  time_t t;
-  ::time(&t);
-  sample->set_timestamp(t);
+  const jlong now_ms = os::javaTimeMillis();
+  sample->set_timestamp((time_t)(now_ms / 1000), (int)(now_ms % 1000));
   DEBUG_ONLY(sample->set_num(-1);)
   sample_jvm_values(sample, avoid_locking);
   sample_platform_values(sample);
 }
 
+// Burst sampling (-XX:+VitalsBurstSampling): if two consecutive regular samples show a sudden
+// change (see the -XX:VitalsBurst...Threshold options), or if requested from outside (e.g. by
+// HiMemReport), the sampler thread samples at a high rate for a short time into a separate small
+// table. That captures the shape of a spike without paying for high frequency sampling all the time.
+
+static const char* volatile g_burst_request_reason = NULL;
+
+void request_burst_sampling(const char* reason) {
+  if (VitalsBurstSampling) {
+    Atomic::release_store(&g_burst_request_reason, reason);
+  }
+}
+
+// Total CPU time, in ns, spent by GC threads; -1 if unavailable.
+static jlong gc_cpu_time_ns() {
+  if (UsePerfData && os::is_thread_cpu_time_supported()) {
+    PerfCounter* const counter = CPUTimeCounters::get_counter(CPUTimeGroups::CPUTimeType::gc_total);
+    if (counter != NULL) {
+      return counter->get_value();
+    }
+  }
+  return -1;
+}
+
+static const char* check_burst_triggers(const Sample* sample, const Sample* previous_sample);
+
 class SamplerThread: public NamedThread {
 
   Sample* _sample;
@@ -983,16 +1285,85 @@ class SamplerThread: public NamedThread {
   int _samples_taken;
   int _jump_cooldown;
 
+  // Only used with burst sampling
+  Sample* _previous_sample;
+  jlong _last_gc_cpu_time_ns;
+  jlong _burst_end_ms;
+
+  // How often we look for burst requests while we sleep between regular samples.
+  static const int burst_request_poll_interval_ms = 1000;
+
   static int get_sample_interval_ms() {
     return (int)VitalsSampleInterval * 1000;
   }
 
+  static jlong now_ms() {
+    return os::javaTimeNanos() / NANOSECS_PER_MILLISEC;
+  }
+
   void take_sample() {
     _sample->reset();
     DEBUG_ONLY(_sample->set_num(_samples_taken);)
     _samples_taken ++;
     sample_values(_sample, VitalsLockFreeSampling);
     g_all_tables->add_sample(_sample);
+    if (VitalsMetricsFile != NULL) {
+      write_metrics_file(_sample);
+    }
+    if (VitalsBurstSampling) {
+      check_for_burst();
+    }
+  }
+
+  // Compare the regular sample just taken with its predecessor; if it changed a lot, request a burst.
+  void check_for_burst() {
+    const char* reason = NULL;
+    if (_samples_taken > 1) {
+      reason = check_burst_triggers(_sample, _previous_sample);
+    }
+    const jlong gc_cpu = gc_cpu_time_ns();
+    if (reason == NULL && VitalsBurstGCCPUThreshold > 0 && gc_cpu >= 0 && _last_gc_cpu_time_ns >= 0) {
+      const jlong percent = ((gc_cpu - _last_gc_cpu_time_ns) * 100) /
+                            ((jlong)get_sample_interval_ms() * NANOSECS_PER_MILLISEC);
+      if (percent >= (jlong)VitalsBurstGCCPUThreshold) {
+        reason = "gc cpu";
+      }
+    }
+    _last_gc_cpu_time_ns = gc_cpu;
+    ::memcpy(_previous_sample, _sample, Sample::size_in_bytes());
+    if (reason != NULL) {
+      request_burst_sampling(reason);
+    }
+  }
+
+  void take_burst_sample() {
+    _sample->reset();
+    sample_values(_sample, VitalsLockFreeSampling);
+    g_all_tables->add_burst_sample(_sample);
+  }
+
+  // Sleep until the next regular sample is due; meanwhile, serve burst requests.
+  void sleep_and_burst(jlong next_sample_ms) {
+    for (;;) {
+      const jlong now = now_ms();
+      if (now >= next_sample_ms || _stop) {
+        return;
+      }
+      const char* const reason = Atomic::load_acquire(&g_burst_request_reason);
+      if (reason != NULL) {
+        Atomic::release_store(&g_burst_request_reason, (const char*)NULL);
+        if (now >= _burst_end_ms) {
+          log_info(vitals)("Vitals: starting burst sampling (%s).", reason);
+        }
+        _burst_end_ms = now + (jlong)VitalsBurstDuration * 1000;
+      }
+      if (now < _burst_end_ms) {
+        os::naked_sleep(MIN2((jlong)VitalsBurstSampleInterval, next_sample_ms - now));
+        take_burst_sample();
+      } else {
+        os::naked_sleep(MIN2((jlong)burst_request_poll_interval_ms, next_sample_ms - now));
+      }
+    }
   }
 
 public:
@@ -1002,9 +1373,15 @@ class SamplerThread: public NamedThread {
       _sample(NULL),
       _stop(false),
       _samples_taken(0),
-      _jump_cooldown(0)
+      _jump_cooldown(0),
+      _previous_sample(NULL),
+      _last_gc_cpu_time_ns(-1),
+      _burst_end_ms(0)
   {
     _sample = Sample::allocate();
+    if (VitalsBurstSampling) {
+      _previous_sample = Sample::allocate();
+    }
     this->set_name("vitals sampler thread");
   }
 
@@ -1012,7 +1389,11 @@ class SamplerThread: public NamedThread {
     record_stack_base_and_size();
     for (;;) {
       take_sample();
-      os::naked_sleep(get_sample_interval_ms());
+      if (VitalsBurstSampling) {
+        sleep_and_burst(now_ms() + get_sample_interval_ms());
+      } else {
+        os::naked_sleep(get_sample_interval_ms());
+      }
       if (_stop) {
         break;
       }
@@ -1078,6 +1459,17 @@ static Column* g_col_number_of_classes = NULL;
 static Column* g_col_number_of_class_loads = NULL;
 static Column* g_col_number_of_class_unloads = NULL;
 
+static bool g_show_thread_cpu_columns = false;
+static Column* g_col_thread_cpu_gc = NULL;
+static Column* g_col_thread_cpu_compiler = NULL;
+static Column* g_col_thread_cpu_java = NULL;
+static Column* g_col_thread_cpu_other = NULL;
+
+static Column* g_col_native_trims = NULL;
+static Column* g_col_native_trim_recovered = NULL;
+
+static Column* g_col_stringtable_free_nodes = NULL;
+
 static bool is_nmt_enabled() {
 #if INCLUDE_NMT
   // Note: JDK version dependency: Before JDK18, NMT had the ability to shut down operations
@@ -1100,6 +1492,8 @@ static bool add_jvm_columns() {
   Legend::the_legend()->add_footnote("    [nmt]: only shown if NMT is available and activated");
   Legend::the_legend()->add_footnote("     [cs]: only shown on 64-bit if class space is active");
   Legend::the_legend()->add_footnote("  [linux]: only on Linux");
+  Legend::the_legend()->add_footnote("   [trim]: only shown with periodic native heap trimming (TrimNativeHeapInterval)");
+  Legend::the_legend()->add_footnote("   [stfl]: only shown with StringTableNodeFreeList");
 
   g_col_heap_committed =
       define_column<MemorySizeColumn>(jvm_cat, "heap", "comm", "Java Heap Size, committed", true);
@@ -1164,10 +1558,53 @@ static bool add_jvm_columns() {
   g_col_number_of_class_unloads =
         define_column<DeltaValueColumn>(jvm_cat, "cls", "uld", "Classes unloaded [delta]", true);
 
+  g_show_thread_cpu_columns = os::is_thread_cpu_time_supported();
+  g_col_thread_cpu_gc =
+        define_column<DeltaValueColumn>(jvm_cat, "tcpu", "gc", "CPU time of GC threads (ms) [delta]", g_show_thread_cpu_columns);
+  g_col_thread_cpu_compiler =
+        define_column<DeltaValueColumn>(jvm_cat, "tcpu", "comp", "CPU time of compiler threads (ms) [delta]", g_show_thread_cpu_columns);
+  g_col_thread_cpu_java =
+        define_column<DeltaValueColumn>(jvm_cat, "tcpu", "java", "CPU time of application java threads (ms) [delta]", g_show_thread_cpu_columns);
+  g_col_thread_cpu_other =
+        define_column<DeltaValueColumn>(jvm_cat, "tcpu", "oth", "CPU time of other VM threads (ms) [delta]", g_show_thread_cpu_columns);
+
+  const bool show_trim_columns = NativeHeapTrimmer::enabled();
+  g_col_native_trims =
+        define_column<DeltaValueColumn>(jvm_cat, "trim", "num", "Periodic native heap trims [delta] [trim]", show_trim_columns);
+  g_col_native_trim_recovered =
+        define_column<DeltaMemorySizeColumn>(jvm_cat, "trim", "rec", "Memory returned to the OS by periodic native heap trims, with TrimNativeHeapFreeThreshold [delta] [trim]",
+                                             show_trim_columns && TrimNativeHeapFreeThreshold > 0);
+
+  g_col_stringtable_free_nodes =
+        define_column<MemorySizeColumn>(jvm_cat, "strt", "free", "Memory held by the StringTable node free list [stfl]", StringTableNodeFreeList);
+
   return true;
 }
 
 
+// Returns the reason if the change between two consecutive regular samples should trigger
+// burst sampling, NULL otherwise.
+static const char* check_burst_triggers(const Sample* sample, const Sample* previous_sample) {
+  const Column* const rss_col = platform_rss_column();
+  if (VitalsBurstRSSGrowthThreshold > 0 && rss_col != NULL) {
+    const value_t v = sample->value(rss_col->index());
+    const value_t v2 = previous_sample->value(rss_col->index());
+    if (v != INVALID_VALUE && v2 != INVALID_VALUE && v > v2 &&
+        (v - v2) >= (value_t)VitalsBurstRSSGrowthThreshold) {
+      return "rss growth";
+    }
+  }
+  if (VitalsBurstThreadCountThreshold > 0 && g_col_number_of_java_threads != NULL) {
+    const value_t v = sample->value(g_col_number_of_java_threads->index());
+    const value_t v2 = previous_sample->value(g_col_number_of_java_threads->index());
+    if (v != INVALID_VALUE && v2 != INVALID_VALUE && v > v2 &&
+        (v - v2) >= (value_t)VitalsBurstThreadCountThreshold) {
+      return "thread count";
+    }
+  }
+  return NULL;
+}
+
 ////////// class ValueSampler and childs /////////////////
 
 template <typename T>
@@ -1232,6 +1669,98 @@ static bool get_nmt_values(nmt_values_t* out) {
   return false;
 }
 
+// Thread groups for the CPU time columns.
+enum ThreadCpuGroup {
+  thread_cpu_gc,
+  thread_cpu_compiler,
+  thread_cpu_java,
+  thread_cpu_other,
+  thread_cpu_num_groups
+};
+
+static ThreadCpuGroup thread_cpu_group(const Thread* t) {
+  if (t->is_Java_thread()) {
+    const JavaThread* jt = JavaThread::cast(t);
+    if (jt->is_Compiler_thread()) {
+      return thread_cpu_compiler;
+    }
+    return jt->is_hidden_from_external_view() ? thread_cpu_other : thread_cpu_java;
+  }
+  return (t->is_Worker_thread() || t->is_ConcurrentGC_thread()) ? thread_cpu_gc : thread_cpu_other;
+}
+
+// CPU time, in ns, of the threads of each group that have exited.
+static volatile jlong g_exited_thread_cpu_ns[thread_cpu_num_groups] = { 0 };
+
+// Last CPU times reported per group, in ms.
+static volatile value_t g_last_thread_cpu_ms[thread_cpu_num_groups] = { 0 };
+
+namespace counters {
+
+// Called by an exiting thread, before it leaves the thread list: for a short while, its
+// CPU time may be counted both here and as a live thread. Sampling keeps the reported
+// values from going backwards once the thread is gone from the list.
+void add_exited_thread_cpu_time(Thread* t) {
+  if (!g_show_thread_cpu_columns) {
+    return;
+  }
+  const jlong ns = os::thread_cpu_time(t);
+  if (ns > 0) {
+    Atomic::add(&g_exited_thread_cpu_ns[thread_cpu_group(t)], ns);
+  }
+}
+
+} // namespace counters
+
+// Returns the larger of v and the last value reported for the group, and records it.
+static value_t monotonic_thread_cpu_ms(ThreadCpuGroup group, value_t v) {
+  value_t prev = Atomic::load(&g_last_thread_cpu_ms[group]);
+  while (v > prev) {
+    const value_t cur = Atomic::cmpxchg(&g_last_thread_cpu_ms[group], prev, v);
+    if (cur == prev) {
+      return v;
+    }
+    prev = cur;
+  }
+  return prev;
+}
+
+// CPU time, in ms, of all threads, grouped by what the threads do. Threads that
+// exited are included through the per-group totals they left behind, so the
+// values never go down.
+struct thread_cpu_times_t {
+  value_t gc;
+  value_t compiler;
+  value_t java;
+  value_t other;
+};
+
+static void get_thread_cpu_times(thread_cpu_times_t* out) {
+  jlong ns[thread_cpu_num_groups] = { 0 };
+  for (JavaThread* jt : ThreadsListHandle()) {
+    const jlong t_ns = os::thread_cpu_time(jt);
+    if (t_ns > 0) {
+      ns[thread_cpu_group(jt)] += t_ns;
+    }
+  }
+  for (NonJavaThread::Iterator njti; !njti.end(); njti.step()) {
+    Thread* const t = njti.current();
+    const jlong t_ns = os::thread_cpu_time(t);
+    if (t_ns > 0) {
+      ns[thread_cpu_group(t)] += t_ns;
+    }
+  }
+  value_t ms[thread_cpu_num_groups];
+  for (int i = 0; i < thread_cpu_num_groups; i++) {
+    const jlong total = ns[i] + Atomic::load(&g_exited_thread_cpu_ns[i]);
+    ms[i] = monotonic_thread_cpu_ms((ThreadCpuGroup)i, (value_t)(total / NANOSECS_PER_MILLISEC));
+  }
+  out->gc = ms[thread_cpu_gc];
+  out->compiler = ms[thread_cpu_compiler];
+  out->java = ms[thread_cpu_java];
+  out->other = ms[thread_cpu_other];
+}
+
 void sample_jvm_values(Sample* sample, bool avoid_locking) {
 
   // Note: if avoid_locking=true, skip values which need JVM-side locking.
@@ -1303,6 +1832,33 @@ void sample_jvm_values(Sample* sample, bool avoid_locking) {
       ClassLoaderDataGraph::num_instance_classes() + ClassLoaderDataGraph::num_array_classes());
   set_value_in_sample(g_col_number_of_class_loads, sample, counters::g_classes_loaded);
   set_value_in_sample(g_col_number_of_class_unloads, sample, counters::g_classes_unloaded);
+
+  // Thread CPU time by thread group
+  if (g_show_thread_cpu_columns && !avoid_locking) {
+    thread_cpu_times_t times;
+    get_thread_cpu_times(&times);
+    set_value_in_sample(g_col_thread_cpu_gc, sample, times.gc);
+    set_value_in_sample(g_col_thread_cpu_compiler, sample, times.compiler);
+    set_value_in_sample(g_col_thread_cpu_java, sample, times.java);
+    set_value_in_sample(g_col_thread_cpu_other, sample, times.other);
+  }
+
+  // Periodic native heap trimming
+  uint64_t num_trims = 0;
+  size_t trim_recovered = 0;
+  if (NativeHeapTrimmer::get_statistics(&num_trims, &trim_recovered)) {
+    set_value_in_sample(g_col_native_trims, sample, num_trims);
+    if (TrimNativeHeapFreeThreshold > 0) {
+      set_value_in_sample(g_col_native_trim_recovered, sample, trim_recovered);
+    }
+  }
+
+  // StringTable node free list
+  size_t stringtable_free_nodes = 0;
+  size_t stringtable_free_bytes = 0;
+  if (StringTable::get_node_free_list_statistics(&stringtable_free_nodes, &stringtable_free_bytes)) {
+    set_value_in_sample(g_col_stringtable_free_nodes, sample, stringtable_free_bytes);
+  }
 }
 
 bool initialize() {
@@ -1322,9 +1878,20 @@ bool initialize() {
 
   // -- Now the number of columns is known (and fixed). --
 
-  g_all_tables = new SampleTables();
+  // If requested, keep the sample tables in a memory mapped file. If that fails, we
+  // continue without it.
+  HistoryFileHeader* history_file = NULL;
+  if (VitalsHistoryFile != NULL) {
+    history_file = create_history_file(VitalsHistoryFile);
+  }
+
+  g_all_tables = new SampleTables(history_file);
   success = success && (g_all_tables != NULL);
 
+  if (success && VitalsMetricsFile != NULL) {
+    initialize_metrics_file();
+  }
+
   success = success && initialize_sampler_thread();
 
   if (success) {
@@ -1401,6 +1968,63 @@ void print_report(outputStream* st, const print_info_t* pinfo) {
   os::free(sample_now);
 }
 
+void print_history_file(outputStream* st, const char* name, const print_info_t* pinfo) {
+
+  if (ColumnList::the_list() == NULL) {
+    st->print_cr(" (unavailable)");
+    return;
+  }
+
+  print_info_t info;
+  if (pinfo != NULL) {
+    info = *pinfo;
+  } else {
+    default_settings(&info);
+  }
+
+  size_t size = 0;
+  const HistoryFileHeader* const hdr = (const HistoryFileHeader*)platform_map_file_readonly(name, &size);
+  if (hdr == NULL) {
+    st->print_cr("Cannot open vitals history file %s.", name);
+    return;
+  }
+
+  const char* const error = hdr->check(size);
+  if (error != NULL) {
+    st->print_cr("Cannot decode %s: %s.", name, error);
+  } else {
+    if (info.csv == false) {
+      st->cr();
+      if (info.no_legend == false) {
+        Legend::the_legend()->print_on(st);
+        st->cr();
+      }
+      st->print_cr("History file %s, written by pid %d:", name, hdr->pid());
+      st->cr();
+    }
+    const SampleTable short_term_table(hdr->short_term_entries(), hdr->short_term_table());
+    const SampleTable long_term_table(hdr->long_term_entries(), hdr->long_term_table());
+    Sample* const buf = Sample::allocate();
+    Sample* const previous_buf = Sample::allocate();
+    if (!short_term_table.is_empty()) {
+      if (info.csv == false) {
+        SampleTables::print_time_span(st, hdr->short_term_span());
+      }
+      SampleTables::print_table_with_headers(&short_term_table, st, &info, buf, previous_buf);
+      st->cr();
+    }
+    if (!long_term_table.is_empty()) {
+      SampleTables::print_time_span(st, hdr->long_term_span());
+      SampleTables::print_table_with_headers(&long_term_table, st, &info, buf, previous_buf);
+      st->cr();
+    }
+    os::free(buf);
+    os::free(previous_buf);
+  }
+
+  platform_unmap_file(hdr, size);
+}
+
 // Dump both textual and csv style reports to two files, "sapmachine_vitals_<pid>.txt" and "sapmachine_vitals_<pid>.csv".
 // If these files exist, they are overwritten.
 void dump_reports() {
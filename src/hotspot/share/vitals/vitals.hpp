@@ -63,10 +63,18 @@ namespace sapmachine_vitals {
   // Print report to stream. Leave print_info NULL for default settings.
   void print_report(outputStream* st, const print_info_t* print_info = NULL);
 
+  // Decode and print a history file (see -XX:VitalsHistoryFile), typically written by a JVM
+  // which died abnormally. Leave print_info NULL for default settings.
+  void print_history_file(outputStream* st, const char* name, const print_info_t* print_info = NULL);
+
   // Dump both textual and csv style reports to two files, "vitals_<pid>.txt" and "vitals_<pid>.csv".
   // If these files exist, they are overwritten.
   void dump_reports();
 
+  // Ask the sampler thread to start a burst sampling window (only with -XX:+VitalsBurstSampling).
+  // reason must be a string literal.
+  void request_burst_sampling(const char* reason);
+
   // For printing in thread lists only.
   const Thread* samplerthread();
 
@@ -76,6 +84,7 @@ namespace sapmachine_vitals {
     void inc_classes_loaded(size_t count);
     void inc_classes_unloaded(size_t count);
     void inc_threads_created(size_t count);
+    void add_exited_thread_cpu_time(Thread* t);
   };
 
 };
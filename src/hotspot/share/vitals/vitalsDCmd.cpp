@@ -42,7 +42,9 @@ VitalsDCmd::VitalsDCmd(outputStream* output, bool heap)
     _no_legend("no-legend", "Omit legend.", "BOOLEAN", false, "false"),
     _reverse("reverse", "Reverse printing order.", "BOOLEAN", false, "false"),
     _raw("raw", "Print raw values.", "BOOLEAN", false, "false"),
-    _sample_now("now", "Sample now values", "BOOLEAN", false, "false")
+    _sample_now("now", "Sample now values", "BOOLEAN", false, "false"),
+    _file("file", "Instead of the vitals of this JVM, print the history file written by a "
+          "(possibly dead) JVM started with -XX:VitalsHistoryFile.", "STRING", false)
 {
   _dcmdparser.add_dcmd_option(&_scale);
   _dcmdparser.add_dcmd_option(&_csv);
@@ -50,6 +52,7 @@ VitalsDCmd::VitalsDCmd(outputStream* output, bool heap)
   _dcmdparser.add_dcmd_option(&_reverse);
   _dcmdparser.add_dcmd_option(&_raw);
   _dcmdparser.add_dcmd_option(&_sample_now);
+  _dcmdparser.add_dcmd_option(&_file);
 }
 
 static bool scale_from_name(const char* scale, size_t* out) {
@@ -83,6 +86,10 @@ void VitalsDCmd::execute(DCmdSource source, TRAPS) {
   info.sample_now = _sample_now.value();
 
   output()->print_cr("Vitals:");
+  if (_file.is_set()) {
+    sapmachine_vitals::print_history_file(output(), _file.value(), &info);
+    return;
+  }
   if (info.sample_now && info.csv) {
     output()->print_cr("(\"now\" ignored in csv mode)");
   }
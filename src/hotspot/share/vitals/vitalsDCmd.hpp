@@ -39,8 +39,9 @@ class VitalsDCmd : public DCmdWithParser {
   DCmdArgument<bool> _reverse;
   DCmdArgument<bool> _raw;
   DCmdArgument<bool> _sample_now;
+  DCmdArgument<char*> _file;
 public:
-  static int num_arguments() { return 6; }
+  static int num_arguments() { return 7; }
   VitalsDCmd(outputStream* output, bool heap);
   static const char* name() {
     return "VM.vitals";
@@ -43,6 +43,7 @@ namespace sapmachine_vitals {
   class Sample {
     DEBUG_ONLY(int _num;)
     time_t _timestamp;
+    int _millis;        // millisecond part of the timestamp
     value_t _values[1]; // var sized
   public:
     static int num_values();
@@ -51,11 +52,12 @@ namespace sapmachine_vitals {
 
     void reset();
     void set_value(int index, value_t v);
-    void set_timestamp(time_t t);
+    void set_timestamp(time_t t, int millis = 0);
     DEBUG_ONLY(void set_num(int n);)
 
     value_t value(int index) const;
     time_t timestamp() const    { return _timestamp; }
+    int millis() const          { return _millis; }
     DEBUG_ONLY(int num() const  { return _num; })
   };
 
@@ -245,6 +247,17 @@ namespace sapmachine_vitals {
   bool platform_columns_initialize();
 
   void sample_platform_values(Sample* sample);
+
+  // Returns the platform column holding the process resident set size, or NULL if there is none.
+  const Column* platform_rss_column();
+
+  // Support for the history file (-XX:VitalsHistoryFile).
+  // Creates (or truncates) the file and maps it shared and writable; returns NULL if that failed or
+  // if the platform does not support it.
+  void* platform_create_shared_file_mapping(const char* name, size_t size);
+  // Maps an existing file read-only; returns NULL if that failed.
+  const void* platform_map_file_readonly(const char* name, size_t* size);
+  void platform_unmap_file(const void* p, size_t size);
   void sample_jvm_values(Sample* sample, bool avoid_locking);
 
 }; // namespace sapmachine_vitals
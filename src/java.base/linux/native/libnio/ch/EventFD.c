@@ -37,7 +37,8 @@
 JNIEXPORT jint JNICALL
 Java_sun_nio_ch_EventFD_eventfd0(JNIEnv *env, jclass klazz)
 {
-    int efd = eventfd((uint64_t)0, 0);
+    // close-on-exec, like the epoll descriptor it is registered with
+    int efd = eventfd((uint64_t)0, EFD_CLOEXEC);
     if (efd == -1) {
         JNU_ThrowIOExceptionWithLastError(env, "eventfd failed");
         return IOS_THROWN;
@@ -24,7 +24,9 @@
  */
 
 #include <sys/sendfile.h>
+#include <sys/stat.h>
 #include <dlfcn.h>
+#include <fcntl.h>
 
 #include "jni.h"
 #include "nio.h"
@@ -33,7 +35,16 @@
 
 typedef ssize_t copy_file_range_func(int, loff_t*, int, loff_t*, size_t,
                                      unsigned int);
-static copy_file_range_func* my_copy_file_range_func = NULL;
+// Cleared concurrently by copy_file_range_not_implemented(), so callers read
+// it once into a local and use only that.
+static copy_file_range_func* volatile my_copy_file_range_func = NULL;
+
+// The C library may export copy_file_range on a kernel that does not
+// implement it; once ENOSYS has been seen, stop paying for the failed call.
+static void copy_file_range_not_implemented()
+{
+    my_copy_file_range_func = NULL;
+}
 
 JNIEXPORT void JNICALL
 Java_sun_nio_ch_FileDispatcherImpl_init0(JNIEnv *env, jclass klass)
@@ -42,13 +53,27 @@ Java_sun_nio_ch_FileDispatcherImpl_init0(JNIEnv *env, jclass klass)
         (copy_file_range_func*) dlsym(RTLD_DEFAULT, "copy_file_range");
 }
 
+// copy_file_range rejects a pipe as its source. When the source channel is
+// a FIFO, splice moves the pages straight into the target file instead.
+static jlong
+splice_from_pipe(int srcFD, int dstFD, loff_t* offset, size_t len)
+{
+    struct stat sb;
+    if (fstat(srcFD, &sb) != 0 || !S_ISFIFO(sb.st_mode)) {
+        errno = EINVAL;
+        return -1;
+    }
+    return splice(srcFD, NULL, dstFD, offset, len, SPLICE_F_MOVE);
+}
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileDispatcherImpl_transferFrom0(JNIEnv *env, jobject this,
                                               jobject srcFDO, jobject dstFDO,
                                               jlong position, jlong count,
                                               jboolean append)
 {
-    if (my_copy_file_range_func == NULL)
+    copy_file_range_func* copy_func = my_copy_file_range_func;
+    if (copy_func == NULL)
         return IOS_UNSUPPORTED;
     // copy_file_range fails with EBADF when appending
     if (append == JNI_TRUE)
@@ -59,12 +84,17 @@ Java_sun_nio_ch_FileDispatcherImpl_transferFrom0(JNIEnv *env, jobject this,
 
     loff_t offset = (loff_t)position;
     size_t len = (size_t)count;
-    jlong n = my_copy_file_range_func(srcFD, NULL, dstFD, &offset, len, 0);
+    jlong n = copy_func(srcFD, NULL, dstFD, &offset, len, 0);
+    if (n < 0 && errno == EINVAL) {
+        n = splice_from_pipe(srcFD, dstFD, &offset, len);
+    }
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
-        if (errno == ENOSYS)
+        if (errno == ENOSYS) {
+            copy_file_range_not_implemented();
             return IOS_UNSUPPORTED_CASE;
+        }
         if ((errno == EBADF || errno == EINVAL || errno == EXDEV) &&
             ((ssize_t)count >= 0))
             return IOS_UNSUPPORTED_CASE;
@@ -93,15 +123,18 @@ Java_sun_nio_ch_FileDispatcherImpl_transferTo0(JNIEnv *env, jobject this,
 
     loff_t offset = (loff_t)position;
     jlong n;
-    if (my_copy_file_range_func != NULL) {
+    copy_file_range_func* copy_func = my_copy_file_range_func;
+    if (copy_func != NULL) {
         size_t len = (size_t)count;
-        n = my_copy_file_range_func(srcFD, &offset, dstFD, NULL, len, 0);
+        n = copy_func(srcFD, &offset, dstFD, NULL, len, 0);
         if (n < 0) {
             switch (errno) {
                 case EINTR:
                     return IOS_INTERRUPTED;
-                case EINVAL:
                 case ENOSYS:
+                    copy_file_range_not_implemented();
+                    // fall through
+                case EINVAL:
                 case EXDEV:
                     // ignore and try sendfile()
                     break;
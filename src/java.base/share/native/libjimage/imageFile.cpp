@@ -254,6 +254,72 @@ ImageFileReaderTable ImageFileReader::_reader_table;
 
 SimpleCriticalSection _reader_table_lock;
 
+// Cache of recently decompressed resources, so that repeated requests for the
+// same compressed resource, e.g. from concurrent class loaders, do not pay for
+// decompression again. Direct mapped on the location offset, only small
+// resources are cached, which bounds the total size to
+// decompressed_cache_slots * decompressed_cache_max_size bytes.
+static const u4 decompressed_cache_slots = 64;
+static const u8 decompressed_cache_max_size = 64 * 1024;
+
+struct DecompressedResource {
+    const ImageFileReader* _reader;
+    u8 _offset;
+    u8 _size;
+    u1* _data;
+};
+
+static DecompressedResource _decompressed_cache[decompressed_cache_slots];
+SimpleCriticalSection _decompressed_cache_lock;
+
+static DecompressedResource* decompressed_cache_slot(u8 offset) {
+    return &_decompressed_cache[(offset >> 3) % decompressed_cache_slots];
+}
+
+// Copy a cached resource to the supplied buffer. Returns false if not cached.
+static bool decompressed_cache_get(const ImageFileReader* reader, u8 offset, u8 size, u1* uncompressed_data) {
+    SimpleCriticalSectionLock cs(&_decompressed_cache_lock);
+    DecompressedResource* entry = decompressed_cache_slot(offset);
+    if (entry->_reader != reader || entry->_offset != offset || entry->_data == NULL) {
+        return false;
+    }
+    assert(entry->_size == size && "cached resource size mismatch");
+    memcpy(uncompressed_data, entry->_data, (size_t)size);
+    return true;
+}
+
+static void decompressed_cache_put(const ImageFileReader* reader, u8 offset, u8 size, const u1* uncompressed_data) {
+    if (size > decompressed_cache_max_size) {
+        return;
+    }
+    u1* data = new u1[(size_t)size];
+    memcpy(data, uncompressed_data, (size_t)size);
+    u1* old_data;
+    {
+        SimpleCriticalSectionLock cs(&_decompressed_cache_lock);
+        DecompressedResource* entry = decompressed_cache_slot(offset);
+        old_data = entry->_data;
+        entry->_reader = reader;
+        entry->_offset = offset;
+        entry->_size = size;
+        entry->_data = data;
+    }
+    delete[] old_data;
+}
+
+// Drop all cached resources of a reader that is being deleted.
+static void decompressed_cache_purge(const ImageFileReader* reader) {
+    SimpleCriticalSectionLock cs(&_decompressed_cache_lock);
+    for (u4 i = 0; i < decompressed_cache_slots; i++) {
+        DecompressedResource* entry = &_decompressed_cache[i];
+        if (entry->_reader == reader) {
+            delete[] entry->_data;
+            entry->_reader = NULL;
+            entry->_data = NULL;
+        }
+    }
+}
+
 // Locate an image if file already open.
 ImageFileReader* ImageFileReader::find_image(const char* name) {
     // Lock out _reader_table.
@@ -357,6 +423,7 @@ ImageFileReader::ImageFileReader(const char* name, bool big_endian) :
 ImageFileReader::~ImageFileReader() {
     // Ensure file is closed.
     close();
+    decompressed_cache_purge(this);
     // Free up name.
     if (_name) {
         delete[] _name;
@@ -540,6 +607,9 @@ void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_dat
     u8 compressed_size = location.get_attribute(ImageLocation::ATTRIBUTE_COMPRESSED);
     // If the resource is compressed.
     if (compressed_size != 0) {
+        if (decompressed_cache_get(this, offset, uncompressed_size, uncompressed_data)) {
+            return;
+        }
         u1* compressed_data;
         // If not memory mapped read in bytes.
         if (!memory_map_image) {
@@ -561,6 +631,7 @@ void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_dat
         if (!memory_map_image) {
                 delete[] compressed_data;
         }
+        decompressed_cache_put(this, offset, uncompressed_size, uncompressed_data);
     } else {
         // Read bytes from offset beyond the image index.
         bool is_read = read_at(uncompressed_data, uncompressed_size, _index_size + offset);
@@ -333,6 +333,7 @@ find_file(int fd, zentry *entry, const char *file_name)
     int     res;
     int     entry_size;
     int     read_size;
+    size_t  name_len = JLI_StrLen(file_name);
 
     /*
      * The (imaginary) position within the file relative to which
@@ -416,8 +417,8 @@ find_file(int fd, zentry *entry, const char *file_name)
          * manifest.  If so, build the entry record from the data found in
          * the header located and return success.
          */
-        if ((size_t)CENNAM(p) == JLI_StrLen(file_name) &&
-          memcmp((p + CENHDR), file_name, JLI_StrLen(file_name)) == 0) {
+        if ((size_t)CENNAM(p) == name_len &&
+          memcmp((p + CENHDR), file_name, name_len) == 0) {
             if (JLI_Lseek(fd, base_offset + CENOFF(p), SEEK_SET) < (jlong)0) {
                 free(buffer);
                 return (-1);
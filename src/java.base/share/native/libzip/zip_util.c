@@ -1152,12 +1152,8 @@ jboolean equals(char* name1, int len1, char* name2, int len2) {
     if (len1 != len2) {
         return JNI_FALSE;
     }
-    while (len1-- > 0) {
-        if (*name1++ != *name2++) {
-            return JNI_FALSE;
-        }
-    }
-    return JNI_TRUE;
+    /* memcmp is vectorized by the C library, names can be long */
+    return memcmp(name1, name2, len1) == 0 ? JNI_TRUE : JNI_FALSE;
 }
 
 /*
@@ -1206,6 +1202,19 @@ ZIP_GetEntry2(jzfile *zip, char *name, jint ulen, jboolean addSlash)
             jzcell *zc = &zip->entries[idx];
 
             if (zc->hash == hsh) {
+#ifdef USE_MMAP
+                /*
+                 * With the CEN mapped, reject a colliding entry by its name
+                 * in place, before allocating and filling in a jzentry.
+                 */
+                if (zip->usemmap) {
+                    char *cen = (char*) zip->maddr + zc->cenpos - zip->offset;
+                    if (!equals(cen + CENHDR, CENNAM(cen), name, ulen)) {
+                        idx = zc->next;
+                        continue;
+                    }
+                }
+#endif
                 /*
                  * OK, we've found a ZIP entry whose 32 bit hashcode
                  * matches the name we're looking for.  Try to read
@@ -1557,8 +1566,12 @@ ZIP_InflateFully(void *inBuf, jlong inLen, void *outBuf, jlong outLen, char **pm
     strm.next_in = (Bytef *) inBuf;
     strm.avail_in = (uInt)inLen;
 
+    /*
+     * The output buffer holds the whole entry, so ask for Z_FINISH: zlib then
+     * inflates straight into it without maintaining its sliding window copy.
+     */
     do {
-        switch (inflate(&strm, Z_PARTIAL_FLUSH)) {
+        switch (inflate(&strm, Z_FINISH)) {
             case Z_OK:
                 break;
             case Z_STREAM_END:
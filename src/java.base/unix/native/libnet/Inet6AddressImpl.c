@@ -224,8 +224,10 @@ Java_java_net_Inet6AddressImpl_lookupAllHostAddr(JNIEnv *env, jobject this,
 
     // try once, with our static buffer
     memset(&hints, 0, sizeof(hints));
-    hints.ai_flags = AI_CANONNAME;
+    // The canonical name is never used, and one socket type is enough to
+    // get every address once rather than once per SOCK_STREAM/DGRAM/RAW.
     hints.ai_family = lookupCharacteristicsToAddressFamily(characteristics);
+    hints.ai_socktype = SOCK_STREAM;
 
     error = getaddrinfo(hostname, NULL, &hints, &res);
 
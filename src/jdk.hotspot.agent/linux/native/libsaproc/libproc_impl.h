@@ -90,6 +90,8 @@ typedef struct ps_prochandle_ops {
 
 struct core_data {
    int                core_fd;   // file descriptor of core file
+   char*              core_base; // read-only mapping of the core file, or NULL
+   size_t             core_size; // size of the core_base mapping
    int                exec_fd;   // file descriptor of exec file
    int                interp_fd; // file descriptor of interpreter (ld-linux.so.2)
    // part of the class sharing workaround
@@ -192,3 +192,19 @@ TEST_VM(StringConversion, cross_varlen) {
 
     test_utf8_unicode_cross(utf8_str, unicode_str, UTF8_LENGTH, UNICODE_LENGTH);
 }
+
+TEST_VM(StringConversion, byte_hash_code) {
+    // The unrolled byte hash must match String.hashCode() for any length and
+    // for bytes with the high bit set.
+    jbyte bytes[37];
+    for (int i = 0; i < (int)sizeof(bytes); i++) {
+        bytes[i] = (jbyte)(i * 37 + 0x70);
+    }
+    for (int len = 0; len <= (int)sizeof(bytes); len++) {
+        unsigned int expected = 0;
+        for (int i = 0; i < len; i++) {
+            expected = 31 * expected + (((unsigned int)bytes[i]) & 0xFF);
+        }
+        EXPECT_EQ(expected, java_lang_String::hash_code(bytes, len)) << "length " << len;
+    }
+}
@@ -25,6 +25,8 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1Predictions.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "runtime/flags/flagSetting.hpp"
 #include "unittest.hpp"
 
 TEST_VM(G1Analytics, is_initialized) {
@@ -33,3 +35,24 @@ TEST_VM(G1Analytics, is_initialized) {
   ASSERT_EQ(a.long_term_pause_time_ratio(), 0.0);
   ASSERT_EQ(a.short_term_pause_time_ratio(), 0.0);
 }
+
+TEST_VM(G1Analytics, linear_cost_model) {
+  G1Predictions p(0.5);
+  G1Analytics a(&p);
+
+  // Scanning takes 2ms plus 1ms per 1000 cards.
+  for (size_t cards = 1000; cards <= 4000; cards += 1000) {
+    a.report_card_scan_time_ms(cards, 2.0 + cards / 1000.0, true /* for_young_only_phase */);
+  }
+
+  {
+    FlagSetting fs(G1UseLinearCostModel, true);
+    // Exact fit, so there is no confidence band.
+    ASSERT_NEAR(a.predict_card_scan_time_ms(5000, true /* for_young_only_phase */), 7.0, 1e-6);
+  }
+  {
+    FlagSetting fs(G1UseLinearCostModel, false);
+    // The average cost per card overestimates larger card counts.
+    ASSERT_GT(a.predict_card_scan_time_ms(5000, true /* for_young_only_phase */), 7.0);
+  }
+}
@@ -78,6 +78,7 @@ class G1CardSetTest : public ::testing::Test {
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_bulk_add_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -479,6 +480,45 @@ void G1CardSetTest::cardset_mt_test() {
   ASSERT_TRUE(count_cards._num_cards <= cl.added());
 }
 
+void G1CardSetTest::cardset_bulk_add_test() {
+  const uint CardsPerRegion = 1u << G1CardSet::_split_card_shift;
+
+  G1CardSetConfiguration config(28,
+                                0.9,
+                                8,
+                                0.8,
+                                CardsPerRegion,
+                                0);
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set(&config, &mm);
+
+  // Inline pointer, array, howl and full sized additions to separate card
+  // regions, as well as an addition to an already populated card region.
+  const uint num_cards[] = { 3, 20, 500, CardsPerRegion - 1, 40 };
+  const uint card_regions[] = { 10, 11, 12, 13, 10 };
+
+  uintptr_t* cards = NEW_C_HEAP_ARRAY(uintptr_t, CardsPerRegion, mtGC);
+  for (uint i = 0; i < ARRAY_SIZE(num_cards); i++) {
+    const uint stride = (num_cards[i] * 2 <= CardsPerRegion) ? 2 : 1;
+    for (uint j = 0; j < num_cards[i]; j++) {
+      cards[j] = ((uintptr_t)card_regions[i] << G1CardSet::_split_card_shift) | (j * stride);
+    }
+    card_set.add_cards(cards, num_cards[i]);
+    for (uint j = 0; j < num_cards[i]; j++) {
+      ASSERT_TRUE(card_set.contains_card(cards[j]));
+    }
+  }
+  FREE_C_HEAP_ARRAY(uintptr_t, cards);
+
+  // Card region 10 got every second card in [0, 80), the Full region counts
+  // all of its cards.
+  const size_t expected = 40 + 20 + 500 + CardsPerRegion;
+  ASSERT_EQ(expected, card_set.occupied());
+  check_iteration(&card_set, expected);
+}
+
 TEST_VM(G1CardSetTest, basic_cardset_test) {
   G1CardSetTest::cardset_basic_test();
 }
@@ -486,3 +526,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, bulk_add_cardset_test) {
+  G1CardSetTest::cardset_bulk_add_test();
+}
@@ -658,6 +658,109 @@ TEST_VM_F(OopStorageTest, simple_iterate) {
   process_deferred_updates(storage());
 }
 
+class CountYoungScanClosure {
+public:
+  size_t _count;
+
+  CountYoungScanClosure() : _count(0) {}
+
+  void do_oop(oop* ptr) { ++_count; }
+};
+
+class IsDummyYoung {
+  oop _young;
+
+public:
+  IsDummyYoung(oop young) : _young(young) {}
+
+  bool do_object_b(oop obj) const { return obj == _young; }
+};
+
+class VM_YoungScan : public VM_GTestExecuteAtSafepoint {
+public:
+  VM_YoungScan(OopStorage* storage, IsDummyYoung* is_young) :
+    _storage(storage), _is_young(is_young), _count(0)
+  {}
+
+  void doit() {
+    CountYoungScanClosure cl;
+    _storage->young_oops_do(&cl, _is_young);
+    _count = cl._count;
+  }
+
+  size_t count() const { return _count; }
+
+private:
+  OopStorage* _storage;
+  IsDummyYoung* _is_young;
+  size_t _count;
+};
+
+static size_t young_scan(OopStorage& storage, IsDummyYoung* is_young) {
+  VM_YoungScan op(&storage, is_young);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&op);
+  }
+  return op.count();
+}
+
+TEST_VM_F(OopStorageTest, young_oops_do) {
+  // Dummy oop values.
+  intptr_t old_oop_value = 0xbadbeaf;
+  intptr_t young_oop_value = 0xbadbeaf;
+  oop old_oop = reinterpret_cast<oopDesc*>(&old_oop_value);
+  oop young_oop = reinterpret_cast<oopDesc*>(&young_oop_value);
+  IsDummyYoung is_young(young_oop);
+
+  // Fill two blocks, with one young referent in the second.
+  const size_t block_size = OopStorage::bulk_allocate_limit;
+  const size_t max_entries = 2 * block_size;
+  oop* entries[max_entries];
+  for (size_t i = 0; i < max_entries; ++i) {
+    entries[i] = storage().allocate();
+    ASSERT_TRUE(entries[i] != nullptr);
+    *entries[i] = old_oop;
+  }
+  *entries[max_entries - 1] = young_oop;
+  ASSERT_EQ(2u, active_count(storage()));
+
+  // Without tracking, all entries are visited every time.
+  EXPECT_EQ(max_entries, young_scan(storage(), &is_young));
+  EXPECT_EQ(max_entries, young_scan(storage(), &is_young));
+
+  storage().enable_young_block_tracking();
+  EXPECT_EQ(max_entries, young_scan(storage(), &is_young));
+  // Only the block with the young referent is left to visit.
+  EXPECT_EQ(block_size, young_scan(storage(), &is_young));
+  *entries[max_entries - 1] = old_oop;
+  EXPECT_EQ(block_size, young_scan(storage(), &is_young));
+  EXPECT_EQ(0u, young_scan(storage(), &is_young));
+
+  // Allocation makes the block visited again...
+  release_entry(storage(), entries[0]);
+  entries[0] = storage().allocate();
+  ASSERT_TRUE(entries[0] != nullptr);
+  *entries[0] = old_oop;
+  EXPECT_EQ(block_size, young_scan(storage(), &is_young));
+  EXPECT_EQ(0u, young_scan(storage(), &is_young));
+
+  // ...and any other non-const iteration all blocks.
+  CountingIterateClosure cl;
+  VM_CountAtSafepoint<false> op(&storage(), &cl);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&op);
+  }
+  EXPECT_EQ(max_entries, young_scan(storage(), &is_young));
+  EXPECT_EQ(0u, young_scan(storage(), &is_young));
+
+  for (size_t i = 0; i < max_entries; ++i) {
+    release_entry(storage(), entries[i], false);
+  }
+  process_deferred_updates(storage());
+}
+
 class OopStorageTestIteration : public OopStorageTestWithAllocation {
 public:
   static const size_t _max_workers = 2;
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/partialArraySplitter.hpp"
+#include "unittest.hpp"
+
+static const size_t min_chunk = 500;
+static const size_t max_chunk = 8 * min_chunk;
+
+TEST(PartialArrayChunkSizerTest, fixed) {
+  PartialArrayChunkSizer sizer(min_chunk, min_chunk);
+  ASSERT_EQ(min_chunk, sizer.chunk_size());
+  for (int i = 0; i < 100; ++i) {
+    sizer.record_chunk(min_chunk, 0, 0);
+  }
+  ASSERT_EQ(min_chunk, sizer.chunk_size());
+}
+
+TEST(PartialArrayChunkSizerTest, max_below_min) {
+  PartialArrayChunkSizer sizer(min_chunk, min_chunk / 2);
+  for (int i = 0; i < 100; ++i) {
+    sizer.record_chunk(min_chunk, 0, 0);
+  }
+  ASSERT_EQ(min_chunk, sizer.chunk_size());
+}
+
+TEST(PartialArrayChunkSizerTest, adapts) {
+  PartialArrayChunkSizer sizer(min_chunk, max_chunk);
+  // Starts out with the smallest chunks.
+  ASSERT_EQ(min_chunk, sizer.chunk_size());
+
+  // Chunks that push nothing grow the chunk size up to the maximum.
+  size_t last = sizer.chunk_size();
+  for (int i = 0; i < 100; ++i) {
+    sizer.record_chunk(min_chunk, 10, 10);
+    size_t current = sizer.chunk_size();
+    ASSERT_GE(current, last);
+    ASSERT_LE(current, max_chunk);
+    last = current;
+  }
+  ASSERT_GE(last, max_chunk * 99 / 100);
+
+  // Chunks whose elements all push a task shrink it back to the minimum.
+  for (int i = 0; i < 100; ++i) {
+    sizer.record_chunk(min_chunk, 10, 10 + min_chunk);
+    size_t current = sizer.chunk_size();
+    ASSERT_LE(current, last);
+    ASSERT_GE(current, min_chunk);
+    last = current;
+  }
+  ASSERT_LE(last, min_chunk * 101 / 100);
+
+  // Empty chunks are ignored.
+  sizer.record_chunk(0, 0, 0);
+  ASSERT_EQ(last, sizer.chunk_size());
+}
+
+TEST(PartialArrayChunkSizerTest, queue_drained_by_steals) {
+  PartialArrayChunkSizer sizer(min_chunk, max_chunk);
+  // Other workers stole more tasks than the chunk pushed: counts as no
+  // pushes, and must not wrap around to a huge push count.
+  for (int i = 0; i < 100; ++i) {
+    sizer.record_chunk(min_chunk, 100, 20);
+  }
+  ASSERT_GE(sizer.chunk_size(), max_chunk * 99 / 100);
+  ASSERT_LE(sizer.chunk_size(), max_chunk);
+}
@@ -34,8 +34,9 @@ class PartialArrayTaskStepper::TestSupport : AllStatic {
 public:
   static Step next(const Stepper* stepper,
                    size_t length,
+                   size_t chunk_size,
                    size_t* to_length_addr) {
-    return stepper->next_impl(length, to_length_addr);
+    return stepper->next_impl(length, chunk_size, to_length_addr);
   }
 };
 
@@ -43,23 +44,24 @@ using StepperSupport = PartialArrayTaskStepper::TestSupport;
 
 static uint simulate(const Stepper* stepper,
                      size_t length,
+                     size_t chunk_size,
                      size_t* to_length_addr) {
-  Step init = stepper->start(length);
+  Step init = stepper->start(length, chunk_size);
   *to_length_addr = init._index;
   uint queue_count = init._ncreate;
   uint task = 0;
   for ( ; queue_count > 0; ++task) {
     --queue_count;
-    Step step = StepperSupport::next(stepper, length, to_length_addr);
+    Step step = StepperSupport::next(stepper, length, chunk_size, to_length_addr);
     queue_count += step._ncreate;
   }
   return task;
 }
 
 static void run_test(size_t length, size_t chunk_size, uint n_workers) {
-  const PartialArrayTaskStepper stepper(n_workers, chunk_size);
+  const PartialArrayTaskStepper stepper(n_workers);
   size_t to_length;
-  uint tasks = simulate(&stepper, length, &to_length);
+  uint tasks = simulate(&stepper, length, chunk_size, &to_length);
   ASSERT_EQ(length, to_length);
   ASSERT_EQ(tasks, length / chunk_size);
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "unittest.hpp"
+
+typedef GenericTaskQueue<uint, mtGC, 64> TestQueue;
+typedef GenericTaskQueueSet<TestQueue, mtGC> TestQueueSet;
+
+static void fill(TestQueue* q, uint n) {
+  for (uint i = 0; i < n; i++) {
+    ASSERT_TRUE(q->push(i));
+  }
+}
+
+TEST_VM(GenericTaskQueue, pop_global_batch) {
+  TestQueue victim;
+  TestQueue thief;
+  fill(&victim, 10);
+
+  ASSERT_EQ(4u, victim.pop_global_batch(&thief, 4));
+  ASSERT_EQ(6u, victim.size());
+  ASSERT_EQ(4u, thief.size());
+
+  // The oldest tasks are moved, and keep their order in the new queue.
+  uint t;
+  for (uint i = 4; i > 0; i--) {
+    ASSERT_TRUE(thief.pop_local(t));
+    ASSERT_EQ(i - 1, t);
+  }
+
+  // Stops when the victim runs empty.
+  ASSERT_EQ(6u, victim.pop_global_batch(&thief, 10));
+  ASSERT_TRUE(victim.is_empty());
+  ASSERT_EQ(0u, victim.pop_global_batch(&thief, 10));
+  ASSERT_EQ(6u, thief.size());
+}
+
+static uint steal_and_count(uint batch, uint initial) {
+  UIntFlagSetting fs(TaskQueueStealBatch, batch);
+
+  TestQueue q0;
+  TestQueue q1;
+  TestQueueSet set(2);
+  set.register_queue(0, &q0);
+  set.register_queue(1, &q1);
+  fill(&q0, initial);
+
+  uint t;
+  EXPECT_TRUE(set.steal(1, t));
+  EXPECT_EQ(0u, t);
+  EXPECT_EQ(initial - 1, q0.size() + q1.size());
+  return q1.size();
+}
+
+TEST_VM(GenericTaskQueueSet, steal_batch) {
+  // Single steals leave the thief's queue empty.
+  ASSERT_EQ(0u, steal_and_count(0, 20));
+  // At most half of what the victim has left is taken...
+  ASSERT_EQ(9u, steal_and_count(32, 20));
+  // ...and no more than TaskQueueStealBatch.
+  ASSERT_EQ(4u, steal_and_count(4, 20));
+  // The last task stays with the victim.
+  ASSERT_EQ(0u, steal_and_count(32, 2));
+}
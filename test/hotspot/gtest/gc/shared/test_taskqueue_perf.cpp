@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/quickSort.hpp"
+#include "utilities/ticks.hpp"
+
+#include "unittest.hpp"
+
+// This "test" doesn't really verify much.  Rather, it's mostly a
+// microbenchmark for the GC task queue hot paths: owner push/pop_local
+// and stealing through a GenericTaskQueueSet.  Each case is run a few
+// times for warmup, then measured over a number of repetitions, and the
+// median and 90th percentile per operation are logged.
+
+typedef GenericTaskQueue<uint, mtGC, TASKQUEUE_SIZE> PerfQueue;
+typedef GenericTaskQueueSet<PerfQueue, mtGC> PerfQueueSet;
+
+const uint _warmup_reps = 3;
+const uint _measured_reps = 11;
+const uint _tasks_per_rep = TASKQUEUE_SIZE / 2;
+
+class TaskQueuePerf : public ::testing::Test {
+protected:
+  PerfQueue* _q0;
+  PerfQueue* _q1;
+  PerfQueueSet _set;
+
+public:
+  TaskQueuePerf() : _q0(new PerfQueue()), _q1(new PerfQueue()), _set(2) {
+    _set.register_queue(0, _q0);
+    _set.register_queue(1, _q1);
+  }
+
+  ~TaskQueuePerf() {
+    delete _q0;
+    delete _q1;
+  }
+
+  void fill(uint n) {
+    for (uint i = 0; i < n; i++) {
+      _q0->push(i);
+    }
+  }
+
+  // Pushes and pops _tasks_per_rep tasks on the owner side.
+  Tickspan push_pop_local() {
+    Ticks start = Ticks::now();
+    fill(_tasks_per_rep);
+    uint t;
+    while (_q0->pop_local(t)) {}
+    return Ticks::now() - start;
+  }
+
+  // Fills queue 0 and drains it by stealing from queue 1's side.
+  Tickspan steal() {
+    fill(_tasks_per_rep);
+    Ticks start = Ticks::now();
+    uint t;
+    while (_set.steal(1, t)) {
+      while (_q1->pop_local(t)) {}
+    }
+    return Ticks::now() - start;
+  }
+
+  static int compare(Tickspan a, Tickspan b) {
+    return a.value() < b.value() ? -1 : (a.value() > b.value() ? 1 : 0);
+  }
+
+  template<typename Function>
+  void measure(const char* name, Function f) {
+    for (uint i = 0; i < _warmup_reps; i++) {
+      f();
+    }
+    Tickspan times[_measured_reps];
+    for (uint i = 0; i < _measured_reps; i++) {
+      times[i] = f();
+      ASSERT_TRUE(_q0->is_empty());
+      ASSERT_TRUE(_q1->is_empty());
+    }
+    QuickSort::sort(times, _measured_reps, compare);
+    Tickspan median = times[_measured_reps / 2];
+    Tickspan p90 = times[(_measured_reps * 9) / 10];
+    tty->print_cr("%s: %u tasks, median %.2fns/task, p90 %.2fns/task", name, _tasks_per_rep,
+                  median.seconds() * NANOUNITS / _tasks_per_rep,
+                  p90.seconds() * NANOUNITS / _tasks_per_rep);
+  }
+};
+
+TEST_VM_F(TaskQueuePerf, push_pop_local) {
+  measure("push/pop_local", [&]() { return push_pop_local(); });
+}
+
+TEST_VM_F(TaskQueuePerf, steal) {
+  measure("steal", [&]() { return steal(); });
+}
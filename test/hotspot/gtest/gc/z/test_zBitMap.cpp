@@ -95,6 +95,26 @@ class ZBitMapTest : public ::testing::Test {
     test_set_pair_unset(128, finalizable);
   }
 
+  static void test_par_set_bits(const BitMap::idx_t* indices, size_t count) {
+    ZMovableBitMap bitmap;
+    bitmap.initialize(256);
+
+    bitmap.par_set_bits(count, [&](size_t i) { return indices[i]; });
+
+    for (BitMap::idx_t bit = 0; bit < bitmap.size(); bit++) {
+      bool expected = false;
+      for (size_t i = 0; i < count; i++) {
+        expected |= indices[i] == bit;
+      }
+      EXPECT_EQ(bitmap.at(bit), expected) << "Wrong value for bit " << bit;
+    }
+
+    // Setting the same bits again is a no-op
+    const BitMap::idx_t one_bits = bitmap.count_one_bits();
+    bitmap.par_set_bits(count, [&](size_t i) { return indices[i]; });
+    EXPECT_EQ(bitmap.count_one_bits(), one_bits) << "Bits should not change";
+  }
+
 };
 
 TEST_F(ZBitMapTest, test_set_pair_set) {
@@ -106,3 +126,18 @@ TEST_F(ZBitMapTest, test_set_pair_unset) {
   test_set_pair_unset(false);
   test_set_pair_unset(true);
 }
+
+TEST_F(ZBitMapTest, test_par_set_bits) {
+  // Single bits at word boundaries
+  const BitMap::idx_t single[] = { 0 };
+  test_par_set_bits(single, 0);
+  test_par_set_bits(single, 1);
+
+  // Several bits in the same word, including duplicates
+  const BitMap::idx_t same_word[] = { 1, 1, 5, 17, 17, 17, 63 };
+  test_par_set_bits(same_word, ARRAY_SIZE(same_word));
+
+  // Bits spread over several words, including duplicates across word boundaries
+  const BitMap::idx_t spread[] = { 0, 63, 63, 64, 65, 127, 128, 128, 200, 255 };
+  test_par_set_bits(spread, ARRAY_SIZE(spread));
+}
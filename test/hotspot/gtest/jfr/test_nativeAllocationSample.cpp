@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/support/jfrNativeAllocationSample.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "runtime/semaphore.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+static JfrNativeAllocationSampleData sample_of_size(size_t size) {
+  const JfrNativeAllocationSampleData sample = { JfrTicks::now(), size, size, mtTest };
+  return sample;
+}
+
+TEST_VM(JfrNativeAllocationSampleBuffer, add_and_drain) {
+  JfrNativeAllocationSampleBuffer buffer;
+  JfrNativeAllocationSampleData samples[JfrNativeAllocationSampleBuffer::capacity];
+  EXPECT_EQ(buffer.drain(samples), 0u);
+
+  for (uint i = 0; i < JfrNativeAllocationSampleBuffer::capacity; i++) {
+    EXPECT_TRUE(buffer.add(sample_of_size(i + 1)));
+  }
+  EXPECT_FALSE(buffer.add(sample_of_size(0)));
+
+  ASSERT_EQ(buffer.drain(samples), JfrNativeAllocationSampleBuffer::capacity);
+  for (uint i = 0; i < JfrNativeAllocationSampleBuffer::capacity; i++) {
+    EXPECT_EQ(samples[i]._size, (size_t)i + 1);
+    EXPECT_EQ(samples[i]._mem_tag, mtTest);
+  }
+  EXPECT_EQ(buffer.drain(samples), 0u);
+  EXPECT_TRUE(buffer.add(sample_of_size(1)));
+  EXPECT_EQ(buffer.drain(samples), 1u);
+}
+
+// The owner keeps adding while another thread drains, every added sample
+// must be drained exactly once and in order.
+class NativeAllocationSampleAdderThread : public JavaTestThread {
+  JfrNativeAllocationSampleBuffer* _buffer;
+  size_t _count;
+  volatile bool* _done;
+ public:
+  NativeAllocationSampleAdderThread(Semaphore* post, JfrNativeAllocationSampleBuffer* buffer,
+                                    size_t count, volatile bool* done) :
+    JavaTestThread(post), _buffer(buffer), _count(count), _done(done) {}
+  virtual ~NativeAllocationSampleAdderThread() {}
+
+  void main_run() {
+    for (size_t i = 1; i <= _count; i++) {
+      while (!_buffer->add(sample_of_size(i))) {
+        SpinPause();
+      }
+    }
+    Atomic::release_store(_done, true);
+  }
+};
+
+TEST_VM(JfrNativeAllocationSampleBuffer, concurrent_drain) {
+  const size_t count = 100000;
+  JfrNativeAllocationSampleBuffer buffer;
+  JfrNativeAllocationSampleData samples[JfrNativeAllocationSampleBuffer::capacity];
+  volatile bool done = false;
+  Semaphore post(0);
+
+  (new NativeAllocationSampleAdderThread(&post, &buffer, count, &done))->doit();
+  size_t expected = 1;
+  bool last_drain = false;
+  while (!last_drain) {
+    last_drain = Atomic::load_acquire(&done);
+    const uint drained = buffer.drain(samples);
+    for (uint i = 0; i < drained; i++) {
+      ASSERT_EQ(samples[i]._size, expected);
+      expected++;
+    }
+  }
+  EXPECT_EQ(expected, count + 1);
+  post.wait();
+}
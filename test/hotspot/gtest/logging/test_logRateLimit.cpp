@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "logTestFixture.hpp"
+#include "logTestUtils.inline.hpp"
+#include "logging/log.hpp"
+#include "logging/logTagSet.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/autoRestore.hpp"
+#include "unittest.hpp"
+
+// Windows are driven explicitly; negative values never match the clock.
+class LogTagSet::TestSupport : AllStatic {
+ public:
+  static bool is_rate_limited(LogTagSet& ts, LogLevelType level, int64_t window) {
+    return ts.is_rate_limited(level, window);
+  }
+  static void advance_rate_window(LogTagSet& ts, int64_t window) {
+    ts.advance_rate_window(window);
+  }
+};
+
+using TestSupport = LogTagSet::TestSupport;
+
+class LogRateLimitTest : public LogTestFixture {
+ protected:
+  LogTagSet& _ts;
+
+  LogRateLimitTest() : _ts(LogTagSetMapping<LOG_TAGS(logging, gc, class)>::tagset()) {}
+
+  // Drops the messages over the limit in the given window and
+  // returns the number passed.
+  size_t fill_window(int64_t window, size_t messages) {
+    size_t passed = 0;
+    for (size_t i = 0; i < messages; i++) {
+      if (!TestSupport::is_rate_limited(_ts, LogLevel::Info, window)) {
+        passed++;
+      }
+    }
+    return passed;
+  }
+};
+
+TEST_VM_F(LogRateLimitTest, summary_on_next_window) {
+  AutoModifyRestore<uint> amr(LogRateLimit, 3);
+  set_log_config(TestLogFileName, "logging+gc+class=info");
+
+  EXPECT_EQ(3u, fill_window(-10, 10));
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, "Suppressed"));
+
+  // The first message of the next window reports the drops and passes.
+  EXPECT_FALSE(TestSupport::is_rate_limited(_ts, LogLevel::Info, -9));
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "Suppressed 7 messages (LogRateLimit)"));
+  EXPECT_EQ(2u, fill_window(-9, 2));
+  TestSupport::advance_rate_window(_ts, -8);
+}
+
+TEST_VM_F(LogRateLimitTest, summary_without_next_message) {
+  AutoModifyRestore<uint> amr(LogRateLimit, 2);
+  set_log_config(TestLogFileName, "logging+gc+class=info");
+
+  EXPECT_EQ(2u, fill_window(-20, 7));
+  EXPECT_FALSE(file_contains_substring(TestLogFileName, "Suppressed"));
+
+  // Closing the window reports the drops even if no message follows.
+  LogTagSet::report_rate_limited();
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "Suppressed 5 messages (LogRateLimit)"));
+}
+
+TEST_VM_F(LogRateLimitTest, summary_at_dropped_level) {
+  AutoModifyRestore<uint> amr(LogRateLimit, 1);
+  set_log_config(TestLogFileName, "logging+gc+class=warning");
+
+  EXPECT_FALSE(TestSupport::is_rate_limited(_ts, LogLevel::Warning, -30));
+  EXPECT_TRUE(TestSupport::is_rate_limited(_ts, LogLevel::Warning, -30));
+  TestSupport::advance_rate_window(_ts, -29);
+  EXPECT_TRUE(file_contains_substring(TestLogFileName, "Suppressed 1 messages (LogRateLimit)"));
+}
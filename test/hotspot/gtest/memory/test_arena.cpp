@@ -382,3 +382,58 @@ TEST_VM(Arena, different_chunk_sizes) {
     Arena ar7(mtTest, Arena::Tag::tag_other, random_arena_chunk_size());
   }
 }
+
+static Chunk* new_test_chunk(size_t length) {
+  void* p = os::malloc(Chunk::aligned_overhead_size() + length, mtTest);
+  return ::new (p) Chunk(length);
+}
+
+TEST_VM(ChunkCache, cached_length) {
+  // Standard sizes are kept, larger sizes are rounded up by at most 25%.
+  ASSERT_EQ((size_t)Chunk::size, ChunkCache::cached_length(Chunk::size));
+  ASSERT_EQ((size_t)Chunk::tiny_size, ChunkCache::cached_length(Chunk::tiny_size));
+  const size_t overhead = Chunk::aligned_overhead_size();
+  ASSERT_EQ(80 * K - overhead, ChunkCache::cached_length(65 * K));
+  ASSERT_EQ(ChunkCache::cached_length(65 * K), ChunkCache::cached_length(79 * K));
+  for (size_t len = Chunk::size + BytesPerLong; len < 4 * M; len = len * 3 / 2 + BytesPerLong) {
+    size_t aligned = ARENA_ALIGN(len);
+    size_t cached = ChunkCache::cached_length(aligned);
+    ASSERT_GE(cached, aligned);
+    ASSERT_LE(cached + overhead, (aligned + overhead) * 5 / 4 + BytesPerLong);
+    ASSERT_TRUE(is_aligned(cached, ARENA_AMALLOC_ALIGNMENT));
+  }
+}
+
+TEST_VM(ChunkCache, take_put_trim) {
+  ChunkCache cache;
+  const size_t large = ChunkCache::cached_length(256 * K);
+  Chunk* small = new_test_chunk(Chunk::size);
+  Chunk* large1 = new_test_chunk(large);
+  Chunk* large2 = new_test_chunk(large);
+
+  ASSERT_NULL(cache.take(Chunk::size));
+  cache.put(small);
+  cache.put(large1);
+  cache.put(large2);
+  ASSERT_EQ(Chunk::size + 2 * large, cache.cached_bytes());
+
+  // Only exact lengths are handed out.
+  ASSERT_NULL(cache.take(Chunk::medium_size));
+  ASSERT_EQ(small, cache.take(Chunk::size));
+  ASSERT_NULL(cache.take(Chunk::size));
+  cache.put(small);
+
+  // Trimming keeps standard chunks first, then the most recently cached large ones.
+  cache.trim(Chunk::size + large);
+  ASSERT_EQ(Chunk::size + large, cache.cached_bytes());
+  ASSERT_EQ(large2, cache.take(large));
+  ASSERT_NULL(cache.take(large));
+
+  // Lazily disclaimed chunks are still usable.
+  memset(large2->bottom(), 0x5a, large2->length());
+  cache.put(large2);
+
+  cache.trim(0);
+  ASSERT_EQ(0u, cache.cached_bytes());
+  ASSERT_NULL(cache.take(Chunk::size));
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "nmt/mallocSiteTable.hpp"
+#include "utilities/nativeCallStack.hpp"
+#include "threadHelper.inline.hpp"
+#include "unittest.hpp"
+
+static NativeCallStack test_stack() {
+  address pc[2] = { (address)1234, (address)5678 };
+  return NativeCallStack(pc, 2);
+}
+
+TEST_VM(NMT, malloc_site_entry_counters) {
+  MallocSiteHashtableEntry entry(test_stack(), mtTest);
+
+  entry.allocate(100);
+  entry.allocate(50);
+  EXPECT_EQ(entry.size(), (size_t)150);
+  EXPECT_EQ(entry.count(), (size_t)2);
+
+  entry.deallocate(100);
+  EXPECT_EQ(entry.size(), (size_t)50);
+  EXPECT_EQ(entry.count(), (size_t)1);
+
+  const MallocSite* site = entry.snapshot();
+  EXPECT_EQ(site->size(), (size_t)50);
+  EXPECT_EQ(site->count(), (size_t)1);
+  EXPECT_EQ(site->peak_size(), (size_t)150);
+  EXPECT_EQ(site->mem_tag(), mtTest);
+}
+
+// Allocations and frees done by different threads might be accounted to
+// different stripes, but the sums must still be right.
+TEST_VM(NMT, malloc_site_entry_counters_cross_thread) {
+  MallocSiteHashtableEntry entry(test_stack(), mtTest);
+  const int threads = 4;
+  const int n = 1000;
+
+  auto alloc = [&](Thread* t, int id) {
+    for (int i = 0; i < n; i++) {
+      entry.allocate(8);
+    }
+  };
+  TestThreadGroup<decltype(alloc)> allocators(alloc, threads);
+  allocators.doit();
+  allocators.join();
+
+  EXPECT_EQ(entry.size(), (size_t)(threads * n * 8));
+  EXPECT_EQ(entry.count(), (size_t)(threads * n));
+
+  // Free everything from this thread.
+  for (int i = 0; i < threads * n; i++) {
+    entry.deallocate(8);
+  }
+
+  EXPECT_EQ(entry.size(), (size_t)0);
+  EXPECT_EQ(entry.count(), (size_t)0);
+  EXPECT_GE(entry.snapshot()->peak_size(), (size_t)(n * 8));
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "nmt/mallocTagMap.hpp"
+#include "nmt/mallocTracker.hpp"
+#include "nmt/memTracker.hpp"
+#include "runtime/os.hpp"
+#include "unittest.hpp"
+
+// Use addresses of a reserved range, so they never collide with the blocks
+// NMT itself may be entering into the map.
+TEST_VM(NMT, malloc_tag_map_add_remove) {
+  if (!MallocTagMap::initialize()) {
+    tty->print_cr("skipped, no header-less malloc tracking on this platform");
+    return;
+  }
+  const int n = 20000; // enough to grow every stripe
+  const size_t range_size = n * 16;
+  char* const base = os::reserve_memory(range_size, false, mtTest);
+  ASSERT_NE(base, (char*)nullptr);
+  const MemTag tags[] = { mtTest, mtInternal, mtNMT, mtGC };
+  const int num_tags = sizeof(tags) / sizeof(tags[0]);
+
+  for (int i = 0; i < n; i++) {
+    MallocTagMap::add(base + i * 16, tags[i % num_tags]);
+  }
+  MemTag t;
+  for (int i = 0; i < n; i++) {
+    ASSERT_TRUE(MallocTagMap::lookup(base + i * 16, &t));
+    ASSERT_EQ(t, tags[i % num_tags]);
+  }
+  EXPECT_FALSE(MallocTagMap::lookup(base + 8, &t));
+
+  // Removing every other entry exercises the backward shift.
+  for (int i = 0; i < n; i += 2) {
+    ASSERT_EQ(MallocTagMap::remove(base + i * 16), tags[i % num_tags]);
+  }
+  for (int i = 0; i < n; i++) {
+    ASSERT_EQ(MallocTagMap::lookup(base + i * 16, &t), (i % 2) == 1);
+  }
+  for (int i = 1; i < n; i += 2) {
+    ASSERT_EQ(MallocTagMap::remove(base + i * 16), tags[i % num_tags]);
+  }
+  EXPECT_FALSE(MallocTagMap::lookup(base + 16, &t));
+
+  os::release_memory(base, range_size);
+}
+
+TEST_VM(NMT, malloc_without_headers) {
+  if (!MemTracker::enabled() || MallocTracker::use_headers()) {
+    tty->print_cr("skipped, needs -XX:NativeMemoryTracking=summary -XX:-NMTMallocHeaders");
+    return;
+  }
+  EXPECT_EQ(MemTracker::overhead_per_malloc(), (size_t)0);
+
+  char* p = (char*)os::malloc(10, mtTest);
+  ASSERT_NE(p, (char*)nullptr);
+  MemTag t;
+  EXPECT_TRUE(MallocTagMap::lookup(p, &t));
+  EXPECT_EQ(t, mtTest);
+
+  p = (char*)os::realloc(p, 100000, mtTest);
+  ASSERT_NE(p, (char*)nullptr);
+  EXPECT_TRUE(MallocTagMap::lookup(p, &t));
+  EXPECT_EQ(t, mtTest);
+
+  os::free(p);
+}
@@ -197,6 +197,45 @@ TEST_VM_F(LockStackTest, try_recursive_enter) {
   EXPECT_TRUE(ls.is_empty());
 }
 
+TEST_VM_F(LockStackTest, top) {
+  if (LockingMode != LM_LIGHTWEIGHT) {
+    return;
+  }
+
+  JavaThread* THREAD = JavaThread::current();
+  // the thread should be in vm to use locks
+  ThreadInVMfromNative ThreadInVMfromNative(THREAD);
+
+  LockStack& ls = THREAD->lock_stack();
+
+  EXPECT_TRUE(ls.is_empty());
+
+  oop obj0 = Universe::int_mirror();
+  oop obj1 = Universe::float_mirror();
+
+  push_raw(ls, obj0);
+
+  // 0
+  EXPECT_EQ(obj0, ls.top());
+  EXPECT_EQ(obj0, ls.bottom());
+
+  push_raw(ls, obj1);
+
+  // 0, 1
+  EXPECT_EQ(obj1, ls.top());
+  EXPECT_EQ(obj0, ls.bottom());
+
+  pop_raw(ls);
+
+  // 0
+  EXPECT_EQ(obj0, ls.top());
+
+  // Clear stack
+  pop_raw(ls);
+
+  EXPECT_TRUE(ls.is_empty());
+}
+
 TEST_VM_F(LockStackTest, contains) {
   if (LockingMode != LM_LIGHTWEIGHT) {
     return;
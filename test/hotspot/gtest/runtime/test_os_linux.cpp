@@ -394,6 +394,25 @@ TEST(os_linux, addr_to_function_valid) {
   ASSERT_TRUE(offset >= 0);
 }
 
+// Check that repeated lookups (served from the symbol cache) give the same result,
+// and that a smaller buffer still gets a properly truncated name.
+TEST(os_linux, addr_to_function_cached) {
+  char buf[128] = "";
+  char buf2[128] = "";
+  char small_buf[8] = "";
+  int offset = -1;
+  int offset2 = -1;
+  address valid_function_pointer = (address)JNI_CreateJavaVM + 4;
+  ASSERT_TRUE(os::dll_address_to_function_name(valid_function_pointer, buf, sizeof(buf), &offset, true));
+  ASSERT_TRUE(os::dll_address_to_function_name(valid_function_pointer, buf2, sizeof(buf2), &offset2, true));
+  EXPECT_STREQ(buf, buf2);
+  EXPECT_EQ(offset, offset2);
+  ASSERT_TRUE(os::dll_address_to_function_name(valid_function_pointer, small_buf, sizeof(small_buf), &offset2, true));
+  EXPECT_EQ(strncmp(buf, small_buf, sizeof(small_buf) - 1), 0);
+  EXPECT_EQ(strlen(small_buf), sizeof(small_buf) - 1);
+  EXPECT_EQ(offset, offset2);
+}
+
 #if !defined(__clang_major__) || (__clang_major__ >= 5) // DWARF does not support Clang versions older than 5.0.
 // Test valid address of method ReportJNIFatalError in jniCheck.hpp. We should get "jniCheck.hpp" in the buffer and a valid line number.
 TEST_VM(os_linux, decoder_get_source_info_valid) {
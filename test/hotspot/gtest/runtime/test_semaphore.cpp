@@ -22,7 +22,10 @@
  */
 
 #include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "runtime/semaphore.hpp"
+#include "threadHelper.inline.hpp"
 #include "unittest.hpp"
 
 static void test_semaphore_single_separate(uint count) {
@@ -103,3 +106,70 @@ TEST(Semaphore, trywait) {
     }
   }
 }
+
+class SemaphoreWaiterThread : public JavaTestThread {
+  Semaphore* _sem;
+ public:
+  SemaphoreWaiterThread(Semaphore* post, Semaphore* sem) : JavaTestThread(post), _sem(sem) {}
+  virtual ~SemaphoreWaiterThread() {}
+
+  void main_run() {
+    _sem->wait();
+  }
+};
+
+TEST_VM(Semaphore, many_waiters) {
+  const uint num_waiters = 32;
+  Semaphore done(0);
+  Semaphore sem(0);
+
+  for (uint i = 0; i < num_waiters; i++) {
+    (new SemaphoreWaiterThread(&done, &sem))->doit();
+  }
+  // Let most waiters block, then release them in two batches.
+  os::naked_short_sleep(50);
+  sem.signal(num_waiters / 2);
+  sem.signal(num_waiters - num_waiters / 2);
+
+  for (uint i = 0; i < num_waiters; i++) {
+    done.wait();
+  }
+  EXPECT_FALSE(sem.trywait());
+}
+
+// The waiter frees the semaphore as soon as wait() returns, while the
+// signaling thread may still be inside signal(). Semaphores on the stack of
+// a waiting thread are used like this throughout the VM.
+class SemaphoreDestroyAfterWaitThread : public JavaTestThread {
+  Semaphore* volatile* _shared;
+  uint _iterations;
+ public:
+  SemaphoreDestroyAfterWaitThread(Semaphore* post, Semaphore* volatile* shared, uint iterations) :
+    JavaTestThread(post), _shared(shared), _iterations(iterations) {}
+  virtual ~SemaphoreDestroyAfterWaitThread() {}
+
+  void main_run() {
+    for (uint i = 0; i < _iterations; i++) {
+      Semaphore* sem = new Semaphore(0);
+      Atomic::release_store(_shared, sem);
+      sem->wait();
+      delete sem;
+    }
+  }
+};
+
+TEST_VM(Semaphore, destroy_after_wait) {
+  const uint iterations = 10000;
+  Semaphore done(0);
+  Semaphore* volatile shared = nullptr;
+
+  (new SemaphoreDestroyAfterWaitThread(&done, &shared, iterations))->doit();
+  for (uint i = 0; i < iterations; i++) {
+    Semaphore* sem;
+    while ((sem = Atomic::xchg(&shared, (Semaphore*)nullptr)) == nullptr) {
+      SpinPause();
+    }
+    sem->signal();
+  }
+  done.wait();
+}
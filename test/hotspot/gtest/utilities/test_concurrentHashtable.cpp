@@ -962,6 +962,106 @@ TEST_VM(ConcurrentHashTable, concurrent_scan_grow_shrink) {
   mt_test_doer<RunnerGSInserterThread>();
 }
 
+//#############################################################################################
+// Lock-free readers look up a fixed set of values while the table is
+// repeatedly grown and shrunk. Every lookup must succeed; the read
+// throughput is reported.
+
+#define RDG_START_SIZE 8
+#define RDG_END_SIZE 14
+#define RDG_START (uintptr_t)0x1
+#define RDG_RANGE (uintptr_t)0x3FFF
+
+#define RDG_READER_COUNT 4
+
+class RDGReaderThread : public CHTTestThread {
+public:
+  static volatile bool _exit;
+  static volatile size_t _total_reads;
+  size_t _reads;
+
+  RDGReaderThread(uintptr_t start, uintptr_t stop, TestTable* cht, Semaphore* post)
+    : CHTTestThread(start, stop, cht, post), _reads(0) {};
+  virtual ~RDGReaderThread(){}
+
+  bool keep_looping() {
+    return !_exit;
+  }
+
+  bool test_loop() {
+    for (uintptr_t v = _start; v <= _stop; v++) {
+      TestLookup tl(v);
+      EXPECT_TRUE(cht_get_copy(_cht, this, tl) == v) << "Getting a present value during resize failed.";
+    }
+    _reads += _stop - _start + 1;
+    return true;
+  }
+
+  void postmain() {
+    Atomic::add(&_total_reads, _reads);
+  }
+};
+
+volatile bool RDGReaderThread::_exit = false;
+volatile size_t RDGReaderThread::_total_reads = 0;
+
+class RunnerRDGThread : public CHTTestThread {
+public:
+  Semaphore _done;
+  size_t _resizes;
+  jlong _start_ms;
+
+  RunnerRDGThread(Semaphore* post) : CHTTestThread(0, 0, nullptr, post), _resizes(0), _start_ms(0) {
+    _cht = new TestTable(RDG_START_SIZE, RDG_END_SIZE, 2);
+  };
+  virtual ~RunnerRDGThread(){}
+
+  void premain() {
+    for (uintptr_t v = RDG_START; v <= RDG_START + RDG_RANGE; v++) {
+      TestLookup tl(v);
+      EXPECT_TRUE(_cht->insert(this, tl, v)) << "Inserting an unique value should work.";
+    }
+    for (int i = 0; i < RDG_READER_COUNT; i++) {
+      CHTTestThread* reader = new RDGReaderThread(RDG_START, RDG_START + RDG_RANGE, _cht, &_done);
+      reader->doit();
+    }
+    _start_ms = os::javaTimeMillis();
+  }
+
+  bool test_loop() {
+    while (_cht->get_size_log2(this) < RDG_END_SIZE && _cht->grow(this)) {
+      _resizes++;
+    }
+    while (_cht->get_size_log2(this) > RDG_START_SIZE && _cht->shrink(this)) {
+      _resizes++;
+    }
+    return true;
+  }
+
+  void postmain() {
+    RDGReaderThread::_exit = true;
+    for (int i = 0; i < RDG_READER_COUNT; i++) {
+      _done.wait();
+    }
+    jlong elapsed_ms = MAX2(os::javaTimeMillis() - _start_ms, (jlong)1);
+    tty->print_cr("%zu lock-free reads during %zu resizes in " JLONG_FORMAT " ms (%zu reads/ms)",
+                  RDGReaderThread::_total_reads, _resizes, elapsed_ms,
+                  RDGReaderThread::_total_reads / (size_t)elapsed_ms);
+    EXPECT_GT(_resizes, (size_t)0) << "Table should have been resized.";
+    for (uintptr_t v = RDG_START; v <= RDG_START + RDG_RANGE; v++) {
+      TestLookup tl(v);
+      EXPECT_TRUE(_cht->remove(this, tl)) << "Removing an existing value failed.";
+    }
+    delete _cht;
+  }
+};
+
+TEST_VM(ConcurrentHashTable, concurrent_get_during_resize) {
+  RDGReaderThread::_exit = false;
+  RDGReaderThread::_total_reads = 0;
+  mt_test_doer<RunnerRDGThread>();
+}
+
 
 //#############################################################################################
 
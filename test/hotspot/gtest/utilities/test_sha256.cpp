@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/sha256.hpp"
+#include "unittest.hpp"
+
+static void check_digest(const char* expected, const char* data, size_t length, size_t chunk) {
+  SHA256 sha;
+  for (size_t i = 0; i < length; i += chunk) {
+    sha.update(data + i, MIN2(chunk, length - i));
+  }
+  u1 digest[SHA256::DIGEST_LENGTH];
+  sha.finish(digest);
+  char hex[2 * SHA256::DIGEST_LENGTH + 1];
+  for (size_t i = 0; i < SHA256::DIGEST_LENGTH; i++) {
+    os::snprintf_checked(hex + 2 * i, 3, "%02x", digest[i]);
+  }
+  EXPECT_STREQ(expected, hex) << "length " << length << ", chunk " << chunk;
+}
+
+TEST(SHA256, known_answers) {
+  check_digest("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", "", 0, 1);
+  check_digest("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "abc", 3, 1);
+  const char* two_blocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  for (size_t chunk = 1; chunk <= 64; chunk++) {
+    check_digest("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+                 two_blocks, strlen(two_blocks), chunk);
+  }
+}
+
+TEST(SHA256, padding_boundaries) {
+  // 55 bytes leave exactly room for the length, 56 need another block.
+  char a[64];
+  memset(a, 'a', sizeof(a));
+  check_digest("9f4390f8d30c2dd92ec9f095b65e2b9ae9b0a925a5258e241c9f1e910f734318", a, 55, 64);
+  check_digest("b35439a4ac6f0948b6d6f9e3c6af0f5f590ce20f1bde7090ef7970686ec6738a", a, 56, 64);
+  check_digest("ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb", a, 64, 3);
+}
@@ -72,3 +72,13 @@ TEST_VM(vitals, report_with_nownow) {
     }
   }
 }
+
+TEST_VM(vitals, history_file_missing) {
+  char tmp[64*K];
+  stringStream ss(tmp, sizeof(tmp));
+  sapmachine_vitals::print_history_file(&ss, "/nonexistent/vitals_history_file", NULL);
+  LOG(tmp);
+  if (EnableVitals) {
+    ASSERT_NE(::strstr(tmp, "Cannot open"), (char*)NULL);
+  }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 SAP SE. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#ifdef LINUX
+
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "vitals_linux_oswrapper.hpp"
+#include "unittest.hpp"
+
+//#define LOG(s) tty->print_raw(s);
+#define LOG(s)
+
+using sapmachine_vitals::OSWrapper;
+using sapmachine_vitals::value_t;
+
+// Micro benchmark: cost of reading and parsing all OS values for one sample.
+TEST_VM(vitals, oswrapper_update_cost) {
+  if (!EnableVitals) {
+    return; // OSWrapper is initialized by Vitals
+  }
+  const int num_updates = 200;
+  const jlong t1 = os::javaTimeNanos();
+  for (int i = 0; i < num_updates; i ++) {
+    OSWrapper::update();
+  }
+  const jlong t2 = os::javaTimeNanos();
+
+  char tmp[256];
+  stringStream ss(tmp, sizeof(tmp));
+  ss.print_cr("OSWrapper::update: " JLONG_FORMAT " us per sample", (t2 - t1) / num_updates / 1000);
+  LOG(tmp);
+
+  // These should be available on every kernel we support.
+  ASSERT_NE(OSWrapper::syst_phys(), INVALID_VALUE);
+  ASSERT_NE(OSWrapper::proc_rss_all(), INVALID_VALUE);
+  ASSERT_NE(OSWrapper::proc_thr(), INVALID_VALUE);
+  ASSERT_NE(OSWrapper::proc_cpu_us(), INVALID_VALUE);
+}
+
+// Updating within the cache interval must keep the values available.
+TEST_VM(vitals, oswrapper_update_if_needed_caches) {
+  if (!EnableVitals) {
+    return;
+  }
+  OSWrapper::update();
+  OSWrapper::update_if_needed();
+  ASSERT_NE(OSWrapper::proc_rss_all(), INVALID_VALUE);
+  ASSERT_NE(OSWrapper::proc_thr(), INVALID_VALUE);
+}
+
+#endif // LINUX
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+
+/*
+ * @test id=fast
+ * @summary C1 linear scan in fast mode, forced for every method, must
+ *          produce the same results as the interpreter
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1 -XX:C1FastLinearScanBlockLimit=1
+ *                   -XX:CompileCommand=compileonly,*TestC1FastLinearScan::test*
+ *                   compiler.c1.TestC1FastLinearScan
+ */
+
+/*
+ * @test id=stress
+ * @requires vm.compiler1.enabled & vm.debug
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1 -XX:C1FastLinearScanBlockLimit=1
+ *                   -XX:+StressLinearScan
+ *                   -XX:CompileCommand=compileonly,*TestC1FastLinearScan::test*
+ *                   compiler.c1.TestC1FastLinearScan
+ */
+
+package compiler.c1;
+
+public class TestC1FastLinearScan {
+    static final int ITERATIONS = 20_000;
+
+    static volatile int opaque = 3;
+
+    static int call(int x) {
+        return x * opaque;
+    }
+
+    // Many blocks, with int, long and double values live across calls and
+    // loop back edges, so that intervals are split and spilled.
+    static long testMixed(int n, long seed, double scale) {
+        long acc = seed;
+        double d = scale;
+        int k = n;
+        for (int i = 0; i < n; i++) {
+            switch (i & 3) {
+                case 0:  acc += call(i) + k; break;
+                case 1:  acc ^= (long) (d * i); d += 0.5; break;
+                case 2:  if ((acc & 1) == 0) { k -= call(1); } else { k += 2; } break;
+                default: acc = acc * 31 + Math.round(d); break;
+            }
+            if (acc < 0) {
+                acc = -acc;
+            } else if (acc > 1_000_000_007L) {
+                acc %= 1_000_000_007L;
+            }
+        }
+        return acc + k + (long) d;
+    }
+
+    // Exception handlers and a nested loop with an early exit.
+    static int testHandlers(int[] a, int limit) {
+        int result = 0;
+        outer:
+        for (int i = 0; i < a.length; i++) {
+            try {
+                for (int j = i; j < a.length; j++) {
+                    if (a[j] == limit) {
+                        break outer;
+                    }
+                    result += a[j] / (a[i] - i);
+                }
+            } catch (ArithmeticException e) {
+                result -= call(i);
+            }
+        }
+        return result;
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[40];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = (i * 7) % 13;
+        }
+        // The first calls are interpreted and give the expected results.
+        long expectedMixed = testMixed(100, 17, 1.25);
+        int expectedHandlers = testHandlers(a, 12);
+        int expectedHandlersNoExit = testHandlers(a, -1);
+
+        for (int i = 0; i < ITERATIONS; i++) {
+            check(testMixed(100, 17, 1.25), expectedMixed, "testMixed");
+            check(testHandlers(a, 12), expectedHandlers, "testHandlers");
+            check(testHandlers(a, -1), expectedHandlersNoExit, "testHandlers without exit");
+        }
+    }
+
+    static void check(long actual, long expected, String what) {
+        if (actual != expected) {
+            throw new RuntimeException(what + ": expected " + expected + ", got " + actual);
+        }
+    }
+}
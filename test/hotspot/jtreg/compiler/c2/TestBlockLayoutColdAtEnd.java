@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Moving cold traces behind the hot code must keep connector
+ *          blocks at the end of the block list
+ * @requires vm.compiler2.enabled & vm.debug
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,*TestBlockLayoutColdAtEnd::test*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+BlockLayoutColdAtEnd
+ *                   compiler.c2.TestBlockLayoutColdAtEnd
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,*TestBlockLayoutColdAtEnd::test*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+BlockLayoutColdAtEnd
+ *                   -XX:+StressGCM -XX:+StressLCM -XX:StressSeed=42
+ *                   compiler.c2.TestBlockLayoutColdAtEnd
+ */
+
+package compiler.c2;
+
+public class TestBlockLayoutColdAtEnd {
+    static final int ITERATIONS = 50_000;
+    // The slow paths below are taken this rarely, so that they are laid
+    // out as cold traces without becoming uncommon traps.
+    static final int COLD_PERIOD = 5_000;
+
+    static int sink;
+    static Object[] objects = new Object[16];
+
+    // Loops with several exits, rarely taken slow paths and untaken
+    // branches that become uncommon traps.
+    static int testLoops(int[] a, int n) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            int v = a[i];
+            if (v == Integer.MIN_VALUE) {
+                // never taken
+                throw new IllegalStateException("unexpected " + i);
+            }
+            if ((n + i) % COLD_PERIOD == 0) {
+                sum += slowPath(v, i);
+                continue;
+            }
+            if (v < 0) {
+                break;
+            }
+            for (int j = 0; j < (v & 3); j++) {
+                sum += j ^ v;
+                if (sum == 0x7ead) {
+                    return -sum;
+                }
+            }
+        }
+        return sum;
+    }
+
+    static int slowPath(int v, int i) {
+        return Integer.toString(v + i).length();
+    }
+
+    // Switch with rarely taken cases and null and type checks.
+    static int testSwitch(int n) {
+        Object o = objects[n & (objects.length - 1)];
+        int r;
+        switch (n % 7) {
+            case 0:  r = o instanceof String s ? s.length() : 1; break;
+            case 1:  r = o == null ? 2 : o.hashCode() & 7; break;
+            case 2:  r = n % COLD_PERIOD == 2 ? slowPath(n, 2) : 3; break;
+            case 3:  r = 4; break;
+            default: r = n & 5; break;
+        }
+        synchronized (TestBlockLayoutColdAtEnd.class) {
+            sink += r;
+        }
+        return r;
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < objects.length; i++) {
+            objects[i] = (i % 3 == 0) ? "s" + i : Integer.valueOf(i);
+        }
+        int[] a = new int[100];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = i * 7;
+        }
+        // The layout is verified by the asserts in PhaseCFG::fixup_flow().
+        for (int n = 0; n < ITERATIONS; n++) {
+            sink += testLoops(a, n);
+            testSwitch(n);
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary An object passed to a rarely executed call that C2 replaced with
+ *          an uncommon trap must be materialized correctly when the call is reached
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:CompileThreshold=100000
+ *                   -XX:CompileCommand=compileonly,*TestTrapColdEscapingCalls::test
+ *                   -XX:CompileCommand=dontinline,*TestTrapColdEscapingCalls::report
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+TrapColdEscapingCalls
+ *                   compiler.c2.TestTrapColdEscapingCalls
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:CompileThreshold=100000
+ *                   -XX:CompileCommand=compileonly,*TestTrapColdEscapingCalls::test
+ *                   -XX:CompileCommand=dontinline,*TestTrapColdEscapingCalls::report
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:-TrapColdEscapingCalls
+ *                   compiler.c2.TestTrapColdEscapingCalls
+ */
+
+package compiler.c2;
+
+public class TestTrapColdEscapingCalls {
+    static final int ITERATIONS = 300_000;
+    // The call to report() is taken a few times before test() is compiled,
+    // far less often than once per 10000 invocations.
+    static final int COLD_PERIOD = 50_000;
+
+    static class Point {
+        int x;
+        int y;
+        long z;
+
+        Point(int x, int y, long z) {
+            this.x = x;
+            this.y = y;
+            this.z = z;
+        }
+    }
+
+    static Point reported;
+    static int reportCount;
+
+    static void report(Point p) {
+        reported = p;
+        reportCount++;
+    }
+
+    static long test(int i) {
+        Point p = new Point(i, i + 1, (long) i << 32);
+        if (i % COLD_PERIOD == 0) {
+            report(p);
+        }
+        return p.x + p.y + p.z;
+    }
+
+    static void check(int i, long result) {
+        long expected = i + (i + 1) + ((long) i << 32);
+        if (result != expected) {
+            throw new RuntimeException("test(" + i + ") = " + result + ", expected " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        int expectedReports = 0;
+        for (int i = 1; i <= ITERATIONS; i++) {
+            check(i, test(i));
+            if (i % COLD_PERIOD == 0) {
+                expectedReports++;
+                Point p = reported;
+                if (p == null || p.x != i || p.y != i + 1 || p.z != ((long) i << 32)) {
+                    throw new RuntimeException("wrong object reported for " + i);
+                }
+                reported = null;
+            }
+        }
+        if (reportCount != expectedReports) {
+            throw new RuntimeException("report() called " + reportCount + " times, expected " + expectedReports);
+        }
+    }
+}
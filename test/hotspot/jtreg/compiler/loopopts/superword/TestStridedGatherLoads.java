@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Loads at a constant stride vectorized as gathers must produce the same results as scalar code
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,*TestStridedGatherLoads::test*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:SuperWordMaxGatherStride=8
+ *                   compiler.loopopts.superword.TestStridedGatherLoads
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,*TestStridedGatherLoads::test*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:SuperWordMaxGatherStride=8
+ *                   -XX:+AlignVector
+ *                   compiler.loopopts.superword.TestStridedGatherLoads
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,*TestStridedGatherLoads::test*
+ *                   compiler.loopopts.superword.TestStridedGatherLoads
+ */
+
+package compiler.loopopts.superword;
+
+public class TestStridedGatherLoads {
+    static final int SIZE = 1024;
+    static final int MAX_STRIDE = 8;
+    static final int ITERATIONS = 20_000;
+
+    // The test* methods are compiled by C2; the ref* methods run in the
+    // interpreter only and provide the expected results.
+
+    static void testIntStride2(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[2 * i] + b[i];
+        }
+    }
+
+    static void refIntStride2(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[2 * i] + b[i];
+        }
+    }
+
+    static void testIntStride3(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[3 * i + 1] * b[i];
+        }
+    }
+
+    static void refIntStride3(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[3 * i + 1] * b[i];
+        }
+    }
+
+    static void testLongStride2(long[] a, long[] b, long[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[2 * i] - b[i];
+        }
+    }
+
+    static void refLongStride2(long[] a, long[] b, long[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[2 * i] - b[i];
+        }
+    }
+
+    static void testFloatStride4(float[] a, float[] b, float[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[4 * i + 3] * b[i];
+        }
+    }
+
+    static void refFloatStride4(float[] a, float[] b, float[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[4 * i + 3] * b[i];
+        }
+    }
+
+    static void testDoubleStride8(double[] a, double[] b, double[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[8 * i] + b[i];
+        }
+    }
+
+    static void refDoubleStride8(double[] a, double[] b, double[] r) {
+        for (int i = 0; i < r.length; i++) {
+            r[i] = a[8 * i] + b[i];
+        }
+    }
+
+    // Strided loads from the array that is stored to: the gather must not
+    // read lanes that the vector store of an earlier iteration wrote.
+    static void testIntStride2InPlace(int[] a) {
+        for (int i = 0; i < SIZE; i++) {
+            a[i] = a[2 * i] + 1;
+        }
+    }
+
+    static void refIntStride2InPlace(int[] a) {
+        for (int i = 0; i < SIZE; i++) {
+            a[i] = a[2 * i] + 1;
+        }
+    }
+
+    public static void main(String[] args) {
+        int[] ia = new int[SIZE * MAX_STRIDE];
+        long[] la = new long[SIZE * MAX_STRIDE];
+        float[] fa = new float[SIZE * MAX_STRIDE];
+        double[] da = new double[SIZE * MAX_STRIDE];
+        for (int i = 0; i < SIZE * MAX_STRIDE; i++) {
+            ia[i] = i * 0x9E3779B9;
+            la[i] = i * 0x9E3779B97F4A7C15L;
+            fa[i] = i * 0.5f - 100f;
+            da[i] = i * 0.25 - 1000.0;
+        }
+        int[] ib = new int[SIZE];
+        long[] lb = new long[SIZE];
+        float[] fb = new float[SIZE];
+        double[] db = new double[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            ib[i] = SIZE - i;
+            lb[i] = (long) i << 33;
+            fb[i] = 1.0f + i;
+            db[i] = -0.5 * i;
+        }
+
+        int[] ir = new int[SIZE];
+        int[] iexp = new int[SIZE];
+        long[] lr = new long[SIZE];
+        long[] lexp = new long[SIZE];
+        float[] fr = new float[SIZE];
+        float[] fexp = new float[SIZE];
+        double[] dr = new double[SIZE];
+        double[] dexp = new double[SIZE];
+
+        refIntStride2(ia, ib, iexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testIntStride2(ia, ib, ir);
+        }
+        verify("testIntStride2", ir, iexp);
+
+        refIntStride3(ia, ib, iexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testIntStride3(ia, ib, ir);
+        }
+        verify("testIntStride3", ir, iexp);
+
+        refLongStride2(la, lb, lexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testLongStride2(la, lb, lr);
+        }
+        verify("testLongStride2", lr, lexp);
+
+        refFloatStride4(fa, fb, fexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testFloatStride4(fa, fb, fr);
+        }
+        verify("testFloatStride4", fr, fexp);
+
+        refDoubleStride8(da, db, dexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testDoubleStride8(da, db, dr);
+        }
+        verify("testDoubleStride8", dr, dexp);
+
+        for (int n = 0; n < ITERATIONS; n++) {
+            int[] r = ia.clone();
+            int[] expected = ia.clone();
+            testIntStride2InPlace(r);
+            if (n == 0 || n == ITERATIONS - 1) {
+                refIntStride2InPlace(expected);
+                verify("testIntStride2InPlace", r, expected);
+            }
+        }
+    }
+
+    static void verify(String name, int[] r, int[] expected) {
+        for (int i = 0; i < r.length; i++) {
+            if (r[i] != expected[i]) {
+                throw new RuntimeException(name + ": wrong result at " + i + ": " +
+                                           r[i] + " != " + expected[i]);
+            }
+        }
+    }
+
+    static void verify(String name, long[] r, long[] expected) {
+        for (int i = 0; i < r.length; i++) {
+            if (r[i] != expected[i]) {
+                throw new RuntimeException(name + ": wrong result at " + i + ": " +
+                                           r[i] + " != " + expected[i]);
+            }
+        }
+    }
+
+    static void verify(String name, float[] r, float[] expected) {
+        for (int i = 0; i < r.length; i++) {
+            if (Float.floatToIntBits(r[i]) != Float.floatToIntBits(expected[i])) {
+                throw new RuntimeException(name + ": wrong result at " + i + ": " +
+                                           r[i] + " != " + expected[i]);
+            }
+        }
+    }
+
+    static void verify(String name, double[] r, double[] expected) {
+        for (int i = 0; i < r.length; i++) {
+            if (Double.doubleToLongBits(r[i]) != Double.doubleToLongBits(expected[i])) {
+                throw new RuntimeException(name + ": wrong result at " + i + ": " +
+                                           r[i] + " != " + expected[i]);
+            }
+        }
+    }
+}
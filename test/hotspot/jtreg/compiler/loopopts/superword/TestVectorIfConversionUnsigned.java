@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Unsigned compares in if-converted loops must produce unsigned vector mask compares
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,*TestVectorIfConversionUnsigned::test*
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseVectorIfConversion
+ *                   compiler.loopopts.superword.TestVectorIfConversionUnsigned
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,*TestVectorIfConversionUnsigned::test*
+ *                   -XX:+UseVectorCmov
+ *                   compiler.loopopts.superword.TestVectorIfConversionUnsigned
+ */
+
+package compiler.loopopts.superword;
+
+public class TestVectorIfConversionUnsigned {
+    static final int SIZE = 1024;
+    static final int ITERATIONS = 20_000;
+
+    static final int[] INT_VALUES = {
+        Integer.MIN_VALUE, Integer.MIN_VALUE + 1, -2, -1, 0, 1, 2,
+        Integer.MAX_VALUE - 1, Integer.MAX_VALUE
+    };
+    static final long[] LONG_VALUES = {
+        Long.MIN_VALUE, Long.MIN_VALUE + 1, -2L, -1L, 0L, 1L, 2L,
+        Integer.MIN_VALUE, Integer.MAX_VALUE, 0xFFFF_FFFFL,
+        Long.MAX_VALUE - 1, Long.MAX_VALUE
+    };
+
+    // The test* methods are compiled by C2; the ref* methods run in the
+    // interpreter only and provide the expected results.
+
+    static void testIntLT(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Integer.compareUnsigned(a[i], b[i]) < 0 ? a[i] : b[i];
+        }
+    }
+
+    static void refIntLT(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Integer.compareUnsigned(a[i], b[i]) < 0 ? a[i] : b[i];
+        }
+    }
+
+    static void testIntGE(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Integer.compareUnsigned(a[i], b[i]) >= 0 ? a[i] : b[i];
+        }
+    }
+
+    static void refIntGE(int[] a, int[] b, int[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Integer.compareUnsigned(a[i], b[i]) >= 0 ? a[i] : b[i];
+        }
+    }
+
+    static void testLongLE(long[] a, long[] b, long[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Long.compareUnsigned(a[i], b[i]) <= 0 ? a[i] : b[i];
+        }
+    }
+
+    static void refLongLE(long[] a, long[] b, long[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Long.compareUnsigned(a[i], b[i]) <= 0 ? a[i] : b[i];
+        }
+    }
+
+    static void testLongGT(long[] a, long[] b, long[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Long.compareUnsigned(a[i], b[i]) > 0 ? a[i] : b[i];
+        }
+    }
+
+    static void refLongGT(long[] a, long[] b, long[] r) {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = Long.compareUnsigned(a[i], b[i]) > 0 ? a[i] : b[i];
+        }
+    }
+
+    public static void main(String[] args) {
+        // Every pair of boundary values appears, at varying lane positions.
+        int[] ia = new int[SIZE];
+        int[] ib = new int[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            ia[i] = INT_VALUES[i % INT_VALUES.length];
+            ib[i] = INT_VALUES[(i / INT_VALUES.length) % INT_VALUES.length];
+        }
+        long[] la = new long[SIZE];
+        long[] lb = new long[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            la[i] = LONG_VALUES[i % LONG_VALUES.length];
+            lb[i] = LONG_VALUES[(i / LONG_VALUES.length) % LONG_VALUES.length];
+        }
+
+        int[] ir = new int[SIZE];
+        int[] iexp = new int[SIZE];
+        long[] lr = new long[SIZE];
+        long[] lexp = new long[SIZE];
+
+        refIntLT(ia, ib, iexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testIntLT(ia, ib, ir);
+        }
+        verify("testIntLT", ir, iexp);
+
+        refIntGE(ia, ib, iexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testIntGE(ia, ib, ir);
+        }
+        verify("testIntGE", ir, iexp);
+
+        refLongLE(la, lb, lexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testLongLE(la, lb, lr);
+        }
+        verify("testLongLE", lr, lexp);
+
+        refLongGT(la, lb, lexp);
+        for (int n = 0; n < ITERATIONS; n++) {
+            testLongGT(la, lb, lr);
+        }
+        verify("testLongGT", lr, lexp);
+    }
+
+    static void verify(String name, int[] r, int[] expected) {
+        for (int i = 0; i < r.length; i++) {
+            if (r[i] != expected[i]) {
+                throw new RuntimeException(name + ": wrong result at " + i + ": " +
+                                           r[i] + " != " + expected[i]);
+            }
+        }
+    }
+
+    static void verify(String name, long[] r, long[] expected) {
+        for (int i = 0; i < r.length; i++) {
+            if (r[i] != expected[i]) {
+                throw new RuntimeException(name + ": wrong result at " + i + ": " +
+                                           r[i] + " != " + expected[i]);
+            }
+        }
+    }
+}
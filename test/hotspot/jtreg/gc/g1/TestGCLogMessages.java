@@ -147,6 +147,7 @@ public boolean isAvailable() {
         new LogMessageWithLevel("Code Root Scan \\(ms\\):", Level.DEBUG),
         // Object Copy
         new LogMessageWithLevel("Object Copy \\(ms\\):", Level.DEBUG),
+        new LogMessageWithLevel("Stolen Tasks:", Level.DEBUG),
         new LogMessageWithLevel("Copied Bytes:", Level.DEBUG),
         new LogMessageWithLevel("LAB Waste:", Level.DEBUG),
         new LogMessageWithLevel("LAB Undo Waste:", Level.DEBUG),
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @run driver gc.g1.TestPinnableArrayAllocation
+ * @summary Test that allocating primitive arrays into the pinnable alloc region
+ *          with G1PinnableArrayMinSize works across young and full collections.
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPinnableArrayAllocation {
+
+  public static void main(String args[]) throws Exception {
+    OutputAnalyzer out = ProcessTools.executeLimitedTestJava(
+      "-XX:+UseG1GC",
+      "-Xmx64M",
+      "-XX:+UnlockExperimentalVMOptions",
+      "-XX:G1PinnableArrayMinSize=16K",
+      "-Xlog:gc",
+      Allocate.class.getName());
+
+    out.shouldHaveExitValue(0);
+    out.shouldMatch(".*Pause Young \\(Normal\\).*");
+    out.shouldMatch(".*Pause Full \\(System.gc\\(\\)\\).*");
+  }
+
+  public static class Allocate {
+    public static Object[] keep = new Object[64];
+
+    public static void main(String [] args) throws Exception {
+      for (int i = 0; i < 20_000; i++) {
+        // Mix pinnable primitive arrays with regular objects.
+        keep[i % keep.length] = (i % 2 == 0) ? new byte[32 * 1024] : new Object[16];
+        if (i % 5_000 == 0) {
+          System.gc();
+        }
+      }
+      for (Object o : keep) {
+        if (o == null) {
+          throw new RuntimeException("Lost an object");
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc.serial;
+
+/*
+ * @test TestSerialFullGCSideTables
+ * @summary Stress the Serial full GC with side-table marking and forwarding, and check
+ *          that the object graph, identity hash codes and held locks survive compaction.
+ * @requires vm.gc.Serial
+ * @run main/othervm -Xmx128m -Xmn16m -XX:+UseSerialGC
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseSerialFullGCSideTables
+ *                   gc.serial.TestSerialFullGCSideTables
+ * @run main/othervm -Xmx128m -Xmn16m -XX:+UseSerialGC -XX:-UseCompressedOops
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseSerialFullGCSideTables
+ *                   gc.serial.TestSerialFullGCSideTables
+ * @run main/othervm -Xmx128m -Xmn16m -XX:+UseSerialGC -XX:ObjectAlignmentInBytes=16
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseSerialFullGCSideTables
+ *                   gc.serial.TestSerialFullGCSideTables
+ * @run main/othervm -Xmx64m -Xmn8m -XX:+UseSerialGC
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseSerialFullGCSideTables
+ *                   gc.serial.TestSerialFullGCSideTables
+ * @run main/othervm -Xmx128m -Xmn16m -XX:+UseSerialGC
+ *                   -XX:+UnlockExperimentalVMOptions -XX:-UseSerialFullGCSideTables
+ *                   gc.serial.TestSerialFullGCSideTables
+ */
+
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.IdentityHashMap;
+import java.util.Random;
+
+public class TestSerialFullGCSideTables {
+    static final int ROUNDS = 20;
+    static final int NODES = 50_000;
+
+    static class Node {
+        final int id;
+        Node next;
+        Object payload;
+
+        Node(int id) {
+            this.id = id;
+        }
+    }
+
+    static final Random RANDOM = new Random(42);
+
+    // Live nodes, and the identity hash code taken from each before the first full GC.
+    static Node[] nodes;
+    static int[] hashes;
+
+    public static void main(String[] args) throws Exception {
+        nodes = new Node[NODES];
+        hashes = new int[NODES];
+        for (int i = 0; i < NODES; i++) {
+            nodes[i] = new Node(i);
+            nodes[i].payload = payload(i);
+        }
+        for (int i = 0; i < NODES; i++) {
+            nodes[i].next = nodes[(i * 7 + 1) % NODES];
+            hashes[i] = System.identityHashCode(nodes[i]);
+        }
+
+        ReferenceQueue<Object> queue = new ReferenceQueue<>();
+        ArrayList<Reference<Object>> weakRefs = new ArrayList<>();
+
+        for (int round = 0; round < ROUNDS; round++) {
+            // Drop a share of the nodes, so that compaction has gaps of all sizes to close.
+            for (int i = round % 3; i < NODES; i += 3 + round % 5) {
+                Node n = new Node(i);
+                n.payload = payload(i);
+                n.next = nodes[(i * 7 + 1) % NODES];
+                nodes[i] = n;
+                hashes[i] = System.identityHashCode(n);
+            }
+            for (int i = 0; i < NODES; i++) {
+                nodes[i].next = nodes[(i * 7 + 1) % NODES];
+            }
+
+            // Garbage interleaved with survivors, and some large arrays.
+            ArrayList<Object> garbage = new ArrayList<>();
+            for (int i = 0; i < 10_000; i++) {
+                garbage.add(new byte[RANDOM.nextInt(512)]);
+            }
+            garbage.add(new long[RANDOM.nextInt(256 * 1024)]);
+
+            // References to dead objects must be cleared, those to live ones kept.
+            weakRefs.clear();
+            for (int i = 0; i < 100; i++) {
+                weakRefs.add(new WeakReference<>(new Object(), queue));
+            }
+            WeakReference<Node> liveRef = new WeakReference<>(nodes[round]);
+            SoftReference<Node> softRef = new SoftReference<>(nodes[round + 1]);
+            garbage = null;
+
+            // Full GC while holding locks on some of the survivors.
+            synchronized (nodes[0]) {
+                synchronized (nodes[NODES / 2]) {
+                    System.gc();
+                }
+            }
+
+            if (liveRef.get() != nodes[round]) {
+                throw new RuntimeException("weak reference to a live object was cleared");
+            }
+            if (softRef.get() != nodes[round + 1]) {
+                throw new RuntimeException("soft reference changed");
+            }
+            for (Reference<Object> ref : weakRefs) {
+                if (ref.get() != null) {
+                    throw new RuntimeException("weak reference to a dead object was not cleared");
+                }
+            }
+            verify(round);
+        }
+    }
+
+    static Object payload(int i) {
+        switch (i % 4) {
+            case 0:  return new int[i % 64];
+            case 1:  return "node" + i;
+            case 2:  return new Object[] { new Object(), null, Integer.valueOf(i) };
+            default: return null;
+        }
+    }
+
+    static void verify(int round) {
+        IdentityHashMap<Node, Integer> seen = new IdentityHashMap<>();
+        for (int i = 0; i < NODES; i++) {
+            Node n = nodes[i];
+            if (n.id != i) {
+                throw new RuntimeException("round " + round + ": node " + i + " has id " + n.id);
+            }
+            if (System.identityHashCode(n) != hashes[i]) {
+                throw new RuntimeException("round " + round + ": identity hash of node " + i + " changed");
+            }
+            if (n.next != nodes[(i * 7 + 1) % NODES]) {
+                throw new RuntimeException("round " + round + ": node " + i + " lost its successor");
+            }
+            Object p = n.payload;
+            switch (i % 4) {
+                case 0:
+                    if (!(p instanceof int[] a) || a.length != i % 64) {
+                        throw new RuntimeException("round " + round + ": bad payload for node " + i);
+                    }
+                    break;
+                case 1:
+                    if (!("node" + i).equals(p)) {
+                        throw new RuntimeException("round " + round + ": bad payload for node " + i);
+                    }
+                    break;
+                case 2:
+                    if (!(p instanceof Object[] a) || a.length != 3 || a[1] != null ||
+                        !Integer.valueOf(i).equals(a[2])) {
+                        throw new RuntimeException("round " + round + ": bad payload for node " + i);
+                    }
+                    break;
+                default:
+                    if (p != null) {
+                        throw new RuntimeException("round " + round + ": bad payload for node " + i);
+                    }
+            }
+            if (seen.put(n, i) != null) {
+                throw new RuntimeException("round " + round + ": node " + i + " aliases another node");
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Defining an already defined class must still parse the bytes, so
+ *          malformed bytes throw ClassFormatError and a duplicate definition
+ *          throws LinkageError, unless parallel defines are allowed.
+ * @library /test/lib
+ * @run main/othervm DuplicateDefineTest
+ * @run main/othervm -XX:+AllowParallelDefineClass DuplicateDefineTest parallel
+ */
+
+import java.io.InputStream;
+import java.util.Arrays;
+
+public class DuplicateDefineTest {
+    static class Dup { }
+
+    static class ParallelLoader extends ClassLoader {
+        static {
+            registerAsParallelCapable();
+        }
+
+        ParallelLoader() {
+            super(null);
+        }
+
+        Class<?> define(String name, byte[] bytes) {
+            return defineClass(name, bytes, 0, bytes.length);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean parallel = args.length > 0 && args[0].equals("parallel");
+        String name = Dup.class.getName();
+        byte[] bytes;
+        try (InputStream in = DuplicateDefineTest.class.getResourceAsStream("DuplicateDefineTest$Dup.class")) {
+            bytes = in.readAllBytes();
+        }
+
+        ParallelLoader loader = new ParallelLoader();
+        Class<?> first = loader.define(name, bytes);
+
+        // The bytes of a duplicate definition are parsed before the existing
+        // class is found, so malformed bytes are reported in both modes.
+        byte[] truncated = Arrays.copyOf(bytes, bytes.length / 2);
+        try {
+            loader.define(name, truncated);
+            throw new RuntimeException("Expected ClassFormatError");
+        } catch (ClassFormatError e) {
+            System.out.println("Got expected " + e);
+        }
+
+        if (parallel) {
+            Class<?> second = loader.define(name, bytes);
+            if (second != first) {
+                throw new RuntimeException("Expected the existing class, got " + second);
+            }
+        } else {
+            try {
+                loader.define(name, bytes);
+                throw new RuntimeException("Expected LinkageError");
+            } catch (LinkageError e) {
+                if (e instanceof ClassFormatError || !e.getMessage().contains("duplicate class definition")) {
+                    throw new RuntimeException("Unexpected error", e);
+                }
+                System.out.println("Got expected " + e);
+            }
+        }
+    }
+}
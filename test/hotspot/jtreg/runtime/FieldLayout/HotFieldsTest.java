@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Fields named by -XX:HotFields are laid out before the other fields of their class
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:HotFields=HotFieldsTest$Sample.hotLong,HotFieldsTest$Sample.hotRef
+ *                   HotFieldsTest true
+ * @run main/othervm HotFieldsTest false
+ */
+
+import java.lang.reflect.Field;
+import jdk.internal.misc.Unsafe;
+
+public class HotFieldsTest {
+    static final Unsafe U = Unsafe.getUnsafe();
+
+    static class Sample {
+        long a;
+        long b;
+        Object coldRef;
+        long hotLong;
+        Object hotRef;
+    }
+
+    static long offset(String name) throws Exception {
+        Field f = Sample.class.getDeclaredField(name);
+        return U.objectFieldOffset(f);
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean hot = Boolean.parseBoolean(args[0]);
+        long a = offset("a");
+        long b = offset("b");
+        long coldRef = offset("coldRef");
+        long hotLong = offset("hotLong");
+        long hotRef = offset("hotRef");
+        System.out.println("a=" + a + " b=" + b + " coldRef=" + coldRef +
+                           " hotLong=" + hotLong + " hotRef=" + hotRef);
+
+        if (hot) {
+            // Both hot fields come first, whatever their size or kind.
+            check(hotLong < a && hotLong < b && hotLong < coldRef, "hotLong is not laid out first");
+            check(hotRef < a && hotRef < b && hotRef < coldRef, "hotRef is not laid out first");
+        } else {
+            // Without the flag, primitives still come before oops.
+            check(hotRef > hotLong, "regular layout changed");
+        }
+
+        // The hot oop field must be in the oop maps and survive a GC.
+        Sample[] samples = new Sample[1000];
+        for (int i = 0; i < samples.length; i++) {
+            samples[i] = new Sample();
+            samples[i].hotRef = new Integer[] { i };
+            samples[i].coldRef = "cold" + i;
+        }
+        for (int i = 0; i < 3; i++) {
+            System.gc();
+            byte[][] garbage = new byte[1000][];
+            for (int j = 0; j < garbage.length; j++) {
+                garbage[j] = new byte[1000];
+            }
+        }
+        for (int i = 0; i < samples.length; i++) {
+            check(((Integer[])samples[i].hotRef)[0] == i, "hotRef corrupted at " + i);
+            check(samples[i].coldRef.equals("cold" + i), "coldRef corrupted at " + i);
+        }
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Methods compiled at tier 4 while dumping a dynamic archive are
+ *          compiled at tier 3 early when the archive is used with ArchiveHotMethodHints.
+ * @requires vm.cds
+ * @requires vm.compMode == "Xmixed"
+ * @requires vm.opt.TieredStopAtLevel == null | vm.opt.TieredStopAtLevel == 4
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled
+ * @library /test/lib
+ * @build HotMethodHintsApp
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller -jar hot.jar HotMethodHintsApp
+ * @run driver HotMethodHints
+ */
+
+import jdk.test.lib.cds.CDSTestUtils;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class HotMethodHints {
+    static final String ARCHIVE = "HotMethodHints.jsa";
+    // PrintCompilation line for a tier 3 compilation of the hot method
+    static final String TIER3_COMPILE = "\\s3\\s+HotMethodHintsApp::hot ";
+
+    public static void main(String[] args) throws Exception {
+        String appJar = "hot.jar";
+
+        // Dump with the hints; the dumping run makes hot() reach tier 4.
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockDiagnosticVMOptions", "-XX:+ArchiveHotMethodHints",
+            "-XX:ArchiveClassesAtExit=" + ARCHIVE,
+            "-Xbatch", "-Xlog:cds=info",
+            "-cp", appJar, "HotMethodHintsApp", "dump");
+        output.shouldHaveExitValue(0);
+
+        // With the hints, the first invocation notification compiles hot() at tier 3,
+        // long before the regular tier 3 invocation threshold.
+        output = ProcessTools.executeTestJava(
+            "-XX:+UnlockDiagnosticVMOptions", "-XX:+ArchiveHotMethodHints",
+            "-XX:SharedArchiveFile=" + ARCHIVE,
+            "-Xbatch", "-XX:+PrintCompilation", "-Xlog:class+load",
+            "-cp", appJar, "HotMethodHintsApp", "use");
+        if (CDSTestUtils.isUnableToMap(output)) {
+            return;
+        }
+        output.shouldHaveExitValue(0);
+        output.shouldContain("HotMethodHintsApp source: shared objects file");
+        output.shouldMatch(TIER3_COMPILE);
+
+        // Without them, the same few calls are interpreted only.
+        output = ProcessTools.executeTestJava(
+            "-XX:SharedArchiveFile=" + ARCHIVE,
+            "-Xbatch", "-XX:+PrintCompilation",
+            "-cp", appJar, "HotMethodHintsApp", "use");
+        output.shouldHaveExitValue(0);
+        output.shouldNotMatch(TIER3_COMPILE);
+    }
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+public class HotMethodHintsApp {
+    static int sink;
+
+    // No loops, so that only invocations count towards compilation.
+    static int hot(int x) {
+        return x * 31 + (x >>> 3);
+    }
+
+    public static void main(String[] args) {
+        // "dump" runs hot() until it is compiled at tier 4, "use" calls it
+        // more often than the first invocation notification but less often
+        // than the tier 3 invocation threshold.
+        int calls = args[0].equals("dump") ? 200_000 : 150;
+        for (int i = 0; i < calls; i++) {
+            sink += hot(i);
+        }
+    }
+}
@@ -352,6 +352,14 @@ private static void testJcmdOptions() throws Exception {
       oa.shouldNotContain("Statistic for alloc maps");
       oa = callJcmd(p, "MallocTrace.enable", "-force", "-use-backtrace", "-only-nth=4");
       oa.shouldContain("Malloc statistic enabled"); // We cannot assume this machine has backtrace available.
+      oa = callJcmd(p, "MallocTrace.enable", "-force", "-sample-interval=65536");
+      oa.shouldContain("Sampling about every 65536 bytes allocated per thread");
+      oa.shouldContain("Malloc statistic enabled");
+      oa = callJcmd(p, "MallocTrace.dump");
+      oa.shouldContain("Allocations were sampled about every 65536 bytes per thread");
+      oa = callJcmd(p, "MallocTrace.enable", "-force", "-sample-interval=65536", "-only-nth=4");
+      oa.shouldContain("cannot be combined");
+      oa.shouldNotContain("Malloc statistic enabled");
       oa = callJcmd(p, "MallocTrace.enable", "-force", "-track-free");
       oa.shouldContain("Tracking live memory");
       oa = callJcmd(p, "MallocTrace.dump", "-dump-file=stdout");
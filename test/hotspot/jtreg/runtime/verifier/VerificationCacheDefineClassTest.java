@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary Classes defined by Lookup.defineClass are never skipped by the verification cache
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ * @run driver VerificationCacheDefineClassTest
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Map;
+
+import jdk.test.lib.compiler.InMemoryJavaCompiler;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class VerificationCacheDefineClassTest {
+    // Main defines the same bytes of Defined with Lookup.defineClass in
+    // every run. Defined is in the app loader, like Main, but its bytes do
+    // not come from the class path.
+    static final String MAIN =
+        "import java.lang.invoke.MethodHandles;" +
+        "public class Main {" +
+        "  public static void main(String[] args) throws Exception {" +
+        "    byte[] bytes = Main.class.getResourceAsStream(\"Defined.bin\").readAllBytes();" +
+        "    Class<?> c = MethodHandles.lookup().defineClass(bytes);" +
+        "    System.out.println(\"made \" + c.getDeclaredConstructor().newInstance());" +
+        "  }" +
+        "}";
+    static final String DEFINED =
+        "public class Defined {" +
+        "  public String toString() { return \"Defined\"; }" +
+        "}";
+
+    public static void main(String[] args) throws Exception {
+        Path cache = Path.of("verification.cache");
+        Path app = Path.of("app.jar");
+
+        byte[] mainBytes = InMemoryJavaCompiler.compile("Main", MAIN);
+        byte[] definedBytes = InMemoryJavaCompiler.compile("Defined", DEFINED);
+        Path dir = Files.createDirectories(Path.of("app"));
+        Files.write(dir.resolve("Main.class"), mainBytes);
+        Files.write(dir.resolve("Defined.bin"), definedBytes);
+        JarUtils.createJarFile(app, dir);
+
+        run(cache, app)
+            .shouldHaveExitValue(0)
+            .shouldContain("made Defined")
+            .shouldContain("Wrote ");
+
+        // Main comes from the class path and is found in the cache. Defined
+        // has the same bytes as in the first run, but is verified again.
+        run(cache, app)
+            .shouldHaveExitValue(0)
+            .shouldContain("made Defined")
+            .shouldContain("Skipping verification of Main")
+            .shouldNotContain("Skipping verification of Defined")
+            .shouldContain("Verifying class Defined");
+    }
+
+    static OutputAnalyzer run(Path cache, Path app) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:VerificationCacheFile=" + cache,
+            "-Xshare:off",
+            "-Xlog:verification=info",
+            "-cp", app.toString(),
+            "Main");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        return output;
+    }
+}
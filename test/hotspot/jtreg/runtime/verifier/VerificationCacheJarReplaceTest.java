@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+/*
+ * @test
+ * @summary A replaced dependency jar invalidates the verification cache
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ * @run driver VerificationCacheJarReplaceTest
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.attribute.FileTime;
+import java.util.Map;
+
+import jdk.test.lib.compiler.InMemoryJavaCompiler;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.util.JarUtils;
+
+public class VerificationCacheJarReplaceTest {
+    // Main.make() returns a Sub as a Base, which the verifier only accepts
+    // while Sub extends Base.
+    static final String MAIN =
+        "public class Main {" +
+        "  static Base make() { return new Sub(); }" +
+        "  public static void main(String[] args) { System.out.println(\"made \" + make()); }" +
+        "}";
+    static final String BASE = "public class Base {}";
+    static final String SUB_V1 = "public class Sub extends Base {}";
+    static final String SUB_V2 = "public class Sub {}";
+
+    public static void main(String[] args) throws Exception {
+        Path cache = Path.of("verification.cache");
+        Path app = Path.of("app.jar");
+        Path dep = Path.of("dep.jar");
+
+        byte[] base = InMemoryJavaCompiler.compile("Base", BASE);
+        byte[] subV1 = InMemoryJavaCompiler.compile("Sub", SUB_V1);
+        byte[] subV2 = InMemoryJavaCompiler.compile("Sub", SUB_V2);
+        Path depV1 = writeClasses("dep_v1", Map.of("Base", base, "Sub", subV1));
+        Path depV2 = writeClasses("dep_v2", Map.of("Base", base, "Sub", subV2));
+        JarUtils.createJarFile(dep, depV1);
+        byte[] mainBytes = InMemoryJavaCompiler.compile("Main", MAIN, "-cp", dep.toString());
+        JarUtils.createJarFile(app, writeClasses("app", Map.of("Main", mainBytes)));
+        String cp = app + java.io.File.pathSeparator + dep;
+
+        // First run verifies Main and records it.
+        run(cache, cp)
+            .shouldHaveExitValue(0)
+            .shouldContain("made Sub")
+            .shouldContain("Wrote ");
+
+        // Second run with the same jars skips verifying Main.
+        run(cache, cp)
+            .shouldHaveExitValue(0)
+            .shouldContain("Skipping verification of Main");
+
+        // Replace dep.jar at the same path, keeping its modification time.
+        // Main is unchanged, but no longer verifies against the new hierarchy.
+        FileTime mtime = Files.getLastModifiedTime(dep);
+        Files.delete(dep);
+        JarUtils.createJarFile(dep, depV2);
+        Files.setLastModifiedTime(dep, mtime);
+
+        run(cache, cp)
+            .shouldNotHaveExitValue(0)
+            .shouldContain("Ignoring stale or damaged verification cache")
+            .shouldNotContain("Skipping verification of Main")
+            .shouldContain("java.lang.VerifyError");
+    }
+
+    static Path writeClasses(String dir, Map<String, byte[]> classes) throws Exception {
+        Path path = Files.createDirectories(Path.of(dir));
+        for (Map.Entry<String, byte[]> e : classes.entrySet()) {
+            Files.write(path.resolve(e.getKey() + ".class"), e.getValue());
+        }
+        return path;
+    }
+
+    static OutputAnalyzer run(Path cache, String cp) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:VerificationCacheFile=" + cache,
+            "-Xshare:off",
+            "-Xlog:verification=info",
+            "-cp", cp,
+            "Main");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.reportDiagnosticSummary();
+        return output;
+    }
+}
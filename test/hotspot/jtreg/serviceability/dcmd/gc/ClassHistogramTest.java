@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+import org.testng.annotations.Test;
+import org.testng.Assert;
+
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.class_histogram, with and without -referenced
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng ClassHistogramTest
+ */
+public class ClassHistogramTest {
+    static final int PAYLOAD_LENGTH = 1000;
+
+    public static class TestClass {
+        final byte[] payload = new byte[PAYLOAD_LENGTH];
+    }
+    public static TestClass[] instances = new TestClass[1024];
+
+    static {
+        for (int i = 0; i < instances.length; ++i) {
+            instances[i] = new TestClass();
+        }
+    }
+
+    public void run(CommandExecutor executor) {
+        OutputAnalyzer output = executor.execute("GC.class_histogram");
+
+        /*
+         * example output:
+         *  num     #instances         #bytes  class name (module)
+         * -------------------------------------------------------
+         *    1:          7991     757792  [B (java.base@9-internal)
+         */
+        output.shouldContain(" num     #instances         #bytes  class name (module)");
+        output.shouldNotContain("#referenced");
+
+        /* Require at least one java.lang.Class */
+        output.shouldMatch("^\\s+\\d+:\\s+\\d+\\s+\\d+\\s+java.lang.Class \\(java.base@\\S*\\)\\s*$");
+
+        /* Require at least one java.lang.String */
+        output.shouldMatch("^\\s+\\d+:\\s+\\d+\\s+\\d+\\s+java.lang.String \\(java.base@\\S*\\)\\s*$");
+
+        /* Require exactly one TestClass[] */
+        output.shouldMatch("^\\s+\\d+:\\s+1\\s+\\d+\\s+" +
+            Pattern.quote(TestClass[].class.getName()) + "\\s*$");
+
+        /* Require exactly 1024 TestClass */
+        output.shouldMatch("^\\s+\\d+:\\s+1024\\s+\\d+\\s+" +
+            Pattern.quote(TestClass.class.getName()) + "\\s*$");
+    }
+
+    public void runReferenced(CommandExecutor executor) {
+        OutputAnalyzer output = executor.execute("GC.class_histogram -referenced");
+
+        /*
+         * example output:
+         *  num     #instances         #bytes    #referenced  class name (module)
+         * ----------------------------------------------------------------------
+         *    1:          7991         757792          16384  [B (java.base@9-internal)
+         */
+        output.shouldContain(" num     #instances         #bytes    #referenced  class name (module)");
+        output.shouldContain("----------------------------------------------------------------------");
+
+        /* Every row has the extra column */
+        output.shouldMatch("^\\s+\\d+:\\s+\\d+\\s+\\d+\\s+\\d+\\s+java.lang.String \\(java.base@\\S*\\)\\s*$");
+
+        /* Each TestClass references one payload array */
+        String referenced = output.firstMatch("^\\s+\\d+:\\s+1024\\s+\\d+\\s+(\\d+)\\s+" +
+            Pattern.quote(TestClass.class.getName()) + "\\s*$", 1);
+        Assert.assertNotNull(referenced, "no row for " + TestClass.class.getName());
+        long minimum = (long)instances.length * PAYLOAD_LENGTH;
+        Assert.assertTrue(Long.parseLong(referenced) >= minimum,
+            "referenced bytes " + referenced + " less than " + minimum);
+
+        /* The TestClass[] references all TestClass instances */
+        output.shouldMatch("^\\s+\\d+:\\s+1\\s+\\d+\\s+[1-9]\\d*\\s+" +
+            Pattern.quote(TestClass[].class.getName()) + "\\s*$");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void jmxReferenced() {
+        runReferenced(new JMXExecutor());
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.util.List;
+import java.util.Set;
+import java.util.stream.Collectors;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.jfr.Events;
+
+/**
+ * @test
+ * @summary The first jdk.NativeMemoryUsageDelta events of a new recording
+ *          list every memory tag, also those unchanged since an earlier one
+ * @requires vm.hasJFR & vm.opt.NativeMemoryTracking == null
+ * @library /test/lib
+ * @run main/othervm -XX:NativeMemoryTracking=summary jdk.jfr.event.runtime.TestNativeMemoryUsageDeltaEvents
+ */
+public class TestNativeMemoryUsageDeltaEvents {
+    private static final String DELTA_EVENT = "jdk.NativeMemoryUsageDelta";
+    private static final String USAGE_EVENT = "jdk.NativeMemoryUsage";
+
+    public static void main(String[] args) throws Exception {
+        // Report the current usage of every tag once.
+        try (Recording first = new Recording()) {
+            first.enable(DELTA_EVENT).with("period", "beginChunk");
+            first.start();
+            first.stop();
+            if (Events.fromRecording(first).isEmpty()) {
+                throw new RuntimeException("No " + DELTA_EVENT + " events in the first recording");
+            }
+        }
+
+        // Most tags are unchanged since then, the new recording must still list them.
+        try (Recording second = new Recording()) {
+            second.enable(DELTA_EVENT).with("period", "beginChunk");
+            second.enable(USAGE_EVENT).with("period", "beginChunk");
+            second.start();
+            second.stop();
+            List<RecordedEvent> events = Events.fromRecording(second);
+            Set<String> allTypes = types(events, USAGE_EVENT);
+            Set<String> deltaTypes = types(events, DELTA_EVENT);
+            System.out.println(USAGE_EVENT + " types: " + allTypes);
+            System.out.println(DELTA_EVENT + " types: " + deltaTypes);
+            if (allTypes.isEmpty()) {
+                throw new RuntimeException("No " + USAGE_EVENT + " events");
+            }
+            if (!deltaTypes.containsAll(allTypes)) {
+                allTypes.removeAll(deltaTypes);
+                throw new RuntimeException("Tags missing from " + DELTA_EVENT + ": " + allTypes);
+            }
+        }
+    }
+
+    private static Set<String> types(List<RecordedEvent> events, String eventName) {
+        return events.stream()
+                     .filter(e -> e.getEventType().getName().equals(eventName))
+                     .map(e -> e.getValue("type").toString())
+                     .collect(Collectors.toSet());
+    }
+}
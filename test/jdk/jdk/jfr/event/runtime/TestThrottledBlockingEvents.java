@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.nio.file.Path;
+import java.util.List;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+/**
+ * @test
+ * @summary jdk.ThreadPark and jdk.JavaMonitorEnter honor the throttle setting,
+ *          and the throttler logs its statistics
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @run main/othervm jdk.jfr.event.runtime.TestThrottledBlockingEvents
+ */
+public class TestThrottledBlockingEvents {
+    private static final int ITERATIONS = 2000;
+    private static final Object lock = new Object();
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            record(args[0]);
+            return;
+        }
+        for (String event : List.of("jdk.ThreadPark", "jdk.JavaMonitorEnter")) {
+            OutputAnalyzer output = ProcessTools.executeTestJava("-Xlog:jfr+system+throttle=info",
+                                                                 TestThrottledBlockingEvents.class.getName(), event);
+            output.shouldHaveExitValue(0);
+            output.shouldContain("Event type");
+            output.shouldContain("events (");
+        }
+    }
+
+    private static void record(String eventName) throws Exception {
+        try (Recording recording = new Recording()) {
+            recording.enable(eventName).withoutThreshold().with("throttle", "10/s");
+            recording.start();
+            if (eventName.equals("jdk.ThreadPark")) {
+                for (int i = 0; i < ITERATIONS; i++) {
+                    LockSupport.parkNanos(TimeUnit.MICROSECONDS.toNanos(100));
+                }
+            } else {
+                contend();
+            }
+            recording.stop();
+            Path file = Path.of(eventName + ".jfr");
+            recording.dump(file);
+            List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+            System.out.println(eventName + ": " + events.size() + " events for " + ITERATIONS + " operations");
+            if (events.isEmpty()) {
+                throw new RuntimeException("No " + eventName + " events recorded");
+            }
+            if (events.size() >= ITERATIONS / 2) {
+                throw new RuntimeException(eventName + " is not throttled: " + events.size() + " events");
+            }
+        }
+    }
+
+    // Each iteration makes the main thread block on a monitor held by the other thread.
+    private static void contend() throws Exception {
+        for (int i = 0; i < ITERATIONS; i++) {
+            Thread holder;
+            synchronized (lock) {
+                holder = new Thread(() -> {
+                    synchronized (lock) {
+                        LockSupport.parkNanos(TimeUnit.MILLISECONDS.toNanos(1));
+                    }
+                });
+                holder.start();
+                while (holder.getState() != Thread.State.BLOCKED) {
+                    Thread.onSpinWait();
+                }
+            }
+            // The holder now owns the monitor, wait until it is running inside it.
+            while (holder.getState() == Thread.State.BLOCKED) {
+                Thread.onSpinWait();
+            }
+            synchronized (lock) {
+            }
+            holder.join();
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Arrays;
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Arrays.hashCode for every primitive element type that
+ * ArraysSupport.vectorizedHashCode handles, and String.hashCode for Latin-1
+ * and UTF-16 strings, with and without -XX:+UseVectorizedHashCodeIntrinsic.
+ * Run on each platform to compare the port's stubs (AVX2 on x86, NEON on
+ * AArch64) with each other and with the scalar loop. The short lengths cover
+ * the inlined tail, the long ones the stubs.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public abstract class ArraysHashCode {
+
+    @Param({"1", "7", "31", "64", "257", "4096"})
+    public int size;
+
+    private boolean[] booleans;
+    private byte[] bytes;
+    private char[] chars;
+    private short[] shorts;
+    private int[] ints;
+    private char[] latin1Chars;
+    private char[] utf16Chars;
+
+    @Setup
+    public void setup() {
+        Random random = new Random(42);
+        booleans = new boolean[size];
+        bytes = new byte[size];
+        chars = new char[size];
+        shorts = new short[size];
+        ints = new int[size];
+        latin1Chars = new char[size];
+        for (int i = 0; i < size; i++) {
+            booleans[i] = random.nextBoolean();
+            bytes[i] = (byte) random.nextInt();
+            chars[i] = (char) random.nextInt();
+            shorts[i] = (short) random.nextInt();
+            ints[i] = random.nextInt();
+            latin1Chars[i] = (char) ('a' + random.nextInt(26));
+        }
+        // One character outside Latin-1 makes the whole string UTF-16.
+        utf16Chars = latin1Chars.clone();
+        utf16Chars[0] = '\u03c0';
+    }
+
+    @Benchmark
+    public int booleanArray() {
+        return Arrays.hashCode(booleans);
+    }
+
+    @Benchmark
+    public int byteArray() {
+        return Arrays.hashCode(bytes);
+    }
+
+    @Benchmark
+    public int charArray() {
+        return Arrays.hashCode(chars);
+    }
+
+    @Benchmark
+    public int shortArray() {
+        return Arrays.hashCode(shorts);
+    }
+
+    @Benchmark
+    public int intArray() {
+        return Arrays.hashCode(ints);
+    }
+
+    // A String caches its hash, so each call hashes a new one. The cost of
+    // creating it is the same with and without the intrinsic.
+    @Benchmark
+    public int latin1String() {
+        return new String(latin1Chars).hashCode();
+    }
+
+    @Benchmark
+    public int utf16String() {
+        return new String(utf16Chars).hashCode();
+    }
+
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UnlockDiagnosticVMOptions", "-XX:+UseVectorizedHashCodeIntrinsic" })
+    public static class Intrinsic extends ArraysHashCode {}
+
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UnlockDiagnosticVMOptions", "-XX:-UseVectorizedHashCodeIntrinsic" })
+    public static class Scalar extends ArraysHashCode {}
+}
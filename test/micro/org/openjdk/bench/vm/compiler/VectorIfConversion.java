@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Loop diamonds with a well predicted branch, with and without
+ * -XX:+UseVectorIfConversion. The loops that SuperWord vectorizes should
+ * gain from the blends, and the loop it cannot vectorize, because of the
+ * loop-carried value, should not lose against the predicted branch.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+public abstract class VectorIfConversion {
+
+    @Param({"4096"})
+    public int size;
+
+    // Percentage of elements that take the rare arm
+    @Param({"0", "1", "50"})
+    public int rarePercent;
+
+    private int[] a;
+    private int[] b;
+    private int[] r;
+
+    @Setup
+    public void setup() {
+        Random random = new Random(42);
+        a = new int[size];
+        b = new int[size];
+        r = new int[size];
+        for (int i = 0; i < size; i++) {
+            a[i] = random.nextInt(100) < rarePercent ? -1 - random.nextInt(1000) : random.nextInt(1000);
+            b[i] = random.nextInt(1000);
+        }
+    }
+
+    @Benchmark
+    public int[] vectorizableSelect() {
+        for (int i = 0; i < a.length; i++) {
+            r[i] = a[i] >= 0 ? a[i] + b[i] : b[i];
+        }
+        return r;
+    }
+
+    @Benchmark
+    public int[] vectorizableMax() {
+        for (int i = 0; i < a.length; i++) {
+            int x = a[i];
+            int y = b[i];
+            r[i] = x > y ? x : y;
+        }
+        return r;
+    }
+
+    @Benchmark
+    public int notVectorizable() {
+        int acc = 0;
+        for (int i = 0; i < a.length; i++) {
+            // The value carried from iteration to iteration keeps the loop scalar.
+            acc = a[i] >= 0 ? acc + a[i] : acc * 3;
+        }
+        return acc;
+    }
+
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UnlockDiagnosticVMOptions", "-XX:-UseVectorIfConversion" })
+    public static class Off extends VectorIfConversion {}
+
+    @Fork(value = 3, jvmArgsAppend = { "-XX:+UnlockDiagnosticVMOptions", "-XX:+UseVectorIfConversion" })
+    public static class On extends VectorIfConversion {}
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Models a large, long-lived old generation in generational Shenandoah that
+ * is only sparsely written to, such as a cache whose entries are occasionally
+ * replaced. Each invocation dirties a few cards by storing young objects
+ * into scattered old nodes and then allocates enough garbage to trigger
+ * young collections, whose remembered set scans mostly cover clean cards.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Fork(value = 3, jvmArgs = { "-XX:+UnlockExperimentalVMOptions", "-XX:+UseShenandoahGC",
+                             "-XX:ShenandoahGCMode=generational", "-Xms4g", "-Xmx4g" })
+public class ShenandoahSparseRemset {
+
+    static class Node {
+        Object payload;
+        long pad0, pad1, pad2, pad3, pad4, pad5;
+    }
+
+    // Number of old nodes, about 64 bytes each
+    @Param({"4000000", "16000000"})
+    public int nodes;
+
+    // Distance between consecutive updated nodes; large strides
+    // leave most cards clean
+    @Param({"1009", "65521"})
+    public int stride;
+
+    // Bytes of garbage allocated per invocation
+    @Param({"67108864"})
+    public int garbage;
+
+    private Node[] old;
+    private int index;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        old = new Node[nodes];
+        for (int i = 0; i < nodes; i++) {
+            old[i] = new Node();
+        }
+        // Promote the nodes to the old generation
+        for (int i = 0; i < 4; i++) {
+            System.gc();
+        }
+    }
+
+    @Benchmark
+    public Object updateAndAllocate() {
+        final Node[] o = old;
+        int i = index;
+        for (int n = 0; n < o.length / stride; n++) {
+            o[i].payload = new Object();
+            i = (i + stride) % o.length;
+        }
+        index = i;
+
+        Object sink = null;
+        for (int allocated = 0; allocated < garbage; allocated += 1040) {
+            sink = new byte[1024];
+        }
+        return sink;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the store barrier slow path of generational ZGC for bursts of
+ * old-to-young stores, such as when populating a long-lived cache. Each
+ * store of a new object into the old array ends up in the store barrier
+ * buffer, which is flushed into the remembered set when it fills up.
+ */
+@BenchmarkMode(Mode.Throughput)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Fork(value = 3, jvmArgs = { "-XX:+UseZGC", "-Xms1g", "-Xmx1g" })
+public class ZStoreBarrierFlush {
+
+    @Param({"1024", "65536"})
+    public int size;
+
+    // Distance between consecutive stored elements; 1 keeps the fields
+    // of a buffer on the same page and within few remembered set words
+    @Param({"1", "97"})
+    public int stride;
+
+    private Object[] cache;
+    private int index;
+
+    @Setup
+    public void setup() {
+        cache = new Object[size];
+        // Promote the array to the old generation
+        for (int i = 0; i < 4; i++) {
+            System.gc();
+        }
+    }
+
+    @Benchmark
+    public Object[] populate() {
+        final Object[] c = cache;
+        int i = index;
+        for (int n = 0; n < c.length; n++) {
+            c[i] = new Object();
+            i = (i + stride) % c.length;
+        }
+        index = i;
+        return c;
+    }
+}